@@ -0,0 +1,61 @@
+#pragma once
+
+#include "Application/Mesh.h"
+#include "Application/MeshGenerator.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <map>
+#include <utility>
+
+namespace BenchmarkHelpers
+{
+/// @brief Synthetic meshes used by the benchmarks.
+enum MeshShape : int
+{
+	/// @brief Flat grid with a boundary, see MeshGenerator::CreateGrid.
+	Grid = 0,
+	/// @brief Closed icosphere, see MeshGenerator::CreateIcosphere.
+	Sphere = 1,
+};
+
+/// @brief Synthetic mesh with about the given number of triangles, built once and shared by the benchmarks.
+/// @note The grid has 2*n^2 triangles and the sphere 20*4^k triangles, the closest sizes are used.
+/// @note The copies of the mesh share its caches (boundary loops, position buffers, ...), which must stay empty so that
+/// the results do not depend on the order of the benchmarks: the benchmarks filling them work on a copy.
+inline const Data::Surface::Mesh& GetMesh(const MeshShape shape, const int64_t triangleCount)
+{
+	static std::map<std::pair<MeshShape, int64_t>, Data::Surface::Mesh> meshes;
+	auto it = meshes.find({ shape, triangleCount });
+	if(it == meshes.end())
+	{
+		const double size = static_cast<double>(triangleCount);
+		const auto mesh = shape == Grid
+			? Utilitary::Surface::MeshGenerator::CreateGrid(static_cast<uint32_t>(std::lround(std::sqrt(size / 2.))),
+															static_cast<uint32_t>(std::lround(std::sqrt(size / 2.))))
+			: Utilitary::Surface::MeshGenerator::CreateIcosphere(
+				  static_cast<uint32_t>(std::lround(std::log(size / 20.) / std::log(4.))));
+		it = meshes.try_emplace({ shape, triangleCount }, *mesh).first;
+	}
+	return it->second;
+}
+
+/// @brief Grids and spheres from 20K to 1.3M triangles.
+inline void MeshArguments(benchmark::internal::Benchmark* benchmark)
+{
+	benchmark->ArgNames({ "shape", "triangles" });
+	for(int64_t triangleCount : { 20'480, 81'920, 327'680, 1'310'720 })
+	{
+		benchmark->Args({ Grid, triangleCount });
+		benchmark->Args({ Sphere, triangleCount });
+	}
+	benchmark->Unit(benchmark::kMillisecond);
+}
+
+/// @brief Mesh matching the arguments given by MeshArguments.
+inline const Data::Surface::Mesh& GetMesh(const benchmark::State& state)
+{
+	return GetMesh(static_cast<MeshShape>(state.range(0)), state.range(1));
+}
+} // namespace BenchmarkHelpers
@@ -0,0 +1,43 @@
+#include "Application/MeshBatch.h"
+#include "Application/MeshGenerator.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+
+using namespace Core::BaseType;
+using namespace Utilitary::Surface;
+
+namespace
+{
+void BM_UpdateCommands(benchmark::State& state)
+{
+	// Every stride-th instance moves each frame: a stride above the chunk size regenerates a chunk per moved instance.
+	const uint32_t instanceCount = static_cast<uint32_t>(state.range(0));
+	const uint32_t movedStride = static_cast<uint32_t>(state.range(1));
+	MeshBatch batch;
+	batch.AddPart(*MeshGenerator::CreateIcosphere(1));
+	batch.AddPart(*MeshGenerator::CreateTorus(16, 8));
+	for(uint32_t iInstance = 0; iInstance < instanceCount; ++iInstance)
+		batch.AddInstance(iInstance % 2, Mat4{ 1.f });
+	batch.UpdateCommands();
+
+	float offset = 0.f;
+	for(auto _ : state)
+	{
+		offset += 1.f;
+		Mat4 transform{ 1.f };
+		transform[3] = Vec4{ offset, 0.f, 0.f, 1.f };
+		for(uint32_t iInstance = 0; iInstance < instanceCount; iInstance += movedStride)
+			batch.SetTransform(iInstance, transform);
+		benchmark::DoNotOptimize(batch.UpdateCommands().data());
+	}
+	state.SetItemsProcessed(state.iterations() * ((instanceCount + movedStride - 1) / movedStride));
+}
+BENCHMARK(BM_UpdateCommands)
+	->ArgNames({ "instances", "stride" })
+	->Args({ 10'000, 1 })
+	->Args({ 100'000, 1 })
+	->Args({ 100'000, 1'000 })
+	->Unit(benchmark::kMicrosecond);
+} // namespace
@@ -0,0 +1,36 @@
+#include "Application/Mesh.h"
+#include "Application/MeshBoundary.h"
+#include "BenchmarkHelpers.h"
+
+#include <benchmark/benchmark.h>
+
+using namespace Core::BaseType;
+using namespace Utilitary::Surface;
+using namespace BenchmarkHelpers;
+
+namespace
+{
+void BM_ExtractBoundaryLoops(benchmark::State& state)
+{
+	// Remove one triangle out of a thousand, leaving as many holes.
+	Data::Surface::Mesh mesh(GetMesh(state));
+	for(TriangleIndex iTriangle = 3; iTriangle < mesh.GetTriangleCount(); iTriangle += 1000)
+		mesh.DeleteTriangle(iTriangle);
+
+	for(auto _ : state)
+		benchmark::DoNotOptimize(MeshBoundary::ExtractBoundaryLoops(mesh));
+	state.SetItemsProcessed(state.iterations() * mesh.GetTriangleCount());
+}
+BENCHMARK(BM_ExtractBoundaryLoops)->Apply(MeshArguments);
+
+void BM_GetBoundaryLoops_Cached(benchmark::State& state)
+{
+	// A copy is warmed, the cache of the shared mesh would be inherited by the copies of the other benchmarks.
+	const Data::Surface::Mesh mesh(GetMesh(state));
+	mesh.GetBoundaryLoops();
+
+	for(auto _ : state)
+		benchmark::DoNotOptimize(mesh.GetBoundaryLoops());
+}
+BENCHMARK(BM_GetBoundaryLoops_Cached)->Apply(MeshArguments);
+} // namespace
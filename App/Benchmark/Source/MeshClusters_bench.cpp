@@ -0,0 +1,49 @@
+#include "Application/Mesh.h"
+#include "Application/MeshClusters.h"
+#include "Application/MeshGeometry.h"
+#include "BenchmarkHelpers.h"
+#include "Core/MathHelpers.h"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cmath>
+
+using namespace Core::BaseType;
+using namespace Core::Math::Geometry;
+using namespace Utilitary::Surface;
+using namespace BenchmarkHelpers;
+
+namespace
+{
+void BM_BuildClusters(benchmark::State& state)
+{
+	// Only the clusters of the source mesh, the levels of detail are measured by the decimation. The position buffers
+	// are cached on a copy, the shared mesh is kept without cached buffers.
+	const Data::Surface::Mesh mesh(GetMesh(state));
+	for(auto _ : state)
+		benchmark::DoNotOptimize(MeshClusters::BuildHierarchy(mesh, { .MaxLevelCount = 1 }));
+	state.SetItemsProcessed(state.iterations() * mesh.GetTriangleCount());
+}
+BENCHMARK(BM_BuildClusters)->Apply(MeshArguments);
+
+void BM_SelectClusters(benchmark::State& state)
+{
+	// The camera sees the whole mesh from the front, each cluster goes through the frustum and the cone tests. The
+	// hierarchy is built on a copy, the shared mesh is kept without cached buffers.
+	const Data::Surface::Mesh mesh(GetMesh(state));
+	const ClusterHierarchy hierarchy = MeshClusters::BuildHierarchy(mesh, { .MaxLevelCount = 1 });
+	const AxisAlignedBox boundingBox = MeshGeometry::ComputeBoundingBox(*mesh.GetPositionBuffers());
+	const Vec3 center = 0.5f * (boundingBox.Min + boundingBox.Max);
+	const float radius = 0.5f * Length(boundingBox.GetExtent());
+
+	ClusterView view;
+	view.CameraPosition = center + Vec3{ 0.f, 0.f, 2.f * radius };
+	view.ViewProjection = Perspective(glm::radians(60.f), 16.f / 9.f, 0.01f * radius, 10.f * radius)
+		* LookAt(view.CameraPosition, center, Vec3{ 0.f, 1.f, 0.f });
+	for(auto _ : state)
+		benchmark::DoNotOptimize(MeshClusters::SelectClusters(hierarchy, view));
+	state.SetItemsProcessed(state.iterations() * hierarchy.GetClusterCount());
+}
+BENCHMARK(BM_SelectClusters)->Apply(MeshArguments);
+} // namespace
@@ -0,0 +1,30 @@
+#include "Application/Mesh.h"
+#include "Application/MeshComponents.h"
+#include "BenchmarkHelpers.h"
+
+#include <benchmark/benchmark.h>
+
+using namespace Utilitary::Surface;
+using namespace BenchmarkHelpers;
+
+namespace
+{
+void BM_LabelComponents(benchmark::State& state)
+{
+	const Data::Surface::Mesh& mesh = GetMesh(state);
+	for(auto _ : state)
+		benchmark::DoNotOptimize(MeshComponents::LabelComponents(mesh));
+	state.SetItemsProcessed(state.iterations() * mesh.GetTriangleCount());
+}
+BENCHMARK(BM_LabelComponents)->Apply(MeshArguments);
+
+void BM_ExtractComponents(benchmark::State& state)
+{
+	const Data::Surface::Mesh& mesh = GetMesh(state);
+	const ComponentLabeling labeling = MeshComponents::LabelComponents(mesh);
+	for(auto _ : state)
+		benchmark::DoNotOptimize(MeshComponents::ExtractComponents(mesh, labeling));
+	state.SetItemsProcessed(state.iterations() * mesh.GetTriangleCount());
+}
+BENCHMARK(BM_ExtractComponents)->Apply(MeshArguments);
+} // namespace
@@ -0,0 +1,34 @@
+#include "Application/MeshExporter.h"
+#include "BenchmarkHelpers.h"
+
+#include <benchmark/benchmark.h>
+
+#include <filesystem>
+
+using namespace Utilitary::Surface;
+using namespace BenchmarkHelpers;
+
+namespace
+{
+void BM_ExportOFF(benchmark::State& state)
+{
+	const Data::Surface::Mesh& mesh = GetMesh(state);
+	const std::filesystem::path filepath = std::filesystem::temp_directory_path() / "MeshBenchmarks_Export.off";
+	for(auto _ : state)
+		MeshExporter::ExportOFF(mesh, filepath);
+	state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(std::filesystem::file_size(filepath)));
+	std::filesystem::remove(filepath);
+}
+BENCHMARK(BM_ExportOFF)->Apply(MeshArguments);
+
+void BM_ExportOBJ(benchmark::State& state)
+{
+	const Data::Surface::Mesh& mesh = GetMesh(state);
+	const std::filesystem::path filepath = std::filesystem::temp_directory_path() / "MeshBenchmarks_Export.obj";
+	for(auto _ : state)
+		MeshExporter::ExportOBJ(mesh, filepath);
+	state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(std::filesystem::file_size(filepath)));
+	std::filesystem::remove(filepath);
+}
+BENCHMARK(BM_ExportOBJ)->Apply(MeshArguments);
+} // namespace
@@ -0,0 +1,75 @@
+#include "Application/Mesh.h"
+#include "Application/MeshGenerator.h"
+#include "Application/TestHelpers.h"
+
+#include <benchmark/benchmark.h>
+
+using namespace Utilitary::Surface;
+using namespace Data::Surface;
+
+namespace
+{
+/// @brief Grids from 128K to 8M triangles.
+void GridArguments(benchmark::internal::Benchmark* benchmark)
+{
+	benchmark->ArgNames({ "n" })->Arg(256)->Arg(1024)->Arg(2048)->Unit(benchmark::kMillisecond);
+}
+
+void BM_CreateGrid(benchmark::State& state)
+{
+	const uint32_t n = static_cast<uint32_t>(state.range(0));
+	for(auto _ : state)
+		benchmark::DoNotOptimize(MeshGenerator::CreateGrid(n, n));
+	state.SetItemsProcessed(state.iterations() * 2 * state.range(0) * state.range(0));
+}
+BENCHMARK(BM_CreateGrid)->Apply(GridArguments);
+
+/// @brief Reference: element by element insertion followed by the hash map pass of UpdateMeshConnectivity.
+void BM_CreateGridMesh(benchmark::State& state)
+{
+	const int n = static_cast<int>(state.range(0));
+	for(auto _ : state)
+	{
+		Mesh mesh = TestHelpers::CreateGridMesh(n, n);
+		benchmark::DoNotOptimize(mesh);
+	}
+	state.SetItemsProcessed(state.iterations() * 2 * state.range(0) * state.range(0));
+}
+BENCHMARK(BM_CreateGridMesh)->ArgNames({ "n" })->Arg(256)->Arg(1024)->Unit(benchmark::kMillisecond);
+
+void BM_CreateTorus(benchmark::State& state)
+{
+	const uint32_t n = static_cast<uint32_t>(state.range(0));
+	for(auto _ : state)
+		benchmark::DoNotOptimize(MeshGenerator::CreateTorus(n, n));
+	state.SetItemsProcessed(state.iterations() * 2 * state.range(0) * state.range(0));
+}
+BENCHMARK(BM_CreateTorus)->Apply(GridArguments);
+
+void BM_CreateTerrain(benchmark::State& state)
+{
+	const uint32_t n = static_cast<uint32_t>(state.range(0));
+	for(auto _ : state)
+		benchmark::DoNotOptimize(MeshGenerator::CreateTerrain(n, n));
+	state.SetItemsProcessed(state.iterations() * 2 * state.range(0) * state.range(0));
+}
+BENCHMARK(BM_CreateTerrain)->Apply(GridArguments);
+
+void BM_CreateIcosphere(benchmark::State& state)
+{
+	const uint32_t subdivisionCount = static_cast<uint32_t>(state.range(0));
+	for(auto _ : state)
+		benchmark::DoNotOptimize(MeshGenerator::CreateIcosphere(subdivisionCount));
+	state.SetItemsProcessed(state.iterations() * 20 * (int64_t{ 1 } << (2 * state.range(0))));
+}
+BENCHMARK(BM_CreateIcosphere)->ArgNames({ "k" })->DenseRange(6, 10, 2)->Unit(benchmark::kMillisecond);
+
+void BM_CreateTriangleSoup(benchmark::State& state)
+{
+	const uint32_t triangleCount = static_cast<uint32_t>(state.range(0));
+	for(auto _ : state)
+		benchmark::DoNotOptimize(MeshGenerator::CreateTriangleSoup(triangleCount));
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_CreateTriangleSoup)->ArgNames({ "triangles" })->Arg(1 << 20)->Arg(1 << 23)->Unit(benchmark::kMillisecond);
+} // namespace
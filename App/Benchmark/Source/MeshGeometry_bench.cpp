@@ -0,0 +1,77 @@
+#include "Application/Mesh.h"
+#include "Application/MeshGeometry.h"
+#include "BenchmarkHelpers.h"
+
+#include <benchmark/benchmark.h>
+
+#include <limits>
+#include <memory>
+
+using namespace Core::BaseType;
+using namespace Utilitary::Surface;
+using namespace BenchmarkHelpers;
+
+namespace
+{
+void BM_BuildPositionBuffers(benchmark::State& state)
+{
+	const Data::Surface::Mesh& mesh = GetMesh(state);
+	for(auto _ : state)
+		benchmark::DoNotOptimize(MeshGeometry::BuildPositionBuffers(mesh));
+	state.SetItemsProcessed(state.iterations() * mesh.GetVertexCount());
+}
+BENCHMARK(BM_BuildPositionBuffers)->Apply(MeshArguments);
+
+void BM_ComputeBoundingBox_Vertices(benchmark::State& state)
+{
+	// Reference: a serial loop over the interleaved vertices.
+	const Data::Surface::Mesh& mesh = GetMesh(state);
+	for(auto _ : state)
+	{
+		Vec3 minCorner{ std::numeric_limits<float>::max() };
+		Vec3 maxCorner{ std::numeric_limits<float>::lowest() };
+		for(const Data::Primitive::Vertex& vertex : mesh.GetVertices())
+		{
+			minCorner = glm::min(minCorner, vertex.Position);
+			maxCorner = glm::max(maxCorner, vertex.Position);
+		}
+		benchmark::DoNotOptimize(minCorner);
+		benchmark::DoNotOptimize(maxCorner);
+	}
+	state.SetItemsProcessed(state.iterations() * mesh.GetVertexCount());
+}
+BENCHMARK(BM_ComputeBoundingBox_Vertices)->Apply(MeshArguments);
+
+void BM_ComputeBoundingBox(benchmark::State& state)
+{
+	// Built on a copy, the shared mesh is kept without cached buffers.
+	const Data::Surface::Mesh mesh(GetMesh(state));
+	const std::shared_ptr<const PositionBuffers> positions = mesh.GetPositionBuffers();
+	for(auto _ : state)
+		benchmark::DoNotOptimize(MeshGeometry::ComputeBoundingBox(*positions));
+	state.SetItemsProcessed(state.iterations() * mesh.GetVertexCount());
+}
+BENCHMARK(BM_ComputeBoundingBox)->Apply(MeshArguments);
+
+void BM_ComputeMeasures(benchmark::State& state)
+{
+	// The position buffers of a copy are cached by the first iteration.
+	const Data::Surface::Mesh mesh(GetMesh(state));
+	for(auto _ : state)
+		benchmark::DoNotOptimize(MeshGeometry::ComputeMeasures(mesh));
+	state.SetItemsProcessed(state.iterations() * mesh.GetTriangleCount());
+}
+BENCHMARK(BM_ComputeMeasures)->Apply(MeshArguments);
+
+void BM_Transform(benchmark::State& state)
+{
+	// The positions and normals of a copy turn a little at each iteration.
+	const std::unique_ptr<Data::Surface::Mesh> mesh = GetMesh(state).Clone();
+	mesh->ComputeTriangleNormals(true);
+	const Mat4 transform = glm::rotate(0.01f, Vec3{ 0.f, 0.f, 1.f });
+	for(auto _ : state)
+		MeshGeometry::Transform(*mesh, transform, true);
+	state.SetItemsProcessed(state.iterations() * mesh->GetVertexCount());
+}
+BENCHMARK(BM_Transform)->Apply(MeshArguments);
+} // namespace
@@ -0,0 +1,28 @@
+#include "Application/MeshIntegrity.h"
+#include "BenchmarkHelpers.h"
+
+#include <benchmark/benchmark.h>
+
+using namespace Utilitary::Surface;
+using namespace BenchmarkHelpers;
+
+namespace
+{
+void BM_CheckIntegrity(benchmark::State& state)
+{
+	const Data::Surface::Mesh& mesh = GetMesh(state);
+	for(auto _ : state)
+		benchmark::DoNotOptimize(MeshIntegrity::CheckIntegrity(mesh));
+	state.SetItemsProcessed(state.iterations() * mesh.GetTriangleCount());
+}
+BENCHMARK(BM_CheckIntegrity)->Apply(MeshArguments);
+
+void BM_BuildReport(benchmark::State& state)
+{
+	const Data::Surface::Mesh& mesh = GetMesh(state);
+	for(auto _ : state)
+		benchmark::DoNotOptimize(MeshIntegrity::BuildReport(mesh));
+	state.SetItemsProcessed(state.iterations() * mesh.GetTriangleCount());
+}
+BENCHMARK(BM_BuildReport)->Apply(MeshArguments);
+} // namespace
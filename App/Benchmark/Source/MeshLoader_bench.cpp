@@ -0,0 +1,46 @@
+#include "Application/MeshExporter.h"
+#include "Application/MeshLoader.h"
+#include "BenchmarkHelpers.h"
+
+#include <benchmark/benchmark.h>
+
+#include <filesystem>
+#include <string>
+
+using namespace Utilitary::Surface;
+using namespace BenchmarkHelpers;
+
+namespace
+{
+/// @brief Export the mesh matching the arguments to a temporary file, loaded by the benchmark.
+std::filesystem::path ExportMesh(const benchmark::State& state, const std::string& extension)
+{
+	const std::filesystem::path filepath = std::filesystem::temp_directory_path()
+		/ ("MeshBenchmarks_Load_" + std::to_string(state.range(0)) + "_" + std::to_string(state.range(1)) + extension);
+	if(extension == ".off")
+		MeshExporter::ExportOFF(GetMesh(state), filepath);
+	else
+		MeshExporter::ExportOBJ(GetMesh(state), filepath);
+	return filepath;
+}
+
+void BM_LoadOFF(benchmark::State& state)
+{
+	const std::filesystem::path filepath = ExportMesh(state, ".off");
+	for(auto _ : state)
+		benchmark::DoNotOptimize(MeshLoader::LoadOFF(filepath));
+	state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(std::filesystem::file_size(filepath)));
+	std::filesystem::remove(filepath);
+}
+BENCHMARK(BM_LoadOFF)->Apply(MeshArguments);
+
+void BM_LoadOBJ(benchmark::State& state)
+{
+	const std::filesystem::path filepath = ExportMesh(state, ".obj");
+	for(auto _ : state)
+		benchmark::DoNotOptimize(MeshLoader::LoadOBJ(filepath));
+	state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(std::filesystem::file_size(filepath)));
+	std::filesystem::remove(filepath);
+}
+BENCHMARK(BM_LoadOBJ)->Apply(MeshArguments);
+} // namespace
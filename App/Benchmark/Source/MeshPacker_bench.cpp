@@ -0,0 +1,49 @@
+#include "Application/Mesh.h"
+#include "Application/MeshPacker.h"
+#include "BenchmarkHelpers.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+using namespace Utilitary::Surface;
+using namespace BenchmarkHelpers;
+
+namespace
+{
+/// @brief Copy of the benchmark mesh with smooth normals.
+std::unique_ptr<Data::Surface::Mesh> CreateMeshWithNormals(const benchmark::State& state)
+{
+	std::unique_ptr<Data::Surface::Mesh> mesh = GetMesh(state).Clone();
+	mesh->ComputeSmoothVertexNormals(true);
+	return mesh;
+}
+
+void BM_ComputeLayout(benchmark::State& state)
+{
+	const std::unique_ptr<Data::Surface::Mesh> mesh = CreateMeshWithNormals(state);
+	for(auto _ : state)
+		benchmark::DoNotOptimize(MeshPacker::ComputeLayout(*mesh));
+	state.SetItemsProcessed(state.iterations() * mesh->GetTriangleCount());
+}
+BENCHMARK(BM_ComputeLayout)->Apply(MeshArguments);
+
+void BM_PackBuffers(benchmark::State& state)
+{
+	// The destination stands for the mapped GPU buffers.
+	const std::unique_ptr<Data::Surface::Mesh> mesh = CreateMeshWithNormals(state);
+	const PackedMeshLayout layout = MeshPacker::ComputeLayout(*mesh);
+	std::vector<PackedVertex> vertices(layout.GetVertexCount());
+	std::vector<uint32_t> indices(layout.GetIndexCount());
+	for(auto _ : state)
+	{
+		MeshPacker::PackVertices(*mesh, layout, vertices);
+		MeshPacker::PackIndices(layout, indices);
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(state.iterations() * mesh->GetTriangleCount());
+}
+BENCHMARK(BM_PackBuffers)->Apply(MeshArguments);
+} // namespace
@@ -0,0 +1,107 @@
+#include "Application/Mesh.h"
+#include "Application/MeshReorderer.h"
+#include "Application/TestHelpers.h"
+
+#include <benchmark/benchmark.h>
+
+#include <map>
+#include <optional>
+#include <utility>
+
+using namespace Core::BaseType;
+using namespace Utilitary::Surface;
+using namespace Data::Surface;
+
+namespace
+{
+/// @brief Shuffled torus with nMajor*nMajor/2 vertices, optionally reordered, built once per configuration.
+const Mesh& GetMesh(const int nMajor, const bool isReordered)
+{
+	static std::map<std::pair<int, bool>, Mesh> meshes;
+	auto it = meshes.find({ nMajor, isReordered });
+	if(it == meshes.end())
+	{
+		Mesh mesh = TestHelpers::CreateShuffledMesh(TestHelpers::CreateTorusMesh(nMajor, nMajor / 2));
+		if(isReordered)
+			MeshReorderer::Reorder(mesh);
+		it = meshes.try_emplace({ nMajor, isReordered }, mesh).first;
+	}
+	return it->second;
+}
+
+/// @brief Meshes from 64K to 1M triangles, in shuffled order (0) and reordered (1).
+void MeshArguments(benchmark::internal::Benchmark* benchmark)
+{
+	benchmark->ArgNames({ "nMajor", "reordered" });
+	for(int nMajor : { 256, 512, 1024 })
+	{
+		benchmark->Args({ nMajor, 0 });
+		benchmark->Args({ nMajor, 1 });
+	}
+	benchmark->Unit(benchmark::kMillisecond);
+}
+
+void BM_TrianglesAroundVertex(benchmark::State& state)
+{
+	const Mesh& mesh = GetMesh(static_cast<int>(state.range(0)), state.range(1) != 0);
+	for(auto _ : state)
+	{
+		size_t triangleCount = 0;
+		for(VertexIndex iVertex = 0; iVertex < mesh.GetVertexCount(); ++iVertex)
+		{
+			for(TriangleIndex curTriangleIdx : mesh.GetTrianglesAroundVertex(iVertex))
+				triangleCount += curTriangleIdx;
+		}
+		benchmark::DoNotOptimize(triangleCount);
+	}
+	state.SetItemsProcessed(state.iterations() * mesh.GetVertexCount());
+}
+BENCHMARK(BM_TrianglesAroundVertex)->Apply(MeshArguments);
+
+void BM_VerticesAroundVertex(benchmark::State& state)
+{
+	const Mesh& mesh = GetMesh(static_cast<int>(state.range(0)), state.range(1) != 0);
+	for(auto _ : state)
+	{
+		Vec3 positionSum{ 0.f };
+		for(VertexIndex iVertex = 0; iVertex < mesh.GetVertexCount(); ++iVertex)
+		{
+			for(VertexIndex curVertexIdx : mesh.GetVerticesAroundVertex(iVertex))
+				positionSum += mesh.GetVertexData(curVertexIdx).Position;
+		}
+		benchmark::DoNotOptimize(positionSum);
+	}
+	state.SetItemsProcessed(state.iterations() * mesh.GetVertexCount());
+}
+BENCHMARK(BM_VerticesAroundVertex)->Apply(MeshArguments);
+
+void BM_ComputeSmoothVertexNormals(benchmark::State& state)
+{
+	std::optional<Mesh> mesh;
+	for(auto _ : state)
+	{
+		state.PauseTiming();
+		mesh.emplace(GetMesh(static_cast<int>(state.range(0)), state.range(1) != 0));
+		state.ResumeTiming();
+
+		mesh->ComputeSmoothVertexNormals(true);
+		benchmark::ClobberMemory();
+	}
+}
+BENCHMARK(BM_ComputeSmoothVertexNormals)->Apply(MeshArguments);
+
+void BM_Reorder(benchmark::State& state)
+{
+	std::optional<Mesh> mesh;
+	for(auto _ : state)
+	{
+		state.PauseTiming();
+		mesh.emplace(GetMesh(static_cast<int>(state.range(0)), false));
+		state.ResumeTiming();
+
+		MeshReorderer::Reorder(*mesh);
+		benchmark::ClobberMemory();
+	}
+}
+BENCHMARK(BM_Reorder)->ArgNames({ "nMajor" })->Arg(256)->Arg(1024)->Unit(benchmark::kMillisecond);
+} // namespace
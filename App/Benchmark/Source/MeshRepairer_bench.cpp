@@ -0,0 +1,41 @@
+#include "Application/Mesh.h"
+#include "Application/MeshRepairer.h"
+#include "BenchmarkHelpers.h"
+
+#include <benchmark/benchmark.h>
+
+#include <optional>
+#include <utility>
+
+using namespace Core::BaseType;
+using namespace Utilitary::Surface;
+using namespace BenchmarkHelpers;
+
+namespace
+{
+void BM_Repair(benchmark::State& state)
+{
+	// Flip a triangle out of seven and remove one out of a thousand, leaving small holes.
+	Data::Surface::Mesh brokenMesh(GetMesh(state));
+	for(TriangleIndex iTriangle = 0; iTriangle < brokenMesh.GetTriangleCount(); iTriangle += 7)
+	{
+		auto& vertices = brokenMesh.GetTriangleData(iTriangle).Vertices;
+		std::swap(vertices[1], vertices[2]);
+	}
+	for(TriangleIndex iTriangle = 3; iTriangle < brokenMesh.GetTriangleCount(); iTriangle += 1000)
+		brokenMesh.DeleteTriangle(iTriangle);
+
+	std::optional<Data::Surface::Mesh> mesh;
+	for(auto _ : state)
+	{
+		// The previous copy is destroyed outside the timing as well.
+		state.PauseTiming();
+		mesh.emplace(brokenMesh);
+		state.ResumeTiming();
+
+		benchmark::DoNotOptimize(MeshRepairer::Repair(*mesh));
+	}
+	state.SetItemsProcessed(state.iterations() * brokenMesh.GetTriangleCount());
+}
+BENCHMARK(BM_Repair)->Apply(MeshArguments);
+} // namespace
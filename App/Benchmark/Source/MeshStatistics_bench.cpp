@@ -0,0 +1,47 @@
+#include "Application/Mesh.h"
+#include "Application/MeshStatistics.h"
+#include "BenchmarkHelpers.h"
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+using namespace Core::BaseType;
+using namespace Utilitary::Surface;
+using namespace BenchmarkHelpers;
+
+namespace
+{
+void BM_ComputeOneRingStatistics(benchmark::State& state)
+{
+	const Data::Surface::Mesh& mesh = GetMesh(state);
+	for(auto _ : state)
+		benchmark::DoNotOptimize(MeshStatistics::ComputeOneRingStatistics(mesh));
+	state.SetItemsProcessed(state.iterations() * mesh.GetTriangleCount());
+}
+BENCHMARK(BM_ComputeOneRingStatistics)->Apply(MeshArguments);
+
+/// @brief Reference: the same valences and triangle counts gathered by circulating around each vertex.
+void BM_ComputeValences_Circulators(benchmark::State& state)
+{
+	const Data::Surface::Mesh& mesh = GetMesh(state);
+	std::vector<uint32_t> valences(mesh.GetVertexCount());
+	std::vector<uint32_t> triangleCounts(mesh.GetVertexCount());
+	for(auto _ : state)
+	{
+		for(VertexIndex iVertex = 0; iVertex < mesh.GetVertexCount(); ++iVertex)
+		{
+			triangleCounts[iVertex] = 0;
+			for([[maybe_unused]] const TriangleIndex triangleIdx : mesh.GetTrianglesAroundVertex(iVertex))
+				++triangleCounts[iVertex];
+			valences[iVertex] = 0;
+			for([[maybe_unused]] const VertexIndex vertexIdx : mesh.GetVerticesAroundVertex(iVertex))
+				++valences[iVertex];
+		}
+		benchmark::DoNotOptimize(valences.data());
+		benchmark::DoNotOptimize(triangleCounts.data());
+	}
+	state.SetItemsProcessed(state.iterations() * mesh.GetTriangleCount());
+}
+BENCHMARK(BM_ComputeValences_Circulators)->Apply(MeshArguments);
+} // namespace
@@ -0,0 +1,152 @@
+#include "Application/Mesh.h"
+#include "BenchmarkHelpers.h"
+
+#include <benchmark/benchmark.h>
+
+#include <optional>
+
+using namespace Core::BaseType;
+using namespace Data::Surface;
+using namespace BenchmarkHelpers;
+
+namespace
+{
+void BM_UpdateMeshConnectivity(benchmark::State& state)
+{
+	const Mesh& sourceMesh = GetMesh(state);
+	std::optional<Mesh> mesh;
+	for(auto _ : state)
+	{
+		// Rebuild the mesh without its connectivity, the previous one being destroyed outside the timing as well.
+		state.PauseTiming();
+		mesh.emplace();
+		for(VertexIndex iVertex = 0; iVertex < sourceMesh.GetVertexCount(); ++iVertex)
+			mesh->AddVertex({ .Position = sourceMesh.GetVertexData(iVertex).Position });
+		for(TriangleIndex iTriangle = 0; iTriangle < sourceMesh.GetTriangleCount(); ++iTriangle)
+			mesh->AddTriangle({ .Vertices = sourceMesh.GetTriangleData(iTriangle).Vertices });
+		state.ResumeTiming();
+
+		mesh->UpdateMeshConnectivity();
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(state.iterations() * sourceMesh.GetTriangleCount());
+}
+BENCHMARK(BM_UpdateMeshConnectivity)->Apply(MeshArguments);
+
+void BM_ComputeTriangleNormals(benchmark::State& state)
+{
+	std::optional<Mesh> mesh;
+	for(auto _ : state)
+	{
+		// Copy the mesh, the previous copy being destroyed outside the timing as well.
+		state.PauseTiming();
+		mesh.emplace(GetMesh(state));
+		state.ResumeTiming();
+
+		mesh->ComputeTriangleNormals(true);
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(state.iterations() * GetMesh(state).GetTriangleCount());
+}
+BENCHMARK(BM_ComputeTriangleNormals)->Apply(MeshArguments);
+
+void BM_ComputeSmoothVertexNormals(benchmark::State& state)
+{
+	std::optional<Mesh> mesh;
+	for(auto _ : state)
+	{
+		state.PauseTiming();
+		mesh.emplace(GetMesh(state));
+		state.ResumeTiming();
+
+		mesh->ComputeSmoothVertexNormals(true);
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(state.iterations() * GetMesh(state).GetVertexCount());
+}
+BENCHMARK(BM_ComputeSmoothVertexNormals)->Apply(MeshArguments);
+
+void BM_UpdateVerticesBoundaryStatus(benchmark::State& state)
+{
+	std::optional<Mesh> mesh;
+	for(auto _ : state)
+	{
+		state.PauseTiming();
+		mesh.emplace(GetMesh(state));
+		state.ResumeTiming();
+
+		mesh->UpdateVerticesBoundaryStatus();
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(state.iterations() * GetMesh(state).GetVertexCount());
+}
+BENCHMARK(BM_UpdateVerticesBoundaryStatus)->Apply(MeshArguments);
+
+void BM_VerticesAroundVertex(benchmark::State& state)
+{
+	const Mesh& mesh = GetMesh(state);
+	for(auto _ : state)
+	{
+		Vec3 positionSum{ 0.f };
+		for(VertexIndex iVertex = 0; iVertex < mesh.GetVertexCount(); ++iVertex)
+		{
+			for(VertexIndex curVertexIdx : mesh.GetVerticesAroundVertex(iVertex))
+				positionSum += mesh.GetVertexData(curVertexIdx).Position;
+		}
+		benchmark::DoNotOptimize(positionSum);
+	}
+	state.SetItemsProcessed(state.iterations() * mesh.GetVertexCount());
+}
+BENCHMARK(BM_VerticesAroundVertex)->Apply(MeshArguments);
+
+void BM_TrianglesAroundVertex(benchmark::State& state)
+{
+	const Mesh& mesh = GetMesh(state);
+	for(auto _ : state)
+	{
+		size_t triangleIdxSum = 0;
+		for(VertexIndex iVertex = 0; iVertex < mesh.GetVertexCount(); ++iVertex)
+		{
+			for(TriangleIndex curTriangleIdx : mesh.GetTrianglesAroundVertex(iVertex))
+				triangleIdxSum += curTriangleIdx;
+		}
+		benchmark::DoNotOptimize(triangleIdxSum);
+	}
+	state.SetItemsProcessed(state.iterations() * mesh.GetVertexCount());
+}
+BENCHMARK(BM_TrianglesAroundVertex)->Apply(MeshArguments);
+
+void BM_VerticesAroundVertexView(benchmark::State& state)
+{
+	const Mesh& mesh = GetMesh(state);
+	for(auto _ : state)
+	{
+		Vec3 positionSum{ 0.f };
+		for(VertexIndex iVertex = 0; iVertex < mesh.GetVertexCount(); ++iVertex)
+		{
+			for(VertexIndex curVertexIdx : mesh.GetVerticesAroundVertexView(iVertex))
+				positionSum += mesh.GetVertexData(curVertexIdx).Position;
+		}
+		benchmark::DoNotOptimize(positionSum);
+	}
+	state.SetItemsProcessed(state.iterations() * mesh.GetVertexCount());
+}
+BENCHMARK(BM_VerticesAroundVertexView)->Apply(MeshArguments);
+
+void BM_TrianglesAroundVertexView(benchmark::State& state)
+{
+	const Mesh& mesh = GetMesh(state);
+	for(auto _ : state)
+	{
+		size_t triangleIdxSum = 0;
+		for(VertexIndex iVertex = 0; iVertex < mesh.GetVertexCount(); ++iVertex)
+		{
+			for(TriangleIndex curTriangleIdx : mesh.GetTrianglesAroundVertexView(iVertex))
+				triangleIdxSum += curTriangleIdx;
+		}
+		benchmark::DoNotOptimize(triangleIdxSum);
+	}
+	state.SetItemsProcessed(state.iterations() * mesh.GetVertexCount());
+}
+BENCHMARK(BM_TrianglesAroundVertexView)->Apply(MeshArguments);
+} // namespace
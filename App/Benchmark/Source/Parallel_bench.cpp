@@ -0,0 +1,87 @@
+#include "Core/Parallel.h"
+#include "Core/TaskGraph.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <vector>
+
+using namespace Core::Parallel;
+
+namespace
+{
+void BM_ParallelFor(benchmark::State& state)
+{
+	// Light work per index, so that the cost of dispatching the chunks shows on the small ranges.
+	const size_t count = static_cast<size_t>(state.range(0));
+	std::vector<float> values(count, 1.f);
+	for(auto _ : state)
+	{
+		ParallelFor(
+			0,
+			count,
+			[&](const size_t index)
+			{
+				values[index] = std::sqrt(values[index] + 1.f);
+			});
+		benchmark::DoNotOptimize(values.data());
+	}
+	state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(count));
+}
+BENCHMARK(BM_ParallelFor)->ArgName("indices")->Arg(4'096)->Arg(65'536)->Arg(1'048'576);
+
+void BM_ParallelReduce(benchmark::State& state)
+{
+	const size_t count = static_cast<size_t>(state.range(0));
+	const ReductionMode mode = static_cast<ReductionMode>(state.range(1));
+	for(auto _ : state)
+	{
+		const double sum = ParallelReduce(
+			0,
+			count,
+			0.,
+			[](const size_t chunkBegin, const size_t chunkEnd)
+			{
+				double chunkSum = 0.;
+				for(size_t index = chunkBegin; index < chunkEnd; ++index)
+					chunkSum += 1. / static_cast<double>(index + 1);
+				return chunkSum;
+			},
+			[](const double lhs, const double rhs) { return lhs + rhs; },
+			4096,
+			mode);
+		benchmark::DoNotOptimize(sum);
+	}
+	state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(count));
+}
+BENCHMARK(BM_ParallelReduce)
+	->ArgNames({ "indices", "deterministic" })
+	->ArgsProduct({ { 65'536, 1'048'576 }, { 0, 1 } });
+
+void BM_TaskGraph(benchmark::State& state)
+{
+	// Layers of independent tasks, each layer waiting for the previous one.
+	const uint32_t layerCount = 16;
+	const uint32_t layerSize = static_cast<uint32_t>(state.range(0));
+	std::vector<float> values(static_cast<size_t>(layerCount) * layerSize, 1.f);
+	TaskGraph graph;
+	for(uint32_t iLayer = 0; iLayer < layerCount; ++iLayer)
+	{
+		for(uint32_t iTask = 0; iTask < layerSize; ++iTask)
+		{
+			const TaskGraph::TaskId taskId = graph.AddTask(
+				[&values, taskIdx = iLayer * layerSize + iTask]()
+				{
+					values[taskIdx] = std::sqrt(values[taskIdx] + 1.f);
+				});
+			if(iLayer > 0)
+				graph.AddDependency(taskId - layerSize, taskId);
+		}
+	}
+
+	for(auto _ : state)
+		graph.Run();
+	state.SetItemsProcessed(state.iterations() * graph.GetTaskCount());
+}
+BENCHMARK(BM_TaskGraph)->ArgName("tasksPerLayer")->Arg(4)->Arg(64);
+} // namespace
@@ -0,0 +1,31 @@
+#include <benchmark/benchmark.h>
+
+#include <string_view>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+	// Write the results as JSON next to the console report unless another output is requested, so that the runs can
+	// be compared over time (e.g. with the compare.py tool of Google Benchmark).
+	std::vector<char*> arguments(argv, argv + argc);
+	bool hasOutput = false;
+	for(std::string_view argument : arguments)
+		hasOutput |= argument.starts_with("--benchmark_out=");
+
+	char outputArgument[] = "--benchmark_out=MeshBenchmarks.json";
+	char formatArgument[] = "--benchmark_out_format=json";
+	if(!hasOutput)
+	{
+		arguments.push_back(outputArgument);
+		arguments.push_back(formatArgument);
+	}
+
+	int argumentCount = static_cast<int>(arguments.size());
+	benchmark::Initialize(&argumentCount, arguments.data());
+	if(benchmark::ReportUnrecognizedArguments(argumentCount, arguments.data()))
+		return 1;
+
+	benchmark::RunSpecifiedBenchmarks();
+	benchmark::Shutdown();
+	return 0;
+}
@@ -0,0 +1,29 @@
+#version 460 core
+
+layout(location = 0) in vec3 a_Position;
+layout(location = 1) in vec3 a_Normal;
+layout(location = 2) in vec2 a_TexCoord;
+
+layout(location = 0) uniform mat4 u_ViewProjection;
+
+// Transform of each instance slot of the batch, see GpuBatch::TransformBinding.
+layout(std430, binding = 0) readonly buffer InstanceTransforms
+{
+	mat4 u_Transforms[];
+};
+
+out vec3 v_Position;
+out vec3 v_Normal;
+flat out uint v_DrawID;
+
+void main()
+{
+	uint instance = uint(gl_BaseInstance + gl_InstanceID);
+	mat4 transform = u_Transforms[instance];
+	vec4 position = transform * vec4(a_Position, 1.0);
+	v_Position = position.xyz;
+	// The parts are placed by rigid transforms, possibly uniformly scaled.
+	v_Normal = mat3(transform) * a_Normal;
+	v_DrawID = instance;
+	gl_Position = u_ViewProjection * position;
+}
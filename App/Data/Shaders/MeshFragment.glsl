@@ -0,0 +1,30 @@
+#version 460 core
+
+layout(location = 0) out vec4 fragColor;
+
+in vec3 v_Position;
+in vec3 v_Normal;
+flat in uint v_DrawID;
+
+layout(location = 1) uniform vec3 u_CameraPosition;
+layout(location = 2) uniform int u_ShowClusters;
+
+vec3 clusterColor(uint id)
+{
+	// Integer hash, so that neighbor clusters get unrelated colors.
+	id = (id ^ 61u) ^ (id >> 16u);
+	id *= 9u;
+	id ^= id >> 4u;
+	id *= 0x27d4eb2du;
+	id ^= id >> 15u;
+	return vec3(id & 255u, (id >> 8u) & 255u, (id >> 16u) & 255u) / 255.0;
+}
+
+void main()
+{
+	// Headlight, both sides of the triangles lit.
+	vec3 toCamera = normalize(u_CameraPosition - v_Position);
+	float lighting = 0.15 + 0.85 * abs(dot(normalize(v_Normal), toCamera));
+	vec3 albedo = u_ShowClusters != 0 ? clusterColor(v_DrawID) : vec3(0.8);
+	fragColor = vec4(albedo * lighting, 1.0);
+}
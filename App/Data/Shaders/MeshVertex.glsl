@@ -0,0 +1,20 @@
+#version 460 core
+
+layout(location = 0) in vec3 a_Position;
+layout(location = 1) in vec3 a_Normal;
+layout(location = 2) in vec2 a_TexCoord;
+
+layout(location = 0) uniform mat4 u_ViewProjection;
+
+out vec3 v_Position;
+out vec3 v_Normal;
+flat out uint v_DrawID;
+
+void main()
+{
+	v_Position = a_Position;
+	v_Normal = a_Normal;
+	// Index of the cluster in the multi-draw call.
+	v_DrawID = uint(gl_DrawID);
+	gl_Position = u_ViewProjection * vec4(a_Position, 1.0);
+}
@@ -3,6 +3,7 @@
 #include "Core/Layer.h"
 
 #include <stdint.h>
+#include <string_view>
 
 namespace Application
 {
@@ -19,6 +20,8 @@ public:
 	virtual void OnUpdate(float ts) override;
 	/// @brief Override from Layer
 	virtual void OnRender() override;
+	/// @brief Override from Layer
+	virtual std::string_view GetName() const override { return "AppLayer"; }
 
 private:
 	uint32_t m_Shader = 0;
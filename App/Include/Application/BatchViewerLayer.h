@@ -0,0 +1,60 @@
+#pragma once
+
+#include "Application/GpuBatch.h"
+#include "Application/MeshBatch.h"
+#include "Core/Layer.h"
+#include "Core/Renderer/Renderer.h"
+
+#include <cstdint>
+#include <string_view>
+
+namespace Application
+{
+/// @brief Layer drawing a grid of thousands of small parts with a single indirect multi-draw call.
+/// @note The parts are a few generated meshes instantiated in a square grid. The animated instances move every frame,
+/// only the chunks holding them are regenerated and uploaded (see Utilitary::Surface::MeshBatch and GpuBatch).
+class BatchViewerLayer : public Core::Layer
+{
+public:
+	/// @brief Create the layer, with the parts and the instances of the grid.
+	BatchViewerLayer();
+	/// @brief Free the GPU resources.
+	virtual ~BatchViewerLayer();
+
+	/// @brief Override from Layer
+	virtual void OnUpdate(float ts) override;
+	/// @brief Override from Layer
+	virtual void OnRender() override;
+	/// @brief Override from Layer
+	virtual std::string_view GetName() const override { return "BatchViewerLayer"; }
+
+private:
+	/// @brief Resize the render targets to the viewport, if needed.
+	void ResizeTargets(uint32_t width, uint32_t height);
+	/// @brief Update the batch and draw it into the render targets.
+	void DrawBatch(uint32_t width, uint32_t height);
+
+private:
+	Utilitary::Surface::MeshBatch m_Batch{};
+	GpuBatch m_GpuBatch{};
+
+	uint32_t m_Shader = 0;
+	Renderer::Texture m_ColorTexture{};
+	Renderer::Framebuffer m_Framebuffer{};
+	uint32_t m_DepthBuffer = 0;
+
+	/// @brief Number of instances moving every frame, the first ones of the grid.
+	int m_AnimatedCount = 256;
+	float m_Time = 0.f;
+	bool m_Animate = true;
+	bool m_ShowInstances = false;
+
+	/// @brief Orbit camera around the center of the grid, Z up.
+	float m_Distance = 120.f;
+	float m_Yaw = 0.8f;
+	float m_Pitch = 0.6f;
+
+	/// @brief Time spent in the last update of the batch, in milliseconds.
+	float m_UpdateTime = 0.f;
+};
+} // namespace Application
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "Application/MeshBatch.h"
+
+#include <glad/gl.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Application
+{
+/// @brief GPU copy of a Utilitary::Surface::MeshBatch, drawn with a single glMultiDrawElementsIndirect call.
+/// @note The vertices and indices of the parts fill shared buffers bound to one vertex array (attributes 0, 1 and 2:
+/// position, normal and texture coordinates). The commands fill the indirect buffer and the transforms a shader
+/// storage buffer, bound at TransformBinding: the vertex shader reads the transform of its instance at
+/// gl_BaseInstance + gl_InstanceID. The buffers grow by doubling, between two growths only the geometry appended and
+/// the chunks of instances regenerated are uploaded. A current OpenGL 4.6 context is required.
+class GpuBatch
+{
+public:
+	/// @brief Binding point of the shader storage buffer holding the mat4 transform of each instance slot.
+	static constexpr GLuint TransformBinding = 0;
+
+public:
+	/// @brief Create the vertex array, the buffers are allocated by the first update.
+	GpuBatch();
+	/// @brief Free the buffers.
+	~GpuBatch();
+
+	GpuBatch(const GpuBatch&) = delete;
+	GpuBatch& operator=(const GpuBatch&) = delete;
+
+	/// @brief Regenerate the changed commands of the batch, then upload what changed since the last update.
+	void Update(Utilitary::Surface::MeshBatch& batch);
+
+	/// @brief Draw every instance slot of the last update, with the current program and framebuffer.
+	void Draw() const;
+
+	/// @brief Get the OpenGL name of the indirect buffer.
+	GLuint GetCommandBuffer() const { return m_CommandBuffer.Handle; }
+	/// @brief Get the OpenGL name of the transform buffer.
+	GLuint GetTransformBuffer() const { return m_TransformBuffer.Handle; }
+	/// @brief Get the number of bytes uploaded by the last update.
+	size_t GetUploadedSize() const { return m_UploadedSize; }
+
+private:
+	/// @brief Buffer whose content is updated with glNamedBufferSubData.
+	struct DynamicBuffer
+	{
+		GLuint Handle = 0;
+		/// @brief Size of the storage in bytes.
+		size_t Capacity = 0;
+		/// @brief Number of bytes up to date.
+		size_t Size = 0;
+	};
+
+	/// @brief Upload the bytes of data after those already in the buffer, reallocating it if needed.
+	/// @return True if the buffer was reallocated, all the data then being uploaded again.
+	bool Append(DynamicBuffer& buffer, const void* data, size_t size);
+	/// @brief Upload a range of the data of the buffer.
+	void Upload(DynamicBuffer& buffer, const void* data, size_t offset, size_t size);
+
+private:
+	GLuint m_VertexArray = 0;
+	DynamicBuffer m_VertexBuffer{};
+	DynamicBuffer m_IndexBuffer{};
+	DynamicBuffer m_CommandBuffer{};
+	DynamicBuffer m_TransformBuffer{};
+
+	/// @brief Number of commands drawn.
+	GLsizei m_DrawCount = 0;
+	/// @brief Number of bytes uploaded by the last update.
+	size_t m_UploadedSize = 0;
+};
+} // namespace Application
@@ -1,18 +1,31 @@
 #pragma once
 
 #include "Application/ExtraDataContainer.h"
+#include "Application/MeshRanges.h"
 #include "Application/Primitive.h"
 #include "Core/BaseTypes.h"
 
 #include <memory>
+#include <mutex>
 #include <vector>
 
 /// Forward declaration
 namespace Utilitary::Surface
 {
+struct BoundaryLoops;
+struct GeometryMeasures;
+struct PositionBuffers;
+class MeshComponents;
+class MeshDecimator;
 class MeshExporter;
+class MeshGenerator;
+struct MeshGeometry;
 class MeshIntegrity;
 class MeshLoader;
+struct MeshPacker;
+class MeshRemesher;
+class MeshReorderer;
+class MeshRepairer;
 } // namespace Utilitary::Surface
 
 namespace Data::Primitive
@@ -27,9 +40,17 @@ namespace Data::Surface
 class Mesh
 {
 public:
+	friend Utilitary::Surface::MeshComponents;
+	friend Utilitary::Surface::MeshDecimator;
 	friend Utilitary::Surface::MeshExporter;
+	friend Utilitary::Surface::MeshGenerator;
+	friend Utilitary::Surface::MeshGeometry;
 	friend Utilitary::Surface::MeshIntegrity;
 	friend Utilitary::Surface::MeshLoader;
+	friend Utilitary::Surface::MeshPacker;
+	friend Utilitary::Surface::MeshRemesher;
+	friend Utilitary::Surface::MeshReorderer;
+	friend Utilitary::Surface::MeshRepairer;
 
 	friend Data::Primitive::TriangleProxy;
 	friend Data::Primitive::VertexProxy;
@@ -39,15 +60,19 @@ public:
 	Mesh() = default;
 	/// @brief Copy ctor.
 	Mesh(const Mesh& other);
+	/// @brief Copy assignment, the cached data being shared like by the copy ctor.
+	Mesh& operator=(const Mesh& other);
 	~Mesh() = default;
 
 	/// @brief Deep clone of the mesh.
 	std::unique_ptr<Mesh> Clone() const;
 
 	/// @brief Get the number of vertices in the mesh.
+	/// @note Deleted vertices are counted until the next call to GarbageCollect.
 	uint32_t GetVertexCount() const;
 
 	/// @brief Get the number of triangles in the mesh.
+	/// @note Deleted triangles are counted until the next call to GarbageCollect.
 	uint32_t GetTriangleCount() const;
 
 	/// @brief Get a proxy to the vertex at the given index.
@@ -56,14 +81,19 @@ public:
 	Data::Primitive::TriangleProxy GetTriangle(const Core::BaseType::TriangleIndex index);
 
 	/// @brief Get the vertex data at the given index.
+	/// @note Moving the vertex through it requires a call to NotifyGeometryChanged, see SetVertexPosition.
 	Data::Primitive::Vertex& GetVertexData(const Core::BaseType::VertexIndex index);
 	/// @brief Get the vertex data at the given index.
 	const Data::Primitive::Vertex& GetVertexData(const Core::BaseType::VertexIndex index) const;
 	/// @brief Get the triangle data at the given index.
+	/// @note Editing the triangle through it requires a call to NotifyTopologyChanged or UpdateMeshConnectivity.
 	Data::Primitive::Triangle& GetTriangleData(const Core::BaseType::TriangleIndex index);
 	/// @brief Get the triangle data at the given index.
 	const Data::Primitive::Triangle& GetTriangleData(const Core::BaseType::TriangleIndex index) const;
 
+	/// @brief Move a vertex, which invalidates the cached data depending on the positions.
+	void SetVertexPosition(const Core::BaseType::VertexIndex index, const Core::BaseType::Vec3& position);
+
 	/// @brief Add a vertex to the mesh and return its index.
 	Core::BaseType::VertexIndex AddVertex(const Data::Primitive::Vertex& vertex);
 	/// @brief Add a triangle to the mesh and return its index.
@@ -78,10 +108,12 @@ public:
 	void UpdateMeshConnectivity();
 
 	/// @brief Get the vertices data.
+	/// @note Moving the vertices through it requires a call to NotifyGeometryChanged.
 	std::vector<Data::Primitive::Vertex>& GetVertices();
 	/// @brief Get the vertices data.
 	const std::vector<Data::Primitive::Vertex>& GetVertices() const;
 	/// @brief Get the triangles data.
+	/// @note Editing the triangles through it requires a call to NotifyTopologyChanged or UpdateMeshConnectivity.
 	std::vector<Data::Primitive::Triangle>& GetTriangles();
 	/// @brief Get the triangles data.
 	const std::vector<Data::Primitive::Triangle>& GetTriangles() const;
@@ -104,6 +136,99 @@ public:
 	/// @brief Update the boundary status stored on each vertex as an extra data (true = boundary vertex, false = interrior vertex)
 	void UpdateVerticesBoundaryStatus();
 
+	/// @brief Set the incident triangle of each boundary vertex to the triangle of its outgoing boundary edge.
+	/// @note The one-ring of a boundary vertex is then walked in a single counter-clockwise sweep, without going back
+	/// to the incident triangle. It changes the order of the circulators, the connectivity is left untouched.
+	void UpdateBoundaryIncidentTriangles();
+
+	/// @brief Check whether a vertex lies on a boundary edge.
+	bool IsBoundaryVertex(const Core::BaseType::VertexIndex index) const;
+
+	/// @brief Get the boundary loops of the mesh and the flags of its boundary vertices.
+	/// @note The loops are extracted by the first call (see MeshBoundary::ExtractBoundaryLoops), then cached until the
+	/// next change of the topology. The returned loops stay valid after the change.
+	std::shared_ptr<const Utilitary::Surface::BoundaryLoops> GetBoundaryLoops() const;
+
+	/// @brief Get the positions of the vertices in structure-of-arrays layout, for the vectorized kernels.
+	/// @note The buffers are built by the first call (see MeshGeometry::BuildPositionBuffers), then cached until the
+	/// next change of the geometry. The returned buffers stay valid after the change.
+	std::shared_ptr<const Utilitary::Surface::PositionBuffers> GetPositionBuffers() const;
+
+	/// @brief Get the bounding boxes, centroids, area and volume of the mesh.
+	/// @note The measures are computed by the first call (see MeshGeometry::ComputeMeasures), then cached until the
+	/// next change of the geometry. The returned measures stay valid after the change.
+	std::shared_ptr<const Utilitary::Surface::GeometryMeasures> GetGeometryMeasures() const;
+
+	/// @brief Get the revision of the topology, incremented by each change of the elements or of their connectivity.
+	uint64_t GetTopologyRevision() const;
+	/// @brief Increment the revision of the topology, which invalidates the cached data depending on it.
+	/// @note The methods of the mesh do it, it must be called after editing the triangles through GetTriangleData or
+	/// GetTriangles without calling UpdateMeshConnectivity.
+	void NotifyTopologyChanged();
+
+	/// @brief Get the revision of the geometry, incremented by each change of the positions or of the topology.
+	uint64_t GetGeometryRevision() const;
+	/// @brief Increment the revision of the geometry, which invalidates the cached data depending on the positions.
+	/// @note The methods of the mesh do it, SetVertexPosition included, it must be called after moving vertices through
+	/// GetVertexData or GetVertices.
+	void NotifyGeometryChanged();
+
+	/// @brief Flip the edge opposite to the given local vertex of a triangle.
+	/// @return False if the edge cannot be flipped (boundary edge or flipped edge already in the mesh).
+	/// @note The triangles (c, a, b) and (d, b, a) become (c, a, d) and (d, b, c) and keep their indices.
+	bool FlipEdge(const Core::BaseType::TriangleIndex triangleIdx, const Core::BaseType::EdgeIndex edgeIdx);
+
+	/// @brief Split the edge opposite to the given local vertex of a triangle by inserting a new vertex.
+	/// @return The index of the inserted vertex.
+	/// @note Each triangle sharing the edge is split in two. The new elements reuse the slots of deleted ones when
+	/// available, otherwise they are appended to the mesh.
+	Core::BaseType::VertexIndex SplitEdge(
+		const Core::BaseType::TriangleIndex triangleIdx,
+		const Core::BaseType::EdgeIndex edgeIdx,
+		const Core::BaseType::Vec3& position);
+
+	/// @brief Split a triangle in three by inserting a new vertex connected to its corners.
+	/// @return The index of the inserted vertex.
+	/// @note The new elements reuse the slots of deleted ones when available, otherwise they are appended to the mesh.
+	Core::BaseType::VertexIndex SplitTriangle(
+		const Core::BaseType::TriangleIndex triangleIdx, const Core::BaseType::Vec3& position);
+
+	/// @brief Check whether the edge opposite to the given local vertex of a triangle can be collapsed while keeping
+	/// the mesh manifold.
+	/// @note The link condition must hold (the only vertices adjacent to both endpoints are the opposite vertices of
+	/// the edge), an interior edge cannot join two boundary vertices and each opposite vertex must keep a valid fan.
+	bool IsCollapseValid(
+		const Core::BaseType::TriangleIndex triangleIdx, const Core::BaseType::EdgeIndex edgeIdx) const;
+
+	/// @brief Collapse the edge opposite to the given local vertex of a triangle.
+	/// @param position Position of the remaining vertex.
+	/// @return False if the collapse is not valid.
+	/// @note The vertex Vertices[Previous[edgeIdx]] is merged into the vertex Vertices[Next[edgeIdx]]. The removed
+	/// vertex and triangles are deleted, so the indices of the other elements do not change.
+	bool CollapseEdge(
+		const Core::BaseType::TriangleIndex triangleIdx,
+		const Core::BaseType::EdgeIndex edgeIdx,
+		const Core::BaseType::Vec3& position);
+
+	/// @brief Delete a vertex and all its incident triangles.
+	/// @note The vertices of its link left without incident triangle are deleted as well.
+	void DeleteVertex(const Core::BaseType::VertexIndex index);
+	/// @brief Delete a triangle, its neighbors see a boundary in its place.
+	/// @note The vertices left without incident triangle are deleted as well. The caller is responsible for not
+	/// creating non-manifold vertices, whose remaining fans would not be reachable by the circulators.
+	void DeleteTriangle(const Core::BaseType::TriangleIndex index);
+
+	/// @brief Check whether a vertex has been deleted.
+	bool IsVertexDeleted(const Core::BaseType::VertexIndex index) const;
+	/// @brief Check whether a triangle has been deleted.
+	bool IsTriangleDeleted(const Core::BaseType::TriangleIndex index) const;
+	/// @brief Check whether the mesh contains deleted elements not yet garbage collected.
+	bool HasGarbage() const;
+
+	/// @brief Remove the deleted vertices and triangles and remap every index (connectivity and extra data).
+	/// @note The remaining elements keep their relative order, the compaction runs in parallel.
+	void GarbageCollect();
+
 public:
 	/// @brief Circulator to iterate over the vertices around a given vertex.
 	/// @note The circulator will iterate in counter-clockwise direction first, then in clock-wise direction if it reaches a boundary.
@@ -282,6 +407,42 @@ public:
 	/// @return A range to iterate over the triangles around the given vertex.
 	TrianglesAroundVertexRange GetTrianglesAroundVertex(const Core::BaseType::VertexIndex index) const;
 
+	/// @brief Get a view over the vertices around a given vertex, in the order of GetVerticesAroundVertex.
+	/// @note The view is a std::ranges::forward_range, it is empty for an isolated vertex. See OneRingIterator.
+	VerticesAroundVertexView GetVerticesAroundVertexView(const Core::BaseType::VertexIndex index) const;
+
+	/// @brief Get a view over the triangles around a given vertex, in the order of GetTrianglesAroundVertex.
+	/// @note The view is a std::ranges::forward_range, it is empty for an isolated vertex. See OneRingIterator.
+	TrianglesAroundVertexView GetTrianglesAroundVertexView(const Core::BaseType::VertexIndex index) const;
+
+private:
+	/// @brief Flag a vertex as deleted and make its slot available to the next insertions.
+	void MarkVertexDeleted(const Core::BaseType::VertexIndex index);
+	/// @brief Flag a triangle as deleted and make its slot available to the next insertions.
+	void MarkTriangleDeleted(const Core::BaseType::TriangleIndex index);
+
+	/// @brief Insert a vertex, reusing the slot of a deleted vertex if any.
+	Core::BaseType::VertexIndex AllocateVertex(const Data::Primitive::Vertex& vertex);
+	/// @brief Insert a triangle, reusing the slot of a deleted triangle if any.
+	Core::BaseType::TriangleIndex AllocateTriangle(const Data::Primitive::Triangle& triangle);
+
+	/// @brief Move every element to its new index and remap all the stored indices (connectivity and extra data).
+	/// @param vertexRemap New index of each vertex, -1 to drop it.
+	/// @param vertexCount Number of vertices after the remapping.
+	/// @param triangleRemap New index of each triangle, -1 to drop it.
+	/// @param triangleCount Number of triangles after the remapping.
+	/// @note The dropped elements must not be referenced by the kept ones. The remapping runs in parallel.
+	void Remap(
+		const std::vector<int>& vertexRemap,
+		const int vertexCount,
+		const std::vector<int>& triangleRemap,
+		const int triangleCount);
+
+	/// @brief Replace a neighbor of a triangle, nothing is done if the triangle index is -1.
+	void ReplaceNeighbor(const int triangleIdx, const int oldNeighborIdx, const int newNeighborIdx);
+	/// @brief Replace the incident triangle of a vertex if it is the given one.
+	void ReplaceIncidentTriangle(const int vertexIdx, const int oldTriangleIdx, const int newTriangleIdx);
+
 private:
 	/// @brief List of vertices.
 	std::vector<Data::Primitive::Vertex> m_Vertices{};
@@ -292,5 +453,40 @@ private:
 	std::vector<Data::ExtraData::ExtraDataContainer> m_VerticesExtraDataContainer{};
 	/// @brief Extra data containers for each triangle.
 	std::vector<Data::ExtraData::ExtraDataContainer> m_TrianglesExtraDataContainer{};
+
+	/// @brief Tombstone of each vertex, non-zero for the deleted ones.
+	/// @note The flags are only allocated by the first deletion, missing flags stand for alive vertices.
+	std::vector<uint8_t> m_DeletedVertices{};
+	/// @brief Tombstone of each triangle, non-zero for the deleted ones.
+	/// @note The flags are only allocated by the first deletion, missing flags stand for alive triangles.
+	std::vector<uint8_t> m_DeletedTriangles{};
+	/// @brief Deleted vertices whose slot can be reused.
+	std::vector<Core::BaseType::VertexIndex> m_FreeVertices{};
+	/// @brief Deleted triangles whose slot can be reused.
+	std::vector<Core::BaseType::TriangleIndex> m_FreeTriangles{};
+
+	/// @brief Revision of the topology.
+	uint64_t m_TopologyRevision{ 0 };
+	/// @brief Boundary loops extracted for the revision m_BoundaryLoopsRevision, null until the first extraction.
+	mutable std::shared_ptr<const Utilitary::Surface::BoundaryLoops> m_BoundaryLoops{};
+	/// @brief Revision of the topology for which the boundary loops were extracted.
+	mutable uint64_t m_BoundaryLoopsRevision{ 0 };
+	/// @brief Mutex guarding the boundary loops cache, so that it can be filled from concurrent readers.
+	mutable std::mutex m_BoundaryLoopsMutex{};
+
+	/// @brief Revision of the geometry.
+	uint64_t m_GeometryRevision{ 0 };
+	/// @brief Position buffers built for the revision m_PositionBuffersRevision, null until the first build.
+	mutable std::shared_ptr<const Utilitary::Surface::PositionBuffers> m_PositionBuffers{};
+	/// @brief Revision of the geometry for which the position buffers were built.
+	mutable uint64_t m_PositionBuffersRevision{ 0 };
+	/// @brief Mutex guarding the position buffers cache, so that it can be filled from concurrent readers.
+	mutable std::mutex m_PositionBuffersMutex{};
+	/// @brief Measures computed for the revision m_GeometryMeasuresRevision, null until the first computation.
+	mutable std::shared_ptr<const Utilitary::Surface::GeometryMeasures> m_GeometryMeasures{};
+	/// @brief Revision of the geometry for which the measures were computed.
+	mutable uint64_t m_GeometryMeasuresRevision{ 0 };
+	/// @brief Mutex guarding the measures cache, so that it can be filled from concurrent readers.
+	mutable std::mutex m_GeometryMeasuresMutex{};
 };
 } // namespace Data::Surface
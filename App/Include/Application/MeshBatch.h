@@ -0,0 +1,127 @@
+#pragma once
+
+#include "Application/Mesh.h"
+#include "Application/MeshPacker.h"
+#include "Core/BaseTypes.h"
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace Utilitary::Surface
+{
+/// @brief Arguments of an indexed indirect draw, in the layout read by glMultiDrawElementsIndirect.
+struct DrawElementsIndirectCommand
+{
+	/// @brief Number of indices of the draw, zero to skip it.
+	uint32_t Count = 0;
+	/// @brief Number of instances of the draw, zero to skip it.
+	uint32_t InstanceCount = 0;
+	/// @brief First index of the draw in the index buffer.
+	uint32_t FirstIndex = 0;
+	/// @brief Value added to the indices of the draw.
+	int32_t BaseVertex = 0;
+	/// @brief First instance of the draw, its slot in the transform buffer (gl_BaseInstance in the shaders).
+	uint32_t BaseInstance = 0;
+};
+static_assert(sizeof(DrawElementsIndirectCommand) == 20, "The commands must match the layout of the indirect buffer");
+
+/// @brief Range of a part in the shared vertex and index buffers of a MeshBatch.
+struct BatchPart
+{
+	/// @brief First index of the part, its indices being relative to BaseVertex.
+	uint32_t FirstIndex = 0;
+	/// @brief Number of indices, three per triangle.
+	uint32_t IndexCount = 0;
+	/// @brief First packed vertex of the part.
+	int32_t BaseVertex = 0;
+	/// @brief Number of packed vertices.
+	uint32_t VertexCount = 0;
+};
+
+/// @brief Geometry and instances of many small meshes, drawn with a single glMultiDrawElementsIndirect call.
+/// @note The parts are packed (see MeshPacker) one after the other into shared vertex and 32-bit index arrays. Each
+/// instance places a part with its own transform and owns a slot: the indirect command and the transform of the slot.
+/// The instances are grouped by chunks of InstanceChunkSize slots, a change of an instance only marks its chunk, and
+/// UpdateCommands regenerates the marked chunks in parallel. The arrays are kept on the CPU, the GPU copy (see
+/// Application::GpuBatch) only uploads the chunks regenerated and the geometry appended since the last update.
+class MeshBatch
+{
+public:
+	/// @brief Number of instance slots regenerated, and uploaded, together.
+	static constexpr uint32_t InstanceChunkSize = 256;
+	/// @brief Value of the removed instances in the slots.
+	static constexpr uint32_t InvalidIndex = UINT32_MAX;
+
+public:
+	/// @brief Pack a mesh at the end of the shared arrays.
+	/// @param mesh The part, whose normals are taken from SmoothVertexNormalExtraData (zero when missing).
+	/// @return The index of the part, to instantiate it.
+	uint32_t AddPart(const Data::Surface::Mesh& mesh);
+
+	/// @brief Place a part, reusing the slot of a removed instance if any.
+	/// @return The index of the instance, which is its slot.
+	uint32_t AddInstance(uint32_t part, const Core::BaseType::Mat4& transform);
+	/// @brief Free the slot of an instance, its command is regenerated as an empty draw.
+	void RemoveInstance(uint32_t instance);
+	/// @brief Move an instance.
+	void SetTransform(uint32_t instance, const Core::BaseType::Mat4& transform);
+	/// @brief Show or hide an instance, a hidden instance keeps its slot and draws nothing.
+	void SetVisible(uint32_t instance, bool visible);
+
+	/// @brief Regenerate the commands and the transforms of the chunks changed since the last update, in parallel.
+	/// @return The regenerated chunks, in increasing order, valid until the next update.
+	std::span<const uint32_t> UpdateCommands();
+
+	/// @brief Get the packed vertices of all the parts.
+	std::span<const PackedVertex> GetVertices() const { return m_Vertices; }
+	/// @brief Get the indices of all the parts, each one relative to the base vertex of its part.
+	std::span<const uint32_t> GetIndices() const { return m_Indices; }
+	/// @brief Get the ranges of the parts in the shared arrays.
+	std::span<const BatchPart> GetParts() const { return m_Parts; }
+
+	/// @brief Get the indirect command of each slot, up to date after UpdateCommands.
+	std::span<const DrawElementsIndirectCommand> GetCommands() const { return m_Commands; }
+	/// @brief Get the transform of each slot, up to date after UpdateCommands.
+	std::span<const Core::BaseType::Mat4> GetTransforms() const { return m_Transforms; }
+
+	/// @brief Get the number of slots, removed instances included: the number of commands to draw.
+	uint32_t GetSlotCount() const { return static_cast<uint32_t>(m_Instances.size()); }
+	/// @brief Get the number of instances not removed.
+	uint32_t GetInstanceCount() const { return GetSlotCount() - static_cast<uint32_t>(m_FreeSlots.size()); }
+	/// @brief Get the number of chunks of slots.
+	uint32_t GetChunkCount() const { return (GetSlotCount() + InstanceChunkSize - 1) / InstanceChunkSize; }
+
+private:
+	/// @brief State of an instance slot.
+	struct Instance
+	{
+		Core::BaseType::Mat4 Transform{ 1.f };
+		/// @brief Part of the instance, InvalidIndex for a free slot.
+		uint32_t Part = InvalidIndex;
+		bool Visible = true;
+	};
+
+	/// @brief Mark the chunk of a slot for the next update.
+	void MarkChanged(uint32_t slot);
+
+private:
+	std::vector<PackedVertex> m_Vertices{};
+	std::vector<uint32_t> m_Indices{};
+	std::vector<BatchPart> m_Parts{};
+
+	std::vector<Instance> m_Instances{};
+	/// @brief Slots of the removed instances, reused last removed first.
+	std::vector<uint32_t> m_FreeSlots{};
+
+	std::vector<DrawElementsIndirectCommand> m_Commands{};
+	std::vector<Core::BaseType::Mat4> m_Transforms{};
+
+	/// @brief Whether each chunk is in m_ChangedChunks.
+	std::vector<uint8_t> m_IsChunkChanged{};
+	/// @brief Chunks to regenerate at the next update.
+	std::vector<uint32_t> m_ChangedChunks{};
+	/// @brief Chunks regenerated by the last update.
+	std::vector<uint32_t> m_UpdatedChunks{};
+};
+} // namespace Utilitary::Surface
@@ -0,0 +1,64 @@
+#pragma once
+
+#include "Application/Mesh.h"
+#include "Core/BaseTypes.h"
+#include "Core/Bitset.h"
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace Utilitary::Surface
+{
+/// @brief Boundary of a mesh, the loops of boundary edges (without neighbor) and the vertices lying on them.
+struct BoundaryLoops
+{
+	/// @brief Flag of each vertex, set for the vertices lying on a boundary edge.
+	Core::Container::Bitset VertexFlags{};
+
+	/// @brief Edges of the loop l are the edges [LoopOffsets[l], LoopOffsets[l + 1]) of the arrays below.
+	std::vector<uint32_t> LoopOffsets{ 0 };
+	/// @brief First vertex of each edge, the edge running to the first vertex of the next edge of its loop.
+	/// @note The loops run through their edges in the direction of the triangles, so a hole is turned around
+	/// clockwise when seen from the side the triangles face.
+	std::vector<Core::BaseType::VertexIndex> LoopVertices{};
+	/// @brief Triangle of each edge.
+	std::vector<Core::BaseType::TriangleIndex> LoopTriangles{};
+	/// @brief Local index of each edge in its triangle, the neighbor at this index being -1.
+	std::vector<Core::BaseType::EdgeIndex> LoopEdges{};
+
+	/// @brief Get the number of loops.
+	uint32_t GetLoopCount() const { return static_cast<uint32_t>(LoopOffsets.size()) - 1; }
+
+	/// @brief Get the number of boundary edges.
+	uint32_t GetEdgeCount() const { return LoopOffsets.back(); }
+
+	/// @brief Get the ordered vertices of a loop.
+	std::span<const Core::BaseType::VertexIndex> GetLoopVertices(const uint32_t loop) const
+	{
+		return { LoopVertices.data() + LoopOffsets[loop], LoopVertices.data() + LoopOffsets[loop + 1] };
+	}
+
+	/// @brief Get the triangle of each edge of a loop.
+	std::span<const Core::BaseType::TriangleIndex> GetLoopTriangles(const uint32_t loop) const
+	{
+		return { LoopTriangles.data() + LoopOffsets[loop], LoopTriangles.data() + LoopOffsets[loop + 1] };
+	}
+
+	/// @brief Check whether a vertex lies on a boundary edge.
+	bool IsBoundaryVertex(const Core::BaseType::VertexIndex index) const { return VertexFlags.Test(index); }
+};
+
+/// @brief Struct to extract the boundary of meshes.
+struct MeshBoundary
+{
+	/// @brief Extract the boundary loops of the mesh.
+	/// @param mesh The mesh, its connectivity must be up to date.
+	/// @note The edge following a boundary edge is found by turning around their common vertex, so a vertex
+	/// shared by several fans (bowtie) joins the right edges. The boundary edges are found and linked in parallel.
+	/// @note Each loop starts with its boundary edge of lowest triangle, the loops are sorted by first edge. On a mesh
+	/// with inconsistent orientation, the fans can be broken: the loops are then left open and come first.
+	/// @see Mesh::GetBoundaryLoops for a cached version.
+	static BoundaryLoops ExtractBoundaryLoops(const Data::Surface::Mesh& mesh);
+};
+} // namespace Utilitary::Surface
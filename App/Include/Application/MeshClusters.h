@@ -0,0 +1,176 @@
+#pragma once
+
+#include "Application/Mesh.h"
+#include "Core/BaseTypes.h"
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace Utilitary::Surface
+{
+/// @brief Sphere bounding a set of triangles.
+struct BoundingSphere
+{
+	/// @brief Center of the sphere.
+	Core::BaseType::Vec3 Center{ 0.f };
+	/// @brief Radius of the sphere, negative when it bounds nothing.
+	float Radius = -1.f;
+};
+
+/// @brief Cone containing the normals of a set of triangles.
+struct NormalCone
+{
+	/// @brief Unit axis of the cone, the mean direction of the normals.
+	Core::BaseType::Vec3 Axis{ 0.f, 0.f, 1.f };
+	/// @brief Cosine of the half angle of the cone. The backface test is disabled when it is not positive, the normals
+	/// then spanning half the directions or more.
+	float Cutoff = -1.f;
+};
+
+/// @brief Chunk of spatially coherent triangles (meshlet), tested as a whole by the culling.
+struct MeshCluster
+{
+	/// @brief Position of the first triangle of the cluster in ClusterLevel::Triangles.
+	uint32_t FirstTriangle = 0;
+	/// @brief Number of triangles of the cluster.
+	uint32_t TriangleCount = 0;
+	/// @brief Sphere bounding the triangles.
+	BoundingSphere Bounds{};
+	/// @brief Cone containing the normals of the triangles.
+	NormalCone Cone{};
+};
+
+/// @brief Level of detail of a cluster hierarchy, its triangles split into clusters.
+struct ClusterLevel
+{
+	/// @brief Mesh of the level, decimated from the source mesh for the coarse levels.
+	const Data::Surface::Mesh* LevelMesh = nullptr;
+	/// @brief Decimated copy of the source mesh, null for the first level which is the source mesh itself.
+	std::unique_ptr<Data::Surface::Mesh> OwnedMesh{};
+	/// @brief Geometric error of the level, the mean length of its edges.
+	float Error = 0.f;
+	/// @brief Live triangles of the level mesh, in the order of the clusters.
+	std::vector<Core::BaseType::TriangleIndex> Triangles{};
+	/// @brief Clusters of the level, grouped by cell.
+	std::vector<MeshCluster> Clusters{};
+	/// @brief First cluster of each cell in Clusters, plus the total number of clusters.
+	std::vector<uint32_t> CellClusterOffsets{};
+};
+
+/// @brief Clusters of a mesh at several levels of detail, see MeshClusters::BuildHierarchy.
+struct ClusterHierarchy
+{
+	/// @brief Number of cells along each axis of the grid dividing the bounding cube of the source mesh.
+	uint32_t CellsPerAxis = 1;
+	/// @brief Sphere bounding the clusters of each cell at every level, with a negative radius for the empty cells.
+	std::vector<BoundingSphere> CellBounds{};
+	/// @brief Levels of detail, from the source mesh to the coarsest one.
+	std::vector<ClusterLevel> Levels{};
+
+	/// @brief Get the number of cells of the grid.
+	uint32_t GetCellCount() const { return static_cast<uint32_t>(CellBounds.size()); }
+
+	/// @brief Get the number of clusters over all the levels.
+	uint32_t GetClusterCount() const
+	{
+		uint32_t clusterCount = 0;
+		for(const ClusterLevel& level : Levels)
+			clusterCount += static_cast<uint32_t>(level.Clusters.size());
+		return clusterCount;
+	}
+};
+
+/// @brief Parameters driving the construction of a cluster hierarchy.
+struct ClusterSpecification
+{
+	/// @brief Maximum number of triangles of a cluster.
+	uint32_t MaxClusterTriangleCount{ 128 };
+	/// @brief The grid selecting the levels of detail has 2^CellGridDepth cells along each axis, up to 2^7.
+	uint32_t CellGridDepth{ 3 };
+	/// @brief Maximum number of levels, the source mesh included.
+	uint32_t MaxLevelCount{ 8 };
+	/// @brief Number of triangles under which no coarser level is built.
+	uint32_t MinLevelTriangleCount{ 2048 };
+};
+
+/// @brief Point of view of a frame, see MeshClusters::SelectClusters.
+struct ClusterView
+{
+	/// @brief Projection times view matrix of the camera, with OpenGL clip space conventions.
+	Core::BaseType::Mat4 ViewProjection{ 1.f };
+	/// @brief Position of the camera, in the frame of the mesh.
+	Core::BaseType::Vec3 CameraPosition{ 0.f };
+	/// @brief Number of pixels covered by one unit seen at distance one, viewport height / (2 tan(fovy / 2)).
+	/// @note Zero keeps the first level everywhere.
+	float ProjectionScale = 0.f;
+	/// @brief Maximum projected error of the selected levels, in pixels.
+	float MaxScreenError = 1.f;
+	/// @brief Whether the clusters outside the frustum are culled.
+	bool FrustumCulling = true;
+	/// @brief Whether the clusters whose triangles all face away from the camera are culled.
+	bool BackfaceCulling = true;
+};
+
+/// @brief Clusters to draw for a frame, see MeshClusters::SelectClusters.
+struct ClusterSelection
+{
+	/// @brief Visible clusters of each level, by increasing index.
+	std::vector<std::vector<uint32_t>> VisibleClusters{};
+	/// @brief Number of clusters of the selected levels, in the cells not rejected as a whole.
+	uint32_t TestedClusterCount = 0;
+	/// @brief Number of clusters of the selected levels outside the frustum, the rejected cells included.
+	uint32_t FrustumCulledCount = 0;
+	/// @brief Number of clusters of the selected levels facing away from the camera.
+	uint32_t BackfaceCulledCount = 0;
+
+	/// @brief Get the number of visible clusters over all the levels.
+	uint32_t GetVisibleClusterCount() const
+	{
+		uint32_t visibleCount = 0;
+		for(const std::vector<uint32_t>& clusters : VisibleClusters)
+			visibleCount += static_cast<uint32_t>(clusters.size());
+		return visibleCount;
+	}
+};
+
+/// @brief Struct to split meshes into clusters and select the visible ones each frame.
+/// @note The triangles are sorted by the Hilbert key of their centroid in the bounding cube of the source mesh (see
+/// MeshReorderer::ComputeCurveKey), so that consecutive triangles are close in space. The curve also visits the cells
+/// of the coarse grid one after the other: the clusters are cut from the sorted triangles without straddling two
+/// cells, and each cell selects its level of detail independently.
+struct MeshClusters
+{
+	/// @brief Build the clusters of a mesh and of its coarser levels of detail.
+	/// @param mesh The source mesh, referenced by the first level, it must outlive the hierarchy unchanged. Its
+	/// connectivity must be up to date, the coarser levels being decimated from copies of it.
+	/// @param specification Parameters of the construction.
+	/// @note Each coarser level is decimated (see MeshDecimator::DecimateParallel) to half the triangles of the
+	/// previous one, until MinLevelTriangleCount is reached or the decimation stalls. The levels are independent
+	/// meshes: the borders of two neighbor cells at different levels are not stitched, small cracks can show there.
+	static ClusterHierarchy BuildHierarchy(
+		const Data::Surface::Mesh& mesh, const ClusterSpecification& specification = ClusterSpecification());
+
+	/// @brief Get the planes of the frustum (left, right, bottom, top, near, far) as (normal, offset).
+	/// @note A point p is inside the frustum when dot(normal, p) + offset >= 0 for every plane, the normals are unit.
+	static std::array<Core::BaseType::Vec4, 6> ExtractFrustumPlanes(const Core::BaseType::Mat4& viewProjection);
+
+	/// @brief Check whether a sphere intersects the frustum, conservatively near its corners.
+	static bool IsSphereInFrustum(const std::array<Core::BaseType::Vec4, 6>& planes, const BoundingSphere& sphere);
+
+	/// @brief Check whether all the triangles in the sphere, with a normal in the cone, face away from the camera.
+	/// @note The test is conservative: it fails whenever the cone widened by the angle under which the camera sees the
+	/// sphere reaches the camera side.
+	static bool IsBackfacing(
+		const BoundingSphere& sphere, const NormalCone& cone, const Core::BaseType::Vec3& cameraPosition);
+
+	/// @brief Select the level of detail of each cell and cull its clusters for a point of view.
+	/// @param hierarchy The clusters of the mesh.
+	/// @param view The point of view of the frame.
+	/// @note Each cell takes the coarsest level whose error, projected from the point of its bounding sphere closest to
+	/// the camera, stays under MaxScreenError. The cells outside the frustum are rejected as a whole, then the clusters
+	/// of the others are tested one by one. The cells run in parallel, the result does not depend on the threads.
+	static ClusterSelection SelectClusters(const ClusterHierarchy& hierarchy, const ClusterView& view);
+};
+} // namespace Utilitary::Surface
@@ -0,0 +1,98 @@
+#pragma once
+
+#include "Application/Mesh.h"
+#include "Core/Parallel.h"
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace Utilitary::Surface
+{
+/// @brief Connected components of a mesh, the triangles being connected through their neighbors.
+struct ComponentLabeling
+{
+	/// @brief Label of the deleted triangles.
+	static constexpr uint32_t InvalidLabel = std::numeric_limits<uint32_t>::max();
+
+	/// @brief Component of each triangle.
+	/// @note The components are numbered by increasing lowest triangle index.
+	std::vector<uint32_t> TriangleLabels{};
+	/// @brief Triangles of the component c are Triangles[TriangleOffsets[c], TriangleOffsets[c + 1]).
+	std::vector<uint32_t> TriangleOffsets{ 0 };
+	/// @brief Triangles sorted by component, then by index.
+	std::vector<Core::BaseType::TriangleIndex> Triangles{};
+
+	/// @brief Get the number of components.
+	uint32_t GetComponentCount() const { return static_cast<uint32_t>(TriangleOffsets.size()) - 1; }
+
+	/// @brief Get the triangles of a component, by increasing index.
+	std::span<const Core::BaseType::TriangleIndex> GetTriangles(const uint32_t component) const
+	{
+		return { Triangles.data() + TriangleOffsets[component], Triangles.data() + TriangleOffsets[component + 1] };
+	}
+};
+
+/// @brief Struct to split meshes into connected components and process them independently.
+struct MeshComponents
+{
+	/// @brief Label the connected components of the mesh.
+	/// @param mesh The mesh to label, its connectivity must be up to date.
+	/// @note The triangles are merged with their neighbors by a lock-free union-find (roots linked to the lowest one
+	/// by compare and swap, paths halved by the finds) run in parallel over the triangles.
+	static ComponentLabeling LabelComponents(const Data::Surface::Mesh& mesh);
+
+	/// @brief Copy a component into its own mesh.
+	/// @param mesh The labeled mesh.
+	/// @param labeling Labeling of the mesh, see LabelComponents.
+	/// @param component Index of the component.
+	/// @note The vertices and triangles keep their relative order, as well as their extra data. A non-manifold
+	/// vertex shared by several components is copied in each of them.
+	static std::unique_ptr<Data::Surface::Mesh> ExtractComponent(
+		const Data::Surface::Mesh& mesh, const ComponentLabeling& labeling, uint32_t component);
+
+	/// @brief Copy every component into its own mesh, the components being extracted in parallel.
+	static std::vector<std::unique_ptr<Data::Surface::Mesh>> ExtractComponents(
+		const Data::Surface::Mesh& mesh, const ComponentLabeling& labeling);
+
+	/// @brief Concatenate meshes into a single one.
+	/// @param components The meshes to merge, they must not have deleted elements (see Mesh::GarbageCollect).
+	/// @note The elements of each mesh follow the ones of the previous meshes. The extra data containers are kept if
+	/// any mesh has them, the meshes without containers get empty ones.
+	static std::unique_ptr<Data::Surface::Mesh> MergeComponents(
+		const std::vector<std::unique_ptr<Data::Surface::Mesh>>& components);
+
+	/// @brief Call func(mesh) on each component.
+	/// @param components The meshes to process.
+	/// @param func Callable invoked once per component.
+	/// @param minParallelTriangleCount Components with at least this number of triangles are processed one after the
+	/// other, so that func can use every thread on each of them. The smaller ones are processed concurrently, the
+	/// parallel loops of func then running serially.
+	template<typename Func>
+	static void ForEachComponent(
+		std::vector<std::unique_ptr<Data::Surface::Mesh>>& components,
+		Func&& func,
+		const uint32_t minParallelTriangleCount = 1 << 16)
+	{
+		std::vector<Data::Surface::Mesh*> smallComponents;
+		for(const std::unique_ptr<Data::Surface::Mesh>& component : components)
+		{
+			if(component->GetTriangleCount() >= minParallelTriangleCount)
+				func(*component);
+			else
+				smallComponents.push_back(component.get());
+		}
+
+		Core::Parallel::ParallelFor(
+			0,
+			smallComponents.size(),
+			[&](const size_t iComponent)
+			{
+				func(*smallComponents[iComponent]);
+			},
+			1);
+	}
+};
+} // namespace Utilitary::Surface
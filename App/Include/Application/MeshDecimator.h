@@ -0,0 +1,36 @@
+#pragma once
+
+#include "Application/Mesh.h"
+
+#include <cstdint>
+#include <limits>
+
+namespace Utilitary::Surface
+{
+/// @brief Parameters driving the decimation of a mesh.
+struct DecimationSpecification
+{
+	/// @brief Number of triangles under which the decimation stops.
+	uint32_t TargetTriangleCount{ 0 };
+	/// @brief Maximum quadric error accepted for a single edge collapse.
+	float MaxError{ std::numeric_limits<float>::max() };
+	/// @brief Maximum number of collapse passes.
+	uint32_t MaxPassCount{ 64 };
+};
+
+/// @brief Struct to simplify meshes using quadric error metrics (QEM).
+struct MeshDecimator
+{
+	/// @brief Decimate the mesh with batches of independent edge collapses applied in parallel.
+	/// @param mesh The mesh to decimate, its connectivity must be up to date.
+	/// @param specification Parameters of the decimation.
+	/// @return The number of edge collapses performed.
+	/// @note Each pass selects the collapses whose cost is minimal over their neighborhood ({a, b} and the one-ring
+	/// of both endpoints). Two selected collapses never touch the same triangle, so a whole batch is applied
+	/// concurrently before the vertices and triangles are compacted for the next pass.
+	/// @note Boundary edges are never collapsed, and an interior edge with a boundary endpoint is collapsed onto
+	/// that endpoint, so the boundaries of the mesh are preserved.
+	static uint32_t DecimateParallel(
+		Data::Surface::Mesh& mesh, const DecimationSpecification& specification = DecimationSpecification());
+};
+} // namespace Utilitary::Surface
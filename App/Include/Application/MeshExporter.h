@@ -14,13 +14,15 @@ struct MeshExporter
 	/// @brief Export mesh to an OFF file.
 	/// @param mesh Mesh to export.
 	/// @param filepath Path of the file to which the mesh is exported.
-	/// @note This function assumes the mesh has a valid integrity.
+	/// @note This function assumes the mesh has a valid integrity. Deleted elements are skipped by exporting a
+	/// garbage collected copy of the mesh.
 	static void ExportOFF(const Data::Surface::Mesh& mesh, const std::filesystem::path& filepath);
 
 	/// @brief Export mesh to an OBJ file.
 	/// @param mesh Mesh to export.
 	/// @param filepath Path of the file to which the mesh is exported.
-	/// @note This function assumes the mesh has a valid integrity.
+	/// @note This function assumes the mesh has a valid integrity. Deleted elements are skipped by exporting a
+	/// garbage collected copy of the mesh.
 	static void ExportOBJ(const Data::Surface::Mesh& mesh, const std::filesystem::path& filepath);
 };
 } // namespace Utilitary::Surface
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "Application/Mesh.h"
+
+#include <cstdint>
+#include <memory>
+
+namespace Utilitary::Surface
+{
+/// @brief Struct generating large procedural meshes.
+/// @note The arrays are allocated once and the positions, triangles, neighbors and incident triangles are filled in
+/// parallel from their closed form, no call to UpdateMeshConnectivity is needed. The results are deterministic and do
+/// not depend on the number of threads.
+struct MeshGenerator
+{
+	/// @brief Create a flat grid with (nRow+1)*(nCol+1) vertices and 2*nRow*nCol triangles, in the XY plane.
+	/// @note The elements are stored in the same order as TestHelpers::CreateGridMesh.
+	static std::unique_ptr<Data::Surface::Mesh> CreateGrid(uint32_t nRow, uint32_t nCol);
+
+	/// @brief Create a closed torus with nMajor*nMinor vertices and 2*nMajor*nMinor triangles.
+	/// @param nMajor Number of subdivisions around the main axis (at least 3).
+	/// @param nMinor Number of subdivisions around the tube (at least 3).
+	/// @note The elements are stored in the same order as TestHelpers::CreateTorusMesh.
+	static std::unique_ptr<Data::Surface::Mesh> CreateTorus(
+		uint32_t nMajor, uint32_t nMinor, float majorRadius = 2.f, float minorRadius = 0.5f);
+
+	/// @brief Create a sphere by subdividing an icosahedron, with 10*4^k+2 vertices and 20*4^k triangles.
+	/// @param subdivisionCount Number of 1-to-4 subdivisions k, every new vertex is projected on the sphere.
+	/// @note Each level numbers the split edges from the adjacency of the previous one, without any edge lookup table.
+	static std::unique_ptr<Data::Surface::Mesh> CreateIcosphere(uint32_t subdivisionCount, float radius = 1.f);
+
+	/// @brief Create a grid whose height is a fractal value noise, see CreateGrid.
+	/// @param amplitude Maximal height of the first octave, the total height stays below twice this value.
+	/// @param frequency Number of noise cells per grid cell for the first octave.
+	/// @param octaveCount Number of octaves, each one doubles the frequency and halves the amplitude.
+	/// @param seed Seed of the noise.
+	static std::unique_ptr<Data::Surface::Mesh> CreateTerrain(
+		uint32_t nRow,
+		uint32_t nCol,
+		float amplitude = 8.f,
+		float frequency = 0.05f,
+		uint32_t octaveCount = 5,
+		uint32_t seed = 0);
+
+	/// @brief Create disconnected triangles randomly placed in the unit cube, with 3 vertices per triangle.
+	/// @param triangleCount Number of triangles.
+	/// @param seed Seed of the random positions.
+	/// @note The triangles have no neighbor, their size decreases with their number to limit the overlaps.
+	static std::unique_ptr<Data::Surface::Mesh> CreateTriangleSoup(uint32_t triangleCount, uint32_t seed = 0);
+};
+} // namespace Utilitary::Surface
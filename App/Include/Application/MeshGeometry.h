@@ -0,0 +1,145 @@
+#pragma once
+
+#include "Application/Mesh.h"
+#include "Core/AlignedAllocator.h"
+#include "Core/BaseTypes.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+
+namespace Utilitary::Surface
+{
+/// @brief Positions of the vertices of a mesh in structure-of-arrays layout, one aligned array per coordinate.
+/// @note The kernels reading only the positions load contiguous floats without the topology of the vertices, and
+/// process PositionLaneCount vertices per iteration without remainder loop: the arrays are padded to a multiple of it.
+/// @note The slots of the deleted vertices and the padding hold FillPosition, the position of a live vertex, so that
+/// they never change a bounding box. The kernels summing positions must skip them or remove their contribution.
+struct PositionBuffers
+{
+	/// @brief Number of floats of a lane block, a full AVX-512 register or two AVX registers.
+	static constexpr size_t PositionLaneCount = 16;
+
+	/// @brief X coordinate of each vertex.
+	Core::Memory::AlignedVector<float> X{};
+	/// @brief Y coordinate of each vertex.
+	Core::Memory::AlignedVector<float> Y{};
+	/// @brief Z coordinate of each vertex.
+	Core::Memory::AlignedVector<float> Z{};
+
+	/// @brief Number of vertices of the mesh, deleted ones included, the arrays being padded after it.
+	uint32_t VertexCount = 0;
+	/// @brief Number of vertices not deleted.
+	uint32_t LiveVertexCount = 0;
+	/// @brief Position of the deleted vertices and of the padding, the origin if every vertex is deleted.
+	Core::BaseType::Vec3 FillPosition{ 0.f };
+
+	/// @brief Get the size of the padded arrays.
+	size_t GetPaddedCount() const { return X.size(); }
+
+	/// @brief Get the position of a vertex.
+	Core::BaseType::Vec3 GetPosition(const Core::BaseType::VertexIndex index) const
+	{
+		return { X[index], Y[index], Z[index] };
+	}
+
+	/// @brief Get the coordinates of the vertices along an axis (0 = x, 1 = y, 2 = z), padding excluded.
+	std::span<const float> GetAxis(const int axis) const
+	{
+		const Core::Memory::AlignedVector<float>& coordinates = axis == 0 ? X : (axis == 1 ? Y : Z);
+		return { coordinates.data(), VertexCount };
+	}
+};
+
+/// @brief Axis-aligned bounding box, empty (Min > Max) by default.
+struct AxisAlignedBox
+{
+	/// @brief Minimal corner.
+	Core::BaseType::Vec3 Min{ std::numeric_limits<float>::max() };
+	/// @brief Maximal corner.
+	Core::BaseType::Vec3 Max{ std::numeric_limits<float>::lowest() };
+
+	/// @brief Check whether the box contains no point.
+	bool IsEmpty() const { return Min.x > Max.x || Min.y > Max.y || Min.z > Max.z; }
+
+	/// @brief Get the size of the box along each axis.
+	Core::BaseType::Vec3 GetExtent() const { return IsEmpty() ? Core::BaseType::Vec3{ 0.f } : Max - Min; }
+};
+
+/// @brief Oriented bounding box, along the principal axes of the vertices.
+struct OrientedBox
+{
+	/// @brief Center of the box.
+	Core::BaseType::Vec3 Center{ 0.f };
+	/// @brief Orthonormal right-handed axes of the box, by decreasing variance of the vertices.
+	std::array<Core::BaseType::Vec3, 3> Axes{ Core::BaseType::Vec3{ 1.f, 0.f, 0.f },
+		Core::BaseType::Vec3{ 0.f, 1.f, 0.f },
+		Core::BaseType::Vec3{ 0.f, 0.f, 1.f } };
+	/// @brief Half size of the box along each of its axes.
+	Core::BaseType::Vec3 HalfExtents{ 0.f };
+
+	/// @brief Get the volume of the box.
+	float GetVolume() const { return 8.f * HalfExtents.x * HalfExtents.y * HalfExtents.z; }
+};
+
+/// @brief Measures of the geometry of a mesh, see MeshGeometry::ComputeMeasures.
+struct GeometryMeasures
+{
+	/// @brief Axis-aligned bounding box of the live vertices.
+	AxisAlignedBox BoundingBox{};
+	/// @brief Oriented bounding box of the live vertices.
+	OrientedBox OrientedBoundingBox{};
+	/// @brief Mean position of the live vertices.
+	Core::BaseType::Vec3 VertexCentroid{ 0.f };
+	/// @brief Centroid of the surface, the center of each triangle weighted by its area.
+	Core::BaseType::Vec3 SurfaceCentroid{ 0.f };
+	/// @brief Total area of the triangles.
+	float SurfaceArea = 0.f;
+	/// @brief Signed volume enclosed by the triangles, positive for a closed mesh whose triangles face outwards.
+	float Volume = 0.f;
+};
+
+/// @brief Struct for the geometric kernels over the positions of meshes.
+/// @note The kernels read the positions in structure-of-arrays layout (see PositionBuffers), process them by blocks
+/// of PositionLaneCount vertices so that the loops vectorize, and run in parallel. The sums are reduced in a
+/// deterministic order, so the results do not depend on the number of threads.
+struct MeshGeometry
+{
+	/// @brief Copy the positions of the mesh in structure-of-arrays layout.
+	/// @note The copy runs in parallel.
+	/// @see Mesh::GetPositionBuffers for a cached version.
+	static PositionBuffers BuildPositionBuffers(const Data::Surface::Mesh& mesh);
+
+	/// @brief Compute the bounding box of the live vertices.
+	/// @note Each thread keeps one minimum and maximum per lane of a block of PositionLaneCount vertices, so that the
+	/// loop vectorizes without reordering the comparisons.
+	static AxisAlignedBox ComputeBoundingBox(const PositionBuffers& positions);
+
+	/// @brief Compute the mean position of the live vertices, the origin if there is none.
+	static Core::BaseType::Vec3 ComputeVertexCentroid(const PositionBuffers& positions);
+
+	/// @brief Compute the oriented bounding box of the live vertices.
+	/// @note The axes are the eigenvectors of the covariance of the vertices (principal component analysis), the box
+	/// is not the smallest one but is found in two passes over the positions.
+	static OrientedBox ComputeOrientedBoundingBox(const PositionBuffers& positions);
+
+	/// @brief Compute every measure of the geometry of the mesh.
+	/// @see Mesh::GetGeometryMeasures for a cached version.
+	static GeometryMeasures ComputeMeasures(const Data::Surface::Mesh& mesh);
+
+	/// @brief Apply an affine transform to the positions of the vertices.
+	/// @param mesh The mesh, its cached position buffers are replaced by the transformed ones.
+	/// @param transform Affine transform, its projective row is ignored.
+	/// @param transformNormals Whether to transform the normals stored as extra data as well (triangle normals and
+	/// smooth and flat vertex normals), by the inverse transpose of the linear part. Each normal keeps its length.
+	static void Transform(
+		Data::Surface::Mesh& mesh, const Core::BaseType::Mat4& transform, bool transformNormals = false);
+
+	/// @brief Rotate the positions of the vertices around the origin.
+	/// @see Transform.
+	static void Transform(
+		Data::Surface::Mesh& mesh, const Core::BaseType::Quat& rotation, bool transformNormals = false);
+};
+} // namespace Utilitary::Surface
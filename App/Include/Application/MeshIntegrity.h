@@ -2,7 +2,10 @@
 
 #include "Application/Mesh.h"
 
+#include <array>
 #include <cstdint>
+#include <string>
+#include <vector>
 
 namespace Utilitary::Surface
 {
@@ -22,11 +25,57 @@ struct MeshIntegrity
 		InvalidVertexIndex,
 		InvalidIncidentTriangleIndex,
 		InvalidNeighborTriangleIndex,
+		/// @brief The triangle has an edge shared by more than two triangles.
+		NonManifoldEdge,
+		/// @brief The triangle and one of its neighbors run through their common edge in the same direction.
+		InconsistentOrientation,
+		/// @brief The triangles around the vertex form several fans (bowtie), they are not all reached from its
+		/// incident triangle.
+		NonManifoldVertex,
+	};
+
+	/// @brief Number of exit codes, MeshOK included.
+	static constexpr size_t ExitCodeCount = static_cast<size_t>(ExitCode::NonManifoldVertex) + 1;
+
+	/// @brief Every violation found in a mesh.
+	/// @note The Vertex* codes and NonManifoldVertex report vertices, the other ones report triangles. An element is
+	/// counted once per exit code.
+	struct Report
+	{
+		/// @brief Number of elements violating each exit code.
+		std::array<uint64_t, ExitCodeCount> Counts{};
+		/// @brief Sorted indices of the violating elements for each exit code, truncated to the lowest ones.
+		std::array<std::vector<uint32_t>, ExitCodeCount> Elements{};
+
+		/// @brief True if no violation was found.
+		bool IsValid() const;
+
+		/// @brief Number of elements violating the exit code.
+		uint64_t GetCount(ExitCode code) const { return Counts[static_cast<size_t>(code)]; }
+
+		/// @brief Indices of the elements violating the exit code.
+		const std::vector<uint32_t>& GetElements(ExitCode code) const { return Elements[static_cast<size_t>(code)]; }
+
+		/// @brief One line per violated exit code with its count and first elements.
+		std::string ToString() const;
 	};
 
 	/// @brief Check the integrity of the mesh.
 	/// @param mesh The mesh to check.
 	/// @return ExitCode indicating the result of the integrity check.
+	/// @note Fast mode: the vertices then the triangles are checked in parallel and the check stops at the first
+	/// violation. The manifoldness and orientation checks are only run by BuildReport.
+	/// @note The result does not depend on the number of threads, the violation of the lowest element is returned.
 	static ExitCode CheckIntegrity(const Data::Surface::Mesh& mesh);
+
+	/// @brief Check the whole mesh in parallel and gather every violation.
+	/// @param mesh The mesh to check.
+	/// @param checkTopology Also check the manifoldness of the edges and vertices and the orientation consistency.
+	/// @param maxElementsPerCode Maximal number of element indices kept for each exit code, the counts are exact.
+	static Report BuildReport(
+		const Data::Surface::Mesh& mesh, bool checkTopology = true, size_t maxElementsPerCode = 1000);
+
+	/// @brief Name of an exit code.
+	static const char* GetExitCodeName(ExitCode code);
 };
 } // namespace Utilitary::Surface
@@ -1,7 +1,9 @@
 #pragma once
 
 #include "Application/Mesh.h"
+#include "Core/JobSystem.h"
 
+#include <cstdint>
 #include <filesystem>
 
 namespace Utilitary::Surface
@@ -9,16 +11,28 @@ namespace Utilitary::Surface
 /// @brief Struct for loading meshes from files.
 struct MeshLoader
 {
+	/// @brief Number of records (lines) read between two checks of the progress and of the cancellation.
+	static constexpr uint32_t RecordsPerCheck = 1 << 16;
+
 	/// @brief Load mesh from an OFF file.
 	/// @param filepath Path to the OFF file.
+	/// @param progress Called with the fraction of the file read, then with 1 once the connectivity is built.
+	/// @param cancellation Token checked along the reading, see LoadOBJ.
 	/// @note This function assumes the file is in OFF format.
-	/// @return Pointer to the loaded mesh, or nullptr if loading failed.
-	static std::unique_ptr<Data::Surface::Mesh> LoadOFF(const std::filesystem::path& filepath);
+	/// @return Pointer to the loaded mesh, or nullptr if loading failed or was cancelled.
+	static std::unique_ptr<Data::Surface::Mesh> LoadOFF(const std::filesystem::path& filepath,
+		const Core::Parallel::ProgressCallback& progress = {},
+		const Core::Parallel::CancellationToken& cancellation = {});
 
 	/// @brief Load mesh from an OBJ file.
 	/// @param filepath Path to the OBJ file.
+	/// @param progress Called with the fraction of the file read, then with 1 once the connectivity is built.
+	/// @param cancellation Token checked every RecordsPerCheck records and before the connectivity, to run the loading
+	/// as a background job (see Core::Parallel::JobSystem).
 	/// @note This function assumes the file is in OBJ format.
-	/// @return Pointer to the loaded mesh, or nullptr if loading failed.
-	static std::unique_ptr<Data::Surface::Mesh> LoadOBJ(const std::filesystem::path& filepath);
+	/// @return Pointer to the loaded mesh, or nullptr if loading failed or was cancelled.
+	static std::unique_ptr<Data::Surface::Mesh> LoadOBJ(const std::filesystem::path& filepath,
+		const Core::Parallel::ProgressCallback& progress = {},
+		const Core::Parallel::CancellationToken& cancellation = {});
 };
 } // namespace Utilitary::Surface
@@ -0,0 +1,110 @@
+#pragma once
+
+#include "Application/Mesh.h"
+#include "Core/BaseTypes.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+
+namespace Utilitary::Surface
+{
+/// @brief Vertex of the interleaved stream sent to the GPU, 32 bytes.
+struct PackedVertex
+{
+	/// @brief Position of the vertex.
+	Core::BaseType::Vec3 Position{ 0.f };
+	/// @brief Normal of the corners sharing the vertex.
+	Core::BaseType::Vec3 Normal{ 0.f };
+	/// @brief Texture coordinates of the corners sharing the vertex.
+	Core::BaseType::Vec2 TexCoords{ 0.f };
+};
+static_assert(sizeof(PackedVertex) == 32, "The packed vertices must match the layout of the vertex attributes");
+
+/// @brief Normal written in the packed vertices.
+enum struct PackedNormalSource : uint8_t
+{
+	/// @brief The smooth normal of the vertex (SmoothVertexNormalExtraData), the corners never split on it.
+	SmoothVertex,
+	/// @brief The normal of the triangle (TriangleNormalExtraData), the corners split on the creases.
+	Triangle,
+};
+
+/// @brief Type of the indices of the packed triangles.
+enum struct PackedIndexFormat : uint8_t
+{
+	/// @brief 16-bit indices, for up to 65536 packed vertices.
+	UInt16,
+	/// @brief 32-bit indices.
+	UInt32,
+};
+
+/// @brief Packed vertices of a mesh and the packed vertex of each corner, see MeshPacker::ComputeLayout.
+struct PackedMeshLayout
+{
+	/// @brief Normal written in the packed vertices.
+	PackedNormalSource NormalSource = PackedNormalSource::SmoothVertex;
+	/// @brief Corner (3 * triangle + local index) giving the attributes of each packed vertex.
+	std::vector<uint32_t> SourceCorners{};
+	/// @brief Packed vertex of each corner of the live triangles, three per triangle in the order of the triangles.
+	std::vector<uint32_t> Indices{};
+
+	/// @brief Get the number of packed vertices.
+	uint32_t GetVertexCount() const { return static_cast<uint32_t>(SourceCorners.size()); }
+
+	/// @brief Get the number of indices, three per live triangle.
+	uint32_t GetIndexCount() const { return static_cast<uint32_t>(Indices.size()); }
+
+	/// @brief Get the smallest index type fitting the packed vertices.
+	PackedIndexFormat GetIndexFormat() const
+	{
+		return SourceCorners.size() <= size_t{ std::numeric_limits<uint16_t>::max() } + 1 ? PackedIndexFormat::UInt16
+																						   : PackedIndexFormat::UInt32;
+	}
+
+	/// @brief Get the size in bytes of the vertex buffer.
+	size_t GetVertexBufferSize() const { return SourceCorners.size() * sizeof(PackedVertex); }
+
+	/// @brief Get the size in bytes of the index buffer, in the format given by GetIndexFormat.
+	size_t GetIndexBufferSize() const
+	{
+		return Indices.size() * (GetIndexFormat() == PackedIndexFormat::UInt16 ? sizeof(uint16_t) : sizeof(uint32_t));
+	}
+};
+
+/// @brief Struct to pack meshes into interleaved, indexed vertex streams for the GPU.
+/// @note The packing runs in two steps: ComputeLayout finds the packed vertices, so that the caller can allocate (or
+/// map) the GPU buffers, then PackVertices and PackIndices write straight into them, without intermediate copy.
+struct MeshPacker
+{
+	/// @brief Find the packed vertices of the mesh.
+	/// @param mesh The mesh to pack, the extra data holding the normals and texture coordinates are optional (the
+	/// missing ones are written as zero).
+	/// @param normalSource Normal written in the packed vertices.
+	/// @note A vertex is split only where its corners have different normals or texture coordinates (from
+	/// VerticesTexCoordsExtraData): the corners around each vertex are deduplicated by the hash of their attributes.
+	/// The packed vertices follow the order of the vertices, the split ones being consecutive. The vertices run in
+	/// parallel, and the layout does not depend on the number of threads.
+	static PackedMeshLayout ComputeLayout(
+		const Data::Surface::Mesh& mesh, PackedNormalSource normalSource = PackedNormalSource::SmoothVertex);
+
+	/// @brief Write the packed vertices, in parallel.
+	/// @param mesh The mesh given to ComputeLayout, unchanged since.
+	/// @param layout The layout of the mesh.
+	/// @param vertices The destination, such as a mapped GPU buffer, of at least layout.GetVertexCount() vertices.
+	static void PackVertices(
+		const Data::Surface::Mesh& mesh, const PackedMeshLayout& layout, std::span<PackedVertex> vertices);
+
+	/// @brief Write the 16-bit indices, in parallel.
+	/// @param layout The layout, whose index format must be UInt16.
+	/// @param indices The destination, of at least layout.GetIndexCount() indices.
+	static void PackIndices(const PackedMeshLayout& layout, std::span<uint16_t> indices);
+
+	/// @brief Write the 32-bit indices, in parallel.
+	/// @param layout The layout of the mesh, of any index format.
+	/// @param indices The destination, of at least layout.GetIndexCount() indices.
+	static void PackIndices(const PackedMeshLayout& layout, std::span<uint32_t> indices);
+};
+} // namespace Utilitary::Surface
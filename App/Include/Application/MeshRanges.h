@@ -0,0 +1,191 @@
+#pragma once
+
+#include "Application/Primitive.h"
+#include "Core/BaseTypes.h"
+
+#include <cstddef>
+#include <iterator>
+#include <ranges>
+
+namespace Data::Surface
+{
+/// @brief Elements visited by a one-ring iterator.
+enum struct OneRingElement : uint8_t
+{
+	/// @brief The vertices adjacent to the central vertex.
+	Vertex,
+	/// @brief The triangles incident to the central vertex.
+	Triangle,
+};
+
+/// @brief Forward iterator over the one-ring of a vertex, ended by std::default_sentinel.
+/// @note The fan is walked counter-clockwise from the incident triangle of the vertex. If a boundary is reached, the
+/// walk jumps back to the incident triangle and goes on clockwise, so no triangle is visited twice. Starting from the
+/// first triangle of the fan (see Mesh::UpdateBoundaryIncidentTriangles), the walk never jumps back.
+/// @note The iterator keeps the local index of the central vertex in the current triangle, a step reads the neighbor
+/// from the IndexHelpers tables and matches the vertex in it without branching.
+template<OneRingElement Element>
+class OneRingIterator
+{
+public:
+	using iterator_concept = std::forward_iterator_tag;
+	using iterator_category = std::forward_iterator_tag;
+	using value_type = uint32_t;
+	using difference_type = std::ptrdiff_t;
+
+public:
+	/// @brief Default ctor, the iterator is at the end of its range.
+	OneRingIterator() = default;
+
+	/// @brief Construct an iterator at the beginning of the one-ring of a vertex.
+	/// @param triangles Triangles of the mesh.
+	/// @param vertexIdx Index of the central vertex.
+	/// @param startTriangleIdx Triangle incident to the central vertex, -1 for an empty one-ring.
+	OneRingIterator(
+		const Data::Primitive::Triangle* triangles,
+		const Core::BaseType::VertexIndex vertexIdx,
+		const int startTriangleIdx)
+		: m_Triangles(triangles)
+		, m_VertexIdx(static_cast<int>(vertexIdx))
+		, m_StartTriangleIdx(startTriangleIdx)
+		, m_CurTriangleIdx(startTriangleIdx)
+	{
+		if(startTriangleIdx != -1)
+			m_CurLocalIdx = m_StartLocalIdx = GetLocalIndex(startTriangleIdx);
+	}
+
+	/// @brief Dereference operator to get the current vertex or triangle index.
+	value_type operator*() const
+	{
+		if constexpr(Element == OneRingElement::Vertex)
+		{
+			// The vertex shared with the next triangle of the walk.
+			const auto& localIndices = m_IsInCCWOrder ? IndexHelpers::Previous : IndexHelpers::Next;
+			return static_cast<value_type>(m_Triangles[m_CurTriangleIdx].Vertices[localIndices[m_CurLocalIdx]]);
+		}
+		else
+			return static_cast<value_type>(m_CurTriangleIdx);
+	}
+
+	/// @brief Pre-increment operator.
+	OneRingIterator& operator++()
+	{
+		const Data::Primitive::Triangle& curTriangle = m_Triangles[m_CurTriangleIdx];
+		if(m_IsInCCWOrder)
+		{
+			const int neighborIdx = curTriangle.Neighbors[IndexHelpers::Next[m_CurLocalIdx]];
+			if(neighborIdx == m_StartTriangleIdx)
+				m_CurTriangleIdx = -1; // The one-ring is closed.
+			else if(neighborIdx != -1)
+				MoveTo(neighborIdx);
+			else
+			{
+				// The boundary is reached, go on clockwise from the start triangle.
+				m_IsInCCWOrder = false;
+				m_CurLocalIdx = m_StartLocalIdx;
+				if constexpr(Element == OneRingElement::Vertex)
+					m_CurTriangleIdx = m_StartTriangleIdx; // Its other vertex on the walk comes next.
+				else
+					MoveToClockwiseNeighbor(m_Triangles[m_StartTriangleIdx]);
+			}
+		}
+		else
+			MoveToClockwiseNeighbor(curTriangle);
+		return *this;
+	}
+
+	/// @brief Post-increment operator.
+	OneRingIterator operator++(int)
+	{
+		OneRingIterator copy = *this;
+		++*this;
+		return copy;
+	}
+
+	/// @brief Equality operator, between iterators over the same one-ring.
+	bool operator==(const OneRingIterator& rhs) const
+	{
+		return m_CurTriangleIdx == rhs.m_CurTriangleIdx
+			   && (m_CurTriangleIdx == -1 || m_IsInCCWOrder == rhs.m_IsInCCWOrder);
+	}
+
+	/// @brief Check whether the iterator reached the end of its range.
+	bool operator==(std::default_sentinel_t) const { return m_CurTriangleIdx == -1; }
+
+private:
+	/// @brief Local index of the central vertex in a triangle containing it.
+	uint8_t GetLocalIndex(const int triangleIdx) const
+	{
+		const auto& vertices = m_Triangles[triangleIdx].Vertices;
+		return static_cast<uint8_t>((vertices[1] == m_VertexIdx) + 2 * (vertices[2] == m_VertexIdx));
+	}
+
+	/// @brief Move to a triangle containing the central vertex.
+	void MoveTo(const int triangleIdx)
+	{
+		m_CurTriangleIdx = triangleIdx;
+		m_CurLocalIdx = GetLocalIndex(triangleIdx);
+	}
+
+	/// @brief Move across the edge leaving the central vertex, the walk ends on a boundary.
+	void MoveToClockwiseNeighbor(const Data::Primitive::Triangle& triangle)
+	{
+		const int neighborIdx = triangle.Neighbors[IndexHelpers::Previous[m_CurLocalIdx]];
+		if(neighborIdx == -1)
+			m_CurTriangleIdx = -1;
+		else
+			MoveTo(neighborIdx);
+	}
+
+private:
+	/// @brief Triangles of the mesh.
+	const Data::Primitive::Triangle* m_Triangles{ nullptr };
+	/// @brief Index of the central vertex.
+	int m_VertexIdx{ -1 };
+	/// @brief Triangle the walk started from.
+	int m_StartTriangleIdx{ -1 };
+	/// @brief Current triangle, -1 at the end of the walk.
+	int m_CurTriangleIdx{ -1 };
+	/// @brief Local index of the central vertex in the start triangle.
+	uint8_t m_StartLocalIdx{ 0 };
+	/// @brief Local index of the central vertex in the current triangle.
+	uint8_t m_CurLocalIdx{ 0 };
+	/// @brief Whether the walk is still going counter-clockwise.
+	bool m_IsInCCWOrder{ true };
+};
+
+/// @brief View over the one-ring of a vertex, usable with the std::ranges algorithms and views.
+/// @note The view only refers to the triangles of the mesh, it is invalidated by any change of the connectivity.
+template<OneRingElement Element>
+class OneRingView : public std::ranges::view_interface<OneRingView<Element>>
+{
+public:
+	/// @brief Default ctor, the view is empty.
+	OneRingView() = default;
+
+	/// @brief Construct a view over the one-ring of a vertex, see OneRingIterator.
+	OneRingView(
+		const Data::Primitive::Triangle* triangles,
+		const Core::BaseType::VertexIndex vertexIdx,
+		const int startTriangleIdx)
+		: m_Begin(triangles, vertexIdx, startTriangleIdx)
+	{}
+
+	/// @brief Get the begin iterator.
+	OneRingIterator<Element> begin() const { return m_Begin; }
+	/// @brief Get the end sentinel.
+	std::default_sentinel_t end() const { return std::default_sentinel; }
+
+private:
+	/// @brief Iterator at the beginning of the one-ring.
+	OneRingIterator<Element> m_Begin{};
+};
+
+/// @brief View over the vertices adjacent to a vertex.
+using VerticesAroundVertexView = OneRingView<OneRingElement::Vertex>;
+/// @brief View over the triangles incident to a vertex.
+using TrianglesAroundVertexView = OneRingView<OneRingElement::Triangle>;
+} // namespace Data::Surface
+
+template<Data::Surface::OneRingElement Element>
+inline constexpr bool std::ranges::enable_borrowed_range<Data::Surface::OneRingView<Element>> = true;
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "Application/Mesh.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace Utilitary::Surface
+{
+/// @brief Parameters driving the isotropic remeshing of a mesh.
+struct RemeshingSpecification
+{
+	/// @brief Target edge length, used for every vertex when no sizing field is given.
+	float TargetEdgeLength{ 1.f };
+	/// @brief Optional target edge length of each vertex of the input mesh (sizing field).
+	/// @note When empty, TargetEdgeLength is used everywhere. The sizing of the vertices created by the remeshing is
+	/// interpolated from the endpoints of the split edges.
+	std::vector<float> SizingField{};
+	/// @brief Number of split / collapse / flip / relax iterations.
+	uint32_t IterationCount{ 10 };
+};
+
+/// @brief Struct to remesh surfaces.
+struct MeshRemesher
+{
+	/// @brief Isotropic remeshing (Botsch & Kobbelt) towards the target edge length.
+	/// @param mesh The mesh to remesh, its connectivity must be up to date.
+	/// @param specification Parameters of the remeshing.
+	/// @note Each iteration splits the edges longer than 4/3 of the target length, collapses the ones shorter than
+	/// 4/5 of it, flips edges to equalize the valences and finally relaxes the vertices in their tangent plane.
+	/// @note The edits use the local operators of the mesh, the removed elements are deleted and recycled by the next
+	/// splits, and the mesh is only garbage collected once at the end.
+	/// @note Boundary vertices are never moved nor removed, and the extra data containers are cleared.
+	static void RemeshIsotropic(Data::Surface::Mesh& mesh, const RemeshingSpecification& specification);
+};
+} // namespace Utilitary::Surface
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "Application/Mesh.h"
+
+#include <array>
+#include <cstdint>
+
+namespace Utilitary::Surface
+{
+/// @brief Space filling curves used to sort the vertices.
+enum struct SpaceFillingCurve : uint8_t
+{
+	/// @brief Z-order curve, cheaper to evaluate but with jumps between the octants.
+	Morton,
+	/// @brief Hilbert curve, consecutive keys are always adjacent cells of the grid.
+	Hilbert,
+};
+
+/// @brief Struct to reorder the elements of a mesh for memory locality.
+/// @note The reorderings only permute the elements: every index (vertices, neighbors, incident triangles) is remapped
+/// and the extra data follow their element. Deleted elements are garbage collected first.
+struct MeshReorderer
+{
+	/// @brief Number of bits of the quantized coordinates given to ComputeCurveKey, the keys fit in 63 bits.
+	static constexpr uint32_t CurveBitsPerAxis = 21;
+
+	/// @brief Get the index along a space filling curve of a cell of the 2^21 grid per axis.
+	/// @param coords The quantized coordinates of the cell, below 2^CurveBitsPerAxis.
+	/// @param curve The space filling curve to follow.
+	/// @note Both curves are hierarchical: the 3 * k highest bits of the key give the cell of the 2^k grid.
+	static uint64_t ComputeCurveKey(const std::array<uint32_t, 3>& coords, SpaceFillingCurve curve);
+
+	/// @brief Sort the vertices along a space filling curve through their bounding box.
+	/// @param mesh The mesh whose vertices are reordered.
+	/// @param curve The space filling curve to follow.
+	/// @note The positions are quantized on a 2^21 grid per axis, the keys are computed in parallel.
+	static void ReorderVertices(Data::Surface::Mesh& mesh, SpaceFillingCurve curve = SpaceFillingCurve::Hilbert);
+
+	/// @brief Order the triangles with Forsyth's linear-speed vertex cache optimization.
+	/// @param mesh The mesh whose triangles are reordered, its connectivity must be up to date.
+	/// @param cacheSize Size of the simulated LRU vertex cache.
+	/// @note Consecutive triangles share their vertices as much as possible, which also keeps the triangles around a
+	/// vertex close in memory.
+	static void ReorderTriangles(Data::Surface::Mesh& mesh, uint32_t cacheSize = 32);
+
+	/// @brief Sort the vertices along the curve, then order the triangles for the vertex cache.
+	static void Reorder(
+		Data::Surface::Mesh& mesh, SpaceFillingCurve curve = SpaceFillingCurve::Hilbert, uint32_t cacheSize = 32);
+
+	/// @brief Average number of vertex cache misses per triangle (ACMR) of the triangle order.
+	/// @param mesh The mesh to evaluate.
+	/// @param cacheSize Size of the simulated FIFO vertex cache.
+	/// @return A value between 0.5 (ideal order on large meshes) and 3 (no vertex reuse at all).
+	static float ComputeACMR(const Data::Surface::Mesh& mesh, uint32_t cacheSize = 32);
+};
+} // namespace Utilitary::Surface
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "Application/Mesh.h"
+
+#include <cstdint>
+
+namespace Utilitary::Surface
+{
+/// @brief Parameters driving the repair of a mesh.
+struct RepairSpecification
+{
+	/// @brief Triangles whose area is lower or equal to this value are removed.
+	float MinTriangleArea{ 0.f };
+	/// @brief Flip triangles so that neighbors run through their common edges in opposite directions.
+	/// @note Closed components are oriented outwards, the other ones keep the orientation of most of their triangles.
+	bool FixOrientation{ true };
+	/// @brief Holes bounded by at most this number of edges are filled, 0 disables the hole filling.
+	uint32_t MaxHoleEdgeCount{ 32 };
+};
+
+/// @brief What the repair changed in the mesh.
+struct RepairSummary
+{
+	/// @brief Triangles removed because of a missing or out of range vertex, or a vertex used twice.
+	uint32_t InvalidTriangleCount{ 0 };
+	/// @brief Triangles removed because of an area lower than the threshold.
+	uint32_t DegenerateTriangleCount{ 0 };
+	/// @brief Triangles removed because another triangle has the same vertices.
+	uint32_t DuplicatedTriangleCount{ 0 };
+	/// @brief Triangles whose orientation has been reversed.
+	uint32_t FlippedTriangleCount{ 0 };
+	/// @brief Vertices added to split the non-manifold vertices, one per extra fan.
+	uint32_t SplitVertexCount{ 0 };
+	/// @brief Vertices removed because no triangle uses them.
+	uint32_t UnreferencedVertexCount{ 0 };
+	/// @brief Holes filled.
+	uint32_t FilledHoleCount{ 0 };
+	/// @brief Triangles added to fill the holes.
+	uint32_t FillTriangleCount{ 0 };
+};
+
+/// @brief Struct to repair broken meshes.
+struct MeshRepairer
+{
+	/// @brief Repair the mesh so that it passes MeshIntegrity::CheckIntegrity and the circulators can walk it.
+	/// @param mesh The mesh to repair, its neighbors and incident triangles are ignored and rebuilt.
+	/// @param specification Parameters of the repair.
+	/// @return What the repair changed in the mesh.
+	/// @note The pipeline removes the invalid, degenerate and duplicated triangles, makes the orientation consistent
+	/// in each connected component, splits the non-manifold vertices into one vertex per fan, fills the small holes
+	/// with a minimum area triangulation and finally removes the unreferenced vertices.
+	/// @note Edges shared by more than two triangles, or by two triangles which cannot be oriented consistently
+	/// (Mobius strip), are cut and become boundaries.
+	/// @note The per-element phases run in parallel, as well as the hole filling of the components. The orientation
+	/// propagates through each component in a serial breadth-first traversal, only the choice of the side each
+	/// component faces runs in parallel.
+	/// @note The elements are rebuilt, so the deleted elements are removed and the extra data containers are cleared.
+	static RepairSummary Repair(
+		Data::Surface::Mesh& mesh, const RepairSpecification& specification = RepairSpecification());
+};
+} // namespace Utilitary::Surface
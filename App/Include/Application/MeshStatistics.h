@@ -0,0 +1,46 @@
+#pragma once
+
+#include "Application/Mesh.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace Utilitary::Surface
+{
+/// @brief Statistics of the one-ring neighborhood of each vertex, stored as dense arrays indexed by vertex.
+/// @note The deleted and isolated vertices have null statistics.
+struct OneRingStatistics
+{
+	/// @brief Number of edges incident to each vertex.
+	std::vector<uint32_t> Valences{};
+	/// @brief Number of triangles incident to each vertex.
+	std::vector<uint32_t> TriangleCounts{};
+	/// @brief Sum of the areas of the triangles incident to each vertex.
+	std::vector<float> Areas{};
+	/// @brief Sum of the corner angles at each vertex, in radians.
+	std::vector<float> AngleSums{};
+
+	/// @brief Check whether a vertex lies on a boundary, a manifold vertex having as many edges as triangles when its
+	/// one-ring is closed.
+	bool IsBoundaryVertex(const Core::BaseType::VertexIndex index) const
+	{
+		return Valences[index] != TriangleCounts[index];
+	}
+
+	/// @brief Angle defect of a vertex (2 pi minus its angle sum, pi on the boundary), the discrete Gaussian curvature
+	/// integrated over its one-ring.
+	float GetAngleDefect(const Core::BaseType::VertexIndex index) const;
+};
+
+/// @brief Struct to compute statistics over meshes.
+struct MeshStatistics
+{
+	/// @brief Compute the one-ring statistics of every vertex in a single pass over the triangles.
+	/// @param mesh The mesh, its neighbors must be up to date for the valences.
+	/// @note Each triangle scatters its corners into the arrays without circulating around the vertices. The triangles
+	/// are split in one range per thread, each range accumulating into its own arrays (only spanning the vertices it
+	/// references), which are then reduced in parallel over the vertices.
+	/// @note The valences and triangle counts do not depend on the number of threads, the sums only up to rounding.
+	static OneRingStatistics ComputeOneRingStatistics(const Data::Surface::Mesh& mesh);
+};
+} // namespace Utilitary::Surface
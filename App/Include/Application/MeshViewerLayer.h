@@ -0,0 +1,158 @@
+#pragma once
+
+#include "Application/Mesh.h"
+#include "Application/MeshClusters.h"
+#include "Application/MeshGeometry.h"
+#include "Application/MeshPacker.h"
+#include "Core/BaseTypes.h"
+#include "Core/ConcurrentQueue.h"
+#include "Core/JobSystem.h"
+#include "Core/Layer.h"
+#include "Core/Renderer/Renderer.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+namespace Application
+{
+/// @brief Layer drawing a mesh split into clusters, culled and selected by level of detail on the CPU every frame.
+/// @note Each level of the cluster hierarchy (see Utilitary::Surface::MeshClusters) is packed once into its own
+/// vertex and index buffers, the indices in the order of the clusters. The visible clusters of each level are then
+/// drawn with a single glMultiDrawElements call.
+/// Loading a file, building the hierarchy and packing the levels run in a background job. The prepared mesh is handed
+/// to the render thread through a lock-free queue, then uploaded over several frames within a budget, the previous mesh
+/// being displayed until the upload completes.
+class MeshViewerLayer : public Core::Layer
+{
+public:
+	/// @brief Create the layer, displaying a generated terrain.
+	MeshViewerLayer();
+	/// @brief Free the GPU resources.
+	virtual ~MeshViewerLayer();
+
+	/// @brief Display a mesh in place of the current one.
+	/// @param mesh The mesh to display, its connectivity must be up to date.
+	/// @note The clusters and the levels of detail are built, and the buffers uploaded, before returning.
+	void SetMesh(std::unique_ptr<Data::Surface::Mesh> mesh);
+
+	/// @brief Load an OBJ or OFF file in the background, displayed once prepared and uploaded.
+	/// @note The load in progress, if any, is cancelled.
+	void LoadMesh(const std::filesystem::path& filepath);
+
+	/// @brief Override from Layer
+	virtual void OnRender() override;
+	/// @brief Override from Layer
+	virtual std::string_view GetName() const override { return "MeshViewerLayer"; }
+
+private:
+	/// @brief GPU buffers of a level of detail, the indices following the order of the clusters.
+	struct LevelBuffers
+	{
+		uint32_t VertexArray = 0;
+		uint32_t VertexBuffer = 0;
+		uint32_t IndexBuffer = 0;
+	};
+
+	/// @brief Level of detail packed on a worker, uploaded piece by piece by the render thread.
+	struct PreparedLevel
+	{
+		std::vector<Utilitary::Surface::PackedVertex> Vertices{};
+		/// @brief Indices in the order of the clusters.
+		std::vector<uint32_t> Indices{};
+		/// @brief Buffers, allocated at the start of the upload.
+		LevelBuffers Buffers{};
+		/// @brief Bytes of the vertices and of the indices already uploaded.
+		size_t UploadedVertexSize = 0;
+		size_t UploadedIndexSize = 0;
+	};
+
+	/// @brief Mesh with its cluster hierarchy and its packed levels, ready for the upload.
+	struct PreparedMesh
+	{
+		std::unique_ptr<Data::Surface::Mesh> Mesh{};
+		Utilitary::Surface::ClusterHierarchy Hierarchy{};
+		std::vector<PreparedLevel> Levels{};
+		Utilitary::Surface::AxisAlignedBox BoundingBox{};
+		/// @brief Number of levels whose upload is complete.
+		size_t UploadedLevelCount = 0;
+	};
+
+	/// @brief Build the cluster hierarchy of a mesh and pack its levels, on any thread.
+	/// @param mesh The mesh to prepare, its connectivity must be up to date.
+	/// @return The prepared mesh, nullptr if cancelled.
+	static std::unique_ptr<PreparedMesh> PrepareMesh(std::unique_ptr<Data::Surface::Mesh> mesh,
+		const Core::Parallel::CancellationToken& cancellation,
+		const Core::Parallel::ProgressCallback& progress);
+	/// @brief Take the meshes prepared by the jobs, the last one replacing the mesh being uploaded.
+	void ReceivePreparedMeshes();
+	/// @brief Upload the next pieces of the pending mesh, then display it once complete.
+	/// @param budget Maximum number of bytes to upload.
+	void UploadPendingMesh(size_t budget);
+	/// @brief Display the uploaded pending mesh, the previous one being freed by a job.
+	void SwapPendingMesh();
+	/// @brief Free the buffers of a level.
+	static void ReleaseBuffers(const LevelBuffers& buffers);
+	/// @brief Free the mesh being uploaded and its buffers.
+	void ReleasePendingMesh();
+	/// @brief Free the buffers of the levels.
+	void ReleaseLevels();
+	/// @brief Resize the render targets to the viewport, if needed.
+	void ResizeTargets(uint32_t width, uint32_t height);
+	/// @brief Draw the visible clusters into the render targets.
+	void DrawClusters(uint32_t width, uint32_t height);
+
+private:
+	/// @brief Displayed mesh, the first level of the hierarchy.
+	std::unique_ptr<Data::Surface::Mesh> m_Mesh{};
+	/// @brief Clusters of the mesh and of its levels of detail.
+	Utilitary::Surface::ClusterHierarchy m_Hierarchy{};
+	/// @brief Buffers of each level.
+	std::vector<LevelBuffers> m_Levels{};
+	/// @brief Mesh being uploaded, displayed once complete.
+	std::unique_ptr<PreparedMesh> m_PendingMesh{};
+
+	uint32_t m_Shader = 0;
+	Renderer::Texture m_ColorTexture{};
+	Renderer::Framebuffer m_Framebuffer{};
+	uint32_t m_DepthBuffer = 0;
+
+	/// @brief Orbit camera around the center of the mesh, Z up.
+	Core::BaseType::Vec3 m_Target{ 0.f };
+	float m_SceneRadius = 1.f;
+	float m_Distance = 3.f;
+	float m_Yaw = 0.8f;
+	float m_Pitch = 0.6f;
+
+	/// @brief Settings of the selection.
+	float m_MaxScreenError = 1.f;
+	bool m_FrustumCulling = true;
+	bool m_BackfaceCulling = true;
+	bool m_FreezeSelection = false;
+	bool m_ShowClusters = false;
+
+	/// @brief View of the last selection, kept while it is frozen.
+	Utilitary::Surface::ClusterView m_SelectionView{};
+	/// @brief Clusters drawn in the last frame.
+	Utilitary::Surface::ClusterSelection m_Selection{};
+	/// @brief Time spent in the last selection, in milliseconds.
+	float m_SelectionTime = 0.f;
+	/// @brief Arguments of the draw calls of a level, kept between the frames.
+	std::vector<GLsizei> m_DrawCounts{};
+	std::vector<const void*> m_DrawOffsets{};
+
+	/// @brief Path typed in the panel.
+	std::array<char, 512> m_PathInput{};
+	/// @brief Last loading job, followed by the panel.
+	std::shared_ptr<Core::Parallel::Job> m_LoadJob{};
+	/// @brief Meshes prepared by the jobs, waiting for the render thread.
+	Core::Parallel::ConcurrentQueue<std::unique_ptr<PreparedMesh>> m_PreparedMeshes{ 4 };
+	/// @brief Workers of the loadings, one per core but the render thread's and at least two, so that freeing a mesh
+	/// never waits behind a loading. Declared last so that the jobs stop before the other members are destroyed.
+	Core::Parallel::JobSystem m_Jobs;
+};
+} // namespace Application
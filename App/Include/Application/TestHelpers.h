@@ -4,6 +4,12 @@
 #include "Application/Mesh.h"
 #include "Application/PrimitiveProxy.h"
 
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <random>
+#include <vector>
+
 namespace TestHelpers
 {
 /// @brief Create a valid mesh with 4 vertices and 2 faces, and add extra data to vertices.
@@ -102,4 +108,99 @@ inline Data::Surface::Mesh CreateGridMesh(int nRow = 1, int nCol = 1)
 
 	return mesh;
 }
+
+/// @brief Create a closed torus mesh with nMajor*nMinor vertices and 2*nMajor*nMinor faces.
+/// @param nMajor Number of subdivisions around the main axis (at least 3).
+/// @param nMinor Number of subdivisions around the tube (at least 3).
+inline Data::Surface::Mesh CreateTorusMesh(
+	int nMajor = 16, int nMinor = 8, float majorRadius = 2.f, float minorRadius = 0.5f)
+{
+	Data::Surface::Mesh mesh;
+
+	constexpr float twoPi = 6.28318530718f;
+	for(int iMajor = 0; iMajor < nMajor; ++iMajor)
+	{
+		const float theta = twoPi * static_cast<float>(iMajor) / static_cast<float>(nMajor);
+		for(int iMinor = 0; iMinor < nMinor; ++iMinor)
+		{
+			const float phi = twoPi * static_cast<float>(iMinor) / static_cast<float>(nMinor);
+			const float ringRadius = majorRadius + minorRadius * std::cos(phi);
+			mesh.AddVertex({ .Position = { ringRadius * std::cos(theta),
+										   ringRadius * std::sin(theta),
+										   minorRadius * std::sin(phi) } });
+		}
+	}
+
+	for(int iMajor = 0; iMajor < nMajor; ++iMajor)
+	{
+		const int nextMajor = (iMajor + 1) % nMajor;
+		for(int iMinor = 0; iMinor < nMinor; ++iMinor)
+		{
+			const int nextMinor = (iMinor + 1) % nMinor;
+			const int v00 = iMajor * nMinor + iMinor;
+			const int v10 = nextMajor * nMinor + iMinor;
+			const int v11 = nextMajor * nMinor + nextMinor;
+			const int v01 = iMajor * nMinor + nextMinor;
+			mesh.AddTriangle({ .Vertices = { v00, v10, v11 } });
+			mesh.AddTriangle({ .Vertices = { v00, v11, v01 } });
+		}
+	}
+
+	// Update mesh connectivity (neighbors and incident faces)
+	mesh.UpdateMeshConnectivity();
+
+	return mesh;
+}
+
+/// @brief Create a bowtie: two triangles only sharing their first vertex, which is non-manifold.
+inline Data::Surface::Mesh CreateBowtieMesh()
+{
+	Data::Surface::Mesh mesh;
+
+	mesh.AddVertex({ .Position = { 0., 0., 0. } });
+	mesh.AddVertex({ .Position = { 1., 0., 0. } });
+	mesh.AddVertex({ .Position = { 1., 1., 0. } });
+	mesh.AddVertex({ .Position = { -1., 0., 0. } });
+	mesh.AddVertex({ .Position = { -1., -1., 0. } });
+	mesh.AddTriangle({ .Vertices = { 0, 1, 2 } });
+	mesh.AddTriangle({ .Vertices = { 0, 3, 4 } });
+
+	// Update mesh connectivity (neighbors and incident faces)
+	mesh.UpdateMeshConnectivity();
+
+	return mesh;
+}
+
+/// @brief Create a copy of a mesh whose vertices and triangles are stored in a random order.
+/// @note Mimics the spatially incoherent element order of scanner output.
+inline Data::Surface::Mesh CreateShuffledMesh(const Data::Surface::Mesh& mesh, unsigned int seed = 42)
+{
+	std::mt19937 generator(seed);
+	std::vector<int> vertexOrder(mesh.GetVertexCount());
+	std::iota(vertexOrder.begin(), vertexOrder.end(), 0);
+	std::shuffle(vertexOrder.begin(), vertexOrder.end(), generator);
+	std::vector<int> triangleOrder(mesh.GetTriangleCount());
+	std::iota(triangleOrder.begin(), triangleOrder.end(), 0);
+	std::shuffle(triangleOrder.begin(), triangleOrder.end(), generator);
+
+	Data::Surface::Mesh shuffledMesh;
+	std::vector<int> vertexRemap(vertexOrder.size());
+	for(size_t iVertex = 0; iVertex < vertexOrder.size(); ++iVertex)
+	{
+		vertexRemap[vertexOrder[iVertex]] = static_cast<int>(iVertex);
+		shuffledMesh.AddVertex({ .Position = mesh.GetVertexData(vertexOrder[iVertex]).Position });
+	}
+
+	for(int oldTriangleIdx : triangleOrder)
+	{
+		const auto& oldVertices = mesh.GetTriangleData(oldTriangleIdx).Vertices;
+		shuffledMesh.AddTriangle(
+			{ .Vertices = { vertexRemap[oldVertices[0]], vertexRemap[oldVertices[1]], vertexRemap[oldVertices[2]] } });
+	}
+
+	// Update mesh connectivity (neighbors and incident faces)
+	shuffledMesh.UpdateMeshConnectivity();
+
+	return shuffledMesh;
+}
 } // namespace TestHelpers
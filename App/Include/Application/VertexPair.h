@@ -45,7 +45,8 @@ struct hash<Data::Primitive::VertexPair>
 	{
 		auto h1 = std::hash<Core::BaseType::VertexIndex>{}(vertexPair.GetMinVertexIdx());
 		auto h2 = std::hash<Core::BaseType::VertexIndex>{}(vertexPair.GetMaxVertexIdx());
-		return h1 ^ h2;
+		// Mix the hashes, a plain xor collides for every pair with the same index difference on structured meshes.
+		return h1 ^ (h2 + 0x9E3779B97F4A7C15ull + (h1 << 6) + (h1 >> 2));
 	}
 };
 } // namespace std
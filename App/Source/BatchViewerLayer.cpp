@@ -0,0 +1,189 @@
+#include "Application/BatchViewerLayer.h"
+
+#include "Application/MeshGenerator.h"
+#include "Core/MathHelpers.h"
+#include "Core/Profiler.h"
+#include "Core/Renderer/Shader.h"
+#include "imgui.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <memory>
+#include <numbers>
+
+using namespace Core::BaseType;
+using namespace Core::Math::Geometry;
+using namespace Utilitary::Surface;
+
+namespace
+{
+/// @brief Number of instances along each side of the grid.
+constexpr uint32_t GridSize = 64;
+/// @brief Distance between the centers of neighbor instances.
+constexpr float GridSpacing = 1.5f;
+/// @brief Vertical field of view of the camera.
+constexpr float FieldOfView = std::numbers::pi_v<float> / 4.f;
+
+/// @brief Get the transform of an instance of the grid, spinning and bouncing with the time.
+Mat4 GetInstanceTransform(const uint32_t instance, const float time)
+{
+	const uint32_t row = instance / GridSize;
+	const uint32_t column = instance % GridSize;
+	const float phase = 0.37f * static_cast<float>(instance);
+	const float halfSize = 0.5f * GridSpacing * static_cast<float>(GridSize - 1);
+
+	Mat4 transform = glm::mat4_cast(AngleAxis(time + phase, Normalize(Vec3{ 0.3f, 0.5f, 1.f })));
+	transform[3] = Vec4{ GridSpacing * static_cast<float>(column) - halfSize,
+		GridSpacing * static_cast<float>(row) - halfSize,
+		0.25f * std::sin(2.f * time + phase),
+		1.f };
+	return transform;
+}
+} // namespace
+
+namespace Application
+{
+BatchViewerLayer::BatchViewerLayer()
+{
+	m_Shader = Renderer::CreateGraphicsShader("Data/Shaders/BatchVertex.glsl", "Data/Shaders/MeshFragment.glsl");
+
+	// A few small parts, each one instantiated all over the grid.
+	const std::unique_ptr<Data::Surface::Mesh> parts[] = {
+		MeshGenerator::CreateIcosphere(2, 0.5f),
+		MeshGenerator::CreateTorus(24, 12, 0.4f, 0.12f),
+		MeshGenerator::CreateIcosphere(0, 0.6f),
+		MeshGenerator::CreateTorus(6, 4, 0.35f, 0.2f),
+	};
+	for(const std::unique_ptr<Data::Surface::Mesh>& part : parts)
+	{
+		part->ComputeSmoothVertexNormals(true);
+		m_Batch.AddPart(*part);
+	}
+	for(uint32_t iInstance = 0; iInstance < GridSize * GridSize; ++iInstance)
+	{
+		const uint32_t part = (7 * iInstance + iInstance / GridSize) % static_cast<uint32_t>(std::size(parts));
+		m_Batch.AddInstance(part, GetInstanceTransform(iInstance, 0.f));
+	}
+}
+
+BatchViewerLayer::~BatchViewerLayer()
+{
+	glDeleteProgram(m_Shader);
+	if(m_ColorTexture.Handle != 0)
+	{
+		glDeleteTextures(1, &m_ColorTexture.Handle);
+		glDeleteFramebuffers(1, &m_Framebuffer.Handle);
+		glDeleteRenderbuffers(1, &m_DepthBuffer);
+	}
+}
+
+void BatchViewerLayer::OnUpdate(const float ts)
+{
+	if(!m_Animate)
+		return;
+
+	// Only the chunks of the animated instances are regenerated by the next update.
+	m_Time += ts;
+	for(uint32_t iInstance = 0; iInstance < static_cast<uint32_t>(m_AnimatedCount); ++iInstance)
+		m_Batch.SetTransform(iInstance, GetInstanceTransform(iInstance, m_Time));
+}
+
+void BatchViewerLayer::ResizeTargets(const uint32_t width, const uint32_t height)
+{
+	if(m_ColorTexture.Width == width && m_ColorTexture.Height == height)
+		return;
+
+	if(m_ColorTexture.Handle != 0)
+	{
+		glDeleteTextures(1, &m_ColorTexture.Handle);
+		glDeleteFramebuffers(1, &m_Framebuffer.Handle);
+		glDeleteRenderbuffers(1, &m_DepthBuffer);
+	}
+	m_ColorTexture = Renderer::CreateTexture(static_cast<int>(width), static_cast<int>(height));
+	m_Framebuffer = Renderer::CreateFramebufferWithTexture(m_ColorTexture);
+	glCreateRenderbuffers(1, &m_DepthBuffer);
+	glNamedRenderbufferStorage(
+		m_DepthBuffer, GL_DEPTH_COMPONENT32F, static_cast<GLsizei>(width), static_cast<GLsizei>(height));
+	glNamedFramebufferRenderbuffer(m_Framebuffer.Handle, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, m_DepthBuffer);
+}
+
+void BatchViewerLayer::OnRender()
+{
+	ImGui::Begin("Batch Viewer");
+
+	ImGui::Text("%zu parts, %u instances, %u vertices, 1 draw call",
+		m_Batch.GetParts().size(),
+		m_Batch.GetInstanceCount(),
+		static_cast<uint32_t>(m_Batch.GetVertices().size()));
+	ImGui::Text("Update %.3f ms, %.1f KiB uploaded",
+		m_UpdateTime,
+		static_cast<float>(m_GpuBatch.GetUploadedSize()) / 1024.f);
+	ImGui::SliderInt("Animated instances", &m_AnimatedCount, 0, static_cast<int>(m_Batch.GetSlotCount()));
+	ImGui::Checkbox("Animate", &m_Animate);
+	ImGui::SameLine();
+	ImGui::Checkbox("Show instances", &m_ShowInstances);
+
+	const ImVec2 size = ImGui::GetContentRegionAvail();
+	if(size.x < 1.f || size.y < 1.f)
+	{
+		ImGui::End();
+		return;
+	}
+	const uint32_t width = static_cast<uint32_t>(size.x);
+	const uint32_t height = static_cast<uint32_t>(size.y);
+
+	// Orbit with the left button, zoom with the wheel.
+	const ImVec2 pos = ImGui::GetCursorScreenPos();
+	ImGui::InvisibleButton("Viewport", size);
+	const ImGuiIO& io = ImGui::GetIO();
+	if(ImGui::IsItemActive())
+	{
+		m_Yaw -= 0.01f * io.MouseDelta.x;
+		m_Pitch = std::clamp(m_Pitch + 0.01f * io.MouseDelta.y, -1.55f, 1.55f);
+	}
+	if(ImGui::IsItemHovered() && io.MouseWheel != 0.f)
+		m_Distance = std::clamp(m_Distance * std::pow(0.9f, io.MouseWheel), 1.f, 400.f);
+
+	ResizeTargets(width, height);
+	ImGui::GetWindowDrawList()->AddImage(reinterpret_cast<void*>(static_cast<uintptr_t>(m_ColorTexture.Handle)),
+		pos,
+		ImVec2(pos.x + size.x, pos.y + size.y),
+		ImVec2(0, 1),
+		ImVec2(1, 0));
+	ImGui::End();
+
+	DrawBatch(width, height);
+}
+
+void BatchViewerLayer::DrawBatch(const uint32_t width, const uint32_t height)
+{
+	ProfileScope("BatchViewerLayer::DrawBatch");
+
+	const auto updateStart = std::chrono::steady_clock::now();
+	m_GpuBatch.Update(m_Batch);
+	m_UpdateTime = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - updateStart).count();
+
+	const Vec3 direction{ std::cos(m_Pitch) * std::cos(m_Yaw), std::cos(m_Pitch) * std::sin(m_Yaw), std::sin(m_Pitch) };
+	const Vec3 cameraPosition = m_Distance * direction;
+	const float aspect = static_cast<float>(width) / static_cast<float>(height);
+	const float sceneRadius = GridSpacing * static_cast<float>(GridSize);
+	const Mat4 viewProjection = Perspective(FieldOfView, aspect, 0.1f, m_Distance + sceneRadius)
+		* LookAt(cameraPosition, Vec3{ 0.f }, Vec3{ 0.f, 0.f, 1.f });
+
+	glBindFramebuffer(GL_FRAMEBUFFER, m_Framebuffer.Handle);
+	glViewport(0, 0, static_cast<GLsizei>(width), static_cast<GLsizei>(height));
+	glClearColor(0.1f, 0.1f, 0.12f, 1.0f);
+	glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+	glEnable(GL_DEPTH_TEST);
+
+	glUseProgram(m_Shader);
+	glUniformMatrix4fv(0, 1, GL_FALSE, glm::value_ptr(viewProjection));
+	glUniform3f(1, cameraPosition.x, cameraPosition.y, cameraPosition.z);
+	glUniform1i(2, m_ShowInstances ? 1 : 0);
+	m_GpuBatch.Draw();
+
+	glDisable(GL_DEPTH_TEST);
+	glBindFramebuffer(GL_FRAMEBUFFER, 0);
+}
+} // namespace Application
@@ -0,0 +1,142 @@
+#include "Application/GpuBatch.h"
+
+#include "Core/Profiler.h"
+
+#include <algorithm>
+#include <span>
+
+using namespace Core::BaseType;
+using namespace Utilitary::Surface;
+
+namespace
+{
+/// @brief Smallest storage of a buffer, in bytes.
+constexpr size_t MinBufferCapacity = 64 * 1024;
+
+/// @brief Get the size in bytes of an array.
+template<typename T>
+size_t GetByteCount(const std::span<const T> values)
+{
+	return values.size() * sizeof(T);
+}
+} // namespace
+
+namespace Application
+{
+GpuBatch::GpuBatch()
+{
+	glCreateVertexArrays(1, &m_VertexArray);
+	glEnableVertexArrayAttrib(m_VertexArray, 0); // position
+	glEnableVertexArrayAttrib(m_VertexArray, 1); // normal
+	glEnableVertexArrayAttrib(m_VertexArray, 2); // uv
+	glVertexArrayAttribFormat(
+		m_VertexArray, 0, 3, GL_FLOAT, GL_FALSE, static_cast<GLuint>(offsetof(PackedVertex, Position)));
+	glVertexArrayAttribFormat(
+		m_VertexArray, 1, 3, GL_FLOAT, GL_FALSE, static_cast<GLuint>(offsetof(PackedVertex, Normal)));
+	glVertexArrayAttribFormat(
+		m_VertexArray, 2, 2, GL_FLOAT, GL_FALSE, static_cast<GLuint>(offsetof(PackedVertex, TexCoords)));
+	for(GLuint iAttribute = 0; iAttribute < 3; ++iAttribute)
+		glVertexArrayAttribBinding(m_VertexArray, iAttribute, 0);
+}
+
+GpuBatch::~GpuBatch()
+{
+	glDeleteVertexArrays(1, &m_VertexArray);
+	for(const DynamicBuffer* buffer : { &m_VertexBuffer, &m_IndexBuffer, &m_CommandBuffer, &m_TransformBuffer })
+		glDeleteBuffers(1, &buffer->Handle);
+}
+
+void GpuBatch::Update(MeshBatch& batch)
+{
+	ProfileScope("GpuBatch::Update");
+
+	m_UploadedSize = 0;
+	const std::span<const uint32_t> updatedChunks = batch.UpdateCommands();
+
+	// The geometry is only appended.
+	if(Append(m_VertexBuffer, batch.GetVertices().data(), GetByteCount(batch.GetVertices())))
+		glVertexArrayVertexBuffer(m_VertexArray, 0, m_VertexBuffer.Handle, 0, sizeof(PackedVertex));
+	if(Append(m_IndexBuffer, batch.GetIndices().data(), GetByteCount(batch.GetIndices())))
+		glVertexArrayElementBuffer(m_VertexArray, m_IndexBuffer.Handle);
+
+	// The new slots are appended, then each run of neighbor chunks already on the GPU is uploaded at once.
+	const std::span<const DrawElementsIndirectCommand> commands = batch.GetCommands();
+	const std::span<const Mat4> transforms = batch.GetTransforms();
+	const size_t uploadedSlotCount = m_CommandBuffer.Size / sizeof(DrawElementsIndirectCommand);
+	const bool isCommandBufferNew = Append(m_CommandBuffer, commands.data(), GetByteCount(commands));
+	const bool isTransformBufferNew = Append(m_TransformBuffer, transforms.data(), GetByteCount(transforms));
+	for(size_t iRunStart = 0; iRunStart < updatedChunks.size();)
+	{
+		size_t iRunEnd = iRunStart + 1;
+		while(iRunEnd < updatedChunks.size() && updatedChunks[iRunEnd] == updatedChunks[iRunEnd - 1] + 1)
+			++iRunEnd;
+
+		const size_t firstSlot = size_t{ updatedChunks[iRunStart] } * MeshBatch::InstanceChunkSize;
+		const size_t endSlot =
+			std::min(uploadedSlotCount, size_t{ updatedChunks[iRunEnd - 1] + 1 } * MeshBatch::InstanceChunkSize);
+		iRunStart = iRunEnd;
+		if(firstSlot >= endSlot)
+			continue;
+
+		const size_t slotCount = endSlot - firstSlot;
+		if(!isCommandBufferNew)
+		{
+			Upload(m_CommandBuffer,
+				commands.data() + firstSlot,
+				firstSlot * sizeof(DrawElementsIndirectCommand),
+				slotCount * sizeof(DrawElementsIndirectCommand));
+		}
+		if(!isTransformBufferNew)
+		{
+			Upload(m_TransformBuffer,
+				transforms.data() + firstSlot,
+				firstSlot * sizeof(Mat4),
+				slotCount * sizeof(Mat4));
+		}
+	}
+	m_DrawCount = static_cast<GLsizei>(batch.GetSlotCount());
+}
+
+void GpuBatch::Draw() const
+{
+	ProfileScope("GpuBatch::Draw");
+
+	if(m_DrawCount == 0)
+		return;
+
+	glBindVertexArray(m_VertexArray);
+	glBindBufferBase(GL_SHADER_STORAGE_BUFFER, TransformBinding, m_TransformBuffer.Handle);
+	glBindBuffer(GL_DRAW_INDIRECT_BUFFER, m_CommandBuffer.Handle);
+	glMultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_INT, nullptr, m_DrawCount, 0);
+	glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+	glBindVertexArray(0);
+}
+
+bool GpuBatch::Append(DynamicBuffer& buffer, const void* data, const size_t size)
+{
+	if(size <= buffer.Size)
+		return false;
+
+	if(size <= buffer.Capacity)
+	{
+		Upload(buffer, static_cast<const std::byte*>(data) + buffer.Size, buffer.Size, size - buffer.Size);
+		buffer.Size = size;
+		return false;
+	}
+
+	// Immutable storage, the buffer is replaced and its whole content uploaded again.
+	glDeleteBuffers(1, &buffer.Handle);
+	buffer.Capacity = std::max({ size, 2 * buffer.Capacity, MinBufferCapacity });
+	glCreateBuffers(1, &buffer.Handle);
+	glNamedBufferStorage(buffer.Handle, static_cast<GLsizeiptr>(buffer.Capacity), nullptr, GL_DYNAMIC_STORAGE_BIT);
+	Upload(buffer, data, 0, size);
+	buffer.Size = size;
+	return true;
+}
+
+void GpuBatch::Upload(DynamicBuffer& buffer, const void* data, const size_t offset, const size_t size)
+{
+	glNamedBufferSubData(buffer.Handle, static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(size), data);
+	m_UploadedSize += size;
+}
+} // namespace Application
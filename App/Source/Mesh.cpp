@@ -1,17 +1,55 @@
 #include "Application/Mesh.h"
 
 #include "Application/ExtraDataType.h"
+#include "Application/MeshBoundary.h"
+#include "Application/MeshGeometry.h"
 #include "Application/PrimitiveProxy.h"
 #include "Application/VertexPair.h"
 #include "Core/MathHelpers.h"
+#include "Core/MemoryArena.h"
+#include "Core/Parallel.h"
+#include "Core/Profiler.h"
 
 using namespace Core::BaseType;
 using namespace Core::Math::Geometry;
+using namespace Core::Parallel;
 using namespace Data::Primitive;
 using namespace Data::ExtraData;
 using namespace Utilitary::Primitive;
 
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <memory_resource>
 #include <numeric>
+#include <unordered_map>
+
+namespace
+{
+/// @brief Collect the sorted, unique vertices adjacent to a vertex.
+void GatherLink(const Data::Surface::Mesh& mesh, const VertexIndex vertexIdx, std::vector<VertexIndex>& link)
+{
+	link.clear();
+	for(TriangleIndex triangleIdx : mesh.GetTrianglesAroundVertexView(vertexIdx))
+	{
+		for(int curVertexIdx : mesh.GetTriangleData(triangleIdx).Vertices)
+		{
+			if(static_cast<VertexIndex>(curVertexIdx) != vertexIdx)
+				link.push_back(static_cast<VertexIndex>(curVertexIdx));
+		}
+	}
+	std::sort(link.begin(), link.end());
+	link.erase(std::unique(link.begin(), link.end()), link.end());
+}
+
+/// @brief Local index of the edge a triangle shares with the given neighbor.
+EdgeIndex GetNeighborLocalIndex(const Triangle& triangle, const int neighborIdx)
+{
+	const auto it = std::find(triangle.Neighbors.begin(), triangle.Neighbors.end(), neighborIdx);
+	assert(it != triangle.Neighbors.end());
+	return static_cast<EdgeIndex>(it - triangle.Neighbors.begin());
+}
+} // namespace
 
 namespace Data::Surface
 {
@@ -20,7 +58,54 @@ Mesh::Mesh(const Mesh& other)
 	, m_Triangles(other.m_Triangles)
 	, m_VerticesExtraDataContainer(other.m_VerticesExtraDataContainer)
 	, m_TrianglesExtraDataContainer(other.m_TrianglesExtraDataContainer)
-{}
+	, m_DeletedVertices(other.m_DeletedVertices)
+	, m_DeletedTriangles(other.m_DeletedTriangles)
+	, m_FreeVertices(other.m_FreeVertices)
+	, m_FreeTriangles(other.m_FreeTriangles)
+	, m_TopologyRevision(other.m_TopologyRevision)
+	, m_GeometryRevision(other.m_GeometryRevision)
+{
+	const std::scoped_lock lock(
+		other.m_BoundaryLoopsMutex, other.m_PositionBuffersMutex, other.m_GeometryMeasuresMutex);
+	m_BoundaryLoops = other.m_BoundaryLoops;
+	m_BoundaryLoopsRevision = other.m_BoundaryLoopsRevision;
+	m_PositionBuffers = other.m_PositionBuffers;
+	m_PositionBuffersRevision = other.m_PositionBuffersRevision;
+	m_GeometryMeasures = other.m_GeometryMeasures;
+	m_GeometryMeasuresRevision = other.m_GeometryMeasuresRevision;
+}
+
+Mesh& Mesh::operator=(const Mesh& other)
+{
+	if(this == &other)
+		return *this;
+
+	m_Vertices = other.m_Vertices;
+	m_Triangles = other.m_Triangles;
+	m_VerticesExtraDataContainer = other.m_VerticesExtraDataContainer;
+	m_TrianglesExtraDataContainer = other.m_TrianglesExtraDataContainer;
+	m_DeletedVertices = other.m_DeletedVertices;
+	m_DeletedTriangles = other.m_DeletedTriangles;
+	m_FreeVertices = other.m_FreeVertices;
+	m_FreeTriangles = other.m_FreeTriangles;
+	m_TopologyRevision = other.m_TopologyRevision;
+	m_GeometryRevision = other.m_GeometryRevision;
+
+	const std::scoped_lock lock(
+		m_BoundaryLoopsMutex,
+		m_PositionBuffersMutex,
+		m_GeometryMeasuresMutex,
+		other.m_BoundaryLoopsMutex,
+		other.m_PositionBuffersMutex,
+		other.m_GeometryMeasuresMutex);
+	m_BoundaryLoops = other.m_BoundaryLoops;
+	m_BoundaryLoopsRevision = other.m_BoundaryLoopsRevision;
+	m_PositionBuffers = other.m_PositionBuffers;
+	m_PositionBuffersRevision = other.m_PositionBuffersRevision;
+	m_GeometryMeasures = other.m_GeometryMeasures;
+	m_GeometryMeasuresRevision = other.m_GeometryMeasuresRevision;
+	return *this;
+}
 
 /// @brief Get the number of faces in the mesh.
 std::unique_ptr<Mesh> Mesh::Clone() const
@@ -74,8 +159,16 @@ Triangle& Mesh::GetTriangleData(const TriangleIndex index)
 	return m_Triangles[index];
 }
 
+void Mesh::SetVertexPosition(const VertexIndex index, const Vec3& position)
+{
+	assert(index < GetVertexCount() && "Index out of bound");
+	m_Vertices[index].Position = position;
+	NotifyGeometryChanged();
+}
+
 VertexIndex Mesh::AddVertex(const Vertex& vertex)
 {
+	NotifyTopologyChanged();
 	VertexIndex index = static_cast<VertexIndex>(m_Vertices.size());
 	if(!m_Vertices.empty() && m_VerticesExtraDataContainer.size() == m_Vertices.size())
 		m_VerticesExtraDataContainer.emplace_back();
@@ -85,6 +178,7 @@ VertexIndex Mesh::AddVertex(const Vertex& vertex)
 
 TriangleIndex Mesh::AddTriangle(const Triangle& triangle)
 {
+	NotifyTopologyChanged();
 	TriangleIndex index = static_cast<TriangleIndex>(m_Triangles.size());
 	if(!m_Triangles.empty() && m_TrianglesExtraDataContainer.size() == m_Triangles.size())
 		m_TrianglesExtraDataContainer.emplace_back();
@@ -108,10 +202,18 @@ void Mesh::AddTrianglesExtraDataContainer()
 
 void Mesh::UpdateMeshConnectivity()
 {
-	std::unordered_map<VertexPair, std::pair<TriangleIndex, EdgeIndex>> neighborMap;
+	ProfileScope("Mesh::UpdateMeshConnectivity");
+	NotifyTopologyChanged();
+
+	// The map is a temporary of the scratch arena, its nodes being freed at once when the scope ends.
+	const Core::Memory::ScratchScope scratch;
+	std::pmr::unordered_map<VertexPair, std::pair<TriangleIndex, EdgeIndex>> neighborMap(scratch.GetResource());
+	neighborMap.reserve(3 * static_cast<size_t>(GetTriangleCount()) / 2);
 
 	for(TriangleIndex iTriangle = 0; iTriangle < GetTriangleCount(); ++iTriangle)
 	{
+		if(IsTriangleDeleted(iTriangle))
+			continue;
 		Triangle& curTriangle = m_Triangles[iTriangle];
 
 		// Set the incident triangle index for each vertex if it's not already the case.
@@ -186,33 +288,44 @@ bool Mesh::HasTrianglesExtraDataContainer() const
 
 void Mesh::ComputeTriangleNormals(bool normalize)
 {
+	ProfileScope("Mesh::ComputeTriangleNormals");
+
 	// Add extra data containers for triangles if necessary.
 	if(!HasTrianglesExtraDataContainer())
 		AddTrianglesExtraDataContainer();
 
-	for(TriangleIndex iTriangle = 0; iTriangle < GetTriangleCount(); ++iTriangle)
-	{
-		const TriangleProxy& curTriangle = GetTriangle(iTriangle);
-
-		// Get each vertex position.
-		const Vec3& posA = m_Vertices[curTriangle.GetVertex(0)].Position;
-		const Vec3& posB = m_Vertices[curTriangle.GetVertex(1)].Position;
-		const Vec3& posC = m_Vertices[curTriangle.GetVertex(2)].Position;
-
-		const Vec3 AB = Normalize(posB - posA);
-		const Vec3 AC = Normalize(posC - posA);
-
-		// Compute and store the normal as an extra data to the current triangle.
-		TriangleNormalExtraData& curTriangleNormal = curTriangle.GetOrCreateExtraData<TriangleNormalExtraData>();
-		Vec3 computedNormal = Cross(AB, AC);
-		if(normalize)
-			computedNormal = Normalize(computedNormal);
-		curTriangleNormal.SetData(computedNormal);
-	}
+	// Each triangle only touches its own extra data container.
+	ParallelFor(
+		0,
+		GetTriangleCount(),
+		[&](const size_t index)
+		{
+			const TriangleIndex iTriangle = static_cast<TriangleIndex>(index);
+			if(IsTriangleDeleted(iTriangle))
+				return;
+			const TriangleProxy& curTriangle = GetTriangle(iTriangle);
+
+			// Get each vertex position.
+			const Vec3& posA = m_Vertices[curTriangle.GetVertex(0)].Position;
+			const Vec3& posB = m_Vertices[curTriangle.GetVertex(1)].Position;
+			const Vec3& posC = m_Vertices[curTriangle.GetVertex(2)].Position;
+
+			const Vec3 AB = Normalize(posB - posA);
+			const Vec3 AC = Normalize(posC - posA);
+
+			// Compute and store the normal as an extra data to the current triangle.
+			TriangleNormalExtraData& curTriangleNormal = curTriangle.GetOrCreateExtraData<TriangleNormalExtraData>();
+			Vec3 computedNormal = Cross(AB, AC);
+			if(normalize)
+				computedNormal = Normalize(computedNormal);
+			curTriangleNormal.SetData(computedNormal);
+		});
 }
 
 void Mesh::ComputeSmoothVertexNormals(bool normalize)
 {
+	ProfileScope("Mesh::ComputeSmoothVertexNormals");
+
 	// Add extra data containers for triangles if necessary.
 	if(!HasTrianglesExtraDataContainer())
 		AddTrianglesExtraDataContainer();
@@ -221,114 +334,708 @@ void Mesh::ComputeSmoothVertexNormals(bool normalize)
 	if(!HasVerticesExtraDataContainer())
 		AddVerticesExtraDataContainer();
 
-	for(TriangleIndex iTriangle = 0; iTriangle < GetTriangleCount(); ++iTriangle)
-	{
-		const TriangleProxy& curTriangle = GetTriangle(iTriangle);
+	// Normal of each corner (3 * triangle + local index) weighted by its angle. The buffers are temporaries of the
+	// scratch arena of the calling thread, the workers only filling them.
+	const Core::Memory::ScratchScope scratch;
+	const size_t triangleCount = GetTriangleCount();
+	const size_t vertexCount = GetVertexCount();
+	std::pmr::vector<Vec3> cornerNormals(3 * triangleCount, scratch.GetResource());
+	std::pmr::vector<uint32_t> firstCornerIndices(vertexCount + 1, 0, scratch.GetResource());
+	ParallelFor(
+		0,
+		triangleCount,
+		[&](const size_t index)
+		{
+			const TriangleIndex iTriangle = static_cast<TriangleIndex>(index);
+			if(IsTriangleDeleted(iTriangle))
+				return;
+			const TriangleProxy& curTriangle = GetTriangle(iTriangle);
 
-		// Get each vertex position.
-		const Vec3& posA = m_Vertices[curTriangle.GetVertex(0)].Position;
-		const Vec3& posB = m_Vertices[curTriangle.GetVertex(1)].Position;
-		const Vec3& posC = m_Vertices[curTriangle.GetVertex(2)].Position;
+			// Get each vertex position.
+			const Vec3& posA = m_Vertices[curTriangle.GetVertex(0)].Position;
+			const Vec3& posB = m_Vertices[curTriangle.GetVertex(1)].Position;
+			const Vec3& posC = m_Vertices[curTriangle.GetVertex(2)].Position;
 
-		const Vec3 AB = Normalize(posB - posA);
-		const Vec3 AC = Normalize(posC - posA);
+			const Vec3 AB = Normalize(posB - posA);
+			const Vec3 AC = Normalize(posC - posA);
 
-		// Get or compute the current triangle normal.
-		Vec3 curTriangleNormal;
-		if(curTriangle.HasExtraData<TriangleNormalExtraData>())
+			// Get or compute the current triangle normal.
+			Vec3 curTriangleNormal;
+			if(curTriangle.HasExtraData<TriangleNormalExtraData>())
+			{
+				curTriangleNormal = curTriangle.GetExtraData<TriangleNormalExtraData>()->GetData();
+			}
+			else
+			{
+				curTriangleNormal = Cross(AB, AC);
+			}
+
+			curTriangleNormal = Normalize(curTriangleNormal);
+
+			// Compute the remaining vectors of the triangle.
+			const Vec3 BC = glm::normalize(posC - posB);
+			const Vec3 BA = glm::normalize(posA - posB);
+
+			const Vec3 CA = glm::normalize(posA - posC);
+			const Vec3 CB = glm::normalize(posB - posC);
+
+			// Compute each angle (in randian).
+			const float angleA = Angle(AB, AC);
+			const float angleB = Angle(BC, BA);
+			const float angleC = Angle(CA, CB);
+
+			// Weight the normal by the related angle on each corner, and count the corners of each vertex.
+			cornerNormals[3 * index] = curTriangleNormal * angleA;
+			cornerNormals[3 * index + 1] = curTriangleNormal * angleB;
+			cornerNormals[3 * index + 2] = curTriangleNormal * angleC;
+			for(EdgeIndex iCorner = 0; iCorner < 3; ++iCorner)
+			{
+				std::atomic_ref<uint32_t> cornerCount(firstCornerIndices[curTriangle.GetVertex(iCorner) + 1]);
+				cornerCount.fetch_add(1, std::memory_order_relaxed);
+			}
+		});
+	std::inclusive_scan(firstCornerIndices.begin(), firstCornerIndices.end(), firstCornerIndices.begin());
+
+	// Corners around each vertex (compressed rows).
+	std::pmr::vector<uint32_t> insertionIndices(
+		firstCornerIndices.begin(), firstCornerIndices.end() - 1, scratch.GetResource());
+	std::pmr::vector<uint32_t> vertexCorners(firstCornerIndices.back(), scratch.GetResource());
+	ParallelFor(
+		0,
+		triangleCount,
+		[&](const size_t index)
 		{
-			curTriangleNormal = curTriangle.GetExtraData<TriangleNormalExtraData>()->GetData();
-		}
-		else
+			const TriangleIndex iTriangle = static_cast<TriangleIndex>(index);
+			if(IsTriangleDeleted(iTriangle))
+				return;
+			for(EdgeIndex iCorner = 0; iCorner < 3; ++iCorner)
+			{
+				std::atomic_ref<uint32_t> insertionIdx(insertionIndices[m_Triangles[index].Vertices[iCorner]]);
+				vertexCorners[insertionIdx.fetch_add(1, std::memory_order_relaxed)] =
+					static_cast<uint32_t>(3 * index + iCorner);
+			}
+		});
+
+	// Compute the smooth normal for each vertex of the mesh.
+	ParallelFor(
+		0,
+		vertexCount,
+		[&](const size_t index)
+		{
+			const VertexIndex iVertex = static_cast<VertexIndex>(index);
+			if(IsVertexDeleted(iVertex))
+				return;
+			// Get the current vertex and create the extra data that will handle the smooth vertex normal.
+			const VertexProxy& curVertex = GetVertex(iVertex);
+			SmoothVertexNormalExtraData& curVertexNormal =
+				curVertex.GetOrCreateExtraData<SmoothVertexNormalExtraData>();
+
+			// Accumulate the weighted corner normals, in the order of the triangles so that the sum does not depend on
+			// the threads.
+			const auto cornersBegin = vertexCorners.begin() + firstCornerIndices[index];
+			const auto cornersEnd = vertexCorners.begin() + firstCornerIndices[index + 1];
+			std::sort(cornersBegin, cornersEnd);
+			Vec3 computedNormal{ 0., 0., 0. };
+			for(auto cornerIt = cornersBegin; cornerIt != cornersEnd; ++cornerIt)
+				computedNormal += cornerNormals[*cornerIt];
+
+			if(normalize && cornersBegin != cornersEnd)
+				computedNormal = Normalize(computedNormal);
+			curVertexNormal.SetData(computedNormal);
+		});
+}
+
+void Mesh::UpdateVerticesBoundaryStatus()
+{
+	// Add extra data containers for vertices if necessary.
+	if(!HasVerticesExtraDataContainer())
+		AddVerticesExtraDataContainer();
+
+	// The boundary flags are read from the cached boundary loops, each vertex only touches its own container.
+	const std::shared_ptr<const Utilitary::Surface::BoundaryLoops> boundaryLoops = GetBoundaryLoops();
+	ParallelFor(
+		0,
+		GetVertexCount(),
+		[&](const size_t iVertex)
+		{
+			auto& curBoundaryStatus =
+				m_VerticesExtraDataContainer[iVertex].GetOrCreate<IsBoundaryVertexExtraData>();
+			curBoundaryStatus.SetData(boundaryLoops->IsBoundaryVertex(static_cast<VertexIndex>(iVertex)));
+		});
+}
+
+void Mesh::UpdateBoundaryIncidentTriangles()
+{
+	// A boundary edge leaves its first vertex, its triangle is the first one of the fan of this vertex.
+	const std::shared_ptr<const Utilitary::Surface::BoundaryLoops> boundaryLoops = GetBoundaryLoops();
+	for(uint32_t iEdge = 0; iEdge < boundaryLoops->GetEdgeCount(); ++iEdge)
+		m_Vertices[boundaryLoops->LoopVertices[iEdge]].IncidentTriangleIdx =
+			static_cast<int>(boundaryLoops->LoopTriangles[iEdge]);
+}
+
+bool Mesh::IsBoundaryVertex(const VertexIndex index) const
+{
+	assert(index < GetVertexCount() && "Index out of bound");
+	if(m_Vertices[index].IncidentTriangleIdx == -1)
+		return false;
+
+	for(TriangleIndex triangleIdx : GetTrianglesAroundVertexView(index))
+	{
+		const Triangle& curTriangle = m_Triangles[triangleIdx];
+		const int localIdx = GetVertexLocalIndex(curTriangle, index);
+		// The two edges incident to the vertex are the ones opposite to the two other vertices.
+		if(curTriangle.Neighbors[IndexHelpers::Next[localIdx]] == -1
+		   || curTriangle.Neighbors[IndexHelpers::Previous[localIdx]] == -1)
+			return true;
+	}
+	return false;
+}
+
+std::shared_ptr<const Utilitary::Surface::BoundaryLoops> Mesh::GetBoundaryLoops() const
+{
+	const std::scoped_lock lock(m_BoundaryLoopsMutex);
+	if(!m_BoundaryLoops || m_BoundaryLoopsRevision != m_TopologyRevision)
+	{
+		m_BoundaryLoops = std::make_shared<const Utilitary::Surface::BoundaryLoops>(
+			Utilitary::Surface::MeshBoundary::ExtractBoundaryLoops(*this));
+		m_BoundaryLoopsRevision = m_TopologyRevision;
+	}
+	return m_BoundaryLoops;
+}
+
+std::shared_ptr<const Utilitary::Surface::PositionBuffers> Mesh::GetPositionBuffers() const
+{
+	const std::scoped_lock lock(m_PositionBuffersMutex);
+	if(!m_PositionBuffers || m_PositionBuffersRevision != m_GeometryRevision)
+	{
+		m_PositionBuffers = std::make_shared<const Utilitary::Surface::PositionBuffers>(
+			Utilitary::Surface::MeshGeometry::BuildPositionBuffers(*this));
+		m_PositionBuffersRevision = m_GeometryRevision;
+	}
+	return m_PositionBuffers;
+}
+
+std::shared_ptr<const Utilitary::Surface::GeometryMeasures> Mesh::GetGeometryMeasures() const
+{
+	const std::scoped_lock lock(m_GeometryMeasuresMutex);
+	if(!m_GeometryMeasures || m_GeometryMeasuresRevision != m_GeometryRevision)
+	{
+		m_GeometryMeasures = std::make_shared<const Utilitary::Surface::GeometryMeasures>(
+			Utilitary::Surface::MeshGeometry::ComputeMeasures(*this));
+		m_GeometryMeasuresRevision = m_GeometryRevision;
+	}
+	return m_GeometryMeasures;
+}
+
+uint64_t Mesh::GetTopologyRevision() const
+{
+	return m_TopologyRevision;
+}
+
+void Mesh::NotifyTopologyChanged()
+{
+	++m_TopologyRevision;
+	NotifyGeometryChanged();
+}
+
+uint64_t Mesh::GetGeometryRevision() const
+{
+	return m_GeometryRevision;
+}
+
+void Mesh::NotifyGeometryChanged()
+{
+	++m_GeometryRevision;
+}
+
+bool Mesh::FlipEdge(const TriangleIndex triangleIdx, const EdgeIndex edgeIdx)
+{
+	assert(triangleIdx < GetTriangleCount() && edgeIdx < 3 && "Index out of bound");
+	assert(!IsTriangleDeleted(triangleIdx) && "Deleted triangle");
+
+	const int curTriangleIdx = static_cast<int>(triangleIdx);
+	const int oppositeTriangleIdx = m_Triangles[triangleIdx].Neighbors[edgeIdx];
+	if(oppositeTriangleIdx == -1)
+		return false; // Boundary edges cannot be flipped.
+
+	const EdgeIndex oppositeEdgeIdx = GetNeighborLocalIndex(m_Triangles[oppositeTriangleIdx], curTriangleIdx);
+	const int cIdx = m_Triangles[triangleIdx].Vertices[edgeIdx];
+	const int aIdx = m_Triangles[triangleIdx].Vertices[IndexHelpers::Next[edgeIdx]];
+	const int bIdx = m_Triangles[triangleIdx].Vertices[IndexHelpers::Previous[edgeIdx]];
+	const int dIdx = m_Triangles[oppositeTriangleIdx].Vertices[oppositeEdgeIdx];
+	if(cIdx == dIdx)
+		return false;
+
+	// The flipped edge must not already exist.
+	for(VertexIndex curVertexIdx : GetVerticesAroundVertexView(static_cast<VertexIndex>(cIdx)))
+	{
+		if(static_cast<int>(curVertexIdx) == dIdx)
+			return false;
+	}
+
+	const int adNeighborIdx = m_Triangles[oppositeTriangleIdx].Neighbors[IndexHelpers::Next[oppositeEdgeIdx]];
+	const int bcNeighborIdx = m_Triangles[triangleIdx].Neighbors[IndexHelpers::Next[edgeIdx]];
+	NotifyTopologyChanged();
+
+	Triangle& curTriangle = m_Triangles[triangleIdx];
+	curTriangle.Vertices[IndexHelpers::Previous[edgeIdx]] = dIdx;
+	curTriangle.Neighbors[edgeIdx] = adNeighborIdx;
+	curTriangle.Neighbors[IndexHelpers::Next[edgeIdx]] = oppositeTriangleIdx;
+
+	Triangle& oppositeTriangle = m_Triangles[oppositeTriangleIdx];
+	oppositeTriangle.Vertices[IndexHelpers::Previous[oppositeEdgeIdx]] = cIdx;
+	oppositeTriangle.Neighbors[oppositeEdgeIdx] = bcNeighborIdx;
+	oppositeTriangle.Neighbors[IndexHelpers::Next[oppositeEdgeIdx]] = curTriangleIdx;
+
+	ReplaceNeighbor(adNeighborIdx, oppositeTriangleIdx, curTriangleIdx);
+	ReplaceNeighbor(bcNeighborIdx, curTriangleIdx, oppositeTriangleIdx);
+	ReplaceIncidentTriangle(aIdx, oppositeTriangleIdx, curTriangleIdx);
+	ReplaceIncidentTriangle(bIdx, curTriangleIdx, oppositeTriangleIdx);
+	return true;
+}
+
+VertexIndex Mesh::SplitEdge(const TriangleIndex triangleIdx, const EdgeIndex edgeIdx, const Vec3& position)
+{
+	assert(triangleIdx < GetTriangleCount() && edgeIdx < 3 && "Index out of bound");
+	assert(!IsTriangleDeleted(triangleIdx) && "Deleted triangle");
+
+	// The triangle (c, a, b) becomes (c, a, m) + (c, m, b).
+	const int curTriangleIdx = static_cast<int>(triangleIdx);
+	const int cIdx = m_Triangles[triangleIdx].Vertices[edgeIdx];
+	const int aIdx = m_Triangles[triangleIdx].Vertices[IndexHelpers::Next[edgeIdx]];
+	const int bIdx = m_Triangles[triangleIdx].Vertices[IndexHelpers::Previous[edgeIdx]];
+	const int oppositeTriangleIdx = m_Triangles[triangleIdx].Neighbors[edgeIdx];
+	const int bcNeighborIdx = m_Triangles[triangleIdx].Neighbors[IndexHelpers::Next[edgeIdx]];
+
+	const int mIdx = static_cast<int>(AllocateVertex({ .Position = position, .IncidentTriangleIdx = curTriangleIdx }));
+	const int newTriangleIdx = static_cast<int>(AllocateTriangle(
+		{ .Vertices = { cIdx, mIdx, bIdx }, .Neighbors = { oppositeTriangleIdx, bcNeighborIdx, curTriangleIdx } }));
+	ReplaceNeighbor(bcNeighborIdx, curTriangleIdx, newTriangleIdx);
+	ReplaceIncidentTriangle(bIdx, curTriangleIdx, newTriangleIdx);
+
+	m_Triangles[triangleIdx].Vertices[IndexHelpers::Previous[edgeIdx]] = mIdx;
+	m_Triangles[triangleIdx].Neighbors[IndexHelpers::Next[edgeIdx]] = newTriangleIdx;
+
+	if(oppositeTriangleIdx == -1)
+		return static_cast<VertexIndex>(mIdx);
+
+	// The opposite triangle (d, b, a) becomes (d, b, m) + (d, m, a).
+	const EdgeIndex oppositeEdgeIdx = GetNeighborLocalIndex(m_Triangles[oppositeTriangleIdx], curTriangleIdx);
+	const int dIdx = m_Triangles[oppositeTriangleIdx].Vertices[oppositeEdgeIdx];
+	const int daNeighborIdx = m_Triangles[oppositeTriangleIdx].Neighbors[IndexHelpers::Next[oppositeEdgeIdx]];
+
+	const int newOppositeTriangleIdx = static_cast<int>(AllocateTriangle(
+		{ .Vertices = { dIdx, mIdx, aIdx }, .Neighbors = { curTriangleIdx, daNeighborIdx, oppositeTriangleIdx } }));
+	ReplaceNeighbor(daNeighborIdx, oppositeTriangleIdx, newOppositeTriangleIdx);
+	ReplaceIncidentTriangle(aIdx, oppositeTriangleIdx, newOppositeTriangleIdx);
+
+	Triangle& oppositeTriangle = m_Triangles[oppositeTriangleIdx];
+	oppositeTriangle.Vertices[IndexHelpers::Previous[oppositeEdgeIdx]] = mIdx;
+	oppositeTriangle.Neighbors[oppositeEdgeIdx] = newTriangleIdx;
+	oppositeTriangle.Neighbors[IndexHelpers::Next[oppositeEdgeIdx]] = newOppositeTriangleIdx;
+	m_Triangles[triangleIdx].Neighbors[edgeIdx] = newOppositeTriangleIdx;
+
+	return static_cast<VertexIndex>(mIdx);
+}
+
+VertexIndex Mesh::SplitTriangle(const TriangleIndex triangleIdx, const Vec3& position)
+{
+	assert(triangleIdx < GetTriangleCount() && "Index out of bound");
+	assert(!IsTriangleDeleted(triangleIdx) && "Deleted triangle");
+
+	// The triangle (a, b, c) becomes (a, b, m) + (b, c, m) + (c, a, m).
+	const int curTriangleIdx = static_cast<int>(triangleIdx);
+	const Triangle oldTriangle = m_Triangles[triangleIdx];
+	const int mIdx = static_cast<int>(AllocateVertex({ .Position = position, .IncidentTriangleIdx = curTriangleIdx }));
+	const int firstTriangleIdx = static_cast<int>(AllocateTriangle(
+		{ .Vertices = { oldTriangle.Vertices[1], oldTriangle.Vertices[2], mIdx },
+		  .Neighbors = { -1, curTriangleIdx, oldTriangle.Neighbors[0] } }));
+	const int secondTriangleIdx = static_cast<int>(AllocateTriangle(
+		{ .Vertices = { oldTriangle.Vertices[2], oldTriangle.Vertices[0], mIdx },
+		  .Neighbors = { curTriangleIdx, firstTriangleIdx, oldTriangle.Neighbors[1] } }));
+	m_Triangles[firstTriangleIdx].Neighbors[0] = secondTriangleIdx;
+	m_Triangles[triangleIdx] = { .Vertices = { oldTriangle.Vertices[0], oldTriangle.Vertices[1], mIdx },
+								 .Neighbors = { firstTriangleIdx, secondTriangleIdx, oldTriangle.Neighbors[2] } };
+
+	ReplaceNeighbor(oldTriangle.Neighbors[0], curTriangleIdx, firstTriangleIdx);
+	ReplaceNeighbor(oldTriangle.Neighbors[1], curTriangleIdx, secondTriangleIdx);
+	ReplaceIncidentTriangle(oldTriangle.Vertices[2], curTriangleIdx, firstTriangleIdx);
+
+	return static_cast<VertexIndex>(mIdx);
+}
+
+bool Mesh::IsCollapseValid(const TriangleIndex triangleIdx, const EdgeIndex edgeIdx) const
+{
+	assert(triangleIdx < GetTriangleCount() && edgeIdx < 3 && "Index out of bound");
+	assert(!IsTriangleDeleted(triangleIdx) && "Deleted triangle");
+
+	const Triangle& curTriangle = m_Triangles[triangleIdx];
+	const VertexIndex firstVertexIdx = curTriangle.Vertices[IndexHelpers::Next[edgeIdx]];
+	const VertexIndex secondVertexIdx = curTriangle.Vertices[IndexHelpers::Previous[edgeIdx]];
+	const bool isBoundaryEdge = curTriangle.Neighbors[edgeIdx] == -1;
+
+	// Collapsing an interior edge between two boundaries pinches the mesh.
+	if(!isBoundaryEdge && IsBoundaryVertex(firstVertexIdx) && IsBoundaryVertex(secondVertexIdx))
+		return false;
+
+	// Link condition: the vertices adjacent to both endpoints are the opposite vertices of the edge.
+	std::vector<VertexIndex> firstLink, secondLink, commonLink;
+	GatherLink(*this, firstVertexIdx, firstLink);
+	GatherLink(*this, secondVertexIdx, secondLink);
+	std::set_intersection(
+		firstLink.begin(), firstLink.end(), secondLink.begin(), secondLink.end(), std::back_inserter(commonLink));
+	if(commonLink.size() != (isBoundaryEdge ? 1 : 2))
+		return false;
+
+	// Each opposite vertex loses a triangle. An interior vertex left with two triangles would fold them onto each
+	// other, a boundary vertex left without triangle would be isolated.
+	for(VertexIndex oppositeVertexIdx : commonLink)
+	{
+		const auto triangleCount = std::ranges::distance(GetTrianglesAroundVertexView(oppositeVertexIdx));
+		if(triangleCount < (IsBoundaryVertex(oppositeVertexIdx) ? 2 : 4))
+			return false;
+	}
+
+	return true;
+}
+
+bool Mesh::CollapseEdge(const TriangleIndex triangleIdx, const EdgeIndex edgeIdx, const Vec3& position)
+{
+	if(!IsCollapseValid(triangleIdx, edgeIdx))
+		return false;
+
+	const VertexIndex keptVertexIdx = m_Triangles[triangleIdx].Vertices[IndexHelpers::Next[edgeIdx]];
+	const VertexIndex removedVertexIdx = m_Triangles[triangleIdx].Vertices[IndexHelpers::Previous[edgeIdx]];
+	const int oppositeTriangleIdx = m_Triangles[triangleIdx].Neighbors[edgeIdx];
+
+	std::vector<TriangleIndex> removedStar;
+	for(TriangleIndex curTriangleIdx : GetTrianglesAroundVertexView(removedVertexIdx))
+		removedStar.push_back(curTriangleIdx);
+
+	std::vector<int> removedTriangles{ static_cast<int>(triangleIdx) };
+	if(oppositeTriangleIdx != -1)
+		removedTriangles.push_back(oppositeTriangleIdx);
+
+	int keptIncidentTriangleIdx = -1;
+	for(int removedTriangleIdx : removedTriangles)
+	{
+		const Triangle& removedTriangle = m_Triangles[removedTriangleIdx];
+		const int keptLocalIdx = GetVertexLocalIndex(removedTriangle, keptVertexIdx);
+		const int removedLocalIdx = GetVertexLocalIndex(removedTriangle, removedVertexIdx);
+		const int oppositeLocalIdx = 3 - keptLocalIdx - removedLocalIdx;
+
+		// The triangles across the two remaining edges become neighbors of each other.
+		const int keptSideNeighborIdx = removedTriangle.Neighbors[removedLocalIdx];
+		const int removedSideNeighborIdx = removedTriangle.Neighbors[keptLocalIdx];
+		ReplaceNeighbor(keptSideNeighborIdx, removedTriangleIdx, removedSideNeighborIdx);
+		ReplaceNeighbor(removedSideNeighborIdx, removedTriangleIdx, keptSideNeighborIdx);
+
+		const int replacementTriangleIdx = keptSideNeighborIdx != -1 ? keptSideNeighborIdx : removedSideNeighborIdx;
+		ReplaceIncidentTriangle(removedTriangle.Vertices[oppositeLocalIdx], removedTriangleIdx, replacementTriangleIdx);
+		if(keptIncidentTriangleIdx == -1)
+			keptIncidentTriangleIdx = replacementTriangleIdx;
+	}
+
+	// Every remaining triangle around the removed vertex now uses the kept vertex.
+	for(TriangleIndex curTriangleIdx : removedStar)
+	{
+		if(std::find(removedTriangles.begin(), removedTriangles.end(), static_cast<int>(curTriangleIdx))
+		   != removedTriangles.end())
+			continue;
+		for(int& curVertexIdx : m_Triangles[curTriangleIdx].Vertices)
 		{
-			curTriangleNormal = Cross(AB, AC);
+			if(static_cast<VertexIndex>(curVertexIdx) == removedVertexIdx)
+				curVertexIdx = static_cast<int>(keptVertexIdx);
 		}
+	}
 
-		curTriangleNormal = Normalize(curTriangleNormal);
+	m_Vertices[keptVertexIdx].Position = position;
+	m_Vertices[keptVertexIdx].IncidentTriangleIdx = keptIncidentTriangleIdx;
 
-		// Compute the remaining vectors of the triangle.
-		const Vec3 BC = glm::normalize(posC - posB);
-		const Vec3 BA = glm::normalize(posA - posB);
+	for(int removedTriangleIdx : removedTriangles)
+		MarkTriangleDeleted(static_cast<TriangleIndex>(removedTriangleIdx));
+	MarkVertexDeleted(removedVertexIdx);
 
-		const Vec3 CA = glm::normalize(posA - posC);
-		const Vec3 CB = glm::normalize(posB - posC);
+	return true;
+}
 
-		// Compute each angle (in randian).
-		const float angleA = Angle(AB, AC);
-		const float angleB = Angle(BC, BA);
-		const float angleC = Angle(CA, CB);
+void Mesh::DeleteVertex(const VertexIndex index)
+{
+	assert(index < GetVertexCount() && !IsVertexDeleted(index) && "Index out of bound");
+
+	if(m_Vertices[index].IncidentTriangleIdx == -1)
+	{
+		MarkVertexDeleted(index);
+		return;
+	}
 
-		// Get a proxy on each vertex of the triangle.
-		const VertexProxy& vertexA = GetVertex(curTriangle.GetVertex(0));
-		const VertexProxy& vertexB = GetVertex(curTriangle.GetVertex(1));
-		const VertexProxy& vertexC = GetVertex(curTriangle.GetVertex(2));
+	// The star is deleted as a whole, deleting its triangles one by one would split the fans of the link vertices.
+	std::vector<TriangleIndex> star;
+	for(TriangleIndex triangleIdx : GetTrianglesAroundVertexView(index))
+		star.push_back(triangleIdx);
+	auto IsInStar = [&star](int triangleIdx)
+	{ return std::find(star.begin(), star.end(), static_cast<TriangleIndex>(triangleIdx)) != star.end(); };
+
+	// Each vertex of the link keeps an incident triangle outside of the star, or is deleted when it has none.
+	for(TriangleIndex triangleIdx : star)
+	{
+		for(int curVertexIdx : m_Triangles[triangleIdx].Vertices)
+		{
+			const int incidentTriangleIdx = m_Vertices[curVertexIdx].IncidentTriangleIdx;
+			if(static_cast<VertexIndex>(curVertexIdx) == index || incidentTriangleIdx == -1
+			   || !IsInStar(incidentTriangleIdx))
+				continue;
 
-		// Add the normal weighted by the related angle as an extra data to each vertex.
-		FlatVertexNormalsExtraData& vertexAExtraData = vertexA.GetOrCreateExtraData<FlatVertexNormalsExtraData>();
-		vertexAExtraData.GetData().emplace_back(curTriangleNormal * angleA);
-		FlatVertexNormalsExtraData& vertexBExtraData = vertexB.GetOrCreateExtraData<FlatVertexNormalsExtraData>();
-		vertexBExtraData.GetData().emplace_back(curTriangleNormal * angleB);
-		FlatVertexNormalsExtraData& vertexCExtraData = vertexC.GetOrCreateExtraData<FlatVertexNormalsExtraData>();
-		vertexCExtraData.GetData().emplace_back(curTriangleNormal * angleC);
+			const TrianglesAroundVertexView ring = GetTrianglesAroundVertexView(static_cast<VertexIndex>(curVertexIdx));
+			const auto replacementIt = std::ranges::find_if(
+				ring, [&](TriangleIndex triangleIdx) { return !IsInStar(static_cast<int>(triangleIdx)); });
+			const int replacementTriangleIdx = replacementIt == ring.end() ? -1 : static_cast<int>(*replacementIt);
+
+			if(replacementTriangleIdx == -1)
+				MarkVertexDeleted(static_cast<VertexIndex>(curVertexIdx));
+			else
+				m_Vertices[curVertexIdx].IncidentTriangleIdx = replacementTriangleIdx;
+		}
 	}
 
-	// Compute the smooth normal for each vertex of the mesh.
-	for(VertexIndex iVertex = 0; iVertex < GetVertexCount(); ++iVertex)
+	for(TriangleIndex triangleIdx : star)
 	{
-		// Get the current vertex and create the extra data that will handle the smooth vertex normal.
-		const VertexProxy& curVertex = GetVertex(iVertex);
-		SmoothVertexNormalExtraData& curVertexNormal = curVertex.GetOrCreateExtraData<SmoothVertexNormalExtraData>();
-
-		// Get the precomputed flat vertex normals weighted by the angles.
-		auto vertexFlatNormals = curVertex.GetExtraData<FlatVertexNormalsExtraData>();
-		assert(vertexFlatNormals != nullptr);
-
-		// Accumulate the weighted flat vertex normals.
-		Vec3 computedNormal = std::accumulate(
-			vertexFlatNormals->GetData().begin(),
-			vertexFlatNormals->GetData().end(),
-			Vec3{ 0., 0., 0. },
-			std::plus<Vec3>());
-
-		if(normalize)
-			computedNormal = Normalize(computedNormal);
-		curVertexNormal.SetData(computedNormal);
-
-		// Erase extra data that is used to compute smooth vertex normal.
-		curVertex.EraseExtraData<FlatVertexNormalsExtraData>();
+		for(int neighborIdx : m_Triangles[triangleIdx].Neighbors)
+			ReplaceNeighbor(neighborIdx, static_cast<int>(triangleIdx), -1);
 	}
+	for(TriangleIndex triangleIdx : star)
+		MarkTriangleDeleted(triangleIdx);
+	MarkVertexDeleted(index);
 }
 
-void Mesh::UpdateVerticesBoundaryStatus()
+void Mesh::DeleteTriangle(const TriangleIndex index)
 {
-	// Add extra data containers for vertices if necessary.
-	if(!HasVerticesExtraDataContainer())
-		AddVerticesExtraDataContainer();
+	assert(index < GetTriangleCount() && !IsTriangleDeleted(index) && "Index out of bound");
 
-	for(VertexIndex iVertex = 0; iVertex < GetVertexCount(); ++iVertex)
+	const Triangle& curTriangle = m_Triangles[index];
+	for(VertexLocalIndex iVertex = 0; iVertex < 3; ++iVertex)
 	{
-		VertexProxy curVertex = GetVertex(iVertex);
-		auto& curBoundaryStatus = curVertex.GetOrCreateExtraData<IsBoundaryVertexExtraData>();
-		curBoundaryStatus.SetData(false);
+		// The two edges incident to the vertex are the ones opposite to the two other vertices.
+		const int curVertexIdx = curTriangle.Vertices[iVertex];
+		const int nextNeighborIdx = curTriangle.Neighbors[IndexHelpers::Next[iVertex]];
+		const int previousNeighborIdx = curTriangle.Neighbors[IndexHelpers::Previous[iVertex]];
+		ReplaceIncidentTriangle(
+			curVertexIdx, static_cast<int>(index), nextNeighborIdx != -1 ? nextNeighborIdx : previousNeighborIdx);
+
+		if(m_Vertices[curVertexIdx].IncidentTriangleIdx == -1)
+			MarkVertexDeleted(static_cast<VertexIndex>(curVertexIdx));
 	}
 
-	for(auto&& curTriangle : m_Triangles)
+	for(int neighborIdx : curTriangle.Neighbors)
+		ReplaceNeighbor(neighborIdx, static_cast<int>(index), -1);
+
+	MarkTriangleDeleted(index);
+}
+
+bool Mesh::IsVertexDeleted(const VertexIndex index) const
+{
+	return index < m_DeletedVertices.size() && m_DeletedVertices[index];
+}
+
+bool Mesh::IsTriangleDeleted(const TriangleIndex index) const
+{
+	return index < m_DeletedTriangles.size() && m_DeletedTriangles[index];
+}
+
+bool Mesh::HasGarbage() const
+{
+	auto IsDeleted = [](uint8_t flag) { return flag != 0; };
+	return std::any_of(m_DeletedVertices.begin(), m_DeletedVertices.end(), IsDeleted)
+		|| std::any_of(m_DeletedTriangles.begin(), m_DeletedTriangles.end(), IsDeleted);
+}
+
+void Mesh::GarbageCollect()
+{
+	// New index of each element (-1 for the deleted ones), from a parallel prefix sum over chunks of elements.
+	auto BuildRemap = [](const std::vector<uint8_t>& deletedFlags, const size_t count, std::vector<int>& remap)
 	{
-		for(EdgeIndex iEdge = 0; iEdge < 3; ++iEdge)
+		constexpr size_t chunkSize = 4096;
+		const size_t chunkCount = (count + chunkSize - 1) / chunkSize;
+		auto IsDeleted = [&deletedFlags](size_t index)
 		{
-			// If the edge opposite to the current vertex is a boundary edge,
-			// set the boundary status on the two incident vertices.
-			if(curTriangle.Neighbors[iEdge] == -1)
+			return index < deletedFlags.size() && deletedFlags[index];
+		};
+
+		std::vector<int> chunkOffsets(chunkCount + 1, 0);
+		ParallelFor(
+			0,
+			chunkCount,
+			[&](size_t iChunk)
+			{
+				int aliveCount = 0;
+				for(size_t index = iChunk * chunkSize; index < std::min(count, (iChunk + 1) * chunkSize); ++index)
+					aliveCount += IsDeleted(index) ? 0 : 1;
+				chunkOffsets[iChunk + 1] = aliveCount;
+			},
+			1);
+		std::partial_sum(chunkOffsets.begin(), chunkOffsets.end(), chunkOffsets.begin());
+
+		remap.resize(count);
+		ParallelFor(
+			0,
+			chunkCount,
+			[&](size_t iChunk)
 			{
-				VertexProxy nextVertex = GetVertex(curTriangle.Vertices[IndexHelpers::Next[iEdge]]);
-				auto& nextBoundaryStatus = nextVertex.GetOrCreateExtraData<IsBoundaryVertexExtraData>();
-				nextBoundaryStatus.SetData(true);
+				int aliveCount = chunkOffsets[iChunk];
+				for(size_t index = iChunk * chunkSize; index < std::min(count, (iChunk + 1) * chunkSize); ++index)
+					remap[index] = IsDeleted(index) ? -1 : aliveCount++;
+			},
+			1);
+
+		return chunkOffsets.back();
+	};
+
+	std::vector<int> vertexRemap, triangleRemap;
+	const int vertexCount = BuildRemap(m_DeletedVertices, m_Vertices.size(), vertexRemap);
+	const int triangleCount = BuildRemap(m_DeletedTriangles, m_Triangles.size(), triangleRemap);
+
+	Remap(vertexRemap, vertexCount, triangleRemap, triangleCount);
 
-				VertexProxy previousVertex = GetVertex(curTriangle.Vertices[IndexHelpers::Previous[iEdge]]);
-				auto& previousBoundaryStatus = previousVertex.GetOrCreateExtraData<IsBoundaryVertexExtraData>();
-				previousBoundaryStatus.SetData(true);
+	m_DeletedVertices.clear();
+	m_DeletedTriangles.clear();
+	m_FreeVertices.clear();
+	m_FreeTriangles.clear();
+}
+
+void Mesh::Remap(
+	const std::vector<int>& vertexRemap,
+	const int vertexCount,
+	const std::vector<int>& triangleRemap,
+	const int triangleCount)
+{
+	assert(vertexRemap.size() == m_Vertices.size() && triangleRemap.size() == m_Triangles.size());
+	NotifyTopologyChanged();
+
+	std::vector<Vertex> vertices(vertexCount);
+	ParallelFor(
+		0,
+		vertexRemap.size(),
+		[&](size_t iVertex)
+		{
+			if(vertexRemap[iVertex] == -1)
+				return;
+
+			Vertex& curVertex = vertices[vertexRemap[iVertex]];
+			curVertex = m_Vertices[iVertex];
+			if(curVertex.IncidentTriangleIdx != -1)
+				curVertex.IncidentTriangleIdx = triangleRemap[curVertex.IncidentTriangleIdx];
+		});
+
+	std::vector<Triangle> triangles(triangleCount);
+	ParallelFor(
+		0,
+		triangleRemap.size(),
+		[&](size_t iTriangle)
+		{
+			if(triangleRemap[iTriangle] == -1)
+				return;
+
+			Triangle& curTriangle = triangles[triangleRemap[iTriangle]];
+			curTriangle = m_Triangles[iTriangle];
+			for(EdgeIndex iEdge = 0; iEdge < 3; ++iEdge)
+			{
+				curTriangle.Vertices[iEdge] = vertexRemap[curTriangle.Vertices[iEdge]];
+				if(curTriangle.Neighbors[iEdge] != -1)
+					curTriangle.Neighbors[iEdge] = triangleRemap[curTriangle.Neighbors[iEdge]];
 			}
-		}
+		});
+
+	// Keep the extra data attached to the remaining elements.
+	auto RemapContainers = [](std::vector<ExtraDataContainer>& containers, const std::vector<int>& remap, int count)
+	{
+		if(containers.empty())
+			return;
+
+		std::vector<ExtraDataContainer> remappedContainers(count);
+		ParallelFor(
+			0,
+			remap.size(),
+			[&](size_t index)
+			{
+				if(remap[index] != -1)
+					remappedContainers[remap[index]] = std::move(containers[index]);
+			});
+		containers = std::move(remappedContainers);
+	};
+	RemapContainers(m_VerticesExtraDataContainer, vertexRemap, vertexCount);
+	RemapContainers(m_TrianglesExtraDataContainer, triangleRemap, triangleCount);
+
+	m_Vertices = std::move(vertices);
+	m_Triangles = std::move(triangles);
+}
+
+void Mesh::MarkVertexDeleted(const VertexIndex index)
+{
+	NotifyTopologyChanged();
+	if(m_DeletedVertices.size() < m_Vertices.size())
+		m_DeletedVertices.resize(m_Vertices.size(), 0);
+
+	m_Vertices[index].IncidentTriangleIdx = -1;
+	m_DeletedVertices[index] = 1;
+	m_FreeVertices.push_back(index);
+}
+
+void Mesh::MarkTriangleDeleted(const TriangleIndex index)
+{
+	NotifyTopologyChanged();
+	if(m_DeletedTriangles.size() < m_Triangles.size())
+		m_DeletedTriangles.resize(m_Triangles.size(), 0);
+
+	m_DeletedTriangles[index] = 1;
+	m_FreeTriangles.push_back(index);
+}
+
+VertexIndex Mesh::AllocateVertex(const Vertex& vertex)
+{
+	NotifyTopologyChanged();
+	if(m_FreeVertices.empty())
+		return AddVertex(vertex);
+
+	const VertexIndex index = m_FreeVertices.back();
+	m_FreeVertices.pop_back();
+	m_DeletedVertices[index] = 0;
+	m_Vertices[index] = vertex;
+	if(HasVerticesExtraDataContainer())
+		m_VerticesExtraDataContainer[index] = ExtraDataContainer();
+	return index;
+}
+
+TriangleIndex Mesh::AllocateTriangle(const Triangle& triangle)
+{
+	if(m_FreeTriangles.empty())
+		return AddTriangle(triangle);
+
+	NotifyTopologyChanged();
+
+	const TriangleIndex index = m_FreeTriangles.back();
+	m_FreeTriangles.pop_back();
+	m_DeletedTriangles[index] = 0;
+	m_Triangles[index] = triangle;
+	if(HasTrianglesExtraDataContainer())
+		m_TrianglesExtraDataContainer[index] = ExtraDataContainer();
+	return index;
+}
+
+void Mesh::ReplaceNeighbor(const int triangleIdx, const int oldNeighborIdx, const int newNeighborIdx)
+{
+	if(triangleIdx == -1)
+		return;
+
+	for(int& curNeighborIdx : m_Triangles[triangleIdx].Neighbors)
+	{
+		if(curNeighborIdx == oldNeighborIdx)
+			curNeighborIdx = newNeighborIdx;
 	}
 }
+
+void Mesh::ReplaceIncidentTriangle(const int vertexIdx, const int oldTriangleIdx, const int newTriangleIdx)
+{
+	if(m_Vertices[vertexIdx].IncidentTriangleIdx == oldTriangleIdx)
+		m_Vertices[vertexIdx].IncidentTriangleIdx = newTriangleIdx;
+}
 } // namespace Data::Surface
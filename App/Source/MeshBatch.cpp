@@ -0,0 +1,139 @@
+#include "Application/MeshBatch.h"
+
+#include "Core/Parallel.h"
+#include "Core/Profiler.h"
+
+#include <algorithm>
+#include <cassert>
+
+using namespace Core::BaseType;
+using namespace Core::Parallel;
+
+namespace
+{
+/// @brief Number of chunks regenerated by each task, a chunk takes a few microseconds.
+constexpr size_t ChunkGrainSize = 4;
+} // namespace
+
+namespace Utilitary::Surface
+{
+uint32_t MeshBatch::AddPart(const Data::Surface::Mesh& mesh)
+{
+	ProfileScope("MeshBatch::AddPart");
+
+	const PackedMeshLayout layout = MeshPacker::ComputeLayout(mesh);
+	BatchPart& part = m_Parts.emplace_back();
+	part.FirstIndex = static_cast<uint32_t>(m_Indices.size());
+	part.IndexCount = layout.GetIndexCount();
+	part.BaseVertex = static_cast<int32_t>(m_Vertices.size());
+	part.VertexCount = layout.GetVertexCount();
+
+	m_Vertices.resize(m_Vertices.size() + part.VertexCount);
+	m_Indices.resize(m_Indices.size() + part.IndexCount);
+	MeshPacker::PackVertices(mesh, layout, std::span(m_Vertices).subspan(static_cast<size_t>(part.BaseVertex)));
+	MeshPacker::PackIndices(layout, std::span(m_Indices).subspan(part.FirstIndex));
+	return static_cast<uint32_t>(m_Parts.size() - 1);
+}
+
+uint32_t MeshBatch::AddInstance(const uint32_t part, const Mat4& transform)
+{
+	assert(part < m_Parts.size() && "Unknown part");
+
+	uint32_t slot = GetSlotCount();
+	if(!m_FreeSlots.empty())
+	{
+		slot = m_FreeSlots.back();
+		m_FreeSlots.pop_back();
+	}
+	else
+	{
+		m_Instances.emplace_back();
+		m_Commands.emplace_back();
+		m_Transforms.emplace_back(1.f);
+		m_IsChunkChanged.resize(GetChunkCount(), 0);
+	}
+
+	Instance& instance = m_Instances[slot];
+	instance.Transform = transform;
+	instance.Part = part;
+	instance.Visible = true;
+	MarkChanged(slot);
+	return slot;
+}
+
+void MeshBatch::RemoveInstance(const uint32_t instance)
+{
+	assert(instance < GetSlotCount() && m_Instances[instance].Part != InvalidIndex && "Unknown instance");
+
+	m_Instances[instance].Part = InvalidIndex;
+	m_FreeSlots.push_back(instance);
+	MarkChanged(instance);
+}
+
+void MeshBatch::SetTransform(const uint32_t instance, const Mat4& transform)
+{
+	assert(instance < GetSlotCount() && m_Instances[instance].Part != InvalidIndex && "Unknown instance");
+
+	m_Instances[instance].Transform = transform;
+	MarkChanged(instance);
+}
+
+void MeshBatch::SetVisible(const uint32_t instance, const bool visible)
+{
+	assert(instance < GetSlotCount() && m_Instances[instance].Part != InvalidIndex && "Unknown instance");
+
+	if(m_Instances[instance].Visible == visible)
+		return;
+	m_Instances[instance].Visible = visible;
+	MarkChanged(instance);
+}
+
+std::span<const uint32_t> MeshBatch::UpdateCommands()
+{
+	ProfileScope("MeshBatch::UpdateCommands");
+
+	// The sorted chunks let the uploads merge the neighbor ones.
+	m_UpdatedChunks.swap(m_ChangedChunks);
+	m_ChangedChunks.clear();
+	std::ranges::sort(m_UpdatedChunks);
+	ParallelFor(
+		0,
+		m_UpdatedChunks.size(),
+		[&](const size_t iPosition)
+		{
+			const uint32_t iChunk = m_UpdatedChunks[iPosition];
+			m_IsChunkChanged[iChunk] = 0;
+			const uint32_t chunkEnd = std::min(GetSlotCount(), (iChunk + 1) * InstanceChunkSize);
+			for(uint32_t iSlot = iChunk * InstanceChunkSize; iSlot < chunkEnd; ++iSlot)
+			{
+				const Instance& instance = m_Instances[iSlot];
+				DrawElementsIndirectCommand& command = m_Commands[iSlot];
+				if(instance.Part == InvalidIndex)
+				{
+					// Empty draw, the slot stays in place until it is reused.
+					command = DrawElementsIndirectCommand{ .BaseInstance = iSlot };
+					continue;
+				}
+
+				const BatchPart& part = m_Parts[instance.Part];
+				command.Count = part.IndexCount;
+				command.InstanceCount = instance.Visible ? 1 : 0;
+				command.FirstIndex = part.FirstIndex;
+				command.BaseVertex = part.BaseVertex;
+				command.BaseInstance = iSlot;
+				m_Transforms[iSlot] = instance.Transform;
+			}
+		},
+		ChunkGrainSize);
+	return m_UpdatedChunks;
+}
+
+void MeshBatch::MarkChanged(const uint32_t slot)
+{
+	const uint32_t iChunk = slot / InstanceChunkSize;
+	if(m_IsChunkChanged[iChunk] != 0)
+		return;
+	m_IsChunkChanged[iChunk] = 1;
+	m_ChangedChunks.push_back(iChunk);
+}
+} // namespace Utilitary::Surface
@@ -0,0 +1,161 @@
+#include "Application/MeshBoundary.h"
+
+#include "Core/Parallel.h"
+#include "Core/Profiler.h"
+
+#include <atomic>
+#include <bit>
+#include <limits>
+#include <numeric>
+#include <utility>
+
+using namespace Core::BaseType;
+using namespace Core::Parallel;
+using namespace Data::Primitive;
+using namespace Data::Surface;
+using namespace Utilitary::Primitive;
+
+namespace
+{
+/// @brief Index of the edges without following edge.
+constexpr uint32_t InvalidEdge = std::numeric_limits<uint32_t>::max();
+
+/// @brief Find the boundary edge leaving the end vertex of a boundary edge, by turning around the vertex.
+/// @return The triangle and local index of the edge, the triangle being -1 if the fan of the vertex is broken.
+std::pair<int, EdgeIndex> FindNextBoundaryEdge(
+	const Mesh& mesh, const TriangleIndex triangleIdx, const EdgeIndex edgeIdx)
+{
+	// The edge runs from Vertices[Next[edgeIdx]] to Vertices[Previous[edgeIdx]], the edge of a triangle leaving a
+	// vertex of local index i is the one of index Previous[i].
+	const VertexIndex endVertexIdx = mesh.GetTriangleData(triangleIdx).Vertices[IndexHelpers::Previous[edgeIdx]];
+	int curTriangleIdx = static_cast<int>(triangleIdx);
+	EdgeIndex curEdgeIdx = IndexHelpers::Next[edgeIdx];
+	for(uint32_t iStep = 0; iStep < mesh.GetTriangleCount(); ++iStep)
+	{
+		const int neighborIdx = mesh.GetTriangleData(curTriangleIdx).Neighbors[curEdgeIdx];
+		if(neighborIdx == -1)
+			return { curTriangleIdx, curEdgeIdx };
+		if(neighborIdx == static_cast<int>(triangleIdx) || static_cast<uint32_t>(neighborIdx) >= mesh.GetTriangleCount()
+		   || mesh.IsTriangleDeleted(neighborIdx))
+			break;
+
+		// The neighbor runs through the common edge towards the vertex, the next edge leaves it.
+		const int localIdx = GetVertexLocalIndex(mesh.GetTriangleData(neighborIdx), endVertexIdx);
+		if(localIdx == -1)
+			break;
+		curTriangleIdx = neighborIdx;
+		curEdgeIdx = IndexHelpers::Previous[localIdx];
+	}
+	return { -1, 0 };
+}
+} // namespace
+
+namespace Utilitary::Surface
+{
+BoundaryLoops MeshBoundary::ExtractBoundaryLoops(const Mesh& mesh)
+{
+	ProfileScope("MeshBoundary::ExtractBoundaryLoops");
+
+	const uint32_t triangleCount = mesh.GetTriangleCount();
+	auto GetBoundaryMask = [&mesh](const size_t triangleIdx)
+	{
+		if(mesh.IsTriangleDeleted(static_cast<TriangleIndex>(triangleIdx)))
+			return 0u;
+		uint32_t mask = 0;
+		const auto& neighbors = mesh.GetTriangleData(static_cast<TriangleIndex>(triangleIdx)).Neighbors;
+		for(EdgeIndex iEdge = 0; iEdge < 3; ++iEdge)
+			mask |= neighbors[iEdge] == -1 ? 1u << iEdge : 0u;
+		return mask;
+	};
+
+	// Number the boundary edges by triangle, then by local index.
+	std::vector<uint32_t> edgeOffsets(static_cast<size_t>(triangleCount) + 1, 0);
+	ParallelFor(
+		0,
+		triangleCount,
+		[&](const size_t iTriangle)
+		{
+			edgeOffsets[iTriangle + 1] = static_cast<uint32_t>(std::popcount(GetBoundaryMask(iTriangle)));
+		});
+	std::inclusive_scan(edgeOffsets.begin(), edgeOffsets.end(), edgeOffsets.begin());
+	const uint32_t edgeCount = edgeOffsets.back();
+	auto GetEdgeId = [&](const TriangleIndex triangleIdx, const EdgeIndex edgeIdx)
+	{
+		const uint32_t lowerEdgesMask = GetBoundaryMask(triangleIdx) & ((1u << edgeIdx) - 1);
+		return edgeOffsets[triangleIdx] + static_cast<uint32_t>(std::popcount(lowerEdgesMask));
+	};
+
+	BoundaryLoops boundary;
+	boundary.VertexFlags.Resize(mesh.GetVertexCount());
+	std::vector<TriangleIndex> edgeTriangles(edgeCount);
+	std::vector<EdgeIndex> edgeLocalIndices(edgeCount);
+	ParallelFor(
+		0,
+		triangleCount,
+		[&](const size_t iTriangle)
+		{
+			const Triangle& triangle = mesh.GetTriangleData(static_cast<TriangleIndex>(iTriangle));
+			uint32_t edgeId = edgeOffsets[iTriangle];
+			const uint32_t mask = GetBoundaryMask(iTriangle);
+			for(EdgeIndex iEdge = 0; iEdge < 3; ++iEdge)
+			{
+				if((mask & (1u << iEdge)) == 0)
+					continue;
+				edgeTriangles[edgeId] = static_cast<TriangleIndex>(iTriangle);
+				edgeLocalIndices[edgeId++] = iEdge;
+				boundary.VertexFlags.SetAtomic(triangle.Vertices[IndexHelpers::Next[iEdge]]);
+				boundary.VertexFlags.SetAtomic(triangle.Vertices[IndexHelpers::Previous[iEdge]]);
+			}
+		});
+
+	// Link each boundary edge to the one leaving its end vertex.
+	std::vector<uint32_t> nextEdges(edgeCount, InvalidEdge);
+	std::vector<uint8_t> hasPreviousEdge(edgeCount, 0);
+	ParallelFor(
+		0,
+		edgeCount,
+		[&](const size_t iEdge)
+		{
+			const auto [nextTriangleIdx, nextEdgeIdx] =
+				FindNextBoundaryEdge(mesh, edgeTriangles[iEdge], edgeLocalIndices[iEdge]);
+			if(nextTriangleIdx == -1)
+				return;
+			nextEdges[iEdge] = GetEdgeId(static_cast<TriangleIndex>(nextTriangleIdx), nextEdgeIdx);
+			std::atomic_ref<uint8_t>(hasPreviousEdge[nextEdges[iEdge]]).store(1, std::memory_order_relaxed);
+		});
+
+	// Follow the links, the open loops from their first edge, then the closed ones from their lowest edge.
+	boundary.LoopOffsets.reserve(64);
+	boundary.LoopVertices.reserve(edgeCount);
+	boundary.LoopTriangles.reserve(edgeCount);
+	boundary.LoopEdges.reserve(edgeCount);
+	std::vector<uint8_t> visitedFlags(edgeCount, 0);
+	auto AppendLoop = [&](const uint32_t firstEdge)
+	{
+		uint32_t curEdge = firstEdge;
+		while(curEdge != InvalidEdge && !visitedFlags[curEdge])
+		{
+			visitedFlags[curEdge] = 1;
+			const Triangle& triangle = mesh.GetTriangleData(edgeTriangles[curEdge]);
+			const EdgeIndex edgeIdx = edgeLocalIndices[curEdge];
+			boundary.LoopVertices.push_back(static_cast<VertexIndex>(triangle.Vertices[IndexHelpers::Next[edgeIdx]]));
+			boundary.LoopTriangles.push_back(edgeTriangles[curEdge]);
+			boundary.LoopEdges.push_back(edgeIdx);
+			curEdge = nextEdges[curEdge];
+		}
+		boundary.LoopOffsets.push_back(static_cast<uint32_t>(boundary.LoopVertices.size()));
+	};
+	for(uint32_t iEdge = 0; iEdge < edgeCount; ++iEdge)
+	{
+		if(!hasPreviousEdge[iEdge])
+			AppendLoop(iEdge);
+	}
+	for(uint32_t iEdge = 0; iEdge < edgeCount; ++iEdge)
+	{
+		if(!visitedFlags[iEdge])
+			AppendLoop(iEdge);
+	}
+
+	return boundary;
+}
+} // namespace Utilitary::Surface
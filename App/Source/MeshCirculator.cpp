@@ -264,4 +264,15 @@ Mesh::TrianglesAroundVertexRange Mesh::GetTrianglesAroundVertex(const VertexInde
 {
 	return TrianglesAroundVertexRange(*this, index);
 }
+
+//==========================Views==========================//
+VerticesAroundVertexView Mesh::GetVerticesAroundVertexView(const VertexIndex index) const
+{
+	return VerticesAroundVertexView(m_Triangles.data(), index, m_Vertices[index].IncidentTriangleIdx);
+}
+
+TrianglesAroundVertexView Mesh::GetTrianglesAroundVertexView(const VertexIndex index) const
+{
+	return TrianglesAroundVertexView(m_Triangles.data(), index, m_Vertices[index].IncidentTriangleIdx);
+}
 } // namespace Data::Surface
@@ -0,0 +1,437 @@
+#include "Application/MeshClusters.h"
+
+#include "Application/MeshDecimator.h"
+#include "Application/MeshGeometry.h"
+#include "Application/MeshReorderer.h"
+#include "Core/MathHelpers.h"
+#include "Core/Parallel.h"
+#include "Core/Profiler.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <span>
+#include <utility>
+
+using namespace Core::BaseType;
+using namespace Core::Math::Geometry;
+using namespace Core::Parallel;
+using namespace Data::Primitive;
+using namespace Data::Surface;
+using namespace Utilitary::Surface;
+
+namespace
+{
+/// @brief Key of the deleted triangles, sorted after the keys of the curve which fit in 63 bits.
+constexpr uint64_t DeletedTriangleKey = std::numeric_limits<uint64_t>::max();
+
+/// @brief Maximum depth of the grid of cells, 2M cells.
+constexpr uint32_t MaxCellGridDepth = 7;
+
+/// @brief Number of cells handled by each chunk of the selection.
+constexpr size_t CellGrainSize = 4;
+
+/// @brief Quantization of the positions on the grid of the curve keys, over the bounding cube of the source mesh.
+/// @note The coarse levels use the frame of the source mesh, so that their cells match.
+struct CurveFrame
+{
+	Vec3 MinCorner{ 0.f };
+	float Scale = 0.f;
+
+	/// @brief Get the key of a point along the Hilbert curve, clamped to the cube.
+	uint64_t GetKey(const Vec3& position) const
+	{
+		constexpr float maxCoord = static_cast<float>((1u << MeshReorderer::CurveBitsPerAxis) - 1);
+		std::array<uint32_t, 3> coords;
+		for(int iAxis = 0; iAxis < 3; ++iAxis)
+		{
+			const float coord = (position[iAxis] - MinCorner[iAxis]) * Scale + 0.5f;
+			coords[iAxis] = static_cast<uint32_t>(std::clamp(coord, 0.f, maxCoord));
+		}
+		return MeshReorderer::ComputeCurveKey(coords, SpaceFillingCurve::Hilbert);
+	}
+};
+
+/// @brief Get the sphere bounding a set of spheres, centered on the middle of their bounding box.
+BoundingSphere MergeSpheres(std::span<const BoundingSphere> spheres)
+{
+	AxisAlignedBox box;
+	for(const BoundingSphere& sphere : spheres)
+	{
+		if(sphere.Radius < 0.f)
+			continue;
+		box.Min = glm::min(box.Min, sphere.Center - Vec3{ sphere.Radius });
+		box.Max = glm::max(box.Max, sphere.Center + Vec3{ sphere.Radius });
+	}
+	if(box.IsEmpty())
+		return BoundingSphere{};
+
+	BoundingSphere merged{ 0.5f * (box.Min + box.Max), 0.f };
+	for(const BoundingSphere& sphere : spheres)
+	{
+		if(sphere.Radius >= 0.f)
+			merged.Radius = std::max(merged.Radius, Length(sphere.Center - merged.Center) + sphere.Radius);
+	}
+	return merged;
+}
+
+/// @brief Get the unit normal of a triangle, zero if it is degenerate.
+Vec3 GetUnitNormal(const std::vector<Vertex>& vertices, const Triangle& triangle)
+{
+	const Vec3& a = vertices[triangle.Vertices[0]].Position;
+	const Vec3 normal = Cross(vertices[triangle.Vertices[1]].Position - a, vertices[triangle.Vertices[2]].Position - a);
+	const float length = Length(normal);
+	return length > 0.f ? normal / length : Vec3{ 0.f };
+}
+
+/// @brief Compute the bounding sphere and the normal cone of the triangles of a cluster.
+void ComputeClusterBounds(const Mesh& mesh, std::span<const TriangleIndex> triangles, MeshCluster& cluster)
+{
+	const std::vector<Vertex>& vertices = mesh.GetVertices();
+	const std::vector<Triangle>& meshTriangles = mesh.GetTriangles();
+
+	// Degenerate triangles face no direction, they do not widen the cone.
+	AxisAlignedBox box;
+	Vec3 normalSum{ 0.f };
+	for(const TriangleIndex iTriangle : triangles)
+	{
+		for(const int iVertex : meshTriangles[iTriangle].Vertices)
+		{
+			box.Min = glm::min(box.Min, vertices[iVertex].Position);
+			box.Max = glm::max(box.Max, vertices[iVertex].Position);
+		}
+		normalSum += GetUnitNormal(vertices, meshTriangles[iTriangle]);
+	}
+
+	const float sumLength = Length(normalSum);
+	const bool hasCone = sumLength > 1e-3f * static_cast<float>(triangles.size());
+	cluster.Bounds = BoundingSphere{ 0.5f * (box.Min + box.Max), 0.f };
+	cluster.Cone = NormalCone{};
+	if(hasCone)
+	{
+		cluster.Cone.Axis = normalSum / sumLength;
+		cluster.Cone.Cutoff = 1.f;
+	}
+	for(const TriangleIndex iTriangle : triangles)
+	{
+		for(const int iVertex : meshTriangles[iTriangle].Vertices)
+		{
+			cluster.Bounds.Radius =
+				std::max(cluster.Bounds.Radius, Length(vertices[iVertex].Position - cluster.Bounds.Center));
+		}
+		const Vec3 normal = GetUnitNormal(vertices, meshTriangles[iTriangle]);
+		if(hasCone && normal != Vec3{ 0.f })
+			cluster.Cone.Cutoff = std::min(cluster.Cone.Cutoff, Dot(cluster.Cone.Axis, normal));
+	}
+}
+
+/// @brief Compute the mean length of the edges of the triangles, each interior edge being counted twice.
+float ComputeMeanEdgeLength(const Mesh& mesh, std::span<const TriangleIndex> triangles)
+{
+	if(triangles.empty())
+		return 0.f;
+
+	const std::vector<Vertex>& vertices = mesh.GetVertices();
+	const std::vector<Triangle>& meshTriangles = mesh.GetTriangles();
+	const double lengthSum = ParallelReduce(
+		0,
+		triangles.size(),
+		0.,
+		[&](const size_t chunkBegin, const size_t chunkEnd)
+		{
+			double chunkSum = 0.;
+			for(size_t iPosition = chunkBegin; iPosition < chunkEnd; ++iPosition)
+			{
+				const std::array<int, 3>& corners = meshTriangles[triangles[iPosition]].Vertices;
+				for(EdgeIndex iEdge = 0; iEdge < 3; ++iEdge)
+				{
+					chunkSum += Length(
+						vertices[corners[(iEdge + 1) % 3]].Position - vertices[corners[iEdge]].Position);
+				}
+			}
+			return chunkSum;
+		},
+		[](const double lhs, const double rhs) { return lhs + rhs; },
+		4096,
+		ReductionMode::Deterministic);
+	return static_cast<float>(lengthSum / (3. * static_cast<double>(triangles.size())));
+}
+
+/// @brief Sort the triangles of a level along the curve and cut them into clusters within the cells.
+void BuildLevelClusters(
+	ClusterLevel& level, const CurveFrame& frame, const ClusterSpecification& specification, const uint32_t gridDepth)
+{
+	const Mesh& mesh = *level.LevelMesh;
+	const std::vector<Vertex>& vertices = mesh.GetVertices();
+	const std::vector<Triangle>& triangles = mesh.GetTriangles();
+
+	std::vector<std::pair<uint64_t, TriangleIndex>> keys(triangles.size());
+	ParallelFor(
+		0,
+		triangles.size(),
+		[&](const size_t iTriangle)
+		{
+			const TriangleIndex triangleIdx = static_cast<TriangleIndex>(iTriangle);
+			if(mesh.IsTriangleDeleted(triangleIdx))
+			{
+				keys[iTriangle] = { DeletedTriangleKey, triangleIdx };
+				return;
+			}
+			const std::array<int, 3>& corners = triangles[iTriangle].Vertices;
+			const Vec3 centroid =
+				(vertices[corners[0]].Position + vertices[corners[1]].Position + vertices[corners[2]].Position) / 3.f;
+			keys[iTriangle] = { frame.GetKey(centroid), triangleIdx };
+		});
+	std::sort(keys.begin(), keys.end());
+	const auto liveEnd = std::lower_bound(
+		keys.begin(), keys.end(), std::pair<uint64_t, TriangleIndex>{ DeletedTriangleKey, 0 });
+
+	level.Triangles.resize(static_cast<size_t>(liveEnd - keys.begin()));
+	std::transform(keys.begin(), liveEnd, level.Triangles.begin(), [](const auto& key) { return key.second; });
+
+	// The highest bits of the key give the cell along the curve, the triangles of a cell are consecutive. Each run is
+	// cut into chunks of even sizes.
+	const uint32_t cellShift = 3 * (MeshReorderer::CurveBitsPerAxis - gridDepth);
+	const uint32_t maxTriangleCount = std::max(specification.MaxClusterTriangleCount, 1u);
+	level.CellClusterOffsets.assign((size_t{ 1 } << (3 * gridDepth)) + 1, 0);
+	size_t runBegin = 0;
+	while(runBegin < level.Triangles.size())
+	{
+		const uint64_t cell = keys[runBegin].first >> cellShift;
+		size_t runEnd = runBegin + 1;
+		while(runEnd < level.Triangles.size() && keys[runEnd].first >> cellShift == cell)
+			++runEnd;
+
+		const size_t runLength = runEnd - runBegin;
+		const size_t clusterCount = (runLength + maxTriangleCount - 1) / maxTriangleCount;
+		for(size_t iCluster = 0; iCluster < clusterCount; ++iCluster)
+		{
+			const size_t first = runBegin + runLength * iCluster / clusterCount;
+			const size_t last = runBegin + runLength * (iCluster + 1) / clusterCount;
+			MeshCluster& cluster = level.Clusters.emplace_back();
+			cluster.FirstTriangle = static_cast<uint32_t>(first);
+			cluster.TriangleCount = static_cast<uint32_t>(last - first);
+		}
+		level.CellClusterOffsets[cell + 1] = static_cast<uint32_t>(clusterCount);
+		runBegin = runEnd;
+	}
+	std::inclusive_scan(
+		level.CellClusterOffsets.begin(), level.CellClusterOffsets.end(), level.CellClusterOffsets.begin());
+
+	ParallelFor(
+		0,
+		level.Clusters.size(),
+		[&](const size_t iCluster)
+		{
+			MeshCluster& cluster = level.Clusters[iCluster];
+			ComputeClusterBounds(
+				mesh,
+				std::span<const TriangleIndex>(level.Triangles).subspan(cluster.FirstTriangle, cluster.TriangleCount),
+				cluster);
+		},
+		64);
+	level.Error = ComputeMeanEdgeLength(mesh, level.Triangles);
+}
+
+/// @brief Get the coarsest level whose error seen from the camera stays under the threshold of the view.
+size_t SelectLevel(const ClusterHierarchy& hierarchy, const BoundingSphere& cellBounds, const ClusterView& view)
+{
+	if(view.ProjectionScale <= 0.f)
+		return 0;
+
+	const float distance = Length(cellBounds.Center - view.CameraPosition) - cellBounds.Radius;
+	if(distance <= 0.f)
+		return 0;
+	const float maxError = view.MaxScreenError * distance / view.ProjectionScale;
+	for(size_t iLevel = hierarchy.Levels.size() - 1; iLevel > 0; --iLevel)
+	{
+		if(hierarchy.Levels[iLevel].Error <= maxError)
+			return iLevel;
+	}
+	return 0;
+}
+} // namespace
+
+namespace Utilitary::Surface
+{
+ClusterHierarchy MeshClusters::BuildHierarchy(const Mesh& mesh, const ClusterSpecification& specification)
+{
+	ProfileScope("MeshClusters::BuildHierarchy");
+
+	ClusterHierarchy hierarchy;
+	const uint32_t gridDepth = std::min(specification.CellGridDepth, MaxCellGridDepth);
+	hierarchy.CellsPerAxis = 1u << gridDepth;
+	hierarchy.CellBounds.resize(size_t{ 1 } << (3 * gridDepth));
+
+	// Cubic frame around the source mesh, shared by the levels.
+	const AxisAlignedBox boundingBox = MeshGeometry::ComputeBoundingBox(*mesh.GetPositionBuffers());
+	const Vec3 boxExtent = boundingBox.GetExtent();
+	const float extent = std::max({ boxExtent.x, boxExtent.y, boxExtent.z });
+	const CurveFrame frame{ boundingBox.Min,
+		extent > 0.f ? static_cast<float>((1u << MeshReorderer::CurveBitsPerAxis) - 1) / extent : 0.f };
+
+	ClusterLevel& sourceLevel = hierarchy.Levels.emplace_back();
+	sourceLevel.LevelMesh = &mesh;
+	BuildLevelClusters(sourceLevel, frame, specification, gridDepth);
+
+	while(hierarchy.Levels.size() < specification.MaxLevelCount)
+	{
+		const ClusterLevel& previousLevel = hierarchy.Levels.back();
+		const uint32_t previousCount = static_cast<uint32_t>(previousLevel.Triangles.size());
+		if(previousCount <= specification.MinLevelTriangleCount)
+			break;
+
+		std::unique_ptr<Mesh> coarseMesh = previousLevel.LevelMesh->Clone();
+		DecimationSpecification decimation;
+		decimation.TargetTriangleCount = std::max(previousCount / 2, specification.MinLevelTriangleCount);
+		if(MeshDecimator::DecimateParallel(*coarseMesh, decimation) == 0)
+			break;
+		if(coarseMesh->HasGarbage())
+			coarseMesh->GarbageCollect();
+
+		const float previousError = previousLevel.Error;
+		ClusterLevel& coarseLevel = hierarchy.Levels.emplace_back();
+		coarseLevel.OwnedMesh = std::move(coarseMesh);
+		coarseLevel.LevelMesh = coarseLevel.OwnedMesh.get();
+		BuildLevelClusters(coarseLevel, frame, specification, gridDepth);
+
+		// The selection relies on errors increasing with the levels.
+		coarseLevel.Error = std::max(coarseLevel.Error, previousError);
+	}
+
+	ParallelFor(
+		0,
+		hierarchy.CellBounds.size(),
+		[&](const size_t iCell)
+		{
+			std::vector<BoundingSphere> spheres;
+			for(const ClusterLevel& level : hierarchy.Levels)
+			{
+				for(uint32_t iCluster = level.CellClusterOffsets[iCell]; iCluster < level.CellClusterOffsets[iCell + 1];
+					++iCluster)
+					spheres.push_back(level.Clusters[iCluster].Bounds);
+			}
+			hierarchy.CellBounds[iCell] = MergeSpheres(spheres);
+		},
+		16);
+	return hierarchy;
+}
+
+std::array<Vec4, 6> MeshClusters::ExtractFrustumPlanes(const Mat4& viewProjection)
+{
+	// Gribb and Hartmann: each plane is the last row of the matrix plus or minus another one (column-major storage).
+	const Mat4& m = viewProjection;
+	const auto row = [&](const int iRow) { return Vec4{ m[0][iRow], m[1][iRow], m[2][iRow], m[3][iRow] }; };
+	std::array<Vec4, 6> planes{
+		row(3) + row(0), row(3) - row(0), row(3) + row(1), row(3) - row(1), row(3) + row(2), row(3) - row(2)
+	};
+	for(Vec4& plane : planes)
+	{
+		const float normalLength = Length(Vec3{ plane });
+		if(normalLength > 0.f)
+			plane /= normalLength;
+	}
+	return planes;
+}
+
+bool MeshClusters::IsSphereInFrustum(const std::array<Vec4, 6>& planes, const BoundingSphere& sphere)
+{
+	if(sphere.Radius < 0.f)
+		return false;
+	for(const Vec4& plane : planes)
+	{
+		if(Dot(Vec3{ plane }, sphere.Center) + plane.w < -sphere.Radius)
+			return false;
+	}
+	return true;
+}
+
+bool MeshClusters::IsBackfacing(const BoundingSphere& sphere, const NormalCone& cone, const Vec3& cameraPosition)
+{
+	if(cone.Cutoff <= 0.f || sphere.Radius < 0.f)
+		return false;
+	const Vec3 toCamera = cameraPosition - sphere.Center;
+	const float distance = Length(toCamera);
+	if(distance <= sphere.Radius)
+		return false;
+
+	// The directions from the points of the sphere to the camera deviate by the angle b from the center one, the
+	// normals by the angle a from the axis: every triangle faces away when the angle between the axis and the
+	// direction to the camera exceeds 90 degrees + a + b.
+	const float sinSphere = sphere.Radius / distance;
+	const float cosSphere = std::sqrt(1.f - sinSphere * sinSphere);
+	const float cosCone = cone.Cutoff;
+	const float sinCone = std::sqrt(std::max(1.f - cosCone * cosCone, 0.f));
+	if(cosCone * cosSphere - sinCone * sinSphere <= 0.f)
+		return false;
+	const float sinWidened = sinCone * cosSphere + cosCone * sinSphere;
+	return Dot(cone.Axis, toCamera) < -sinWidened * distance;
+}
+
+ClusterSelection MeshClusters::SelectClusters(const ClusterHierarchy& hierarchy, const ClusterView& view)
+{
+	ProfileScope("MeshClusters::SelectClusters");
+
+	ClusterSelection emptySelection;
+	emptySelection.VisibleClusters.resize(hierarchy.Levels.size());
+	if(hierarchy.Levels.empty())
+		return emptySelection;
+
+	const std::array<Vec4, 6> planes = ExtractFrustumPlanes(view.ViewProjection);
+	return ParallelReduce(
+		0,
+		hierarchy.CellBounds.size(),
+		emptySelection,
+		[&](const size_t chunkBegin, const size_t chunkEnd)
+		{
+			ClusterSelection selection;
+			selection.VisibleClusters.resize(hierarchy.Levels.size());
+			for(size_t iCell = chunkBegin; iCell < chunkEnd; ++iCell)
+			{
+				const BoundingSphere& cellBounds = hierarchy.CellBounds[iCell];
+				if(cellBounds.Radius < 0.f)
+					continue;
+
+				const size_t iLevel = SelectLevel(hierarchy, cellBounds, view);
+				const ClusterLevel& level = hierarchy.Levels[iLevel];
+				const uint32_t clustersBegin = level.CellClusterOffsets[iCell];
+				const uint32_t clustersEnd = level.CellClusterOffsets[iCell + 1];
+				if(view.FrustumCulling && !IsSphereInFrustum(planes, cellBounds))
+				{
+					selection.FrustumCulledCount += clustersEnd - clustersBegin;
+					continue;
+				}
+
+				selection.TestedClusterCount += clustersEnd - clustersBegin;
+				std::vector<uint32_t>& visibleClusters = selection.VisibleClusters[iLevel];
+				for(uint32_t iCluster = clustersBegin; iCluster < clustersEnd; ++iCluster)
+				{
+					const MeshCluster& cluster = level.Clusters[iCluster];
+					if(view.FrustumCulling && !IsSphereInFrustum(planes, cluster.Bounds))
+						++selection.FrustumCulledCount;
+					else if(view.BackfaceCulling && IsBackfacing(cluster.Bounds, cluster.Cone, view.CameraPosition))
+						++selection.BackfaceCulledCount;
+					else
+						visibleClusters.push_back(iCluster);
+				}
+			}
+			return selection;
+		},
+		[](ClusterSelection lhs, ClusterSelection rhs)
+		{
+			for(size_t iLevel = 0; iLevel < lhs.VisibleClusters.size(); ++iLevel)
+			{
+				lhs.VisibleClusters[iLevel].insert(lhs.VisibleClusters[iLevel].end(),
+					rhs.VisibleClusters[iLevel].begin(),
+					rhs.VisibleClusters[iLevel].end());
+			}
+			lhs.TestedClusterCount += rhs.TestedClusterCount;
+			lhs.FrustumCulledCount += rhs.FrustumCulledCount;
+			lhs.BackfaceCulledCount += rhs.BackfaceCulledCount;
+			return lhs;
+		},
+		CellGrainSize,
+		ReductionMode::Deterministic);
+}
+} // namespace Utilitary::Surface
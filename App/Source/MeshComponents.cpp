@@ -0,0 +1,351 @@
+#include "Application/MeshComponents.h"
+
+#include "Core/Profiler.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <numeric>
+
+using namespace Core::BaseType;
+using namespace Core::Parallel;
+using namespace Data::Primitive;
+using namespace Data::Surface;
+
+namespace
+{
+/// @brief Concurrent disjoint sets over the triangles, each set being represented by its lowest triangle.
+/// @note The parents only ever decrease, which keeps the concurrent linking and path halving consistent.
+class ConcurrentUnionFind
+{
+public:
+	explicit ConcurrentUnionFind(const size_t count)
+		: m_Parents(count)
+	{
+		ParallelFor(
+			0,
+			count,
+			[this](const size_t index)
+			{
+				m_Parents[index] = static_cast<uint32_t>(index);
+			});
+	}
+
+	/// @brief Root of the set of an element, the parents met on the way are replaced by their own parent.
+	uint32_t Find(uint32_t index)
+	{
+		while(true)
+		{
+			uint32_t parent = GetParent(index).load(std::memory_order_relaxed);
+			if(parent == index)
+				return index;
+
+			const uint32_t grandParent = GetParent(parent).load(std::memory_order_relaxed);
+			if(grandParent != parent)
+				GetParent(index).compare_exchange_weak(parent, grandParent, std::memory_order_relaxed);
+			index = grandParent;
+		}
+	}
+
+	/// @brief Merge the sets of two elements, the highest root is linked to the lowest one.
+	void Unite(const uint32_t firstIndex, const uint32_t secondIndex)
+	{
+		while(true)
+		{
+			uint32_t firstRoot = Find(firstIndex);
+			uint32_t secondRoot = Find(secondIndex);
+			if(firstRoot == secondRoot)
+				return;
+			if(firstRoot < secondRoot)
+				std::swap(firstRoot, secondRoot);
+
+			// Another thread may have linked the root in the meantime, the roots are then searched again.
+			uint32_t expectedParent = firstRoot;
+			if(GetParent(firstRoot).compare_exchange_strong(expectedParent, secondRoot, std::memory_order_relaxed))
+				return;
+		}
+	}
+
+private:
+	std::atomic_ref<uint32_t> GetParent(const uint32_t index) { return std::atomic_ref<uint32_t>(m_Parents[index]); }
+
+private:
+	std::vector<uint32_t> m_Parents;
+};
+
+/// @brief Check whether a triangle index, possibly -1 or out of range, is part of a component.
+bool IsInComponent(
+	const Utilitary::Surface::ComponentLabeling& labeling, const int triangleIdx, const uint32_t component)
+{
+	return triangleIdx >= 0 && static_cast<size_t>(triangleIdx) < labeling.TriangleLabels.size()
+		&& labeling.TriangleLabels[triangleIdx] == component;
+}
+} // namespace
+
+namespace Utilitary::Surface
+{
+ComponentLabeling MeshComponents::LabelComponents(const Mesh& mesh)
+{
+	ProfileScope("MeshComponents::LabelComponents");
+
+	const uint32_t triangleCount = mesh.GetTriangleCount();
+	ConcurrentUnionFind unionFind(triangleCount);
+	ParallelFor(
+		0,
+		triangleCount,
+		[&](const size_t iTriangle)
+		{
+			const TriangleIndex triangleIdx = static_cast<TriangleIndex>(iTriangle);
+			if(mesh.IsTriangleDeleted(triangleIdx))
+				return;
+
+			// Each pair of neighbors is merged once, from its lowest triangle.
+			for(const int neighborIdx : mesh.GetTriangleData(triangleIdx).Neighbors)
+			{
+				if(neighborIdx <= static_cast<int>(triangleIdx) || static_cast<uint32_t>(neighborIdx) >= triangleCount
+				   || mesh.IsTriangleDeleted(neighborIdx))
+					continue;
+				unionFind.Unite(triangleIdx, static_cast<uint32_t>(neighborIdx));
+			}
+		});
+
+	// The roots are the lowest triangle of their component, numbering them in order gives the labels.
+	ComponentLabeling labeling;
+	labeling.TriangleLabels.resize(triangleCount);
+	std::vector<uint32_t> rootLabels(static_cast<size_t>(triangleCount) + 1, 0);
+	ParallelFor(
+		0,
+		triangleCount,
+		[&](const size_t iTriangle)
+		{
+			const uint32_t root = unionFind.Find(static_cast<uint32_t>(iTriangle));
+			labeling.TriangleLabels[iTriangle] = root;
+			if(root == iTriangle && !mesh.IsTriangleDeleted(root))
+				rootLabels[iTriangle + 1] = 1;
+		});
+	std::inclusive_scan(rootLabels.begin(), rootLabels.end(), rootLabels.begin());
+
+	const uint32_t componentCount = rootLabels.back();
+	labeling.TriangleOffsets.assign(static_cast<size_t>(componentCount) + 1, 0);
+	ParallelFor(
+		0,
+		triangleCount,
+		[&](const size_t iTriangle)
+		{
+			if(mesh.IsTriangleDeleted(static_cast<TriangleIndex>(iTriangle)))
+			{
+				labeling.TriangleLabels[iTriangle] = ComponentLabeling::InvalidLabel;
+				return;
+			}
+			const uint32_t label = rootLabels[labeling.TriangleLabels[iTriangle]];
+			labeling.TriangleLabels[iTriangle] = label;
+			std::atomic_ref<uint32_t>(labeling.TriangleOffsets[label + 1]).fetch_add(1, std::memory_order_relaxed);
+		});
+	std::vector<uint32_t>& offsets = labeling.TriangleOffsets;
+	std::inclusive_scan(offsets.begin(), offsets.end(), offsets.begin());
+
+	// Bucket the triangles by component, then restore their order inside each bucket.
+	std::vector<uint32_t> insertionIndices(offsets.begin(), offsets.end() - 1);
+	labeling.Triangles.resize(offsets.back());
+	ParallelFor(
+		0,
+		triangleCount,
+		[&](const size_t iTriangle)
+		{
+			const uint32_t label = labeling.TriangleLabels[iTriangle];
+			if(label == ComponentLabeling::InvalidLabel)
+				return;
+			const uint32_t insertionIdx =
+				std::atomic_ref<uint32_t>(insertionIndices[label]).fetch_add(1, std::memory_order_relaxed);
+			labeling.Triangles[insertionIdx] = static_cast<TriangleIndex>(iTriangle);
+		});
+	ParallelFor(
+		0,
+		componentCount,
+		[&](const size_t iComponent)
+		{
+			std::sort(labeling.Triangles.begin() + labeling.TriangleOffsets[iComponent],
+					  labeling.Triangles.begin() + labeling.TriangleOffsets[iComponent + 1]);
+		},
+		64);
+
+	return labeling;
+}
+
+std::unique_ptr<Mesh> MeshComponents::ExtractComponent(
+	const Mesh& mesh, const ComponentLabeling& labeling, const uint32_t component)
+{
+	assert(component < labeling.GetComponentCount() && "Invalid component index.");
+
+	const std::span<const TriangleIndex> triangles = labeling.GetTriangles(component);
+
+	// The vertices of the component, by increasing index.
+	std::vector<VertexIndex> vertices;
+	vertices.reserve(triangles.size() * 3);
+	for(const TriangleIndex triangleIdx : triangles)
+		for(const int vertexIdx : mesh.GetTriangleData(triangleIdx).Vertices)
+			vertices.push_back(static_cast<VertexIndex>(vertexIdx));
+	std::sort(vertices.begin(), vertices.end());
+	vertices.erase(std::unique(vertices.begin(), vertices.end()), vertices.end());
+
+	const auto getLocalVertexIdx = [&vertices](const int vertexIdx)
+	{
+		return static_cast<int>(std::lower_bound(vertices.begin(), vertices.end(), vertexIdx) - vertices.begin());
+	};
+	const auto getLocalTriangleIdx = [&triangles](const int triangleIdx)
+	{
+		return static_cast<int>(std::lower_bound(triangles.begin(), triangles.end(), triangleIdx) - triangles.begin());
+	};
+
+	auto componentMesh = std::make_unique<Mesh>();
+	componentMesh->m_Triangles.resize(triangles.size());
+	ParallelFor(
+		0,
+		triangles.size(),
+		[&](const size_t iTriangle)
+		{
+			const Triangle& triangle = mesh.GetTriangleData(triangles[iTriangle]);
+			Triangle& componentTriangle = componentMesh->m_Triangles[iTriangle];
+			for(EdgeIndex iEdge = 0; iEdge < 3; ++iEdge)
+			{
+				componentTriangle.Vertices[iEdge] = getLocalVertexIdx(triangle.Vertices[iEdge]);
+				const int neighborIdx = triangle.Neighbors[iEdge];
+				componentTriangle.Neighbors[iEdge] = IsInComponent(labeling, neighborIdx, component)
+					? getLocalTriangleIdx(neighborIdx)
+					: -1;
+			}
+		});
+
+	// A vertex keeps its incident triangle if it belongs to the component, it gets the first one around it otherwise.
+	componentMesh->m_Vertices.resize(vertices.size());
+	ParallelFor(
+		0,
+		vertices.size(),
+		[&](const size_t iVertex)
+		{
+			const Vertex& vertex = mesh.GetVertexData(vertices[iVertex]);
+			const int incidentTriangleIdx = vertex.IncidentTriangleIdx;
+			componentMesh->m_Vertices[iVertex] = {
+				.Position = vertex.Position,
+				.IncidentTriangleIdx = IsInComponent(labeling, incidentTriangleIdx, component)
+					? getLocalTriangleIdx(incidentTriangleIdx)
+					: -1,
+			};
+		});
+	for(size_t iTriangle = 0; iTriangle < triangles.size(); ++iTriangle)
+	{
+		for(const int vertexIdx : componentMesh->m_Triangles[iTriangle].Vertices)
+		{
+			Vertex& vertex = componentMesh->m_Vertices[vertexIdx];
+			if(vertex.IncidentTriangleIdx == -1)
+				vertex.IncidentTriangleIdx = static_cast<int>(iTriangle);
+		}
+	}
+
+	if(mesh.HasVerticesExtraDataContainer())
+	{
+		componentMesh->m_VerticesExtraDataContainer.resize(vertices.size());
+		for(size_t iVertex = 0; iVertex < vertices.size(); ++iVertex)
+			componentMesh->m_VerticesExtraDataContainer[iVertex] = mesh.m_VerticesExtraDataContainer[vertices[iVertex]];
+	}
+	if(mesh.HasTrianglesExtraDataContainer())
+	{
+		componentMesh->m_TrianglesExtraDataContainer.resize(triangles.size());
+		for(size_t iTriangle = 0; iTriangle < triangles.size(); ++iTriangle)
+			componentMesh->m_TrianglesExtraDataContainer[iTriangle] =
+				mesh.m_TrianglesExtraDataContainer[triangles[iTriangle]];
+	}
+
+	return componentMesh;
+}
+
+std::vector<std::unique_ptr<Mesh>> MeshComponents::ExtractComponents(
+	const Mesh& mesh, const ComponentLabeling& labeling)
+{
+	ProfileScope("MeshComponents::ExtractComponents");
+
+	std::vector<std::unique_ptr<Mesh>> components(labeling.GetComponentCount());
+	ParallelFor(
+		0,
+		components.size(),
+		[&](const size_t iComponent)
+		{
+			components[iComponent] = ExtractComponent(mesh, labeling, static_cast<uint32_t>(iComponent));
+		},
+		1);
+	return components;
+}
+
+std::unique_ptr<Mesh> MeshComponents::MergeComponents(const std::vector<std::unique_ptr<Mesh>>& components)
+{
+	ProfileScope("MeshComponents::MergeComponents");
+
+	// First vertex and triangle of each component in the merged mesh.
+	std::vector<uint32_t> vertexOffsets(components.size() + 1, 0);
+	std::vector<uint32_t> triangleOffsets(components.size() + 1, 0);
+	bool hasVerticesExtraData = false;
+	bool hasTrianglesExtraData = false;
+	for(size_t iComponent = 0; iComponent < components.size(); ++iComponent)
+	{
+		const Mesh& component = *components[iComponent];
+		assert(!component.HasGarbage() && "The components must be garbage collected before being merged.");
+		vertexOffsets[iComponent + 1] = vertexOffsets[iComponent] + component.GetVertexCount();
+		triangleOffsets[iComponent + 1] = triangleOffsets[iComponent] + component.GetTriangleCount();
+		hasVerticesExtraData |= component.HasVerticesExtraDataContainer();
+		hasTrianglesExtraData |= component.HasTrianglesExtraDataContainer();
+	}
+
+	auto mesh = std::make_unique<Mesh>();
+	mesh->m_Vertices.resize(vertexOffsets.back());
+	mesh->m_Triangles.resize(triangleOffsets.back());
+	if(hasVerticesExtraData)
+		mesh->m_VerticesExtraDataContainer.resize(vertexOffsets.back());
+	if(hasTrianglesExtraData)
+		mesh->m_TrianglesExtraDataContainer.resize(triangleOffsets.back());
+
+	ParallelFor(
+		0,
+		components.size(),
+		[&](const size_t iComponent)
+		{
+			const Mesh& component = *components[iComponent];
+			const int vertexOffset = static_cast<int>(vertexOffsets[iComponent]);
+			const int triangleOffset = static_cast<int>(triangleOffsets[iComponent]);
+			const auto shiftIndex = [](const int index, const int offset)
+			{
+				return index == -1 ? -1 : index + offset;
+			};
+
+			for(VertexIndex iVertex = 0; iVertex < component.GetVertexCount(); ++iVertex)
+			{
+				const Vertex& vertex = component.m_Vertices[iVertex];
+				mesh->m_Vertices[vertexOffset + iVertex] = {
+					.Position = vertex.Position,
+					.IncidentTriangleIdx = shiftIndex(vertex.IncidentTriangleIdx, triangleOffset),
+				};
+			}
+			for(TriangleIndex iTriangle = 0; iTriangle < component.GetTriangleCount(); ++iTriangle)
+			{
+				const Triangle& triangle = component.m_Triangles[iTriangle];
+				Triangle& mergedTriangle = mesh->m_Triangles[triangleOffset + iTriangle];
+				for(EdgeIndex iEdge = 0; iEdge < 3; ++iEdge)
+				{
+					mergedTriangle.Vertices[iEdge] = shiftIndex(triangle.Vertices[iEdge], vertexOffset);
+					mergedTriangle.Neighbors[iEdge] = shiftIndex(triangle.Neighbors[iEdge], triangleOffset);
+				}
+			}
+
+			if(component.HasVerticesExtraDataContainer())
+				std::copy(component.m_VerticesExtraDataContainer.begin(),
+						  component.m_VerticesExtraDataContainer.end(),
+						  mesh->m_VerticesExtraDataContainer.begin() + vertexOffset);
+			if(component.HasTrianglesExtraDataContainer())
+				std::copy(component.m_TrianglesExtraDataContainer.begin(),
+						  component.m_TrianglesExtraDataContainer.end(),
+						  mesh->m_TrianglesExtraDataContainer.begin() + triangleOffset);
+		},
+		1);
+
+	return mesh;
+}
+} // namespace Utilitary::Surface
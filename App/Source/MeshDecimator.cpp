@@ -0,0 +1,522 @@
+#include "Application/MeshDecimator.h"
+
+#include "Core/MathHelpers.h"
+#include "Core/Parallel.h"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cassert>
+#include <cmath>
+#include <mutex>
+#include <vector>
+
+using namespace Core::BaseType;
+using namespace Core::Math::Geometry;
+using namespace Core::Parallel;
+using namespace Data::Primitive;
+using namespace Data::Surface;
+using namespace Utilitary::Primitive;
+
+namespace
+{
+/// @brief Key of an edge which cannot be collapsed during the current pass.
+constexpr uint64_t InvalidKey = std::numeric_limits<uint64_t>::max();
+
+/// @brief Symmetric 4x4 error quadric, stored as its 10 distinct coefficients.
+struct Quadric
+{
+	double A00{ 0. }, A01{ 0. }, A02{ 0. }, A11{ 0. }, A12{ 0. }, A22{ 0. };
+	double B0{ 0. }, B1{ 0. }, B2{ 0. };
+	double C{ 0. };
+
+	/// @brief Build the quadric of the plane n.p + d = 0, weighted by the given factor.
+	static Quadric FromPlane(const Vec3& n, double d, double weight)
+	{
+		Quadric q;
+		q.A00 = weight * n.x * n.x;
+		q.A01 = weight * n.x * n.y;
+		q.A02 = weight * n.x * n.z;
+		q.A11 = weight * n.y * n.y;
+		q.A12 = weight * n.y * n.z;
+		q.A22 = weight * n.z * n.z;
+		q.B0 = weight * d * n.x;
+		q.B1 = weight * d * n.y;
+		q.B2 = weight * d * n.z;
+		q.C = weight * d * d;
+		return q;
+	}
+
+	Quadric& operator+=(const Quadric& rhs)
+	{
+		A00 += rhs.A00;
+		A01 += rhs.A01;
+		A02 += rhs.A02;
+		A11 += rhs.A11;
+		A12 += rhs.A12;
+		A22 += rhs.A22;
+		B0 += rhs.B0;
+		B1 += rhs.B1;
+		B2 += rhs.B2;
+		C += rhs.C;
+		return *this;
+	}
+
+	/// @brief Evaluate the squared distance error at the given position.
+	double Evaluate(const Vec3& p) const
+	{
+		const double x = p.x, y = p.y, z = p.z;
+		return A00 * x * x + 2. * A01 * x * y + 2. * A02 * x * z + A11 * y * y + 2. * A12 * y * z + A22 * z * z
+			+ 2. * (B0 * x + B1 * y + B2 * z) + C;
+	}
+
+	/// @brief Compute the position minimizing the error.
+	/// @return False if the system is ill-conditioned.
+	bool Minimize(Vec3& result) const
+	{
+		// Cofactors of the symmetric matrix A.
+		const double c00 = A11 * A22 - A12 * A12;
+		const double c01 = A02 * A12 - A01 * A22;
+		const double c02 = A01 * A12 - A02 * A11;
+		const double det = A00 * c00 + A01 * c01 + A02 * c02;
+
+		const double scale = std::abs(A00) + std::abs(A11) + std::abs(A22);
+		if(std::abs(det) <= 1e-9 * scale * scale * scale || scale == 0.)
+			return false;
+
+		const double c11 = A00 * A22 - A02 * A02;
+		const double c12 = A01 * A02 - A00 * A12;
+		const double c22 = A00 * A11 - A01 * A01;
+
+		// Solve A x = -B.
+		const double invDet = -1. / det;
+		result.x = static_cast<float>(invDet * (c00 * B0 + c01 * B1 + c02 * B2));
+		result.y = static_cast<float>(invDet * (c01 * B0 + c11 * B1 + c12 * B2));
+		result.z = static_cast<float>(invDet * (c02 * B0 + c12 * B1 + c22 * B2));
+		return true;
+	}
+};
+
+/// @brief Edge collapse candidate of the current pass.
+struct CollapseCandidate
+{
+	/// @brief Sortable key combining the cost (high bits) and the edge identifier (low bits).
+	uint64_t Key{ InvalidKey };
+	/// @brief Vertex kept by the collapse.
+	VertexIndex KeptVertexIdx{ 0 };
+	/// @brief Vertex removed by the collapse.
+	VertexIndex RemovedVertexIdx{ 0 };
+	/// @brief Position of the kept vertex after the collapse.
+	Vec3 Target{};
+};
+
+/// @brief Collect the triangles around a vertex.
+void GatherStar(const Mesh& mesh, const VertexIndex vertexIdx, std::vector<TriangleIndex>& star)
+{
+	star.clear();
+	for(TriangleIndex triangleIdx : mesh.GetTrianglesAroundVertexView(vertexIdx))
+		star.push_back(triangleIdx);
+}
+
+/// @brief Lower the value stored in an atomic to the given one.
+void AtomicMin(std::atomic<uint64_t>& value, uint64_t candidate)
+{
+	uint64_t current = value.load(std::memory_order_relaxed);
+	while(candidate < current && !value.compare_exchange_weak(current, candidate, std::memory_order_relaxed))
+	{
+	}
+}
+
+/// @brief Compute the per vertex error quadrics from the planes of the incident triangles.
+std::vector<Quadric> ComputeVertexQuadrics(const Mesh& mesh)
+{
+	const std::vector<Vertex>& vertices = mesh.GetVertices();
+	const std::vector<Triangle>& triangles = mesh.GetTriangles();
+
+	std::vector<Quadric> triangleQuadrics(triangles.size());
+	ParallelFor(
+		0,
+		triangles.size(),
+		[&](size_t iTriangle)
+		{
+			const Triangle& curTriangle = triangles[iTriangle];
+			const Vec3& posA = vertices[curTriangle.Vertices[0]].Position;
+			const Vec3& posB = vertices[curTriangle.Vertices[1]].Position;
+			const Vec3& posC = vertices[curTriangle.Vertices[2]].Position;
+
+			const Vec3 normal = Cross(posB - posA, posC - posA);
+			const float doubleArea = Length(normal);
+			if(doubleArea <= std::numeric_limits<float>::min())
+				return; // Degenerated triangles do not define a plane.
+
+			const Vec3 unitNormal = normal / doubleArea;
+			triangleQuadrics[iTriangle] = Quadric::FromPlane(unitNormal, -Dot(unitNormal, posA), 0.5 * doubleArea);
+		});
+
+	std::vector<Quadric> vertexQuadrics(vertices.size());
+	ParallelFor(
+		0,
+		vertices.size(),
+		[&](size_t iVertex)
+		{
+			if(vertices[iVertex].IncidentTriangleIdx == -1)
+				return;
+
+			for(TriangleIndex triangleIdx : mesh.GetTrianglesAroundVertexView(static_cast<VertexIndex>(iVertex)))
+				vertexQuadrics[iVertex] += triangleQuadrics[triangleIdx];
+		});
+
+	return vertexQuadrics;
+}
+
+/// @brief Flag each vertex lying on a boundary edge.
+std::vector<uint8_t> ComputeBoundaryFlags(const Mesh& mesh)
+{
+	std::vector<uint8_t> boundaryFlags(mesh.GetVertexCount(), 0);
+	ParallelFor(
+		0,
+		boundaryFlags.size(),
+		[&](size_t iVertex)
+		{
+			boundaryFlags[iVertex] = mesh.IsBoundaryVertex(static_cast<VertexIndex>(iVertex));
+		});
+
+	return boundaryFlags;
+}
+
+/// @brief Check that moving the vertices of the triangles around the collapse does not flip any of them.
+bool PreservesOrientation(
+	const Mesh& mesh,
+	const std::vector<TriangleIndex>& star,
+	const VertexIndex keptVertexIdx,
+	const VertexIndex removedVertexIdx,
+	const Vec3& target)
+{
+	for(TriangleIndex triangleIdx : star)
+	{
+		const Triangle& curTriangle = mesh.GetTriangleData(triangleIdx);
+
+		std::array<Vec3, 3> oldPositions;
+		std::array<Vec3, 3> newPositions;
+		bool isRemoved = false;
+		for(VertexLocalIndex iVertex = 0; iVertex < 3; ++iVertex)
+		{
+			const VertexIndex curVertexIdx = static_cast<VertexIndex>(curTriangle.Vertices[iVertex]);
+			oldPositions[iVertex] = mesh.GetVertexData(curVertexIdx).Position;
+			newPositions[iVertex] = oldPositions[iVertex];
+			if(curVertexIdx == keptVertexIdx || curVertexIdx == removedVertexIdx)
+			{
+				newPositions[iVertex] = target;
+				// Triangles containing both vertices are removed by the collapse.
+				isRemoved |= GetVertexLocalIndex(curTriangle, curVertexIdx == keptVertexIdx ? removedVertexIdx
+																						   : keptVertexIdx)
+					!= -1;
+			}
+		}
+
+		if(isRemoved)
+			continue;
+
+		const Vec3 oldNormal = Cross(oldPositions[1] - oldPositions[0], oldPositions[2] - oldPositions[0]);
+		const Vec3 newNormal = Cross(newPositions[1] - newPositions[0], newPositions[2] - newPositions[0]);
+		if(Dot(oldNormal, newNormal) <= 0.f)
+			return false;
+	}
+
+	return true;
+}
+} // namespace
+
+namespace Utilitary::Surface
+{
+uint32_t MeshDecimator::DecimateParallel(Mesh& mesh, const DecimationSpecification& specification)
+{
+	assert(static_cast<uint64_t>(mesh.GetTriangleCount()) * 3 < std::numeric_limits<uint32_t>::max());
+
+	// The passes work on dense arrays, drop any element deleted before the decimation.
+	if(mesh.HasGarbage())
+		mesh.GarbageCollect();
+
+	std::vector<Quadric> quadrics = ComputeVertexQuadrics(mesh);
+
+	uint32_t collapseCount = 0;
+	for(uint32_t iPass = 0; iPass < specification.MaxPassCount; ++iPass)
+	{
+		const uint32_t triangleCount = mesh.GetTriangleCount();
+		if(triangleCount <= specification.TargetTriangleCount)
+			break;
+
+		std::vector<Vertex>& vertices = mesh.GetVertices();
+		std::vector<Triangle>& triangles = mesh.GetTriangles();
+
+		const std::vector<uint8_t> boundaryFlags = ComputeBoundaryFlags(mesh);
+
+		// 1. Evaluate the cost of each edge, each edge being owned by the triangle with the smallest index.
+		std::vector<CollapseCandidate> candidates(static_cast<size_t>(triangleCount) * 3);
+		ParallelForRange(
+			0,
+			triangleCount,
+			[&](size_t chunkBegin, size_t chunkEnd)
+			{
+				std::vector<TriangleIndex> keptStar, removedStar;
+
+				for(size_t iTriangle = chunkBegin; iTriangle < chunkEnd; ++iTriangle)
+				{
+					const Triangle& curTriangle = triangles[iTriangle];
+					for(EdgeIndex iEdge = 0; iEdge < 3; ++iEdge)
+					{
+						const int neighborIdx = curTriangle.Neighbors[iEdge];
+						if(neighborIdx == -1 || static_cast<size_t>(neighborIdx) < iTriangle)
+							continue; // Boundary edges are never collapsed.
+
+						VertexIndex keptVertexIdx = curTriangle.Vertices[IndexHelpers::Next[iEdge]];
+						VertexIndex removedVertexIdx = curTriangle.Vertices[IndexHelpers::Previous[iEdge]];
+						if(boundaryFlags[keptVertexIdx] && boundaryFlags[removedVertexIdx])
+							continue; // Collapsing an interior edge between two boundaries pinches the mesh.
+
+						if(boundaryFlags[removedVertexIdx])
+							std::swap(keptVertexIdx, removedVertexIdx);
+
+						if(!mesh.IsCollapseValid(static_cast<TriangleIndex>(iTriangle), iEdge))
+							continue;
+
+						// Compute the position of the remaining vertex and the resulting error.
+						Quadric quadric = quadrics[keptVertexIdx];
+						quadric += quadrics[removedVertexIdx];
+
+						const Vec3& keptPosition = vertices[keptVertexIdx].Position;
+						const Vec3& removedPosition = vertices[removedVertexIdx].Position;
+						Vec3 target = keptPosition;
+						if(!boundaryFlags[keptVertexIdx] && !quadric.Minimize(target))
+						{
+							target = keptPosition;
+							for(const Vec3& curPosition : { removedPosition, (keptPosition + removedPosition) * 0.5f })
+							{
+								if(quadric.Evaluate(curPosition) < quadric.Evaluate(target))
+									target = curPosition;
+							}
+						}
+
+						const float cost = static_cast<float>(std::max(0., quadric.Evaluate(target)));
+						if(cost > specification.MaxError)
+							continue;
+
+						GatherStar(mesh, keptVertexIdx, keptStar);
+						GatherStar(mesh, removedVertexIdx, removedStar);
+						if(!PreservesOrientation(mesh, keptStar, keptVertexIdx, removedVertexIdx, target)
+						   || !PreservesOrientation(mesh, removedStar, keptVertexIdx, removedVertexIdx, target))
+							continue;
+
+						// Positive floats keep their order when compared as integers.
+						const uint64_t edgeIdx = iTriangle * 3 + iEdge;
+						CollapseCandidate& candidate = candidates[edgeIdx];
+						candidate.Key = (static_cast<uint64_t>(std::bit_cast<uint32_t>(cost)) << 32) | edgeIdx;
+						candidate.KeptVertexIdx = keptVertexIdx;
+						candidate.RemovedVertexIdx = removedVertexIdx;
+						candidate.Target = target;
+					}
+				}
+			});
+
+		// 2. Select the candidates whose key is the smallest over their neighborhood, i.e. both endpoints and their
+		// one-ring. The neighborhoods of two selected candidates are disjoint, so they never touch the same triangle.
+		std::vector<std::atomic<uint64_t>> minKeys(vertices.size());
+		ParallelFor(
+			0,
+			minKeys.size(),
+			[&](size_t iVertex)
+			{
+				minKeys[iVertex].store(InvalidKey, std::memory_order_relaxed);
+			});
+
+		auto ForEachNeighborhoodVertex = [&mesh](
+											 const CollapseCandidate& candidate,
+											 std::vector<TriangleIndex>& star,
+											 std::vector<VertexIndex>& neighborhood,
+											 auto&& func)
+		{
+			neighborhood.clear();
+			for(VertexIndex curVertexIdx : { candidate.KeptVertexIdx, candidate.RemovedVertexIdx })
+			{
+				GatherStar(mesh, curVertexIdx, star);
+				for(TriangleIndex triangleIdx : star)
+				{
+					for(int neighborVertexIdx : mesh.GetTriangleData(triangleIdx).Vertices)
+						neighborhood.push_back(static_cast<VertexIndex>(neighborVertexIdx));
+				}
+			}
+
+			for(VertexIndex curVertexIdx : neighborhood)
+			{
+				if(!func(curVertexIdx))
+					return false;
+			}
+			return true;
+		};
+
+		ParallelForRange(
+			0,
+			candidates.size(),
+			[&](size_t chunkBegin, size_t chunkEnd)
+			{
+				std::vector<TriangleIndex> star;
+				std::vector<VertexIndex> neighborhood;
+				for(size_t iCandidate = chunkBegin; iCandidate < chunkEnd; ++iCandidate)
+				{
+					const CollapseCandidate& candidate = candidates[iCandidate];
+					if(candidate.Key == InvalidKey)
+						continue;
+
+					ForEachNeighborhoodVertex(
+						candidate,
+						star,
+						neighborhood,
+						[&](VertexIndex curVertexIdx)
+						{
+							AtomicMin(minKeys[curVertexIdx], candidate.Key);
+							return true;
+						});
+				}
+			});
+
+		std::vector<uint64_t> selectedEdges;
+		std::mutex selectedEdgesMutex;
+		ParallelForRange(
+			0,
+			candidates.size(),
+			[&](size_t chunkBegin, size_t chunkEnd)
+			{
+				std::vector<TriangleIndex> star;
+				std::vector<VertexIndex> neighborhood;
+				std::vector<uint64_t> localSelectedEdges;
+				for(size_t iCandidate = chunkBegin; iCandidate < chunkEnd; ++iCandidate)
+				{
+					const CollapseCandidate& candidate = candidates[iCandidate];
+					if(candidate.Key == InvalidKey)
+						continue;
+
+					const bool isLocalMinimum = ForEachNeighborhoodVertex(
+						candidate,
+						star,
+						neighborhood,
+						[&](VertexIndex curVertexIdx)
+						{
+							return minKeys[curVertexIdx].load(std::memory_order_relaxed) == candidate.Key;
+						});
+
+					if(isLocalMinimum)
+						localSelectedEdges.push_back(candidate.Key);
+				}
+
+				std::scoped_lock lock(selectedEdgesMutex);
+				selectedEdges.insert(selectedEdges.end(), localSelectedEdges.begin(), localSelectedEdges.end());
+			});
+
+		if(selectedEdges.empty())
+			break;
+
+		// Each collapse removes two triangles, keep the cheapest ones if the batch would overshoot the target.
+		std::sort(selectedEdges.begin(), selectedEdges.end());
+		const size_t collapseBudget = (triangleCount - specification.TargetTriangleCount + 1) / 2;
+		if(selectedEdges.size() > collapseBudget)
+			selectedEdges.resize(collapseBudget);
+
+		// 3. Apply the batch of independent collapses concurrently.
+		// The flags are written concurrently for disjoint elements, so they are sized before the batch.
+		std::vector<uint8_t>& deadVertices = mesh.m_DeletedVertices;
+		std::vector<uint8_t>& deadTriangles = mesh.m_DeletedTriangles;
+		deadVertices.assign(vertices.size(), 0);
+		deadTriangles.assign(triangles.size(), 0);
+		ParallelForRange(
+			0,
+			selectedEdges.size(),
+			[&](size_t chunkBegin, size_t chunkEnd)
+			{
+				std::vector<TriangleIndex> removedStar;
+				for(size_t iSelected = chunkBegin; iSelected < chunkEnd; ++iSelected)
+				{
+					const uint64_t edgeIdx = selectedEdges[iSelected] & 0xFFFFFFFFu;
+					const CollapseCandidate& candidate = candidates[edgeIdx];
+					const VertexIndex keptVertexIdx = candidate.KeptVertexIdx;
+					const VertexIndex removedVertexIdx = candidate.RemovedVertexIdx;
+
+					GatherStar(mesh, removedVertexIdx, removedStar);
+
+					const TriangleIndex firstTriangleIdx = static_cast<TriangleIndex>(edgeIdx / 3);
+					const TriangleIndex secondTriangleIdx = triangles[firstTriangleIdx].Neighbors[edgeIdx % 3];
+
+					int keptIncidentTriangleIdx = -1;
+					for(TriangleIndex removedTriangleIdx : { firstTriangleIdx, secondTriangleIdx })
+					{
+						const Triangle& removedTriangle = triangles[removedTriangleIdx];
+						const int keptLocalIdx = GetVertexLocalIndex(removedTriangle, keptVertexIdx);
+						const int removedLocalIdx = GetVertexLocalIndex(removedTriangle, removedVertexIdx);
+						const int oppositeLocalIdx = 3 - keptLocalIdx - removedLocalIdx;
+
+						// The triangles across the two remaining edges become neighbors of each other.
+						const int keptSideNeighborIdx = removedTriangle.Neighbors[removedLocalIdx];
+						const int removedSideNeighborIdx = removedTriangle.Neighbors[keptLocalIdx];
+						auto ReplaceNeighbor = [&](int triangleIdx, int oldNeighborIdx, int newNeighborIdx)
+						{
+							if(triangleIdx == -1)
+								return;
+							for(int& curNeighborIdx : triangles[triangleIdx].Neighbors)
+							{
+								if(curNeighborIdx == oldNeighborIdx)
+									curNeighborIdx = newNeighborIdx;
+							}
+						};
+						ReplaceNeighbor(keptSideNeighborIdx, removedTriangleIdx, removedSideNeighborIdx);
+						ReplaceNeighbor(removedSideNeighborIdx, removedTriangleIdx, keptSideNeighborIdx);
+
+						// The opposite vertex must not reference the removed triangle anymore.
+						Vertex& oppositeVertex = vertices[removedTriangle.Vertices[oppositeLocalIdx]];
+						if(oppositeVertex.IncidentTriangleIdx == static_cast<int>(removedTriangleIdx))
+							oppositeVertex.IncidentTriangleIdx =
+								keptSideNeighborIdx != -1 ? keptSideNeighborIdx : removedSideNeighborIdx;
+
+						if(keptIncidentTriangleIdx == -1)
+							keptIncidentTriangleIdx =
+								keptSideNeighborIdx != -1 ? keptSideNeighborIdx : removedSideNeighborIdx;
+
+						deadTriangles[removedTriangleIdx] = 1;
+					}
+
+					// Every remaining triangle around the removed vertex now uses the kept vertex.
+					for(TriangleIndex triangleIdx : removedStar)
+					{
+						if(deadTriangles[triangleIdx])
+							continue;
+						for(int& curVertexIdx : triangles[triangleIdx].Vertices)
+						{
+							if(static_cast<VertexIndex>(curVertexIdx) == removedVertexIdx)
+								curVertexIdx = static_cast<int>(keptVertexIdx);
+						}
+					}
+
+					Vertex& keptVertex = vertices[keptVertexIdx];
+					keptVertex.Position = candidate.Target;
+					keptVertex.IncidentTriangleIdx = keptIncidentTriangleIdx;
+					quadrics[keptVertexIdx] += quadrics[removedVertexIdx];
+					deadVertices[removedVertexIdx] = 1;
+				}
+			},
+			64);
+
+		collapseCount += static_cast<uint32_t>(selectedEdges.size());
+
+		// 4. Compact the vertices and triangles before the next pass.
+		size_t aliveVertexCount = 0;
+		for(size_t iVertex = 0; iVertex < quadrics.size(); ++iVertex)
+		{
+			if(!deadVertices[iVertex])
+				quadrics[aliveVertexCount++] = quadrics[iVertex];
+		}
+		quadrics.resize(aliveVertexCount);
+
+		mesh.GarbageCollect();
+	}
+
+	return collapseCount;
+}
+} // namespace Utilitary::Surface
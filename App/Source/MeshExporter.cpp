@@ -5,6 +5,7 @@
 #include "Application/PrimitiveProxy.h"
 #include "Core/BaseTypes.h"
 #include "Core/PrintHelpers.h"
+#include "Core/Profiler.h"
 
 using namespace Data::Surface;
 using namespace Data::Primitive;
@@ -22,6 +23,17 @@ namespace Utilitary::Surface
 {
 void MeshExporter::ExportOFF(const Mesh& mesh, const std::filesystem::path& filepath)
 {
+	ProfileScope("MeshExporter::ExportOFF");
+
+	// Deleted elements are not written, export a garbage collected copy instead.
+	if(mesh.HasGarbage())
+	{
+		Mesh collectedMesh(mesh);
+		collectedMesh.GarbageCollect();
+		ExportOFF(collectedMesh, filepath);
+		return;
+	}
+
 	std::ofstream file(filepath, std::ios::trunc);
 
 	Debug("Writing to {}", filepath.string());
@@ -47,6 +59,17 @@ void MeshExporter::ExportOFF(const Mesh& mesh, const std::filesystem::path& file
 void MeshExporter::ExportOBJ(const Mesh& mesh, const std::filesystem::path& filepath)
 
 {
+	ProfileScope("MeshExporter::ExportOBJ");
+
+	// Deleted elements are not written, export a garbage collected copy instead.
+	if(mesh.HasGarbage())
+	{
+		Mesh collectedMesh(mesh);
+		collectedMesh.GarbageCollect();
+		ExportOBJ(collectedMesh, filepath);
+		return;
+	}
+
 	std::ofstream file(filepath, std::ios::trunc);
 
 	Debug("Writing to {}", filepath.string());
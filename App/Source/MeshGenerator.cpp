@@ -0,0 +1,436 @@
+#include "Application/MeshGenerator.h"
+
+#include "Core/MathHelpers.h"
+#include "Core/Parallel.h"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+using namespace Core::BaseType;
+using namespace Core::Math::Geometry;
+using namespace Core::Parallel;
+using namespace Data::Primitive;
+using namespace Data::Surface;
+
+namespace
+{
+constexpr float TwoPi = 6.28318530718f;
+
+/// @brief Integer hash with a good avalanche, used as a stateless random generator.
+uint32_t HashUInt(uint32_t value)
+{
+	value ^= value >> 16;
+	value *= 0x7FEB352Du;
+	value ^= value >> 15;
+	value *= 0x846CA68Bu;
+	value ^= value >> 16;
+	return value;
+}
+
+/// @brief Map a hash to a float in [0, 1).
+float ToUnitFloat(const uint32_t hash)
+{
+	return static_cast<float>(hash >> 8) * (1.f / 16777216.f);
+}
+
+/// @brief Random value in [-1, 1) at a node of the noise lattice.
+float GetLatticeValue(const int32_t x, const int32_t y, const uint32_t seed)
+{
+	const uint32_t hash = HashUInt(static_cast<uint32_t>(x) ^ HashUInt(static_cast<uint32_t>(y) ^ HashUInt(seed)));
+	return ToUnitFloat(hash) * 2.f - 1.f;
+}
+
+/// @brief Value noise: smooth interpolation of the random values of the four surrounding lattice nodes.
+float GetValueNoise(const float x, const float y, const uint32_t seed)
+{
+	const float floorX = std::floor(x);
+	const float floorY = std::floor(y);
+	const int32_t x0 = static_cast<int32_t>(floorX);
+	const int32_t y0 = static_cast<int32_t>(floorY);
+
+	// Smoothstep weights, the noise is C1 across the cells.
+	const float tx = x - floorX;
+	const float ty = y - floorY;
+	const float sx = tx * tx * (3.f - 2.f * tx);
+	const float sy = ty * ty * (3.f - 2.f * ty);
+
+	const float bottom = std::lerp(GetLatticeValue(x0, y0, seed), GetLatticeValue(x0 + 1, y0, seed), sx);
+	const float top = std::lerp(GetLatticeValue(x0, y0 + 1, seed), GetLatticeValue(x0 + 1, y0 + 1, seed), sx);
+	return std::lerp(bottom, top, sy);
+}
+} // namespace
+
+namespace Utilitary::Surface
+{
+std::unique_ptr<Mesh> MeshGenerator::CreateGrid(const uint32_t nRow, const uint32_t nCol)
+{
+	assert(nRow > 0 && nCol > 0 && "The grid needs at least one cell");
+
+	const size_t nVertexCol = static_cast<size_t>(nCol) + 1;
+	const size_t vertexCount = (static_cast<size_t>(nRow) + 1) * nVertexCol;
+	const size_t cellCount = static_cast<size_t>(nRow) * nCol;
+	assert(2 * cellCount <= static_cast<size_t>(std::numeric_limits<int>::max()) && "Too many triangles");
+
+	auto mesh = std::make_unique<Mesh>();
+	std::vector<Vertex>& vertices = mesh->m_Vertices;
+	std::vector<Triangle>& triangles = mesh->m_Triangles;
+	vertices.resize(vertexCount);
+	triangles.resize(2 * cellCount);
+
+	ParallelFor(
+		0,
+		vertexCount,
+		[&](const size_t iVertex)
+		{
+			const size_t iRow = iVertex / nVertexCol;
+			const size_t iCol = iVertex % nVertexCol;
+			vertices[iVertex].Position = { static_cast<float>(iCol), static_cast<float>(iRow), 0.f };
+
+			// Lower-left cell of the vertex, clamped on the last row and column: the vertex is the corner (0,0) of
+			// its first triangle, the corner (0,1) or (1,1) of its first triangle on the last column and the corner
+			// (1,0) of its second triangle on the last row.
+			const size_t cellIdx = std::min<size_t>(iRow, nRow - 1) * nCol + std::min<size_t>(iCol, nCol - 1);
+			const bool isSecondTriangle = iRow == nRow && iCol < nCol;
+			vertices[iVertex].IncidentTriangleIdx = static_cast<int>(2 * cellIdx + (isSecondTriangle ? 1 : 0));
+		});
+
+	ParallelFor(
+		0,
+		cellCount,
+		[&](const size_t cellIdx)
+		{
+			const size_t iRow = cellIdx / nCol;
+			const size_t iCol = cellIdx % nCol;
+			const int v00 = static_cast<int>(iRow * nVertexCol + iCol);
+			const int v01 = v00 + 1;
+			const int v10 = v00 + static_cast<int>(nVertexCol);
+			const int v11 = v10 + 1;
+			const int firstTriangleIdx = static_cast<int>(2 * cellIdx);
+			const int secondTriangleIdx = firstTriangleIdx + 1;
+
+			// The first triangle borders the next cell on the right and the cell below, the second one borders the
+			// cell above and the previous cell on the left.
+			triangles[firstTriangleIdx] = {
+				.Vertices = { v00, v01, v11 },
+				.Neighbors = { iCol + 1 < nCol ? secondTriangleIdx + 2 : -1,
+							   secondTriangleIdx,
+							   iRow > 0 ? secondTriangleIdx - 2 * static_cast<int>(nCol) : -1 },
+			};
+			triangles[secondTriangleIdx] = {
+				.Vertices = { v00, v11, v10 },
+				.Neighbors = { iRow + 1 < nRow ? firstTriangleIdx + 2 * static_cast<int>(nCol) : -1,
+							   iCol > 0 ? firstTriangleIdx - 2 : -1,
+							   firstTriangleIdx },
+			};
+		});
+
+	return mesh;
+}
+
+std::unique_ptr<Mesh> MeshGenerator::CreateTorus(
+	const uint32_t nMajor, const uint32_t nMinor, const float majorRadius, const float minorRadius)
+{
+	assert(nMajor >= 3 && nMinor >= 3 && "The torus needs at least 3 subdivisions in each direction");
+
+	const size_t cellCount = static_cast<size_t>(nMajor) * nMinor;
+	assert(2 * cellCount <= static_cast<size_t>(std::numeric_limits<int>::max()) && "Too many triangles");
+
+	auto mesh = std::make_unique<Mesh>();
+	std::vector<Vertex>& vertices = mesh->m_Vertices;
+	std::vector<Triangle>& triangles = mesh->m_Triangles;
+	vertices.resize(cellCount);
+	triangles.resize(2 * cellCount);
+
+	// The vertex (iMajor, iMinor) and the cell it is the first corner of share the same index.
+	auto GetCellIdx = [nMajor, nMinor](const size_t iMajor, const size_t iMinor)
+	{
+		return static_cast<int>((iMajor % nMajor) * nMinor + iMinor % nMinor);
+	};
+
+	ParallelFor(
+		0,
+		cellCount,
+		[&](const size_t cellIdx)
+		{
+			const size_t iMajor = cellIdx / nMinor;
+			const size_t iMinor = cellIdx % nMinor;
+
+			const float theta = TwoPi * static_cast<float>(iMajor) / static_cast<float>(nMajor);
+			const float phi = TwoPi * static_cast<float>(iMinor) / static_cast<float>(nMinor);
+			const float ringRadius = majorRadius + minorRadius * std::cos(phi);
+			vertices[cellIdx] = {
+				.Position = { ringRadius * std::cos(theta), ringRadius * std::sin(theta), minorRadius * std::sin(phi) },
+				.IncidentTriangleIdx = static_cast<int>(2 * cellIdx),
+			};
+
+			// The indices wrap around in both directions, the previous indices are shifted by a full turn.
+			const int v00 = static_cast<int>(cellIdx);
+			const int v10 = GetCellIdx(iMajor + 1, iMinor);
+			const int v11 = GetCellIdx(iMajor + 1, iMinor + 1);
+			const int v01 = GetCellIdx(iMajor, iMinor + 1);
+			const int firstTriangleIdx = static_cast<int>(2 * cellIdx);
+			const int secondTriangleIdx = firstTriangleIdx + 1;
+			triangles[firstTriangleIdx] = {
+				.Vertices = { v00, v10, v11 },
+				.Neighbors = { 2 * v10 + 1, secondTriangleIdx, 2 * GetCellIdx(iMajor, iMinor + nMinor - 1) + 1 },
+			};
+			triangles[secondTriangleIdx] = {
+				.Vertices = { v00, v11, v01 },
+				.Neighbors = { 2 * v01, 2 * GetCellIdx(iMajor + nMajor - 1, iMinor), firstTriangleIdx },
+			};
+		});
+
+	return mesh;
+}
+
+std::unique_ptr<Mesh> MeshGenerator::CreateIcosphere(const uint32_t subdivisionCount, const float radius)
+{
+	assert(subdivisionCount <= 13 && "Too many triangles");
+
+	const float t = (1.f + std::sqrt(5.f)) * 0.5f;
+	std::vector<Vertex> vertices = {
+		{ { -1, t, 0 } }, { { 1, t, 0 } }, { { -1, -t, 0 } }, { { 1, -t, 0 } },
+		{ { 0, -1, t } }, { { 0, 1, t } }, { { 0, -1, -t } }, { { 0, 1, -t } },
+		{ { t, 0, -1 } }, { { t, 0, 1 } }, { { -t, 0, -1 } }, { { -t, 0, 1 } },
+	};
+	std::vector<Triangle> triangles = {
+		{ { 0, 11, 5 } }, { { 0, 5, 1 } },	 { { 0, 1, 7 } },	{ { 0, 7, 10 } }, { { 0, 10, 11 } },
+		{ { 1, 5, 9 } },  { { 5, 11, 4 } },	 { { 11, 10, 2 } }, { { 10, 7, 6 } }, { { 7, 1, 8 } },
+		{ { 3, 9, 4 } },  { { 3, 4, 2 } },	 { { 3, 2, 6 } },	{ { 3, 6, 8 } },  { { 3, 8, 9 } },
+		{ { 4, 9, 5 } },  { { 2, 4, 11 } },	 { { 6, 2, 10 } },	{ { 8, 6, 7 } },  { { 9, 8, 1 } },
+	};
+
+	// Connectivity of the icosahedron, a brute force search is enough for 20 triangles.
+	for(Vertex& vertex : vertices)
+		vertex.Position = Normalize(vertex.Position) * radius;
+	for(size_t iTriangle = 0; iTriangle < triangles.size(); ++iTriangle)
+	{
+		Triangle& triangle = triangles[iTriangle];
+		for(EdgeIndex iEdge = 0; iEdge < 3; ++iEdge)
+		{
+			vertices[triangle.Vertices[iEdge]].IncidentTriangleIdx = static_cast<int>(iTriangle);
+			for(size_t iOther = 0; iOther < triangles.size(); ++iOther)
+			{
+				const VertexIndex firstVertexIdx = triangle.Vertices[IndexHelpers::Next[iEdge]];
+				const VertexIndex secondVertexIdx = triangle.Vertices[IndexHelpers::Previous[iEdge]];
+				if(iOther != iTriangle
+				   && Utilitary::Primitive::GetEdgeIndex(triangles[iOther], firstVertexIdx, secondVertexIdx) >= 0)
+					triangle.Neighbors[iEdge] = static_cast<int>(iOther);
+			}
+		}
+	}
+
+	for(uint32_t iSubdivision = 0; iSubdivision < subdivisionCount; ++iSubdivision)
+	{
+		const size_t vertexCount = vertices.size();
+		const size_t triangleCount = triangles.size();
+
+		// Each edge is owned by its triangle of lowest index (or its only triangle on a boundary), the midpoints are
+		// numbered by a prefix sum over the owned edges.
+		auto IsOwnedEdge = [&triangles](const size_t triangleIdx, const EdgeIndex edgeIdx)
+		{
+			const int neighborIdx = triangles[triangleIdx].Neighbors[edgeIdx];
+			return neighborIdx < 0 || triangleIdx < static_cast<size_t>(neighborIdx);
+		};
+		std::vector<uint32_t> firstMidpointIdx(triangleCount);
+		ParallelFor(
+			0,
+			triangleCount,
+			[&](const size_t iTriangle)
+			{
+				firstMidpointIdx[iTriangle] = IsOwnedEdge(iTriangle, 0) + IsOwnedEdge(iTriangle, 1)
+					+ IsOwnedEdge(iTriangle, 2);
+			});
+		const size_t lastOwnedEdgeCount = firstMidpointIdx.back();
+		std::exclusive_scan(firstMidpointIdx.begin(), firstMidpointIdx.end(), firstMidpointIdx.begin(), 0u);
+		const size_t midpointCount = firstMidpointIdx.back() + lastOwnedEdgeCount;
+
+		// Midpoint of the owned edges, the other ones are read from the owner in a second pass.
+		std::vector<std::array<int, 3>> midpoints(triangleCount);
+		vertices.resize(vertexCount + midpointCount);
+		ParallelFor(
+			0,
+			triangleCount,
+			[&](const size_t iTriangle)
+			{
+				const Triangle& triangle = triangles[iTriangle];
+				int midpointIdx = static_cast<int>(vertexCount + firstMidpointIdx[iTriangle]);
+				for(EdgeIndex iEdge = 0; iEdge < 3; ++iEdge)
+				{
+					if(!IsOwnedEdge(iTriangle, iEdge))
+						continue;
+
+					const Vec3& firstPos = vertices[triangle.Vertices[IndexHelpers::Next[iEdge]]].Position;
+					const Vec3& secondPos = vertices[triangle.Vertices[IndexHelpers::Previous[iEdge]]].Position;
+					// The central child triangle holds all the midpoints of its parent.
+					vertices[midpointIdx] = {
+						.Position = Normalize(firstPos + secondPos) * radius,
+						.IncidentTriangleIdx = static_cast<int>(4 * iTriangle + 3),
+					};
+					midpoints[iTriangle][iEdge] = midpointIdx++;
+				}
+			});
+		ParallelFor(
+			0,
+			triangleCount,
+			[&](const size_t iTriangle)
+			{
+				const Triangle& triangle = triangles[iTriangle];
+				for(EdgeIndex iEdge = 0; iEdge < 3; ++iEdge)
+				{
+					if(IsOwnedEdge(iTriangle, iEdge))
+						continue;
+
+					const int neighborIdx = triangle.Neighbors[iEdge];
+					const Triangle& neighbor = triangles[neighborIdx];
+					const int neighborEdgeIdx = Utilitary::Primitive::GetEdgeIndex(
+						neighbor,
+						triangle.Vertices[IndexHelpers::Next[iEdge]],
+						triangle.Vertices[IndexHelpers::Previous[iEdge]]);
+					assert(neighborEdgeIdx >= 0 && "Inconsistent neighbors");
+					midpoints[iTriangle][iEdge] = midpoints[neighborIdx][neighborEdgeIdx];
+				}
+			});
+
+		// Old vertices keep the corner child of their incident triangle.
+		ParallelFor(
+			0,
+			vertexCount,
+			[&](const size_t iVertex)
+			{
+				const int triangleIdx = vertices[iVertex].IncidentTriangleIdx;
+				const int localIdx = Utilitary::Primitive::GetVertexLocalIndex(
+					triangles[triangleIdx], static_cast<VertexIndex>(iVertex));
+				vertices[iVertex].IncidentTriangleIdx = 4 * triangleIdx + localIdx;
+			});
+
+		// The children of a triangle (a, b, c) are stored as (a, ab, ca), (b, bc, ab), (c, ca, bc) then (ab, bc, ca).
+		// The corner child of vertex i is numbered 4t+i in every triangle t around the vertex, which gives the
+		// neighbors across the halves of the split edges.
+		std::vector<Triangle> subdividedTriangles(4 * triangleCount);
+		ParallelFor(
+			0,
+			triangleCount,
+			[&](const size_t iTriangle)
+			{
+				const Triangle& triangle = triangles[iTriangle];
+				const std::array<int, 3>& triangleMidpoints = midpoints[iTriangle];
+				const int centerIdx = static_cast<int>(4 * iTriangle + 3);
+
+				auto GetCornerChildAcross = [&](const EdgeIndex edgeIdx, const VertexIndex vertexIdx)
+				{
+					const int neighborIdx = triangle.Neighbors[edgeIdx];
+					if(neighborIdx < 0)
+						return -1;
+					const Triangle& neighbor = triangles[neighborIdx];
+					return 4 * neighborIdx + Utilitary::Primitive::GetVertexLocalIndex(neighbor, vertexIdx);
+				};
+
+				for(EdgeIndex iCorner = 0; iCorner < 3; ++iCorner)
+				{
+					const EdgeIndex nextIdx = IndexHelpers::Next[iCorner];
+					const EdgeIndex prevIdx = IndexHelpers::Previous[iCorner];
+					const int vertexIdx = triangle.Vertices[iCorner];
+					subdividedTriangles[4 * iTriangle + iCorner] = {
+						.Vertices = { vertexIdx, triangleMidpoints[prevIdx], triangleMidpoints[nextIdx] },
+						.Neighbors = { centerIdx,
+									   GetCornerChildAcross(nextIdx, vertexIdx),
+									   GetCornerChildAcross(prevIdx, vertexIdx) },
+					};
+				}
+				subdividedTriangles[centerIdx] = {
+					.Vertices = { triangleMidpoints[2], triangleMidpoints[0], triangleMidpoints[1] },
+					.Neighbors = { centerIdx - 1, centerIdx - 3, centerIdx - 2 },
+				};
+			});
+		triangles = std::move(subdividedTriangles);
+	}
+
+	auto mesh = std::make_unique<Mesh>();
+	mesh->m_Vertices = std::move(vertices);
+	mesh->m_Triangles = std::move(triangles);
+	return mesh;
+}
+
+std::unique_ptr<Mesh> MeshGenerator::CreateTerrain(
+	const uint32_t nRow,
+	const uint32_t nCol,
+	const float amplitude,
+	const float frequency,
+	const uint32_t octaveCount,
+	const uint32_t seed)
+{
+	auto mesh = CreateGrid(nRow, nCol);
+	std::vector<Vertex>& vertices = mesh->m_Vertices;
+
+	ParallelFor(
+		0,
+		vertices.size(),
+		[&](const size_t iVertex)
+		{
+			Vec3& position = vertices[iVertex].Position;
+			float octaveAmplitude = amplitude;
+			float octaveFrequency = frequency;
+			for(uint32_t iOctave = 0; iOctave < octaveCount; ++iOctave)
+			{
+				const float noise =
+					GetValueNoise(position.x * octaveFrequency, position.y * octaveFrequency, seed + iOctave);
+				position.z += octaveAmplitude * noise;
+				octaveAmplitude *= 0.5f;
+				octaveFrequency *= 2.f;
+			}
+		});
+
+	return mesh;
+}
+
+std::unique_ptr<Mesh> MeshGenerator::CreateTriangleSoup(const uint32_t triangleCount, const uint32_t seed)
+{
+	assert(static_cast<size_t>(triangleCount) * 3 <= static_cast<size_t>(std::numeric_limits<int>::max())
+		   && "Too many vertices");
+
+	auto mesh = std::make_unique<Mesh>();
+	std::vector<Vertex>& vertices = mesh->m_Vertices;
+	std::vector<Triangle>& triangles = mesh->m_Triangles;
+	vertices.resize(3 * static_cast<size_t>(triangleCount));
+	triangles.resize(triangleCount);
+
+	// About the spacing between the triangles if they were evenly spread.
+	const float triangleSize = 1.f / std::cbrt(static_cast<float>(std::max(triangleCount, 1u)));
+	const uint32_t seedHash = HashUInt(seed);
+
+	ParallelFor(
+		0,
+		triangleCount,
+		[&](const size_t iTriangle)
+		{
+			// Each triangle draws its own random numbers from its index, the result does not depend on the chunks.
+			uint32_t state = HashUInt(seedHash ^ static_cast<uint32_t>(iTriangle));
+			auto GetRandomFloat = [&state]()
+			{
+				state = HashUInt(state + 0x9E3779B9u);
+				return ToUnitFloat(state);
+			};
+
+			const Vec3 center{ GetRandomFloat(), GetRandomFloat(), GetRandomFloat() };
+			const int firstVertexIdx = static_cast<int>(3 * iTriangle);
+			for(int iCorner = 0; iCorner < 3; ++iCorner)
+			{
+				const Vec3 offset{ GetRandomFloat() - 0.5f, GetRandomFloat() - 0.5f, GetRandomFloat() - 0.5f };
+				vertices[firstVertexIdx + iCorner] = {
+					.Position = center + offset * triangleSize,
+					.IncidentTriangleIdx = static_cast<int>(iTriangle),
+				};
+			}
+			triangles[iTriangle] = { .Vertices = { firstVertexIdx, firstVertexIdx + 1, firstVertexIdx + 2 } };
+		});
+
+	return mesh;
+}
+} // namespace Utilitary::Surface
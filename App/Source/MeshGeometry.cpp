@@ -0,0 +1,549 @@
+#include "Application/MeshGeometry.h"
+
+#include "Application/ExtraDataType.h"
+#include "Core/MathHelpers.h"
+#include "Core/Parallel.h"
+#include "Core/Profiler.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <memory>
+#include <mutex>
+#include <numeric>
+
+using namespace Core::BaseType;
+using namespace Core::Math::Geometry;
+using namespace Core::Parallel;
+using namespace Data::ExtraData;
+using namespace Data::Primitive;
+using namespace Data::Surface;
+
+namespace
+{
+/// @brief Number of position lanes processed together by the kernels.
+constexpr size_t LaneCount = Utilitary::Surface::PositionBuffers::PositionLaneCount;
+
+/// @brief Extrema of each lane over a range of lane blocks.
+struct LaneBounds
+{
+	std::array<float, LaneCount> Min[3];
+	std::array<float, LaneCount> Max[3];
+};
+
+/// @brief Sums of the coordinates relative to an origin: x, y, z, then xx, xy, xz, yy, yz and zz.
+using Moments = std::array<double, 9>;
+
+/// @brief Symmetric 3x3 matrix, or its eigenvectors as columns.
+using Matrix3 = std::array<std::array<double, 3>, 3>;
+
+/// @brief Number of lane blocks summed in float before the conversion to double.
+constexpr size_t MomentBlockGrain = 64;
+
+/// @brief Get the data of a coordinate array, telling the compiler it starts on a cache line.
+const float* GetAlignedData(const Core::Memory::AlignedVector<float>& coordinates)
+{
+	return std::assume_aligned<Core::Memory::CacheLineSize>(coordinates.data());
+}
+
+/// @brief Get the data of a coordinate array to fill, telling the compiler it starts on a cache line.
+float* GetAlignedData(Core::Memory::AlignedVector<float>& coordinates)
+{
+	return std::assume_aligned<Core::Memory::CacheLineSize>(coordinates.data());
+}
+
+/// @brief Get lane extrema containing no value.
+LaneBounds MakeEmptyLaneBounds()
+{
+	LaneBounds bounds;
+	for(int iAxis = 0; iAxis < 3; ++iAxis)
+	{
+		bounds.Min[iAxis].fill(std::numeric_limits<float>::max());
+		bounds.Max[iAxis].fill(std::numeric_limits<float>::lowest());
+	}
+	return bounds;
+}
+
+/// @brief Merge the extrema of two ranges of lane blocks.
+LaneBounds MergeLaneBounds(LaneBounds lhs, const LaneBounds& rhs)
+{
+	for(int iAxis = 0; iAxis < 3; ++iAxis)
+	{
+		for(size_t iLane = 0; iLane < LaneCount; ++iLane)
+		{
+			lhs.Min[iAxis][iLane] = std::min(lhs.Min[iAxis][iLane], rhs.Min[iAxis][iLane]);
+			lhs.Max[iAxis][iLane] = std::max(lhs.Max[iAxis][iLane], rhs.Max[iAxis][iLane]);
+		}
+	}
+	return lhs;
+}
+
+/// @brief Compute the sums of the coordinates and of their products, relative to the fill position.
+/// @note Each chunk sums MomentBlockGrain blocks per lane in float, and the chunks are added in double in a
+/// deterministic order. The fill slots are at the origin, so they add nothing.
+Moments ComputeMoments(const Utilitary::Surface::PositionBuffers& positions)
+{
+	const Vec3& origin = positions.FillPosition;
+	const float* xs = GetAlignedData(positions.X);
+	const float* ys = GetAlignedData(positions.Y);
+	const float* zs = GetAlignedData(positions.Z);
+	return ParallelReduce(
+		0,
+		positions.GetPaddedCount() / LaneCount,
+		Moments{},
+		[&](const size_t blockBegin, const size_t blockEnd)
+		{
+			std::array<float, LaneCount> laneSums[9] = {};
+			for(size_t iBlock = blockBegin; iBlock < blockEnd; ++iBlock)
+			{
+				const size_t offset = iBlock * LaneCount;
+				for(size_t iLane = 0; iLane < LaneCount; ++iLane)
+				{
+					const float x = xs[offset + iLane] - origin.x;
+					const float y = ys[offset + iLane] - origin.y;
+					const float z = zs[offset + iLane] - origin.z;
+					laneSums[0][iLane] += x;
+					laneSums[1][iLane] += y;
+					laneSums[2][iLane] += z;
+					laneSums[3][iLane] += x * x;
+					laneSums[4][iLane] += x * y;
+					laneSums[5][iLane] += x * z;
+					laneSums[6][iLane] += y * y;
+					laneSums[7][iLane] += y * z;
+					laneSums[8][iLane] += z * z;
+				}
+			}
+
+			Moments chunkMoments{};
+			for(size_t iMoment = 0; iMoment < chunkMoments.size(); ++iMoment)
+				chunkMoments[iMoment] = std::accumulate(laneSums[iMoment].begin(), laneSums[iMoment].end(), 0.);
+			return chunkMoments;
+		},
+		[](Moments lhs, const Moments& rhs)
+		{
+			for(size_t iMoment = 0; iMoment < lhs.size(); ++iMoment)
+				lhs[iMoment] += rhs[iMoment];
+			return lhs;
+		},
+		MomentBlockGrain,
+		ReductionMode::Deterministic);
+}
+
+/// @brief Diagonalize a symmetric matrix with the cyclic Jacobi method.
+/// @param matrix The matrix, whose diagonal holds the eigenvalues at the end.
+/// @return The eigenvectors, as the columns of an orthonormal matrix.
+Matrix3 DiagonalizeSymmetric(Matrix3& matrix)
+{
+	Matrix3 eigenvectors{ { { 1., 0., 0. }, { 0., 1., 0. }, { 0., 0., 1. } } };
+	for(int iSweep = 0; iSweep < 32; ++iSweep)
+	{
+		const double offDiagonal = std::abs(matrix[0][1]) + std::abs(matrix[0][2]) + std::abs(matrix[1][2]);
+		const double diagonal = std::abs(matrix[0][0]) + std::abs(matrix[1][1]) + std::abs(matrix[2][2]);
+		if(offDiagonal <= 1e-15 * diagonal || offDiagonal == 0.)
+			break;
+
+		for(int p = 0; p < 2; ++p)
+		{
+			for(int q = p + 1; q < 3; ++q)
+			{
+				if(matrix[p][q] == 0.)
+					continue;
+
+				// Rotation in the (p, q) plane cancelling the coefficient (p, q).
+				const double theta = (matrix[q][q] - matrix[p][p]) / (2. * matrix[p][q]);
+				const double tangent = (theta >= 0. ? 1. : -1.) / (std::abs(theta) + std::sqrt(theta * theta + 1.));
+				const double cosine = 1. / std::sqrt(tangent * tangent + 1.);
+				const double sine = tangent * cosine;
+				for(int k = 0; k < 3; ++k)
+				{
+					const double kp = matrix[k][p];
+					const double kq = matrix[k][q];
+					matrix[k][p] = cosine * kp - sine * kq;
+					matrix[k][q] = sine * kp + cosine * kq;
+				}
+				for(int k = 0; k < 3; ++k)
+				{
+					const double pk = matrix[p][k];
+					const double qk = matrix[q][k];
+					matrix[p][k] = cosine * pk - sine * qk;
+					matrix[q][k] = sine * pk + cosine * qk;
+				}
+				for(int k = 0; k < 3; ++k)
+				{
+					const double kp = eigenvectors[k][p];
+					const double kq = eigenvectors[k][q];
+					eigenvectors[k][p] = cosine * kp - sine * kq;
+					eigenvectors[k][q] = sine * kp + cosine * kq;
+				}
+			}
+		}
+	}
+	return eigenvectors;
+}
+
+/// @brief Transform a normal by the inverse transpose of a linear map, keeping its length.
+Vec3 TransformNormal(const glm::mat3& normalMatrix, const Vec3& normal)
+{
+	const float length = glm::length(normal);
+	if(length == 0.f)
+		return normal;
+	return Normalize(normalMatrix * normal) * length;
+}
+} // namespace
+
+namespace Utilitary::Surface
+{
+PositionBuffers MeshGeometry::BuildPositionBuffers(const Mesh& mesh)
+{
+	ProfileScope("MeshGeometry::BuildPositionBuffers");
+
+	PositionBuffers buffers;
+	buffers.VertexCount = mesh.GetVertexCount();
+	const size_t laneCount = PositionBuffers::PositionLaneCount;
+	const size_t paddedCount = (static_cast<size_t>(buffers.VertexCount) + laneCount - 1) / laneCount * laneCount;
+
+	// The first live vertex fills the slots not holding a live position.
+	const std::vector<Vertex>& vertices = mesh.GetVertices();
+	for(VertexIndex iVertex = 0; iVertex < buffers.VertexCount; ++iVertex)
+	{
+		if(!mesh.IsVertexDeleted(iVertex))
+		{
+			buffers.FillPosition = vertices[iVertex].Position;
+			break;
+		}
+	}
+	buffers.X.assign(paddedCount, buffers.FillPosition.x);
+	buffers.Y.assign(paddedCount, buffers.FillPosition.y);
+	buffers.Z.assign(paddedCount, buffers.FillPosition.z);
+
+	const size_t liveVertexCount = ParallelReduce(
+		0,
+		static_cast<size_t>(buffers.VertexCount),
+		size_t{ 0 },
+		[&](const size_t chunkBegin, const size_t chunkEnd)
+		{
+			size_t chunkLiveCount = 0;
+			for(size_t iVertex = chunkBegin; iVertex < chunkEnd; ++iVertex)
+			{
+				if(mesh.IsVertexDeleted(static_cast<VertexIndex>(iVertex)))
+					continue;
+				const Vec3& position = vertices[iVertex].Position;
+				buffers.X[iVertex] = position.x;
+				buffers.Y[iVertex] = position.y;
+				buffers.Z[iVertex] = position.z;
+				++chunkLiveCount;
+			}
+			return chunkLiveCount;
+		},
+		[](const size_t lhs, const size_t rhs) { return lhs + rhs; });
+	buffers.LiveVertexCount = static_cast<uint32_t>(liveVertexCount);
+	return buffers;
+}
+
+AxisAlignedBox MeshGeometry::ComputeBoundingBox(const PositionBuffers& positions)
+{
+	ProfileScope("MeshGeometry::ComputeBoundingBox");
+
+	AxisAlignedBox box;
+	if(positions.LiveVertexCount == 0)
+		return box;
+
+	// The padding holds a live position, so the blocks are processed whole.
+	const std::array<const float*, 3> coordinates = { GetAlignedData(positions.X),
+		GetAlignedData(positions.Y),
+		GetAlignedData(positions.Z) };
+	const LaneBounds identity = MakeEmptyLaneBounds();
+
+	const LaneBounds bounds = ParallelReduce(
+		0,
+		positions.GetPaddedCount() / LaneCount,
+		identity,
+		[&](const size_t blockBegin, const size_t blockEnd)
+		{
+			LaneBounds chunkBounds = identity;
+			for(int iAxis = 0; iAxis < 3; ++iAxis)
+			{
+				std::array<float, LaneCount>& laneMin = chunkBounds.Min[iAxis];
+				std::array<float, LaneCount>& laneMax = chunkBounds.Max[iAxis];
+				for(size_t iBlock = blockBegin; iBlock < blockEnd; ++iBlock)
+				{
+					const float* block = coordinates[iAxis] + iBlock * LaneCount;
+					for(size_t iLane = 0; iLane < LaneCount; ++iLane)
+					{
+						laneMin[iLane] = block[iLane] < laneMin[iLane] ? block[iLane] : laneMin[iLane];
+						laneMax[iLane] = block[iLane] > laneMax[iLane] ? block[iLane] : laneMax[iLane];
+					}
+				}
+			}
+			return chunkBounds;
+		},
+		MergeLaneBounds,
+		256);
+
+	for(int iAxis = 0; iAxis < 3; ++iAxis)
+	{
+		box.Min[iAxis] = *std::ranges::min_element(bounds.Min[iAxis]);
+		box.Max[iAxis] = *std::ranges::max_element(bounds.Max[iAxis]);
+	}
+	return box;
+}
+
+Vec3 MeshGeometry::ComputeVertexCentroid(const PositionBuffers& positions)
+{
+	ProfileScope("MeshGeometry::ComputeVertexCentroid");
+
+	if(positions.LiveVertexCount == 0)
+		return Vec3{ 0.f };
+	const Moments moments = ComputeMoments(positions);
+	const double liveVertexCount = positions.LiveVertexCount;
+	return positions.FillPosition
+		+ Vec3{ static_cast<float>(moments[0] / liveVertexCount),
+			  static_cast<float>(moments[1] / liveVertexCount),
+			  static_cast<float>(moments[2] / liveVertexCount) };
+}
+
+OrientedBox MeshGeometry::ComputeOrientedBoundingBox(const PositionBuffers& positions)
+{
+	ProfileScope("MeshGeometry::ComputeOrientedBoundingBox");
+
+	OrientedBox box;
+	if(positions.LiveVertexCount == 0)
+		return box;
+
+	// Covariance of the vertices, relative to the fill position.
+	const Moments moments = ComputeMoments(positions);
+	const double liveVertexCount = positions.LiveVertexCount;
+	const std::array<double, 3> mean = { moments[0] / liveVertexCount,
+		moments[1] / liveVertexCount,
+		moments[2] / liveVertexCount };
+	Matrix3 covariance;
+	const int productIndices[3][3] = { { 3, 4, 5 }, { 4, 6, 7 }, { 5, 7, 8 } };
+	for(int iRow = 0; iRow < 3; ++iRow)
+	{
+		for(int iColumn = 0; iColumn < 3; ++iColumn)
+			covariance[iRow][iColumn] =
+				moments[productIndices[iRow][iColumn]] / liveVertexCount - mean[iRow] * mean[iColumn];
+	}
+
+	// Principal axes by decreasing variance, the last one completing a right-handed frame.
+	const Matrix3 eigenvectors = DiagonalizeSymmetric(covariance);
+	std::array<int, 3> order = { 0, 1, 2 };
+	std::ranges::sort(order, [&](const int lhs, const int rhs) { return covariance[lhs][lhs] > covariance[rhs][rhs]; });
+	for(int iAxis = 0; iAxis < 2; ++iAxis)
+	{
+		const int iColumn = order[iAxis];
+		box.Axes[iAxis] = Normalize(Vec3{ static_cast<float>(eigenvectors[0][iColumn]),
+			static_cast<float>(eigenvectors[1][iColumn]),
+			static_cast<float>(eigenvectors[2][iColumn]) });
+	}
+	box.Axes[2] = Normalize(Cross(box.Axes[0], box.Axes[1]));
+	box.Axes[1] = Cross(box.Axes[2], box.Axes[0]);
+
+	// Extrema of the projections on the axes, the fill slots projecting on a live vertex.
+	const Vec3& origin = positions.FillPosition;
+	const float* xs = GetAlignedData(positions.X);
+	const float* ys = GetAlignedData(positions.Y);
+	const float* zs = GetAlignedData(positions.Z);
+	const LaneBounds identity = MakeEmptyLaneBounds();
+	const LaneBounds bounds = ParallelReduce(
+		0,
+		positions.GetPaddedCount() / LaneCount,
+		identity,
+		[&](const size_t blockBegin, const size_t blockEnd)
+		{
+			LaneBounds chunkBounds = identity;
+			for(size_t iBlock = blockBegin; iBlock < blockEnd; ++iBlock)
+			{
+				const size_t offset = iBlock * LaneCount;
+				for(int iAxis = 0; iAxis < 3; ++iAxis)
+				{
+					const Vec3& axis = box.Axes[iAxis];
+					std::array<float, LaneCount>& laneMin = chunkBounds.Min[iAxis];
+					std::array<float, LaneCount>& laneMax = chunkBounds.Max[iAxis];
+					for(size_t iLane = 0; iLane < LaneCount; ++iLane)
+					{
+						const float projection = axis.x * (xs[offset + iLane] - origin.x)
+							+ axis.y * (ys[offset + iLane] - origin.y) + axis.z * (zs[offset + iLane] - origin.z);
+						laneMin[iLane] = projection < laneMin[iLane] ? projection : laneMin[iLane];
+						laneMax[iLane] = projection > laneMax[iLane] ? projection : laneMax[iLane];
+					}
+				}
+			}
+			return chunkBounds;
+		},
+		MergeLaneBounds,
+		256);
+
+	box.Center = origin;
+	for(int iAxis = 0; iAxis < 3; ++iAxis)
+	{
+		const float minProjection = *std::ranges::min_element(bounds.Min[iAxis]);
+		const float maxProjection = *std::ranges::max_element(bounds.Max[iAxis]);
+		box.Center += box.Axes[iAxis] * (0.5f * (minProjection + maxProjection));
+		box.HalfExtents[iAxis] = 0.5f * (maxProjection - minProjection);
+	}
+	return box;
+}
+
+GeometryMeasures MeshGeometry::ComputeMeasures(const Mesh& mesh)
+{
+	ProfileScope("MeshGeometry::ComputeMeasures");
+
+	const std::shared_ptr<const PositionBuffers> positions = mesh.GetPositionBuffers();
+	GeometryMeasures measures;
+	measures.BoundingBox = ComputeBoundingBox(*positions);
+	measures.OrientedBoundingBox = ComputeOrientedBoundingBox(*positions);
+	measures.VertexCentroid = ComputeVertexCentroid(*positions);
+	if(measures.BoundingBox.IsEmpty())
+		return measures;
+
+	// Area, area-weighted centers and signed volumes of the triangles, relative to the center of the box to limit the
+	// cancellations: the area, the weighted center and the volume.
+	const Vec3 origin = 0.5f * (measures.BoundingBox.Min + measures.BoundingBox.Max);
+	const std::vector<Triangle>& triangles = mesh.GetTriangles();
+	const std::array<double, 5> sums = ParallelReduce(
+		0,
+		triangles.size(),
+		std::array<double, 5>{},
+		[&](const size_t chunkBegin, const size_t chunkEnd)
+		{
+			std::array<double, 5> chunkSums{};
+			for(size_t iTriangle = chunkBegin; iTriangle < chunkEnd; ++iTriangle)
+			{
+				if(mesh.IsTriangleDeleted(static_cast<TriangleIndex>(iTriangle)))
+					continue;
+				const Triangle& curTriangle = triangles[iTriangle];
+				const Vec3 posA = positions->GetPosition(curTriangle.Vertices[0]) - origin;
+				const Vec3 posB = positions->GetPosition(curTriangle.Vertices[1]) - origin;
+				const Vec3 posC = positions->GetPosition(curTriangle.Vertices[2]) - origin;
+
+				const double area = 0.5 * glm::length(Cross(posB - posA, posC - posA));
+				const Vec3 center = (posA + posB + posC) / 3.f;
+				chunkSums[0] += area;
+				chunkSums[1] += area * center.x;
+				chunkSums[2] += area * center.y;
+				chunkSums[3] += area * center.z;
+				chunkSums[4] += Dot(posA, Cross(posB, posC)) / 6.;
+			}
+			return chunkSums;
+		},
+		[](std::array<double, 5> lhs, const std::array<double, 5>& rhs)
+		{
+			for(size_t iSum = 0; iSum < lhs.size(); ++iSum)
+				lhs[iSum] += rhs[iSum];
+			return lhs;
+		},
+		4096,
+		ReductionMode::Deterministic);
+
+	measures.SurfaceArea = static_cast<float>(sums[0]);
+	measures.Volume = static_cast<float>(sums[4]);
+	measures.SurfaceCentroid = sums[0] > 0.
+		? origin
+			+ Vec3{ static_cast<float>(sums[1] / sums[0]),
+				  static_cast<float>(sums[2] / sums[0]),
+				  static_cast<float>(sums[3] / sums[0]) }
+		: measures.VertexCentroid;
+	return measures;
+}
+
+void MeshGeometry::Transform(Mesh& mesh, const Mat4& transform, const bool transformNormals)
+{
+	ProfileScope("MeshGeometry::Transform");
+
+	// Transform the cached positions block by block, the padding included.
+	const std::shared_ptr<const PositionBuffers> positions = mesh.GetPositionBuffers();
+	auto transformed = std::make_shared<PositionBuffers>();
+	transformed->VertexCount = positions->VertexCount;
+	transformed->LiveVertexCount = positions->LiveVertexCount;
+	transformed->FillPosition = Vec3{ transform * Vec4{ positions->FillPosition, 1.f } };
+	transformed->X.resize(positions->GetPaddedCount());
+	transformed->Y.resize(positions->GetPaddedCount());
+	transformed->Z.resize(positions->GetPaddedCount());
+
+	const float* xs = GetAlignedData(positions->X);
+	const float* ys = GetAlignedData(positions->Y);
+	const float* zs = GetAlignedData(positions->Z);
+	float* transformedXs = GetAlignedData(transformed->X);
+	float* transformedYs = GetAlignedData(transformed->Y);
+	float* transformedZs = GetAlignedData(transformed->Z);
+	ParallelForRange(
+		0,
+		positions->GetPaddedCount() / LaneCount,
+		[&](const size_t blockBegin, const size_t blockEnd)
+		{
+			// The matrix is column-major: transform[column][row].
+			const Mat4 matrix = transform;
+			for(size_t iBlock = blockBegin; iBlock < blockEnd; ++iBlock)
+			{
+				const size_t offset = iBlock * LaneCount;
+				for(size_t iLane = 0; iLane < LaneCount; ++iLane)
+				{
+					const size_t iSlot = offset + iLane;
+					const float x = xs[iSlot];
+					const float y = ys[iSlot];
+					const float z = zs[iSlot];
+					transformedXs[iSlot] = matrix[0][0] * x + matrix[1][0] * y + matrix[2][0] * z + matrix[3][0];
+					transformedYs[iSlot] = matrix[0][1] * x + matrix[1][1] * y + matrix[2][1] * z + matrix[3][1];
+					transformedZs[iSlot] = matrix[0][2] * x + matrix[1][2] * y + matrix[2][2] * z + matrix[3][2];
+				}
+			}
+		},
+		256);
+
+	// Write the live positions back to the vertices.
+	ParallelFor(
+		0,
+		transformed->VertexCount,
+		[&](const size_t iVertex)
+		{
+			if(!mesh.IsVertexDeleted(static_cast<VertexIndex>(iVertex)))
+				mesh.m_Vertices[iVertex].Position = transformed->GetPosition(static_cast<VertexIndex>(iVertex));
+		});
+
+	if(transformNormals)
+	{
+		const glm::mat3 normalMatrix = glm::transpose(glm::inverse(glm::mat3(transform)));
+		if(mesh.HasTrianglesExtraDataContainer())
+		{
+			ParallelFor(
+				0,
+				mesh.m_TrianglesExtraDataContainer.size(),
+				[&](const size_t iTriangle)
+				{
+					ExtraDataContainer& curContainer = mesh.m_TrianglesExtraDataContainer[iTriangle];
+					if(TriangleNormalExtraData* triangleNormal = curContainer.Get<TriangleNormalExtraData>())
+						triangleNormal->SetData(TransformNormal(normalMatrix, triangleNormal->GetData()));
+				});
+		}
+		if(mesh.HasVerticesExtraDataContainer())
+		{
+			ParallelFor(
+				0,
+				mesh.m_VerticesExtraDataContainer.size(),
+				[&](const size_t iVertex)
+				{
+					ExtraDataContainer& curContainer = mesh.m_VerticesExtraDataContainer[iVertex];
+					if(SmoothVertexNormalExtraData* smoothNormal = curContainer.Get<SmoothVertexNormalExtraData>())
+						smoothNormal->SetData(TransformNormal(normalMatrix, smoothNormal->GetData()));
+					if(FlatVertexNormalsExtraData* flatNormals = curContainer.Get<FlatVertexNormalsExtraData>())
+					{
+						for(Vec3& flatNormal : flatNormals->GetData())
+							flatNormal = TransformNormal(normalMatrix, flatNormal);
+					}
+				});
+		}
+	}
+
+	// The transformed buffers are the ones of the new geometry, no need to build them again.
+	mesh.NotifyGeometryChanged();
+	const std::scoped_lock lock(mesh.m_PositionBuffersMutex);
+	mesh.m_PositionBuffers = std::move(transformed);
+	mesh.m_PositionBuffersRevision = mesh.m_GeometryRevision;
+}
+
+void MeshGeometry::Transform(Mesh& mesh, const Quat& rotation, const bool transformNormals)
+{
+	Transform(mesh, glm::mat4_cast(rotation), transformNormals);
+}
+} // namespace Utilitary::Surface
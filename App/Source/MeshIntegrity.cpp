@@ -1,79 +1,518 @@
 #include "Application/MeshIntegrity.h"
 
+#include "Core/Parallel.h"
+#include "Core/TaskGraph.h"
+
+#include <algorithm>
+#include <atomic>
+#include <format>
+#include <limits>
+#include <mutex>
+#include <numeric>
+
 using namespace Core::BaseType;
+using namespace Core::Parallel;
 using namespace Data::Primitive;
 using namespace Data::Surface;
 
-namespace Utilitary::Surface
+namespace
 {
-MeshIntegrity::ExitCode MeshIntegrity::CheckIntegrity(const Mesh& mesh)
+using ExitCode = Utilitary::Surface::MeshIntegrity::ExitCode;
+using Report = Utilitary::Surface::MeshIntegrity::Report;
+
+/// @brief Number of elements checked by a thread between two looks at the other threads' results.
+constexpr size_t ElementGrainSize = 4096;
+
+/// @brief Check a vertex, the checks depend on each other so at most one violation is found.
+ExitCode CheckVertex(const Mesh& mesh, const int vertexIdx)
 {
-	// Check the integrity of each vertex of the mesh.
-	for(int iVertex = 0; iVertex < static_cast<int>(mesh.GetVertexCount()); ++iVertex)
+	const Vertex& vertex = mesh.GetVertexData(vertexIdx);
+	// Check that the vertex has a valid incident triangle.
+	if(vertex.IncidentTriangleIdx == -1)
+		return ExitCode::VertexHasNullIncidentTriangle;
+
+	// Check that the vertex has a valid incident triangle index.
+	if(vertex.IncidentTriangleIdx < 0 || static_cast<uint32_t>(vertex.IncidentTriangleIdx) >= mesh.GetTriangleCount()
+	   || mesh.IsTriangleDeleted(vertex.IncidentTriangleIdx))
+		return ExitCode::InvalidIncidentTriangleIndex;
+
+	// Check that the vertex is indeed part of its incident triangle.
+	const auto& triangleVertices = mesh.GetTriangleData(vertex.IncidentTriangleIdx).Vertices;
+	if(triangleVertices[0] != vertexIdx && triangleVertices[1] != vertexIdx && triangleVertices[2] != vertexIdx)
+		return ExitCode::VertexNotInTriangle;
+
+	return ExitCode::MeshOK;
+}
+
+/// @brief Check a triangle and call onViolation(code) for each violation, in the order of the checks.
+/// @param checkOrientation Also check that the neighbors run through the common edges in the opposite direction.
+/// @note onViolation returns false to stop the checks of the triangle.
+template<typename Func>
+void CheckTriangle(const Mesh& mesh, const int triangleIdx, const bool checkOrientation, Func&& onViolation)
+{
+	const int vertexCount = static_cast<int>(mesh.GetVertexCount());
+	const int triangleCount = static_cast<int>(mesh.GetTriangleCount());
+	const Triangle& triangle = mesh.GetTriangleData(triangleIdx);
+
+	// Check that the triangle has valid vertices, the other checks would be meaningless otherwise.
+	if(triangle.Vertices[0] == -1 || triangle.Vertices[1] == -1 || triangle.Vertices[2] == -1)
 	{
-		const Vertex& curVertex = mesh.m_Vertices[iVertex];
-		// Check that the vertex has a valid incident triangle.
-		if(curVertex.IncidentTriangleIdx == -1)
-			return ExitCode::VertexHasNullIncidentTriangle;
-
-		// Check that the vertex has a valid incident triangle index.
-		if(static_cast<uint32_t>(curVertex.IncidentTriangleIdx) >= mesh.GetTriangleCount())
-			return ExitCode::InvalidIncidentTriangleIndex;
-
-		// Check that the vertex is indeed part of its incident triangle.
-		const Triangle& triangle = mesh.m_Triangles[curVertex.IncidentTriangleIdx];
-		auto&& triangleVertices = triangle.Vertices;
-		if(triangleVertices[0] != iVertex && triangleVertices[1] != iVertex && triangleVertices[2] != iVertex)
-			return ExitCode::VertexNotInTriangle;
+		onViolation(ExitCode::TriangleHasNullVertex);
+		return;
 	}
 
-	// Check the integrity of each triangle of the mesh.
-	int vertexCount = static_cast<int>(mesh.GetVertexCount());
-	int triangleCount = static_cast<int>(mesh.GetTriangleCount());
-	for(int iTriangle = 0; iTriangle < triangleCount; ++iTriangle)
+	// Check that the triangle does not have duplicated vertices.
+	if(triangle.Vertices[0] == triangle.Vertices[1] || triangle.Vertices[1] == triangle.Vertices[2]
+	   || triangle.Vertices[2] == triangle.Vertices[0])
 	{
-		const Triangle& curTriangle = mesh.m_Triangles[iTriangle];
-		// Check that the triangle has valid vertices.
-		if(curTriangle.Vertices[0] == -1 || curTriangle.Vertices[1] == -1 || curTriangle.Vertices[2] == -1)
-			return ExitCode::TriangleHasNullVertex;
+		onViolation(ExitCode::TriangleHasDuplicatedVertices);
+		return;
+	}
 
-		// Check that the triangle does not have duplicated vertices.
-		if(curTriangle.Vertices[0] == curTriangle.Vertices[1] || curTriangle.Vertices[1] == curTriangle.Vertices[2]
-		   || curTriangle.Vertices[2] == curTriangle.Vertices[0])
-			return ExitCode::TriangleHasDuplicatedVertices;
+	for(EdgeIndex iEdge = 0; iEdge < 3; ++iEdge)
+	{
+		// Check that each vertex has a valid index.
+		const int vertexIdx = triangle.Vertices[iEdge];
+		if((vertexIdx < 0 || vertexIdx >= vertexCount || mesh.IsVertexDeleted(vertexIdx))
+		   && !onViolation(ExitCode::InvalidVertexIndex))
+			return;
 
-		for(EdgeIndex iEdge = 0; iEdge < 3; ++iEdge)
+		// Check that each neighbor triangle is reciprocal.
+		const int neighborIdx = triangle.Neighbors[iEdge];
+		if(neighborIdx == -1)
+			continue;
+
+		// Check that the neighbor index is valid.
+		if(neighborIdx < 0 || neighborIdx >= triangleCount || mesh.IsTriangleDeleted(neighborIdx))
+		{
+			if(!onViolation(ExitCode::InvalidNeighborTriangleIndex))
+				return;
+			continue;
+		}
+
+		// A triangle cannot be its own neighbor.
+		if(neighborIdx == triangleIdx)
+		{
+			if(!onViolation(ExitCode::TriangleIsItsOwnNeighbor))
+				return;
+			continue;
+		}
+
+		// Check that the neighbor has the current triangle as neighbor on the same edge.
+		const VertexIndex firstVertexIdx = triangle.Vertices[IndexHelpers::Next[iEdge]];
+		const VertexIndex secondVertexIdx = triangle.Vertices[IndexHelpers::Previous[iEdge]];
+		const Triangle& neighbor = mesh.GetTriangleData(neighborIdx);
+		const int neighborEdgeIdx = Utilitary::Primitive::GetEdgeIndex(neighbor, firstVertexIdx, secondVertexIdx);
+		if(neighborEdgeIdx == -1 || neighbor.Neighbors[neighborEdgeIdx] != triangleIdx)
 		{
-			// Check that each vertex has a valid index.
-			if(curTriangle.Vertices[iEdge] >= vertexCount)
-				return MeshIntegrity::ExitCode::InvalidVertexIndex;
+			if(!onViolation(ExitCode::TriangleNeighborNotReciprocal))
+				return;
+			continue;
+		}
+
+		// The neighbor must run through the edge from the second vertex to the first one.
+		if(checkOrientation
+		   && static_cast<VertexIndex>(neighbor.Vertices[IndexHelpers::Next[neighborEdgeIdx]]) != secondVertexIdx
+		   && !onViolation(ExitCode::InconsistentOrientation))
+			return;
+	}
+}
+
+/// @brief True if the triangle references three distinct alive vertices, the topology checks only use those.
+bool HasValidVertices(const Mesh& mesh, const Triangle& triangle)
+{
+	for(const int vertexIdx : triangle.Vertices)
+		if(vertexIdx < 0 || static_cast<uint32_t>(vertexIdx) >= mesh.GetVertexCount()
+		   || mesh.IsVertexDeleted(vertexIdx))
+			return false;
+	return triangle.Vertices[0] != triangle.Vertices[1] && triangle.Vertices[1] != triangle.Vertices[2]
+		&& triangle.Vertices[2] != triangle.Vertices[0];
+}
 
-			// Check that each neighbor triangle is reciprocal.
-			int neighborIdx = curTriangle.Neighbors[iEdge];
-			if(neighborIdx != -1)
+/// @brief Count the triangles reached by walking around the vertex from its incident triangle through the neighbors.
+/// @param maxCount Bound of the walk, in case of inconsistent neighbors.
+uint32_t CountFanTriangles(const Mesh& mesh, const int vertexIdx, const uint32_t maxCount)
+{
+	const int startTriangleIdx = mesh.GetVertexData(vertexIdx).IncidentTriangleIdx;
+	uint32_t count = 1;
+
+	// Walk in one direction, then in the other one if a boundary is reached.
+	for(const auto& firstEdges : { IndexHelpers::Next, IndexHelpers::Previous })
+	{
+		int curTriangleIdx = startTriangleIdx;
+		int localIdx = Utilitary::Primitive::GetVertexLocalIndex(mesh.GetTriangleData(curTriangleIdx), vertexIdx);
+		EdgeIndex edgeIdx = firstEdges[localIdx];
+		while(count < maxCount)
+		{
+			const int neighborIdx = mesh.GetTriangleData(curTriangleIdx).Neighbors[edgeIdx];
+			if(neighborIdx < 0 || static_cast<uint32_t>(neighborIdx) >= mesh.GetTriangleCount()
+			   || mesh.IsTriangleDeleted(neighborIdx))
+				break;
+			if(neighborIdx == startTriangleIdx)
+				return count;
+
+			// Leave the neighbor through its other edge around the vertex.
+			const Triangle& neighbor = mesh.GetTriangleData(neighborIdx);
+			localIdx = Utilitary::Primitive::GetVertexLocalIndex(neighbor, vertexIdx);
+			if(localIdx == -1)
+				break;
+			if(neighbor.Neighbors[IndexHelpers::Next[localIdx]] == curTriangleIdx)
+				edgeIdx = IndexHelpers::Previous[localIdx];
+			else if(neighbor.Neighbors[IndexHelpers::Previous[localIdx]] == curTriangleIdx)
+				edgeIdx = IndexHelpers::Next[localIdx];
+			else
+				break;
+
+			curTriangleIdx = neighborIdx;
+			++count;
+		}
+	}
+	return count;
+}
+
+/// @brief Violations found by a thread, merged into the report at the end of its chunk.
+struct LocalReport
+{
+	std::array<std::vector<uint32_t>, Utilitary::Surface::MeshIntegrity::ExitCodeCount> Elements{};
+
+	void Add(const ExitCode code, const uint32_t elementIdx)
+	{
+		std::vector<uint32_t>& elements = Elements[static_cast<size_t>(code)];
+		// The checks of an element may report the same code several times.
+		if(elements.empty() || elements.back() != elementIdx)
+			elements.push_back(elementIdx);
+	}
+
+	void MergeInto(Utilitary::Surface::MeshIntegrity::Report& report, std::mutex& mutex) const
+	{
+		const std::scoped_lock lock(mutex);
+		for(size_t iCode = 0; iCode < Elements.size(); ++iCode)
+		{
+			report.Counts[iCode] += Elements[iCode].size();
+			report.Elements[iCode].insert(report.Elements[iCode].end(), Elements[iCode].begin(), Elements[iCode].end());
+		}
+	}
+};
+
+/// @brief Triangles around each vertex (compressed rows), those of the vertex v being the elements
+/// [FirstTriangleIndices[v], FirstTriangleIndices[v + 1]) of TriangleIndices.
+struct VertexStars
+{
+	std::vector<uint32_t> FirstTriangleIndices{};
+	std::vector<uint32_t> TriangleIndices{};
+};
+
+/// @brief Check each element, and the orientation of the neighbors.
+void CheckElements(const Mesh& mesh, const bool checkTopology, Report& report, std::mutex& reportMutex)
+{
+	const uint32_t vertexCount = mesh.GetVertexCount();
+	const uint32_t triangleCount = mesh.GetTriangleCount();
+	ParallelForRange(
+		0,
+		static_cast<size_t>(vertexCount) + triangleCount,
+		[&](const size_t chunkBegin, const size_t chunkEnd)
+		{
+			LocalReport localReport;
+			for(size_t iElement = chunkBegin; iElement < chunkEnd; ++iElement)
 			{
-				// Get the two vertices defining the edge opposite to the neighbor.
-				VertexIndex v0Idx = curTriangle.Vertices[IndexHelpers::Next[iEdge]];
-				VertexIndex v1Idx = curTriangle.Vertices[IndexHelpers::Previous[iEdge]];
+				if(iElement < vertexCount)
+				{
+					const VertexIndex vertexIdx = static_cast<VertexIndex>(iElement);
+					if(mesh.IsVertexDeleted(vertexIdx))
+						continue;
+					const ExitCode code = CheckVertex(mesh, static_cast<int>(vertexIdx));
+					if(code != ExitCode::MeshOK)
+						localReport.Add(code, vertexIdx);
+					continue;
+				}
 
-				// Check that the neighbor index is valid.
-				if(neighborIdx >= triangleCount)
-					return ExitCode::InvalidNeighborTriangleIndex;
+				const TriangleIndex triangleIdx = static_cast<TriangleIndex>(iElement - vertexCount);
+				if(mesh.IsTriangleDeleted(triangleIdx))
+					continue;
+				CheckTriangle(mesh,
+							  static_cast<int>(triangleIdx),
+							  checkTopology,
+							  [&localReport, triangleIdx](const ExitCode code)
+							  {
+								  localReport.Add(code, triangleIdx);
+								  return true;
+							  });
+			}
+			localReport.MergeInto(report, reportMutex);
+		},
+		ElementGrainSize);
+}
 
-				// A triangle cannot be its own neighbor.
-				if(neighborIdx == iTriangle)
-					return ExitCode::TriangleIsItsOwnNeighbor;
+/// @brief Gather the triangles around each vertex with atomic counters.
+VertexStars BuildVertexStars(const Mesh& mesh)
+{
+	const uint32_t vertexCount = mesh.GetVertexCount();
+	const uint32_t triangleCount = mesh.GetTriangleCount();
+	std::vector<uint32_t> firstTriangleIndices(static_cast<size_t>(vertexCount) + 1, 0);
+	ParallelFor(
+		0,
+		triangleCount,
+		[&](const size_t iTriangle)
+		{
+			const Triangle& triangle = mesh.GetTriangleData(static_cast<TriangleIndex>(iTriangle));
+			if(mesh.IsTriangleDeleted(static_cast<TriangleIndex>(iTriangle)) || !HasValidVertices(mesh, triangle))
+				return;
+			for(const int vertexIdx : triangle.Vertices)
+			{
+				std::atomic_ref<uint32_t> starSize(firstTriangleIndices[vertexIdx + 1]);
+				starSize.fetch_add(1, std::memory_order_relaxed);
+			}
+		},
+		ElementGrainSize);
+	std::inclusive_scan(firstTriangleIndices.begin(), firstTriangleIndices.end(), firstTriangleIndices.begin());
+
+	std::vector<uint32_t> insertionIndices(firstTriangleIndices.begin(), firstTriangleIndices.end() - 1);
+	std::vector<uint32_t> vertexTriangles(firstTriangleIndices.back());
+	ParallelFor(
+		0,
+		triangleCount,
+		[&](const size_t iTriangle)
+		{
+			const Triangle& triangle = mesh.GetTriangleData(static_cast<TriangleIndex>(iTriangle));
+			if(mesh.IsTriangleDeleted(static_cast<TriangleIndex>(iTriangle)) || !HasValidVertices(mesh, triangle))
+				return;
+			for(const int vertexIdx : triangle.Vertices)
+			{
+				const uint32_t insertionIdx =
+					std::atomic_ref<uint32_t>(insertionIndices[vertexIdx]).fetch_add(1, std::memory_order_relaxed);
+				vertexTriangles[insertionIdx] = static_cast<uint32_t>(iTriangle);
+			}
+		},
+		ElementGrainSize);
+	return { .FirstTriangleIndices = std::move(firstTriangleIndices), .TriangleIndices = std::move(vertexTriangles) };
+}
 
-				// Get the neighbor triangle and the two vertices.
-				const Triangle& neighbor = mesh.m_Triangles[neighborIdx];
-				int edgeIndex = Utilitary::Primitive::GetEdgeIndex(neighbor, v0Idx, v1Idx);
+/// @brief An edge is non-manifold if more than two triangles around its first vertex contain its second vertex.
+void CheckNonManifoldEdges(const Mesh& mesh, const VertexStars& stars, Report& report, std::mutex& reportMutex)
+{
+	const std::vector<uint32_t>& firstTriangleIndices = stars.FirstTriangleIndices;
+	const std::vector<uint32_t>& vertexTriangles = stars.TriangleIndices;
+	const uint32_t triangleCount = mesh.GetTriangleCount();
+	ParallelForRange(
+		0,
+		triangleCount,
+		[&](const size_t chunkBegin, const size_t chunkEnd)
+		{
+			LocalReport localReport;
+			for(size_t iTriangle = chunkBegin; iTriangle < chunkEnd; ++iTriangle)
+			{
+				const TriangleIndex triangleIdx = static_cast<TriangleIndex>(iTriangle);
+				const Triangle& triangle = mesh.GetTriangleData(triangleIdx);
+				if(mesh.IsTriangleDeleted(triangleIdx) || !HasValidVertices(mesh, triangle))
+					continue;
 
-				// Check that the neighbor has the current triangle as neighbor on the same edge.
-				if(edgeIndex == -1 || neighbor.Neighbors[edgeIndex] != iTriangle)
-					return ExitCode::TriangleNeighborNotReciprocal;
+				for(EdgeIndex iEdge = 0; iEdge < 3; ++iEdge)
+				{
+					const int firstVertexIdx = triangle.Vertices[iEdge];
+					const int secondVertexIdx = triangle.Vertices[IndexHelpers::Next[iEdge]];
+					const auto aroundBegin = vertexTriangles.begin() + firstTriangleIndices[firstVertexIdx];
+					const auto aroundEnd = vertexTriangles.begin() + firstTriangleIndices[firstVertexIdx + 1];
+					const auto isOnEdge = [&mesh, secondVertexIdx](const uint32_t aroundTriangleIdx)
+					{
+						const auto& vertices = mesh.GetTriangleData(aroundTriangleIdx).Vertices;
+						return std::find(vertices.begin(), vertices.end(), secondVertexIdx) != vertices.end();
+					};
+					if(std::count_if(aroundBegin, aroundEnd, isOnEdge) > 2)
+					{
+						localReport.Add(ExitCode::NonManifoldEdge, triangleIdx);
+						break;
+					}
+				}
 			}
-		}
+			localReport.MergeInto(report, reportMutex);
+		},
+		ElementGrainSize);
+}
+
+/// @brief A vertex is non-manifold if the walk around it misses some of its triangles.
+void CheckNonManifoldVertices(const Mesh& mesh, const VertexStars& stars, Report& report, std::mutex& reportMutex)
+{
+	const std::vector<uint32_t>& firstTriangleIndices = stars.FirstTriangleIndices;
+	const uint32_t vertexCount = mesh.GetVertexCount();
+	ParallelForRange(
+		0,
+		vertexCount,
+		[&](const size_t chunkBegin, const size_t chunkEnd)
+		{
+			LocalReport localReport;
+			for(size_t iVertex = chunkBegin; iVertex < chunkEnd; ++iVertex)
+			{
+				const int vertexIdx = static_cast<int>(iVertex);
+				if(mesh.IsVertexDeleted(vertexIdx) || CheckVertex(mesh, vertexIdx) != ExitCode::MeshOK)
+					continue;
+
+				const uint32_t starSize = firstTriangleIndices[iVertex + 1] - firstTriangleIndices[iVertex];
+				if(CountFanTriangles(mesh, vertexIdx, starSize) < starSize)
+					localReport.Add(ExitCode::NonManifoldVertex, static_cast<uint32_t>(iVertex));
+			}
+			localReport.MergeInto(report, reportMutex);
+		},
+		ElementGrainSize);
+}
+} // namespace
+
+namespace Utilitary::Surface
+{
+bool MeshIntegrity::Report::IsValid() const
+{
+	return std::all_of(Counts.begin(),
+					   Counts.end(),
+					   [](const uint64_t count)
+					   {
+						   return count == 0;
+					   });
+}
+
+std::string MeshIntegrity::Report::ToString() const
+{
+	if(IsValid())
+		return std::string(GetExitCodeName(ExitCode::MeshOK)) + '\n';
+
+	std::string text;
+	for(size_t iCode = 0; iCode < ExitCodeCount; ++iCode)
+	{
+		if(Counts[iCode] == 0)
+			continue;
+
+		text += std::format("{}: {} (", GetExitCodeName(static_cast<ExitCode>(iCode)), Counts[iCode]);
+		constexpr size_t printedCount = 10;
+		for(size_t iElement = 0; iElement < std::min(printedCount, Elements[iCode].size()); ++iElement)
+			text += std::format("{}{}", iElement == 0 ? "" : ", ", Elements[iCode][iElement]);
+		text += Counts[iCode] > printedCount ? ", ...)\n" : ")\n";
+	}
+	return text;
+}
+
+MeshIntegrity::ExitCode MeshIntegrity::CheckIntegrity(const Mesh& mesh)
+{
+	// The vertices come first, then the triangles. The first violation is packed with its element in a single key so
+	// that the lowest one wins, the threads stop as soon as they pass it.
+	const size_t vertexCount = mesh.GetVertexCount();
+	const size_t elementCount = vertexCount + mesh.GetTriangleCount();
+	std::atomic<uint64_t> firstViolationKey{ std::numeric_limits<uint64_t>::max() };
+
+	ParallelForRange(
+		0,
+		elementCount,
+		[&](const size_t chunkBegin, const size_t chunkEnd)
+		{
+			for(size_t iElement = chunkBegin; iElement < chunkEnd; ++iElement)
+			{
+				uint64_t curKey = firstViolationKey.load(std::memory_order_relaxed);
+				if((iElement << 8) >= curKey)
+					return;
+
+				ExitCode code = ExitCode::MeshOK;
+				if(iElement < vertexCount)
+				{
+					// Deleted vertices are ignored until the next garbage collection.
+					if(!mesh.IsVertexDeleted(static_cast<VertexIndex>(iElement)))
+						code = CheckVertex(mesh, static_cast<int>(iElement));
+				}
+				else if(!mesh.IsTriangleDeleted(static_cast<TriangleIndex>(iElement - vertexCount)))
+				{
+					CheckTriangle(mesh,
+								  static_cast<int>(iElement - vertexCount),
+								  false,
+								  [&code](const ExitCode violation)
+								  {
+									  code = violation;
+									  return false;
+								  });
+				}
+				if(code == ExitCode::MeshOK)
+					continue;
+
+				const uint64_t key = iElement << 8 | static_cast<uint64_t>(code);
+				while(key < curKey && !firstViolationKey.compare_exchange_weak(curKey, key, std::memory_order_relaxed))
+				{
+				}
+				return;
+			}
+		},
+		ElementGrainSize);
+
+	const uint64_t key = firstViolationKey.load(std::memory_order_relaxed);
+	return key == std::numeric_limits<uint64_t>::max() ? ExitCode::MeshOK : static_cast<ExitCode>(key & 0xFF);
+}
+
+MeshIntegrity::Report MeshIntegrity::BuildReport(
+	const Mesh& mesh, const bool checkTopology, const size_t maxElementsPerCode)
+{
+	Report report;
+	std::mutex reportMutex;
+
+	// The element checks run alongside the topology checks, which wait for the triangles around each vertex.
+	TaskGraph graph;
+	graph.AddTask([&]() { CheckElements(mesh, checkTopology, report, reportMutex); });
+	VertexStars stars;
+	if(checkTopology)
+	{
+		const TaskGraph::TaskId starsTask = graph.AddTask([&]() { stars = BuildVertexStars(mesh); });
+		const TaskGraph::TaskId edgesTask =
+			graph.AddTask([&]() { CheckNonManifoldEdges(mesh, stars, report, reportMutex); });
+		const TaskGraph::TaskId verticesTask =
+			graph.AddTask([&]() { CheckNonManifoldVertices(mesh, stars, report, reportMutex); });
+		graph.AddDependency(starsTask, edgesTask);
+		graph.AddDependency(starsTask, verticesTask);
+	}
+	graph.Run();
+
+	// The chunks are merged in any order: sort the elements, then keep the lowest ones.
+	ParallelFor(
+		0,
+		ExitCodeCount,
+		[&](const size_t iCode)
+		{
+			std::vector<uint32_t>& elements = report.Elements[iCode];
+			std::sort(elements.begin(), elements.end());
+			if(elements.size() > maxElementsPerCode)
+			{
+				elements.resize(maxElementsPerCode);
+				elements.shrink_to_fit();
+			}
+		},
+		1);
+
+	return report;
+}
+
+const char* MeshIntegrity::GetExitCodeName(const ExitCode code)
+{
+	switch(code)
+	{
+	case ExitCode::MeshOK:
+		return "MeshOK";
+	case ExitCode::VertexHasNullIncidentTriangle:
+		return "VertexHasNullIncidentTriangle";
+	case ExitCode::VertexNotInTriangle:
+		return "VertexNotInTriangle";
+	case ExitCode::TriangleHasNullVertex:
+		return "TriangleHasNullVertex";
+	case ExitCode::TriangleNeighborNotReciprocal:
+		return "TriangleNeighborNotReciprocal";
+	case ExitCode::TriangleHasDuplicatedVertices:
+		return "TriangleHasDuplicatedVertices";
+	case ExitCode::TriangleIsItsOwnNeighbor:
+		return "TriangleIsItsOwnNeighbor";
+	case ExitCode::InvalidVertexIndex:
+		return "InvalidVertexIndex";
+	case ExitCode::InvalidIncidentTriangleIndex:
+		return "InvalidIncidentTriangleIndex";
+	case ExitCode::InvalidNeighborTriangleIndex:
+		return "InvalidNeighborTriangleIndex";
+	case ExitCode::NonManifoldEdge:
+		return "NonManifoldEdge";
+	case ExitCode::InconsistentOrientation:
+		return "InconsistentOrientation";
+	case ExitCode::NonManifoldVertex:
+		return "NonManifoldVertex";
 	}
-	return MeshIntegrity::ExitCode::MeshOK;
+	return "Unknown";
 }
 } // namespace Utilitary::Surface
@@ -2,19 +2,22 @@
 
 #include "Application/ExtraDataType.h"
 #include "Application/PrimitiveProxy.h"
-#include "Application/VertexPair.h"
+#include "Core/MemoryArena.h"
 #include "Core/PrintHelpers.h"
+#include "Core/Profiler.h"
 
+#include <algorithm>
 #include <cassert>
 #include <fstream>
 #include <iostream>
-#include <unordered_map>
+#include <memory_resource>
 #include <utility>
 
 using namespace Data::Surface;
 using namespace Data::Primitive;
 using namespace Data::ExtraData;
 using namespace Core::BaseType;
+using namespace Core::Parallel;
 
 namespace
 {
@@ -55,12 +58,86 @@ int ReadNextInteger(std::ifstream& file)
 	// Convert string to index
 	return std::stoi(buffer) - 1;
 }
+
+/// @brief Share of the reading in the progress of a loading, the rest being the connectivity.
+constexpr float ReadingProgressShare = 0.9f;
+
+/// @brief Progress and cancellation of the reading of a file, checked every MeshLoader::RecordsPerCheck records.
+class ReadingMonitor
+{
+public:
+	ReadingMonitor(std::ifstream& file,
+		const std::filesystem::path& filepath,
+		const ProgressCallback& progress,
+		const CancellationToken& cancellation)
+		: m_File(file)
+		, m_Progress(progress)
+		, m_Cancellation(cancellation)
+	{
+		std::error_code error;
+		const uintmax_t fileSize = std::filesystem::file_size(filepath, error);
+		m_FileSize = error ? 0.0 : static_cast<double>(fileSize);
+	}
+
+	/// @brief Count a record, and report the position in the file every RecordsPerCheck records.
+	/// @return True if the loading is cancelled.
+	bool IsCancelledAfterRecord()
+	{
+		if(++m_RecordCount % Utilitary::Surface::MeshLoader::RecordsPerCheck != 0)
+			return false;
+
+		if(m_Progress && m_FileSize > 0.0)
+		{
+			const double position = static_cast<double>(std::max<std::streamoff>(m_File.tellg(), 0));
+			m_Progress(ReadingProgressShare * static_cast<float>(std::min(position / m_FileSize, 1.0)));
+		}
+		return m_Cancellation.IsCancelled();
+	}
+
+private:
+	std::ifstream& m_File;
+	const ProgressCallback& m_Progress;
+	const CancellationToken& m_Cancellation;
+	/// @brief Size of the file in bytes, 0 if unknown.
+	double m_FileSize = 0.0;
+	uint32_t m_RecordCount = 0;
+};
+
+/// @brief Log the cancellation of a loading.
+/// @return nullptr, the result of a cancelled loading.
+std::unique_ptr<Mesh> CancelLoading(const std::filesystem::path& filepath)
+{
+	Info("Loading of {} cancelled", filepath.string());
+	return nullptr;
+}
+
+/// @brief Build the connectivity of a loaded mesh, unless the loading is cancelled.
+/// @return The mesh, nullptr if the loading is cancelled.
+std::unique_ptr<Mesh> FinishLoading(std::unique_ptr<Mesh> mesh,
+	const std::filesystem::path& filepath,
+	const ProgressCallback& progress,
+	const CancellationToken& cancellation)
+{
+	if(cancellation.IsCancelled())
+		return CancelLoading(filepath);
+
+	// Set the incident triangles and the neighboring faces using the edges.
+	if(progress)
+		progress(ReadingProgressShare);
+	mesh->UpdateMeshConnectivity();
+	if(progress)
+		progress(1.f);
+	return mesh;
+}
 } // namespace
 
 namespace Utilitary::Surface
 {
-std::unique_ptr<Mesh> MeshLoader::LoadOFF(const std::filesystem::path& filepath)
+std::unique_ptr<Mesh> MeshLoader::LoadOFF(
+	const std::filesystem::path& filepath, const ProgressCallback& progress, const CancellationToken& cancellation)
 {
+	ProfileScope("MeshLoader::LoadOFF");
+
 	std::ifstream file(filepath);
 
 	// Checking file opening
@@ -81,6 +158,7 @@ std::unique_ptr<Mesh> MeshLoader::LoadOFF(const std::filesystem::path& filepath)
 	}
 
 	auto mesh = std::make_unique<Mesh>();
+	ReadingMonitor monitor(file, filepath, progress, cancellation);
 
 	// Retrieving the number of vertices / faces
 	SkipCommentsAndWhitespace(file);
@@ -93,27 +171,10 @@ std::unique_ptr<Mesh> MeshLoader::LoadOFF(const std::filesystem::path& filepath)
 	{
 		SkipCommentsAndWhitespace(file);
 		file >> curVertex.Position.x >> curVertex.Position.y >> curVertex.Position.z;
+		if(monitor.IsCancelledAfterRecord())
+			return CancelLoading(filepath);
 	}
 
-	// Map to store edges and their corresponding triangle and edge index
-	std::unordered_map<VertexPair, std::pair<TriangleIndex, EdgeIndex>> neighborMap;
-
-	// Set neighboring faces using the edges
-	auto SetFacesNeigbhor =
-		[&](TriangleIndex faceIdx, VertexIndex firstVertexIdx, VertexIndex secondVertexIdx, EdgeIndex edgeIdx)
-	{
-		if(neighborMap.find({ firstVertexIdx, secondVertexIdx }) == neighborMap.end())
-		{
-			neighborMap[{ firstVertexIdx, secondVertexIdx }] = { faceIdx, edgeIdx };
-		}
-		else // The edge with firstVertex and secondVertex is already registered in map
-		{
-			auto [faceNeighborIdx, neighborEdgeIdx] = neighborMap[{ firstVertexIdx, secondVertexIdx }];
-			mesh->m_Triangles[faceNeighborIdx].Neighbors[neighborEdgeIdx] = faceIdx;
-			mesh->m_Triangles[faceIdx].Neighbors[edgeIdx] = faceNeighborIdx;
-		}
-	};
-
 	mesh->m_Triangles.resize(faceCount);
 	for(int iTriangle = 0; iTriangle < faceCount; ++iTriangle)
 	{
@@ -129,35 +190,22 @@ std::unique_ptr<Mesh> MeshLoader::LoadOFF(const std::filesystem::path& filepath)
 			VertexIndex curVertexIdx;
 			file >> curVertexIdx;
 
-			// Get pointers to the vertex.
-			Vertex& curVertex = mesh->m_Vertices[curVertexIdx];
-
-			// Set IncidentTriangleIdx for the vertex if it's not already the case.
-			if(curVertex.IncidentTriangleIdx == -1)
-				curVertex.IncidentTriangleIdx = iTriangle;
-
 			// Set vertices of the triangle.
 			curFace.Vertices[iEdge] = curVertexIdx;
 		}
-
-		const VertexIndex iVertex0 = static_cast<VertexIndex>(curFace.Vertices[0]);
-		const VertexIndex iVertex1 = static_cast<VertexIndex>(curFace.Vertices[1]);
-		const VertexIndex iVertex2 = static_cast<VertexIndex>(curFace.Vertices[2]);
-
-		// Edge v0-v1
-		SetFacesNeigbhor(iTriangle, iVertex0, iVertex1, 2);
-		// Edge v1-v2
-		SetFacesNeigbhor(iTriangle, iVertex1, iVertex2, 0);
-		// Edge v2-v0
-		SetFacesNeigbhor(iTriangle, iVertex2, iVertex0, 1);
+		if(monitor.IsCancelledAfterRecord())
+			return CancelLoading(filepath);
 	}
-
 	file.close();
-	return mesh;
+
+	return FinishLoading(std::move(mesh), filepath, progress, cancellation);
 }
 
-std::unique_ptr<Mesh> MeshLoader::LoadOBJ(const std::filesystem::path& filepath)
+std::unique_ptr<Mesh> MeshLoader::LoadOBJ(
+	const std::filesystem::path& filepath, const ProgressCallback& progress, const CancellationToken& cancellation)
 {
+	ProfileScope("MeshLoader::LoadOBJ");
+
 	std::ifstream file(filepath);
 
 	// Checking file opening
@@ -176,33 +224,20 @@ std::unique_ptr<Mesh> MeshLoader::LoadOBJ(const std::filesystem::path& filepath)
 
 	auto mesh = std::make_unique<Mesh>();
 
-	// Map to store edges and their corresponding triangle and edge index.
-	std::unordered_map<VertexPair, std::pair<TriangleIndex, EdgeIndex>> neighborMap;
-
+	// The attributes read before the faces are temporaries of the scratch arena, freed at once after the loading.
+	const Core::Memory::ScratchScope scratch;
 	// While store texture coordinates informations.
-	std::vector<Vec2> texCoords;
+	std::pmr::vector<Vec2> texCoords(scratch.GetResource());
 	// While store triangle (flat) normal informations.
-	std::vector<Vec3> flatNormals;
-
-	// Set neighboring faces using the edges
-	auto SetFacesNeigbhor =
-		[&](TriangleIndex faceIdx, VertexIndex firstVertexIdx, VertexIndex secondVertexIdx, EdgeIndex edgeIdx)
-	{
-		if(neighborMap.find({ firstVertexIdx, secondVertexIdx }) == neighborMap.end())
-		{
-			neighborMap[{ firstVertexIdx, secondVertexIdx }] = { faceIdx, edgeIdx };
-		}
-		else // The edge with firstVertex and secondVertex is already registered in map
-		{
-			auto [faceNeighborIdx, neighborEdgeIdx] = neighborMap[{ firstVertexIdx, secondVertexIdx }];
-			mesh->m_Triangles[faceNeighborIdx].Neighbors[neighborEdgeIdx] = faceIdx;
-			mesh->m_Triangles[faceIdx].Neighbors[edgeIdx] = faceNeighborIdx;
-		}
-	};
+	std::pmr::vector<Vec3> flatNormals(scratch.GetResource());
 
+	ReadingMonitor monitor(file, filepath, progress, cancellation);
 	std::string type;
 	while(file.peek() != EOF)
 	{
+		if(monitor.IsCancelledAfterRecord())
+			return CancelLoading(filepath);
+
 		SkipCommentsAndWhitespace(file);
 
 		if(file.peek() == EOF)
@@ -254,7 +289,6 @@ std::unique_ptr<Mesh> MeshLoader::LoadOBJ(const std::filesystem::path& filepath)
 		}
 		else if(type == "f")
 		{ // Triangle (triangle)
-			const TriangleIndex curTriangleIdx = mesh->GetTriangleCount();
 			Triangle& curFace = mesh->m_Triangles.emplace_back();
 			auto& curContainer = mesh->m_TrianglesExtraDataContainer.emplace_back();
 
@@ -263,12 +297,12 @@ std::unique_ptr<Mesh> MeshLoader::LoadOBJ(const std::filesystem::path& filepath)
 			{
 				int curVertexIdx = ReadNextInteger(file);
 				assert(curVertexIdx != -1);
-				Vertex& curVertex = mesh->m_Vertices[curVertexIdx];
-				if(curVertex.IncidentTriangleIdx == -1)
-					curVertex.IncidentTriangleIdx = curTriangleIdx;
-
 				curFace.Vertices[iVertex] = curVertexIdx;
 
+				// Plain "f v1 v2 v3" faces have neither texCoords nor normal.
+				if(file.peek() != '/')
+					continue;
+
 				// Skip '/' character.
 				file.ignore(1);
 
@@ -292,22 +326,11 @@ std::unique_ptr<Mesh> MeshLoader::LoadOBJ(const std::filesystem::path& filepath)
 					faceNormal.SetData(flatNormals[flatNormalIdx]);
 				}
 			}
-
-			const VertexIndex iVertex0 = static_cast<VertexIndex>(curFace.Vertices[0]);
-			const VertexIndex iVertex1 = static_cast<VertexIndex>(curFace.Vertices[1]);
-			const VertexIndex iVertex2 = static_cast<VertexIndex>(curFace.Vertices[2]);
-
-			// Edge v0-v1
-			SetFacesNeigbhor(curTriangleIdx, iVertex0, iVertex1, 2);
-			// Edge v1-v2
-			SetFacesNeigbhor(curTriangleIdx, iVertex1, iVertex2, 0);
-			// Edge v2-v0
-			SetFacesNeigbhor(curTriangleIdx, iVertex2, iVertex0, 1);
 		}
 	}
-
 	file.close();
-	return mesh;
+
+	return FinishLoading(std::move(mesh), filepath, progress, cancellation);
 }
 
 } // namespace Utilitary::Surface
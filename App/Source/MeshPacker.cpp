@@ -0,0 +1,286 @@
+#include "Application/MeshPacker.h"
+
+#include "Application/ExtraDataType.h"
+#include "Core/MemoryArena.h"
+#include "Core/Parallel.h"
+#include "Core/Profiler.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cassert>
+#include <memory_resource>
+#include <numeric>
+
+using namespace Core::BaseType;
+using namespace Core::Parallel;
+using namespace Data::ExtraData;
+using namespace Data::Primitive;
+using namespace Data::Surface;
+
+namespace
+{
+/// @brief Attributes of a corner deciding whether it shares the packed vertex of another corner of its vertex.
+struct CornerAttributes
+{
+	Vec3 Normal{ 0.f };
+	Vec2 TexCoords{ 0.f };
+
+	bool operator==(const CornerAttributes& other) const = default;
+};
+
+/// @brief Hash of the bits of the attributes (FNV-1a over their words).
+uint64_t HashAttributes(const CornerAttributes& attributes)
+{
+	uint64_t hash = 0xcbf29ce484222325;
+	const Vec3& normal = attributes.Normal;
+	for(const float value : { normal.x, normal.y, normal.z, attributes.TexCoords.x, attributes.TexCoords.y })
+	{
+		hash ^= std::bit_cast<uint32_t>(value);
+		hash *= 0x100000001b3;
+	}
+	return hash;
+}
+
+/// @brief Extra data of a mesh holding the attributes of the corners, zero where they are missing.
+/// @note Each lookup in an extra data container hashes a type, so the triangles and vertices are read once each.
+struct AttributeSources
+{
+	const std::vector<Triangle>& Triangles;
+	std::span<const ExtraDataContainer> VerticesExtraData;
+	std::span<const ExtraDataContainer> TrianglesExtraData;
+	Utilitary::Surface::PackedNormalSource NormalSource;
+
+	/// @brief Get the attributes read from a triangle for its three corners, the triangle normal if it is the source.
+	std::array<CornerAttributes, 3> GetTriangleAttributes(const TriangleIndex iTriangle) const
+	{
+		std::array<CornerAttributes, 3> attributes{};
+		if(iTriangle >= TrianglesExtraData.size())
+			return attributes;
+		const ExtraDataContainer& extraData = TrianglesExtraData[iTriangle];
+		if(NormalSource == Utilitary::Surface::PackedNormalSource::Triangle)
+		{
+			if(const auto* triangleNormal = extraData.Get<TriangleNormalExtraData>())
+			{
+				for(CornerAttributes& cornerAttributes : attributes)
+					cornerAttributes.Normal = triangleNormal->GetData();
+			}
+		}
+		if(const auto* texCoords = extraData.Get<VerticesTexCoordsExtraData>())
+		{
+			for(VertexLocalIndex iLocal = 0; iLocal < 3; ++iLocal)
+				attributes[iLocal].TexCoords = texCoords->GetVertexTexCoords(iLocal);
+		}
+		return attributes;
+	}
+
+	/// @brief Check whether the normal comes from the vertices.
+	bool HasVertexNormals() const { return NormalSource == Utilitary::Surface::PackedNormalSource::SmoothVertex; }
+
+	/// @brief Get the smooth normal of a vertex.
+	Vec3 GetVertexNormal(const VertexIndex iVertex) const
+	{
+		if(iVertex < VerticesExtraData.size())
+		{
+			if(const auto* smoothNormal = VerticesExtraData[iVertex].Get<SmoothVertexNormalExtraData>())
+				return smoothNormal->GetData();
+		}
+		return Vec3{ 0.f };
+	}
+};
+} // namespace
+
+namespace Utilitary::Surface
+{
+PackedMeshLayout MeshPacker::ComputeLayout(const Mesh& mesh, const PackedNormalSource normalSource)
+{
+	ProfileScope("MeshPacker::ComputeLayout");
+
+	PackedMeshLayout layout;
+	layout.NormalSource = normalSource;
+	const AttributeSources sources{ mesh.m_Triangles,
+		mesh.m_VerticesExtraDataContainer,
+		mesh.m_TrianglesExtraDataContainer,
+		normalSource };
+
+	// Corners around each vertex (compressed rows), and the first index of each live triangle. The buffers are
+	// temporaries of the scratch arena of the calling thread, the workers only filling them.
+	const Core::Memory::ScratchScope scratch;
+	const size_t triangleCount = mesh.GetTriangleCount();
+	const size_t vertexCount = mesh.GetVertexCount();
+	std::pmr::vector<uint32_t> firstCornerIndices(vertexCount + 1, 0, scratch.GetResource());
+	std::pmr::vector<uint32_t> firstIndices(triangleCount + 1, 0, scratch.GetResource());
+	std::pmr::vector<CornerAttributes> cornerAttributes(3 * triangleCount, scratch.GetResource());
+	ParallelFor(
+		0,
+		triangleCount,
+		[&](const size_t iTriangle)
+		{
+			if(mesh.IsTriangleDeleted(static_cast<TriangleIndex>(iTriangle)))
+				return;
+			firstIndices[iTriangle + 1] = 3;
+			const std::array<CornerAttributes, 3> attributes =
+				sources.GetTriangleAttributes(static_cast<TriangleIndex>(iTriangle));
+			std::ranges::copy(attributes, cornerAttributes.begin() + 3 * iTriangle);
+			for(const int iVertex : mesh.m_Triangles[iTriangle].Vertices)
+			{
+				std::atomic_ref<uint32_t> cornerCount(firstCornerIndices[iVertex + 1]);
+				cornerCount.fetch_add(1, std::memory_order_relaxed);
+			}
+		});
+	std::inclusive_scan(firstCornerIndices.begin(), firstCornerIndices.end(), firstCornerIndices.begin());
+	std::inclusive_scan(firstIndices.begin(), firstIndices.end(), firstIndices.begin());
+
+	std::pmr::vector<uint32_t> insertionIndices(
+		firstCornerIndices.begin(), firstCornerIndices.end() - 1, scratch.GetResource());
+	std::pmr::vector<uint32_t> vertexCorners(firstCornerIndices.back(), scratch.GetResource());
+	ParallelFor(
+		0,
+		triangleCount,
+		[&](const size_t iTriangle)
+		{
+			if(mesh.IsTriangleDeleted(static_cast<TriangleIndex>(iTriangle)))
+				return;
+			for(EdgeIndex iCorner = 0; iCorner < 3; ++iCorner)
+			{
+				std::atomic_ref<uint32_t> insertionIdx(insertionIndices[mesh.m_Triangles[iTriangle].Vertices[iCorner]]);
+				vertexCorners[insertionIdx.fetch_add(1, std::memory_order_relaxed)] =
+					static_cast<uint32_t>(3 * iTriangle + iCorner);
+			}
+		});
+
+	// Deduplicate the corners of each vertex, in the order of the triangles so that the layout does not depend on the
+	// threads: a corner takes the packed vertex of the first previous corner with the same attributes.
+	std::pmr::vector<uint64_t> hashes(vertexCorners.size(), scratch.GetResource());
+	std::pmr::vector<uint32_t> cornerPackedOffsets(3 * triangleCount, scratch.GetResource());
+	std::pmr::vector<uint32_t> firstPackedIndices(vertexCount + 1, 0, scratch.GetResource());
+	ParallelFor(
+		0,
+		vertexCount,
+		[&](const size_t iVertex)
+		{
+			const uint32_t cornersBegin = firstCornerIndices[iVertex];
+			const uint32_t cornersEnd = firstCornerIndices[iVertex + 1];
+			if(cornersBegin == cornersEnd)
+				return;
+			std::sort(vertexCorners.begin() + cornersBegin, vertexCorners.begin() + cornersEnd);
+			const Vec3 vertexNormal =
+				sources.HasVertexNormals() ? sources.GetVertexNormal(static_cast<VertexIndex>(iVertex)) : Vec3{ 0.f };
+
+			uint32_t packedCount = 0;
+			for(uint32_t iPosition = cornersBegin; iPosition < cornersEnd; ++iPosition)
+			{
+				const uint32_t corner = vertexCorners[iPosition];
+				CornerAttributes& attributes = cornerAttributes[corner];
+				if(sources.HasVertexNormals())
+					attributes.Normal = vertexNormal;
+				hashes[iPosition] = HashAttributes(attributes);
+
+				uint32_t iPrevious = cornersBegin;
+				while(iPrevious < iPosition
+					  && (hashes[iPrevious] != hashes[iPosition]
+						  || !(cornerAttributes[vertexCorners[iPrevious]] == attributes)))
+					++iPrevious;
+				cornerPackedOffsets[corner] =
+					iPrevious < iPosition ? cornerPackedOffsets[vertexCorners[iPrevious]] : packedCount++;
+			}
+			firstPackedIndices[iVertex + 1] = packedCount;
+		});
+	std::inclusive_scan(firstPackedIndices.begin(), firstPackedIndices.end(), firstPackedIndices.begin());
+
+	// The first corner of each packed vertex gives its attributes.
+	layout.SourceCorners.resize(firstPackedIndices.back());
+	ParallelFor(
+		0,
+		vertexCount,
+		[&](const size_t iVertex)
+		{
+			uint32_t packedCount = 0;
+			for(uint32_t iPosition = firstCornerIndices[iVertex]; iPosition < firstCornerIndices[iVertex + 1];
+				++iPosition)
+			{
+				const uint32_t corner = vertexCorners[iPosition];
+				if(cornerPackedOffsets[corner] == packedCount)
+				{
+					layout.SourceCorners[firstPackedIndices[iVertex] + packedCount] = corner;
+					++packedCount;
+				}
+			}
+		});
+
+	layout.Indices.resize(firstIndices.back());
+	ParallelFor(
+		0,
+		triangleCount,
+		[&](const size_t iTriangle)
+		{
+			if(mesh.IsTriangleDeleted(static_cast<TriangleIndex>(iTriangle)))
+				return;
+			for(EdgeIndex iCorner = 0; iCorner < 3; ++iCorner)
+			{
+				const int iVertex = mesh.m_Triangles[iTriangle].Vertices[iCorner];
+				layout.Indices[firstIndices[iTriangle] + iCorner] =
+					firstPackedIndices[iVertex] + cornerPackedOffsets[3 * iTriangle + iCorner];
+			}
+		});
+	return layout;
+}
+
+void MeshPacker::PackVertices(const Mesh& mesh, const PackedMeshLayout& layout, std::span<PackedVertex> vertices)
+{
+	ProfileScope("MeshPacker::PackVertices");
+
+	assert(vertices.size() >= layout.GetVertexCount() && "The destination is too small");
+	const AttributeSources sources{ mesh.m_Triangles,
+		mesh.m_VerticesExtraDataContainer,
+		mesh.m_TrianglesExtraDataContainer,
+		layout.NormalSource };
+
+	// Each packed vertex is written whole, in order, which suits the write-combined memory of the mapped buffers.
+	ParallelFor(
+		0,
+		layout.GetVertexCount(),
+		[&](const size_t iPacked)
+		{
+			const uint32_t corner = layout.SourceCorners[iPacked];
+			const VertexIndex iVertex = mesh.m_Triangles[corner / 3].Vertices[corner % 3];
+			const CornerAttributes attributes = sources.GetTriangleAttributes(corner / 3)[corner % 3];
+			const Vec3 normal = sources.HasVertexNormals() ? sources.GetVertexNormal(iVertex) : attributes.Normal;
+			vertices[iPacked] = PackedVertex{ mesh.m_Vertices[iVertex].Position, normal, attributes.TexCoords };
+		});
+}
+
+void MeshPacker::PackIndices(const PackedMeshLayout& layout, std::span<uint16_t> indices)
+{
+	ProfileScope("MeshPacker::PackIndices");
+
+	assert(layout.GetIndexFormat() == PackedIndexFormat::UInt16 && "The packed vertices do not fit 16-bit indices");
+	assert(indices.size() >= layout.GetIndexCount() && "The destination is too small");
+	ParallelForRange(
+		0,
+		layout.GetIndexCount(),
+		[&](const size_t chunkBegin, const size_t chunkEnd)
+		{
+			for(size_t iIndex = chunkBegin; iIndex < chunkEnd; ++iIndex)
+				indices[iIndex] = static_cast<uint16_t>(layout.Indices[iIndex]);
+		},
+		16384);
+}
+
+void MeshPacker::PackIndices(const PackedMeshLayout& layout, std::span<uint32_t> indices)
+{
+	ProfileScope("MeshPacker::PackIndices");
+
+	assert(indices.size() >= layout.GetIndexCount() && "The destination is too small");
+	ParallelForRange(
+		0,
+		layout.GetIndexCount(),
+		[&](const size_t chunkBegin, const size_t chunkEnd)
+		{
+			std::copy(
+				layout.Indices.begin() + chunkBegin, layout.Indices.begin() + chunkEnd, indices.begin() + chunkBegin);
+		},
+		16384);
+}
+} // namespace Utilitary::Surface
@@ -0,0 +1,466 @@
+#include "Application/MeshRemesher.h"
+
+#include "Core/MathHelpers.h"
+#include "Core/Parallel.h"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+using namespace Core::BaseType;
+using namespace Core::Math::Geometry;
+using namespace Core::Parallel;
+using namespace Data::Primitive;
+using namespace Data::Surface;
+using namespace Utilitary::Primitive;
+
+namespace
+{
+/// @brief Edges longer than this factor times the target length are split.
+constexpr float SplitFactor = 4.f / 3.f;
+/// @brief Edges shorter than this factor times the target length are collapsed.
+constexpr float CollapseFactor = 4.f / 5.f;
+
+/// @brief Edge recorded by a sweep, with the vertices it had at that time.
+struct EdgeRecord
+{
+	/// @brief Ratio between the length of the edge and its target length.
+	float Ratio{ 0.f };
+	TriangleIndex TriangleIdx{ 0 };
+	EdgeIndex EdgeIdx{ 0 };
+	VertexIndex FirstVertexIdx{ 0 };
+	VertexIndex SecondVertexIdx{ 0 };
+};
+
+/// @brief Remeshing passes built on the local operators of the mesh.
+/// @note Removed elements are only deleted, their slots are recycled by the next splits.
+class IncrementalEditor
+{
+public:
+	IncrementalEditor(Mesh& mesh, std::vector<float>& sizing)
+		: m_Mesh(mesh)
+		, m_Vertices(mesh.GetVertices())
+		, m_Triangles(mesh.GetTriangles())
+		, m_Sizing(sizing)
+		, m_BoundaryFlags(m_Vertices.size(), 0)
+	{
+		for(TriangleIndex iTriangle = 0; iTriangle < m_Triangles.size(); ++iTriangle)
+		{
+			if(m_Mesh.IsTriangleDeleted(iTriangle))
+				continue;
+
+			const Triangle& curTriangle = m_Triangles[iTriangle];
+			for(EdgeIndex iEdge = 0; iEdge < 3; ++iEdge)
+			{
+				if(curTriangle.Neighbors[iEdge] != -1)
+					continue;
+				m_BoundaryFlags[curTriangle.Vertices[IndexHelpers::Next[iEdge]]] = 1;
+				m_BoundaryFlags[curTriangle.Vertices[IndexHelpers::Previous[iEdge]]] = 1;
+			}
+		}
+	}
+
+	/// @brief Split every edge longer than the split threshold at its midpoint.
+	void SplitLongEdges()
+	{
+		// Splitting the longest edges first avoids creating needles whose other edges stay too long.
+		std::vector<EdgeRecord> longEdges;
+		do
+		{
+			longEdges.clear();
+			for(TriangleIndex iTriangle = 0; iTriangle < m_Triangles.size(); ++iTriangle)
+			{
+				if(m_Mesh.IsTriangleDeleted(iTriangle))
+					continue;
+
+				for(EdgeIndex iEdge = 0; iEdge < 3; ++iEdge)
+				{
+					const int neighborIdx = m_Triangles[iTriangle].Neighbors[iEdge];
+					if(neighborIdx != -1 && static_cast<TriangleIndex>(neighborIdx) < iTriangle)
+						continue; // Each interior edge is owned by the triangle with the smallest index.
+
+					const VertexIndex firstVertexIdx = m_Triangles[iTriangle].Vertices[IndexHelpers::Next[iEdge]];
+					const VertexIndex secondVertexIdx = m_Triangles[iTriangle].Vertices[IndexHelpers::Previous[iEdge]];
+					const float ratio =
+						EdgeLength(firstVertexIdx, secondVertexIdx) / TargetLength(firstVertexIdx, secondVertexIdx);
+					if(ratio > SplitFactor)
+						longEdges.push_back({ ratio, iTriangle, iEdge, firstVertexIdx, secondVertexIdx });
+				}
+			}
+
+			std::sort(
+				longEdges.begin(),
+				longEdges.end(),
+				[](const EdgeRecord& lhs, const EdgeRecord& rhs) { return lhs.Ratio > rhs.Ratio; });
+
+			for(const EdgeRecord& curEdge : longEdges)
+			{
+				// Skip the edges already modified by a previous split, the next round handles them.
+				const Triangle& curTriangle = m_Triangles[curEdge.TriangleIdx];
+				if(m_Mesh.IsTriangleDeleted(curEdge.TriangleIdx)
+				   || static_cast<VertexIndex>(curTriangle.Vertices[IndexHelpers::Next[curEdge.EdgeIdx]])
+					   != curEdge.FirstVertexIdx
+				   || static_cast<VertexIndex>(curTriangle.Vertices[IndexHelpers::Previous[curEdge.EdgeIdx]])
+					   != curEdge.SecondVertexIdx)
+					continue;
+
+				SplitEdge(curEdge.TriangleIdx, curEdge.EdgeIdx);
+			}
+		} while(!longEdges.empty());
+	}
+
+	/// @brief Collapse every edge shorter than the collapse threshold, when the collapse is valid.
+	void CollapseShortEdges()
+	{
+		for(TriangleIndex iTriangle = 0; iTriangle < m_Triangles.size(); ++iTriangle)
+		{
+			for(EdgeIndex iEdge = 0; iEdge < 3 && !m_Mesh.IsTriangleDeleted(iTriangle); ++iEdge)
+			{
+				const int neighborIdx = m_Triangles[iTriangle].Neighbors[iEdge];
+				if(neighborIdx == -1 || static_cast<TriangleIndex>(neighborIdx) < iTriangle)
+					continue; // Boundary edges are never collapsed.
+
+				const VertexIndex firstVertexIdx = m_Triangles[iTriangle].Vertices[IndexHelpers::Next[iEdge]];
+				const VertexIndex secondVertexIdx = m_Triangles[iTriangle].Vertices[IndexHelpers::Previous[iEdge]];
+				if(EdgeLength(firstVertexIdx, secondVertexIdx)
+				   < CollapseFactor * TargetLength(firstVertexIdx, secondVertexIdx))
+					CollapseEdge(iTriangle, iEdge);
+			}
+		}
+	}
+
+	/// @brief Flip the edges whose flip brings the valences closer to 6 (4 on the boundaries).
+	void EqualizeValences()
+	{
+		m_Valences.assign(m_Vertices.size(), 0);
+		ParallelFor(
+			0,
+			m_Vertices.size(),
+			[&](size_t iVertex)
+			{
+				if(m_Mesh.IsVertexDeleted(iVertex) || m_Vertices[iVertex].IncidentTriangleIdx == -1)
+					return;
+
+				const auto triangleCount =
+					std::ranges::distance(m_Mesh.GetTrianglesAroundVertexView(static_cast<VertexIndex>(iVertex)));
+				m_Valences[iVertex] = static_cast<int>(triangleCount) + m_BoundaryFlags[iVertex];
+			});
+
+		for(TriangleIndex iTriangle = 0; iTriangle < m_Triangles.size(); ++iTriangle)
+		{
+			if(m_Mesh.IsTriangleDeleted(iTriangle))
+				continue;
+
+			for(EdgeIndex iEdge = 0; iEdge < 3; ++iEdge)
+			{
+				const int neighborIdx = m_Triangles[iTriangle].Neighbors[iEdge];
+				if(neighborIdx != -1 && static_cast<TriangleIndex>(neighborIdx) > iTriangle)
+					FlipEdge(iTriangle, iEdge);
+			}
+		}
+	}
+
+	/// @brief Move each interior vertex towards the centroid of its neighbors, within its tangent plane.
+	void RelaxTangentially()
+	{
+		std::vector<Vec3> positions(m_Vertices.size());
+		ParallelForRange(
+			0,
+			m_Vertices.size(),
+			[&](size_t chunkBegin, size_t chunkEnd)
+			{
+				std::vector<TriangleIndex> star;
+				std::vector<VertexIndex> link;
+				for(size_t iVertex = chunkBegin; iVertex < chunkEnd; ++iVertex)
+				{
+					const Vec3& position = m_Vertices[iVertex].Position;
+					positions[iVertex] = position;
+					if(m_Mesh.IsVertexDeleted(iVertex) || m_BoundaryFlags[iVertex]
+					   || m_Vertices[iVertex].IncidentTriangleIdx == -1)
+						continue;
+
+					const VertexIndex vertexIdx = static_cast<VertexIndex>(iVertex);
+					GatherStar(vertexIdx, star);
+					GatherLink(vertexIdx, star, link);
+
+					Vec3 normal{ 0.f };
+					for(TriangleIndex triangleIdx : star)
+						normal += TriangleNormal(triangleIdx);
+					const float normalLength = Length(normal);
+					if(normalLength <= std::numeric_limits<float>::min())
+						continue;
+					normal /= normalLength;
+
+					Vec3 centroid{ 0.f };
+					for(VertexIndex curVertexIdx : link)
+						centroid += m_Vertices[curVertexIdx].Position;
+					centroid /= static_cast<float>(link.size());
+
+					// Project the displacement on the tangent plane.
+					positions[iVertex] = centroid + normal * Dot(normal, position - centroid);
+				}
+			});
+
+		ParallelFor(
+			0,
+			m_Vertices.size(),
+			[&](size_t iVertex)
+			{
+				m_Vertices[iVertex].Position = positions[iVertex];
+			});
+		m_Mesh.NotifyGeometryChanged();
+	}
+
+private:
+	float EdgeLength(const VertexIndex firstVertexIdx, const VertexIndex secondVertexIdx) const
+	{
+		return Length(m_Vertices[firstVertexIdx].Position - m_Vertices[secondVertexIdx].Position);
+	}
+
+	float TargetLength(const VertexIndex firstVertexIdx, const VertexIndex secondVertexIdx) const
+	{
+		return 0.5f * (m_Sizing[firstVertexIdx] + m_Sizing[secondVertexIdx]);
+	}
+
+	Vec3 TriangleNormal(const TriangleIndex triangleIdx) const
+	{
+		const Triangle& curTriangle = m_Triangles[triangleIdx];
+		const Vec3& posA = m_Vertices[curTriangle.Vertices[0]].Position;
+		return Cross(
+			m_Vertices[curTriangle.Vertices[1]].Position - posA, m_Vertices[curTriangle.Vertices[2]].Position - posA);
+	}
+
+	/// @brief Collect the triangles around a vertex.
+	void GatherStar(const VertexIndex vertexIdx, std::vector<TriangleIndex>& star) const
+	{
+		star.clear();
+		for(TriangleIndex triangleIdx : m_Mesh.GetTrianglesAroundVertexView(vertexIdx))
+			star.push_back(triangleIdx);
+	}
+
+	/// @brief Collect the sorted, unique vertices adjacent to a vertex from its star.
+	void GatherLink(
+		const VertexIndex vertexIdx, const std::vector<TriangleIndex>& star, std::vector<VertexIndex>& link) const
+	{
+		link.clear();
+		for(TriangleIndex triangleIdx : star)
+		{
+			for(int curVertexIdx : m_Triangles[triangleIdx].Vertices)
+			{
+				if(static_cast<VertexIndex>(curVertexIdx) != vertexIdx)
+					link.push_back(static_cast<VertexIndex>(curVertexIdx));
+			}
+		}
+		std::sort(link.begin(), link.end());
+		link.erase(std::unique(link.begin(), link.end()), link.end());
+	}
+
+	/// @brief Local index of the edge shared with the given neighbor.
+	EdgeIndex GetNeighborLocalIndex(const TriangleIndex triangleIdx, const int neighborIdx) const
+	{
+		const std::array<int, 3>& neighbors = m_Triangles[triangleIdx].Neighbors;
+		return static_cast<EdgeIndex>(std::find(neighbors.begin(), neighbors.end(), neighborIdx) - neighbors.begin());
+	}
+
+	/// @brief Split the edge opposite to the given local vertex at its midpoint.
+	void SplitEdge(const TriangleIndex triangleIdx, const EdgeIndex edgeIdx)
+	{
+		const VertexIndex aIdx = m_Triangles[triangleIdx].Vertices[IndexHelpers::Next[edgeIdx]];
+		const VertexIndex bIdx = m_Triangles[triangleIdx].Vertices[IndexHelpers::Previous[edgeIdx]];
+		const bool isBoundary = m_Triangles[triangleIdx].Neighbors[edgeIdx] == -1;
+		const float sizing = 0.5f * (m_Sizing[aIdx] + m_Sizing[bIdx]);
+
+		const VertexIndex mIdx =
+			m_Mesh.SplitEdge(triangleIdx, edgeIdx, (m_Vertices[aIdx].Position + m_Vertices[bIdx].Position) * 0.5f);
+		if(mIdx >= m_Sizing.size())
+		{
+			m_Sizing.resize(mIdx + 1);
+			m_BoundaryFlags.resize(mIdx + 1);
+		}
+		m_Sizing[mIdx] = sizing;
+		m_BoundaryFlags[mIdx] = isBoundary;
+	}
+
+	/// @brief Check that moving the vertices of the triangles around the collapse does not flip any of them.
+	bool PreservesOrientation(
+		const std::vector<TriangleIndex>& star,
+		const VertexIndex keptVertexIdx,
+		const VertexIndex removedVertexIdx,
+		const Vec3& target) const
+	{
+		for(TriangleIndex triangleIdx : star)
+		{
+			const Triangle& curTriangle = m_Triangles[triangleIdx];
+			if(GetVertexLocalIndex(curTriangle, keptVertexIdx) != -1
+			   && GetVertexLocalIndex(curTriangle, removedVertexIdx) != -1)
+				continue; // Triangles containing both vertices are removed by the collapse.
+
+			std::array<Vec3, 3> newPositions;
+			for(VertexLocalIndex iVertex = 0; iVertex < 3; ++iVertex)
+			{
+				const VertexIndex curVertexIdx = static_cast<VertexIndex>(curTriangle.Vertices[iVertex]);
+				newPositions[iVertex] = curVertexIdx == keptVertexIdx || curVertexIdx == removedVertexIdx
+					? target
+					: m_Vertices[curVertexIdx].Position;
+			}
+
+			const Vec3 newNormal = Cross(newPositions[1] - newPositions[0], newPositions[2] - newPositions[0]);
+			if(Dot(TriangleNormal(triangleIdx), newNormal) <= 0.f)
+				return false;
+		}
+
+		return true;
+	}
+
+	/// @brief Collapse the edge opposite to the given local vertex if the result stays manifold, keeps its
+	/// orientation and does not create edges longer than the split threshold.
+	void CollapseEdge(const TriangleIndex triangleIdx, const EdgeIndex edgeIdx)
+	{
+		VertexIndex keptVertexIdx = m_Triangles[triangleIdx].Vertices[IndexHelpers::Next[edgeIdx]];
+		VertexIndex removedVertexIdx = m_Triangles[triangleIdx].Vertices[IndexHelpers::Previous[edgeIdx]];
+		if(m_BoundaryFlags[keptVertexIdx] && m_BoundaryFlags[removedVertexIdx])
+			return; // Collapsing an interior edge between two boundaries pinches the mesh.
+
+		if(m_BoundaryFlags[removedVertexIdx])
+			std::swap(keptVertexIdx, removedVertexIdx);
+
+		const Vec3 target = m_BoundaryFlags[keptVertexIdx]
+			? m_Vertices[keptVertexIdx].Position
+			: (m_Vertices[keptVertexIdx].Position + m_Vertices[removedVertexIdx].Position) * 0.5f;
+		const float targetSizing = m_BoundaryFlags[keptVertexIdx]
+			? m_Sizing[keptVertexIdx]
+			: 0.5f * (m_Sizing[keptVertexIdx] + m_Sizing[removedVertexIdx]);
+
+		GatherStar(keptVertexIdx, m_KeptStar);
+		GatherStar(removedVertexIdx, m_RemovedStar);
+		GatherLink(keptVertexIdx, m_KeptStar, m_KeptLink);
+		GatherLink(removedVertexIdx, m_RemovedStar, m_RemovedLink);
+
+		// Do not undo the work of the splits.
+		for(const std::vector<VertexIndex>* link : { &m_KeptLink, &m_RemovedLink })
+		{
+			for(VertexIndex curVertexIdx : *link)
+			{
+				if(curVertexIdx == keptVertexIdx || curVertexIdx == removedVertexIdx)
+					continue;
+				if(Length(target - m_Vertices[curVertexIdx].Position)
+				   > SplitFactor * 0.5f * (targetSizing + m_Sizing[curVertexIdx]))
+					return;
+			}
+		}
+
+		if(!PreservesOrientation(m_KeptStar, keptVertexIdx, removedVertexIdx, target)
+		   || !PreservesOrientation(m_RemovedStar, keptVertexIdx, removedVertexIdx, target))
+			return;
+
+		// The mesh keeps the first vertex of the half-edge, go through the opposite one to keep the other vertex.
+		TriangleIndex collapsedTriangleIdx = triangleIdx;
+		EdgeIndex collapsedEdgeIdx = edgeIdx;
+		if(keptVertexIdx != static_cast<VertexIndex>(m_Triangles[triangleIdx].Vertices[IndexHelpers::Next[edgeIdx]]))
+		{
+			collapsedTriangleIdx = m_Triangles[triangleIdx].Neighbors[edgeIdx];
+			collapsedEdgeIdx = GetNeighborLocalIndex(collapsedTriangleIdx, static_cast<int>(triangleIdx));
+		}
+
+		// The mesh rejects the collapses breaking the link condition.
+		if(m_Mesh.CollapseEdge(collapsedTriangleIdx, collapsedEdgeIdx, target))
+			m_Sizing[keptVertexIdx] = targetSizing;
+	}
+
+	/// @brief Flip the edge opposite to the given local vertex if it improves the valences.
+	/// @note The triangles (c, a, b) and (d, b, a) become (c, a, d) and (d, b, c).
+	void FlipEdge(const TriangleIndex triangleIdx, const EdgeIndex edgeIdx)
+	{
+		const int oppositeTriangleIdx = m_Triangles[triangleIdx].Neighbors[edgeIdx];
+		const Triangle& curTriangle = m_Triangles[triangleIdx];
+		const Triangle& oppositeTriangle = m_Triangles[oppositeTriangleIdx];
+		const EdgeIndex oppositeEdgeIdx = GetNeighborLocalIndex(oppositeTriangleIdx, static_cast<int>(triangleIdx));
+
+		const int cIdx = curTriangle.Vertices[edgeIdx];
+		const int aIdx = curTriangle.Vertices[IndexHelpers::Next[edgeIdx]];
+		const int bIdx = curTriangle.Vertices[IndexHelpers::Previous[edgeIdx]];
+		const int dIdx = oppositeTriangle.Vertices[oppositeEdgeIdx];
+		if(cIdx == dIdx)
+			return;
+
+		// The valences of a and b decrease, the ones of c and d increase.
+		auto Deviation = [this](int vertexIdx, int offset)
+		{
+			const int deviation = m_Valences[vertexIdx] + offset - (m_BoundaryFlags[vertexIdx] ? 4 : 6);
+			return deviation * deviation;
+		};
+		const int deviationBefore = Deviation(aIdx, 0) + Deviation(bIdx, 0) + Deviation(cIdx, 0) + Deviation(dIdx, 0);
+		const int deviationAfter = Deviation(aIdx, -1) + Deviation(bIdx, -1) + Deviation(cIdx, 1) + Deviation(dIdx, 1);
+		if(deviationAfter >= deviationBefore)
+			return;
+
+		for(int curVertexIdx : { aIdx, bIdx })
+		{
+			if(m_Valences[curVertexIdx] <= (m_BoundaryFlags[curVertexIdx] ? 2 : 3))
+				return;
+		}
+
+		// The quad (c, a, d, b) must be convex enough for both new triangles to keep the orientation.
+		const Vec3 normal = TriangleNormal(triangleIdx) + TriangleNormal(oppositeTriangleIdx);
+		const Vec3& posA = m_Vertices[aIdx].Position;
+		const Vec3& posB = m_Vertices[bIdx].Position;
+		const Vec3& posC = m_Vertices[cIdx].Position;
+		const Vec3& posD = m_Vertices[dIdx].Position;
+		if(Dot(Cross(posA - posC, posD - posC), normal) <= 0.f || Dot(Cross(posB - posD, posC - posD), normal) <= 0.f)
+			return;
+
+		// The mesh rejects the flip when the new edge already exists.
+		if(!m_Mesh.FlipEdge(triangleIdx, edgeIdx))
+			return;
+
+		--m_Valences[aIdx];
+		--m_Valences[bIdx];
+		++m_Valences[cIdx];
+		++m_Valences[dIdx];
+	}
+
+	Mesh& m_Mesh;
+	std::vector<Vertex>& m_Vertices;
+	std::vector<Triangle>& m_Triangles;
+	/// @brief Target edge length of each vertex.
+	std::vector<float>& m_Sizing;
+
+	std::vector<uint8_t> m_BoundaryFlags;
+	std::vector<int> m_Valences{};
+
+	/// @brief Scratch buffers reused by the operators.
+	std::vector<TriangleIndex> m_KeptStar{}, m_RemovedStar{};
+	std::vector<VertexIndex> m_KeptLink{}, m_RemovedLink{};
+};
+} // namespace
+
+namespace Utilitary::Surface
+{
+void MeshRemesher::RemeshIsotropic(Mesh& mesh, const RemeshingSpecification& specification)
+{
+	assert(specification.SizingField.empty() || specification.SizingField.size() == mesh.GetVertexCount());
+	assert(specification.TargetEdgeLength > 0.f);
+
+	std::vector<float> sizing = specification.SizingField;
+	if(sizing.empty())
+		sizing.assign(mesh.GetVertexCount(), specification.TargetEdgeLength);
+
+	// The elements are rebuilt, so their extra data cannot be carried over.
+	mesh.m_VerticesExtraDataContainer.clear();
+	mesh.m_TrianglesExtraDataContainer.clear();
+
+	IncrementalEditor editor(mesh, sizing);
+	for(uint32_t iIteration = 0; iIteration < specification.IterationCount; ++iIteration)
+	{
+		editor.SplitLongEdges();
+		editor.CollapseShortEdges();
+		editor.EqualizeValences();
+		editor.RelaxTangentially();
+	}
+
+	mesh.GarbageCollect();
+}
+} // namespace Utilitary::Surface
@@ -0,0 +1,327 @@
+#include "Application/MeshReorderer.h"
+
+#include "Application/MeshGeometry.h"
+#include "Core/Parallel.h"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+using namespace Core::BaseType;
+using namespace Core::Parallel;
+using namespace Data::Primitive;
+using namespace Data::Surface;
+
+namespace
+{
+/// @brief Number of bits of the quantized coordinates, the three axes fit in a 63 bits key.
+constexpr uint32_t BitsPerAxis = Utilitary::Surface::MeshReorderer::CurveBitsPerAxis;
+
+// Parameters of Forsyth's vertex score.
+constexpr float CacheDecayPower = 1.5f;
+constexpr float LastTriangleScore = 0.75f;
+constexpr float ValenceBoostScale = 2.f;
+constexpr float ValenceBoostPower = 0.5f;
+
+/// @brief Insert two zero bits between each of the 21 lowest bits of the value.
+uint64_t SpreadBits(uint64_t value)
+{
+	value &= 0x1FFFFF;
+	value = (value | value << 32) & 0x1F00000000FFFF;
+	value = (value | value << 16) & 0x1F0000FF0000FF;
+	value = (value | value << 8) & 0x100F00F00F00F00F;
+	value = (value | value << 4) & 0x10C30C30C30C30C3;
+	value = (value | value << 2) & 0x1249249249249249;
+	return value;
+}
+
+/// @brief Interleave the bits of the coordinates, the first axis holding the most significant bit of each triplet.
+uint64_t InterleaveBits(const std::array<uint32_t, 3>& coords)
+{
+	return SpreadBits(coords[0]) << 2 | SpreadBits(coords[1]) << 1 | SpreadBits(coords[2]);
+}
+
+/// @brief Index of the cell along the Hilbert curve (Skilling's "Programming the Hilbert curve").
+/// @note The coordinates are first transformed into the transposed Hilbert index, whose interleaved bits give the
+/// index along the curve.
+uint64_t HilbertKey(std::array<uint32_t, 3> coords)
+{
+	constexpr uint32_t highestBit = 1u << (BitsPerAxis - 1);
+
+	// Inverse undo excess work, without branch: the bits of the coordinates are unpredictable.
+	for(uint32_t bit = highestBit; bit > 1; bit >>= 1)
+	{
+		const uint32_t lowerBits = bit - 1;
+		for(uint32_t& curCoord : coords)
+		{
+			// Invert the lower bits of the first coordinate if the bit is set, otherwise swap them with curCoord.
+			const uint32_t setMask = 0u - ((curCoord & bit) != 0 ? 1u : 0u);
+			coords[0] ^= lowerBits & setMask;
+			const uint32_t swappedBits = (coords[0] ^ curCoord) & lowerBits & ~setMask;
+			coords[0] ^= swappedBits;
+			curCoord ^= swappedBits;
+		}
+	}
+
+	// Gray encode.
+	coords[1] ^= coords[0];
+	coords[2] ^= coords[1];
+	uint32_t flippedBits = 0;
+	for(uint32_t bit = highestBit; bit > 1; bit >>= 1)
+		flippedBits ^= (bit - 1) & (0u - ((coords[2] & bit) != 0 ? 1u : 0u));
+	for(uint32_t& curCoord : coords)
+		curCoord ^= flippedBits;
+
+	return InterleaveBits(coords);
+}
+
+/// @brief Score of a vertex in Forsyth's algorithm, -1 once all its triangles are emitted.
+float ComputeVertexScore(const int cachePosition, const uint32_t remainingTriangleCount, const uint32_t cacheSize)
+{
+	if(remainingTriangleCount == 0)
+		return -1.f;
+
+	float score = 0.f;
+	if(cachePosition >= 0)
+	{
+		// The vertices of the last triangle get a fixed score, so that its strip direction is not favored.
+		if(cachePosition < 3)
+			score = LastTriangleScore;
+		else
+			score = std::pow(
+				1.f - static_cast<float>(cachePosition - 3) / static_cast<float>(cacheSize - 3), CacheDecayPower);
+	}
+
+	// Boost the vertices with few remaining triangles to get rid of them quickly.
+	score += ValenceBoostScale * std::pow(static_cast<float>(remainingTriangleCount), -ValenceBoostPower);
+	return score;
+}
+} // namespace
+
+namespace Utilitary::Surface
+{
+uint64_t MeshReorderer::ComputeCurveKey(const std::array<uint32_t, 3>& coords, const SpaceFillingCurve curve)
+{
+	return curve == SpaceFillingCurve::Hilbert ? HilbertKey(coords) : InterleaveBits(coords);
+}
+
+void MeshReorderer::ReorderVertices(Mesh& mesh, const SpaceFillingCurve curve)
+{
+	if(mesh.HasGarbage())
+		mesh.GarbageCollect();
+
+	const std::vector<Vertex>& vertices = mesh.m_Vertices;
+	if(vertices.empty())
+		return;
+
+	// Bounding box of the vertices, read from the positions in structure-of-arrays layout.
+	const std::shared_ptr<const PositionBuffers> positions = mesh.GetPositionBuffers();
+	const AxisAlignedBox boundingBox = MeshGeometry::ComputeBoundingBox(*positions);
+	const Vec3& minCorner = boundingBox.Min;
+
+	// Quantize the positions on a cubic grid covering the bounding box to keep the curve isotropic.
+	const Vec3 boxExtent = boundingBox.GetExtent();
+	const float extent = std::max({ boxExtent.x, boxExtent.y, boxExtent.z });
+	const float scale = extent > 0.f ? static_cast<float>((1u << BitsPerAxis) - 1) / extent : 0.f;
+
+	std::vector<std::pair<uint64_t, int>> keys(vertices.size());
+	ParallelFor(
+		0,
+		vertices.size(),
+		[&](size_t iVertex)
+		{
+			const Vec3 position = positions->GetPosition(static_cast<VertexIndex>(iVertex));
+			std::array<uint32_t, 3> coords;
+			for(int iAxis = 0; iAxis < 3; ++iAxis)
+				coords[iAxis] = static_cast<uint32_t>((position[iAxis] - minCorner[iAxis]) * scale + 0.5f);
+
+			keys[iVertex] = { ComputeCurveKey(coords, curve), static_cast<int>(iVertex) };
+		});
+	std::sort(keys.begin(), keys.end());
+
+	std::vector<int> vertexRemap(vertices.size());
+	for(size_t iKey = 0; iKey < keys.size(); ++iKey)
+		vertexRemap[keys[iKey].second] = static_cast<int>(iKey);
+
+	std::vector<int> triangleRemap(mesh.m_Triangles.size());
+	std::iota(triangleRemap.begin(), triangleRemap.end(), 0);
+
+	mesh.Remap(
+		vertexRemap,
+		static_cast<int>(vertexRemap.size()),
+		triangleRemap,
+		static_cast<int>(triangleRemap.size()));
+}
+
+void MeshReorderer::ReorderTriangles(Mesh& mesh, const uint32_t cacheSize)
+{
+	assert(cacheSize > 3 && "The cache must hold more than one triangle");
+
+	if(mesh.HasGarbage())
+		mesh.GarbageCollect();
+
+	const std::vector<Triangle>& triangles = mesh.m_Triangles;
+	const size_t vertexCount = mesh.m_Vertices.size();
+	const size_t triangleCount = triangles.size();
+	if(triangleCount == 0)
+		return;
+
+	// Triangles of each vertex, the first RemainingTriangleCount ones are not emitted yet.
+	std::vector<uint32_t> remainingTriangleCounts(vertexCount, 0);
+	for(const Triangle& curTriangle : triangles)
+	{
+		for(int curVertexIdx : curTriangle.Vertices)
+			++remainingTriangleCounts[curVertexIdx];
+	}
+
+	std::vector<uint32_t> offsets(vertexCount + 1, 0);
+	std::partial_sum(remainingTriangleCounts.begin(), remainingTriangleCounts.end(), offsets.begin() + 1);
+
+	std::vector<uint32_t> vertexTriangles(offsets.back());
+	{
+		std::vector<uint32_t> insertionOffsets(offsets.begin(), offsets.end() - 1);
+		for(TriangleIndex iTriangle = 0; iTriangle < triangleCount; ++iTriangle)
+		{
+			for(int curVertexIdx : triangles[iTriangle].Vertices)
+				vertexTriangles[insertionOffsets[curVertexIdx]++] = iTriangle;
+		}
+	}
+
+	std::vector<int> cachePositions(vertexCount, -1);
+	std::vector<float> vertexScores(vertexCount);
+	ParallelFor(
+		0,
+		vertexCount,
+		[&](size_t iVertex)
+		{
+			vertexScores[iVertex] = ComputeVertexScore(-1, remainingTriangleCounts[iVertex], cacheSize);
+		});
+
+	std::vector<float> triangleScores(triangleCount);
+	ParallelFor(
+		0,
+		triangleCount,
+		[&](size_t iTriangle)
+		{
+			float score = 0.f;
+			for(int curVertexIdx : triangles[iTriangle].Vertices)
+				score += vertexScores[curVertexIdx];
+			triangleScores[iTriangle] = score;
+		});
+
+	std::vector<uint8_t> emittedTriangles(triangleCount, 0);
+	std::vector<int> triangleRemap(triangleCount);
+	std::vector<int> cache, nextCache;
+	cache.reserve(cacheSize + 3);
+	nextCache.reserve(cacheSize + 3);
+
+	int bestTriangleIdx = static_cast<int>(
+		std::max_element(triangleScores.begin(), triangleScores.end()) - triangleScores.begin());
+	size_t firstCandidateIdx = 0;
+	for(size_t iEmitted = 0; iEmitted < triangleCount; ++iEmitted)
+	{
+		// None of the cached vertices has a triangle left, restart from the first triangle not emitted.
+		if(bestTriangleIdx == -1)
+		{
+			while(emittedTriangles[firstCandidateIdx])
+				++firstCandidateIdx;
+			bestTriangleIdx = static_cast<int>(firstCandidateIdx);
+		}
+
+		emittedTriangles[bestTriangleIdx] = 1;
+		triangleRemap[bestTriangleIdx] = static_cast<int>(iEmitted);
+
+		// Remove the triangle from the remaining triangles of its vertices, which move to the front of the cache.
+		nextCache.clear();
+		for(int curVertexIdx : triangles[bestTriangleIdx].Vertices)
+		{
+			const auto first = vertexTriangles.begin() + offsets[curVertexIdx];
+			const auto last = first + remainingTriangleCounts[curVertexIdx];
+			std::iter_swap(std::find(first, last, static_cast<uint32_t>(bestTriangleIdx)), last - 1);
+			--remainingTriangleCounts[curVertexIdx];
+			nextCache.push_back(curVertexIdx);
+		}
+		for(int curVertexIdx : cache)
+		{
+			if(std::find(nextCache.begin(), nextCache.begin() + 3, curVertexIdx) == nextCache.begin() + 3)
+				nextCache.push_back(curVertexIdx);
+		}
+
+		// Update the scores of the vertices whose cache position changed, and of their remaining triangles.
+		for(size_t iCache = 0; iCache < nextCache.size(); ++iCache)
+		{
+			const int curVertexIdx = nextCache[iCache];
+			cachePositions[curVertexIdx] = iCache < cacheSize ? static_cast<int>(iCache) : -1;
+
+			const float score =
+				ComputeVertexScore(cachePositions[curVertexIdx], remainingTriangleCounts[curVertexIdx], cacheSize);
+			const float scoreDelta = score - vertexScores[curVertexIdx];
+			vertexScores[curVertexIdx] = score;
+			for(uint32_t iTriangle = 0; iTriangle < remainingTriangleCounts[curVertexIdx]; ++iTriangle)
+				triangleScores[vertexTriangles[offsets[curVertexIdx] + iTriangle]] += scoreDelta;
+		}
+		nextCache.resize(std::min<size_t>(nextCache.size(), cacheSize));
+		std::swap(cache, nextCache);
+
+		// The next triangle is the best one among the remaining triangles of the cached vertices.
+		bestTriangleIdx = -1;
+		float bestScore = -1.f;
+		for(int curVertexIdx : cache)
+		{
+			for(uint32_t iTriangle = 0; iTriangle < remainingTriangleCounts[curVertexIdx]; ++iTriangle)
+			{
+				const uint32_t curTriangleIdx = vertexTriangles[offsets[curVertexIdx] + iTriangle];
+				if(triangleScores[curTriangleIdx] > bestScore)
+				{
+					bestScore = triangleScores[curTriangleIdx];
+					bestTriangleIdx = static_cast<int>(curTriangleIdx);
+				}
+			}
+		}
+	}
+
+	std::vector<int> vertexRemap(vertexCount);
+	std::iota(vertexRemap.begin(), vertexRemap.end(), 0);
+
+	mesh.Remap(
+		vertexRemap, static_cast<int>(vertexRemap.size()), triangleRemap, static_cast<int>(triangleRemap.size()));
+}
+
+void MeshReorderer::Reorder(Mesh& mesh, const SpaceFillingCurve curve, const uint32_t cacheSize)
+{
+	ReorderVertices(mesh, curve);
+	ReorderTriangles(mesh, cacheSize);
+}
+
+float MeshReorderer::ComputeACMR(const Mesh& mesh, const uint32_t cacheSize)
+{
+	if(mesh.GetTriangleCount() == 0)
+		return 0.f;
+
+	// Number of misses when each vertex entered the cache, shifted by one so that 0 stands for never cached.
+	std::vector<uint32_t> insertionStamps(mesh.GetVertexCount(), 0);
+	uint32_t missCount = 0;
+	uint32_t triangleCount = 0;
+	for(TriangleIndex iTriangle = 0; iTriangle < mesh.GetTriangleCount(); ++iTriangle)
+	{
+		if(mesh.IsTriangleDeleted(iTriangle))
+			continue;
+
+		++triangleCount;
+		for(int curVertexIdx : mesh.m_Triangles[iTriangle].Vertices)
+		{
+			uint32_t& insertionStamp = insertionStamps[curVertexIdx];
+			if(insertionStamp == 0 || missCount - insertionStamp >= cacheSize)
+				insertionStamp = ++missCount;
+		}
+	}
+
+	return static_cast<float>(missCount) / static_cast<float>(triangleCount);
+}
+} // namespace Utilitary::Surface
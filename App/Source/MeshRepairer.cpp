@@ -0,0 +1,729 @@
+#include "Application/MeshRepairer.h"
+
+#include "Core/MathHelpers.h"
+#include "Core/Parallel.h"
+#include "Core/Profiler.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+using namespace Core::BaseType;
+using namespace Core::Math::Geometry;
+using namespace Core::Parallel;
+using namespace Data::Primitive;
+using namespace Data::Surface;
+using namespace Utilitary::Surface;
+
+namespace
+{
+/// @brief Vertex indices of a triangle, or triangle indices of its neighbors.
+using Corners = std::array<int, 3>;
+
+/// @brief Key of the undirected edge between two vertices.
+uint64_t GetEdgeKey(const int firstVertexIdx, const int secondVertexIdx)
+{
+	const uint64_t firstKey = static_cast<uint32_t>(firstVertexIdx);
+	const uint64_t secondKey = static_cast<uint32_t>(secondVertexIdx);
+	return firstKey < secondKey ? firstKey << 32 | secondKey : secondKey << 32 | firstKey;
+}
+
+/// @brief Edge of a triangle, sorted by key so that the triangles sharing an edge are consecutive.
+struct EdgeEntry
+{
+	uint64_t Key;
+	uint32_t TriangleIdx;
+	EdgeIndex EdgeIdx;
+
+	bool operator<(const EdgeEntry& rhs) const
+	{
+		return Key != rhs.Key ? Key < rhs.Key : TriangleIdx != rhs.TriangleIdx ? TriangleIdx < rhs.TriangleIdx
+																				: EdgeIdx < rhs.EdgeIdx;
+	}
+};
+
+/// @brief Local index of the edge between two vertices in a triangle, or -1.
+int FindEdge(const Corners& triangle, const int firstVertexIdx, const int secondVertexIdx)
+{
+	for(EdgeIndex iEdge = 0; iEdge < 3; ++iEdge)
+	{
+		const int edgeFirstIdx = triangle[IndexHelpers::Next[iEdge]];
+		const int edgeSecondIdx = triangle[IndexHelpers::Previous[iEdge]];
+		if((edgeFirstIdx == firstVertexIdx && edgeSecondIdx == secondVertexIdx)
+		   || (edgeFirstIdx == secondVertexIdx && edgeSecondIdx == firstVertexIdx))
+			return iEdge;
+	}
+	return -1;
+}
+
+/// @brief Whether two triangles run through their common edge in opposite directions.
+/// @param edgeIdx Local index of the common edge in the first triangle.
+bool HaveOppositeDirections(const Corners& triangle, const EdgeIndex edgeIdx, const Corners& neighbor)
+{
+	const int firstVertexIdx = triangle[IndexHelpers::Next[edgeIdx]];
+	const int secondVertexIdx = triangle[IndexHelpers::Previous[edgeIdx]];
+	const int neighborEdgeIdx = FindEdge(neighbor, firstVertexIdx, secondVertexIdx);
+	assert(neighborEdgeIdx != -1 && "The triangles do not share the edge.");
+	return neighbor[IndexHelpers::Next[neighborEdgeIdx]] == secondVertexIdx;
+}
+
+/// @brief Successive phases of the repair, working on plain copies of the vertex positions and triangle corners.
+class RepairPipeline
+{
+public:
+	RepairPipeline(const Mesh& mesh, const RepairSpecification& specification, RepairSummary& summary)
+		: m_Specification(specification)
+		, m_Summary(summary)
+	{
+		m_Positions.resize(mesh.GetVertexCount());
+		ParallelFor(
+			0,
+			m_Positions.size(),
+			[&](const size_t iVertex)
+			{
+				m_Positions[iVertex] = mesh.GetVertexData(static_cast<VertexIndex>(iVertex)).Position;
+			});
+		RemoveInvalidTriangles(mesh);
+	}
+
+	/// @brief Make the orientation consistent in each connected component and cut the edges which cannot be.
+	void FixOrientation()
+	{
+		m_Neighbors = LinkNeighbors(false);
+		if(m_Specification.FixOrientation)
+		{
+			std::vector<uint8_t> flipFlags = ComputeFlipFlags();
+			ParallelFor(
+				0,
+				m_Triangles.size(),
+				[&](const size_t iTriangle)
+				{
+					if(flipFlags[iTriangle] == 0)
+						return;
+					std::swap(m_Triangles[iTriangle][1], m_Triangles[iTriangle][2]);
+					std::swap(m_Neighbors[iTriangle][1], m_Neighbors[iTriangle][2]);
+				});
+			m_Summary.FlippedTriangleCount = static_cast<uint32_t>(std::count(flipFlags.begin(), flipFlags.end(), 1));
+		}
+
+		// Each side of an inconsistent edge is cut by the thread of its own triangle, only the corners are read.
+		ParallelFor(
+			0,
+			m_Triangles.size(),
+			[&](const size_t iTriangle)
+			{
+				for(EdgeIndex iEdge = 0; iEdge < 3; ++iEdge)
+				{
+					const int neighborIdx = m_Neighbors[iTriangle][iEdge];
+					if(neighborIdx == -1)
+						continue;
+					if(!HaveOppositeDirections(m_Triangles[iTriangle], iEdge, m_Triangles[neighborIdx]))
+						m_Neighbors[iTriangle][iEdge] = -1;
+				}
+			});
+	}
+
+	/// @brief Give a new vertex to each fan of triangles around a vertex, but the first one.
+	void SplitNonManifoldVertices()
+	{
+		const size_t vertexCount = m_Positions.size();
+		BuildStars();
+
+		// Fan of each corner of the stars, and number of fans of each vertex.
+		std::vector<uint32_t> fanIndices(m_StarCorners.size());
+		std::vector<uint32_t> extraFanCounts(vertexCount + 1, 0);
+		ParallelForRange(
+			0,
+			vertexCount,
+			[&](const size_t chunkBegin, const size_t chunkEnd)
+			{
+				std::vector<uint32_t> stack;
+				for(size_t iVertex = chunkBegin; iVertex < chunkEnd; ++iVertex)
+				{
+					const uint32_t starBegin = m_StarOffsets[iVertex];
+					const uint32_t starEnd = m_StarOffsets[iVertex + 1];
+					std::fill(fanIndices.begin() + starBegin,
+							  fanIndices.begin() + starEnd,
+							  std::numeric_limits<uint32_t>::max());
+
+					uint32_t fanCount = 0;
+					for(uint32_t iCorner = starBegin; iCorner < starEnd; ++iCorner)
+					{
+						if(fanIndices[iCorner] != std::numeric_limits<uint32_t>::max())
+							continue;
+
+						// Flood the fan through the neighbors across the two edges around the vertex.
+						fanIndices[iCorner] = fanCount;
+						stack.push_back(iCorner);
+						while(!stack.empty())
+						{
+							const uint32_t corner = m_StarCorners[stack.back()];
+							stack.pop_back();
+							const Corners& neighbors = m_Neighbors[corner / 3];
+							for(const EdgeIndex edgeIdx :
+								{ IndexHelpers::Next[corner % 3], IndexHelpers::Previous[corner % 3] })
+							{
+								const int neighborIdx = neighbors[edgeIdx];
+								if(neighborIdx == -1)
+									continue;
+								for(uint32_t iOther = starBegin; iOther < starEnd; ++iOther)
+								{
+									if(m_StarCorners[iOther] / 3 != static_cast<uint32_t>(neighborIdx))
+										continue;
+									if(fanIndices[iOther] == std::numeric_limits<uint32_t>::max())
+									{
+										fanIndices[iOther] = fanCount;
+										stack.push_back(iOther);
+									}
+									break;
+								}
+							}
+						}
+						++fanCount;
+					}
+					extraFanCounts[iVertex + 1] = fanCount > 1 ? fanCount - 1 : 0;
+				}
+			});
+		std::inclusive_scan(extraFanCounts.begin(), extraFanCounts.end(), extraFanCounts.begin());
+
+		// The first fan keeps the vertex, the other ones get a copy appended to the vertices.
+		m_Summary.SplitVertexCount = extraFanCounts.back();
+		m_Positions.resize(vertexCount + m_Summary.SplitVertexCount);
+		ParallelFor(
+			0,
+			vertexCount,
+			[&](const size_t iVertex)
+			{
+				for(uint32_t iCorner = m_StarOffsets[iVertex]; iCorner < m_StarOffsets[iVertex + 1]; ++iCorner)
+				{
+					if(fanIndices[iCorner] == 0)
+						continue;
+					const uint32_t newVertexIdx =
+						static_cast<uint32_t>(vertexCount) + extraFanCounts[iVertex] + fanIndices[iCorner] - 1;
+					const uint32_t corner = m_StarCorners[iCorner];
+					m_Positions[newVertexIdx] = m_Positions[iVertex];
+					m_Triangles[corner / 3][corner % 3] = static_cast<int>(newVertexIdx);
+				}
+			});
+	}
+
+	/// @brief Fill the holes bounded by few enough edges with a minimum area triangulation.
+	void FillHoles()
+	{
+		if(m_Specification.MaxHoleEdgeCount < 3)
+			return;
+
+		const std::vector<std::vector<int>> holes = CollectHoles();
+
+		// The edges of the mesh, a triangulation must not duplicate them.
+		std::vector<uint64_t> edgeKeys(m_Triangles.size() * 3);
+		ParallelFor(
+			0,
+			m_Triangles.size(),
+			[&](const size_t iTriangle)
+			{
+				const Corners& triangle = m_Triangles[iTriangle];
+				for(EdgeIndex iEdge = 0; iEdge < 3; ++iEdge)
+					edgeKeys[3 * iTriangle + iEdge] = GetEdgeKey(triangle[iEdge], triangle[IndexHelpers::Next[iEdge]]);
+			});
+		std::sort(edgeKeys.begin(), edgeKeys.end());
+
+		// The holes share no vertex, so they are triangulated independently.
+		std::vector<std::vector<Corners>> fillTriangles(holes.size());
+		ParallelFor(
+			0,
+			holes.size(),
+			[&](const size_t iHole)
+			{
+				fillTriangles[iHole] = TriangulateHole(holes[iHole], edgeKeys);
+			},
+			1);
+
+		for(const std::vector<Corners>& triangles : fillTriangles)
+		{
+			if(triangles.empty())
+				continue;
+			++m_Summary.FilledHoleCount;
+			m_Summary.FillTriangleCount += static_cast<uint32_t>(triangles.size());
+			m_Triangles.insert(m_Triangles.end(), triangles.begin(), triangles.end());
+		}
+	}
+
+	/// @brief Remove the unreferenced vertices and link the triangles for the last time.
+	void Finalize()
+	{
+		std::vector<uint8_t> referencedFlags(m_Positions.size(), 0);
+		ParallelFor(
+			0,
+			m_Triangles.size(),
+			[&](const size_t iTriangle)
+			{
+				for(const int vertexIdx : m_Triangles[iTriangle])
+					std::atomic_ref<uint8_t>(referencedFlags[vertexIdx]).store(1, std::memory_order_relaxed);
+			});
+
+		std::vector<int> vertexRemap(m_Positions.size(), -1);
+		int vertexCount = 0;
+		for(size_t iVertex = 0; iVertex < m_Positions.size(); ++iVertex)
+		{
+			if(referencedFlags[iVertex] == 0)
+				continue;
+			vertexRemap[iVertex] = vertexCount;
+			m_Positions[vertexCount++] = m_Positions[iVertex];
+		}
+		m_Summary.UnreferencedVertexCount = static_cast<uint32_t>(m_Positions.size()) - vertexCount;
+		m_Positions.resize(vertexCount);
+
+		ParallelFor(
+			0,
+			m_Triangles.size(),
+			[&](const size_t iTriangle)
+			{
+				for(int& vertexIdx : m_Triangles[iTriangle])
+					vertexIdx = vertexRemap[vertexIdx];
+			});
+
+		// Only the edges shared by two consistent triangles are linked.
+		m_Neighbors = LinkNeighbors(true);
+	}
+
+	const std::vector<Vec3>& GetPositions() const { return m_Positions; }
+	const std::vector<Corners>& GetTriangles() const { return m_Triangles; }
+	const std::vector<Corners>& GetNeighbors() const { return m_Neighbors; }
+
+private:
+	/// @brief Copy the alive triangles of the mesh, but the invalid, degenerate and duplicated ones.
+	void RemoveInvalidTriangles(const Mesh& mesh)
+	{
+		enum TriangleStatus : uint8_t
+		{
+			Kept,
+			Deleted,
+			Invalid,
+			Degenerate,
+			Duplicated,
+		};
+
+		const int vertexCount = static_cast<int>(mesh.GetVertexCount());
+		const size_t triangleCount = mesh.GetTriangleCount();
+		std::vector<uint8_t> statuses(triangleCount, Kept);
+		ParallelFor(
+			0,
+			triangleCount,
+			[&](const size_t iTriangle)
+			{
+				if(mesh.IsTriangleDeleted(static_cast<TriangleIndex>(iTriangle)))
+				{
+					statuses[iTriangle] = Deleted;
+					return;
+				}
+
+				const Corners& vertices = mesh.GetTriangleData(static_cast<TriangleIndex>(iTriangle)).Vertices;
+				for(const int vertexIdx : vertices)
+				{
+					if(vertexIdx < 0 || vertexIdx >= vertexCount || mesh.IsVertexDeleted(vertexIdx))
+					{
+						statuses[iTriangle] = Invalid;
+						return;
+					}
+				}
+				if(vertices[0] == vertices[1] || vertices[1] == vertices[2] || vertices[2] == vertices[0])
+				{
+					statuses[iTriangle] = Invalid;
+					return;
+				}
+
+				const Vec3& p0 = m_Positions[vertices[0]];
+				const float area = 0.5f * Length(Cross(m_Positions[vertices[1]] - p0, m_Positions[vertices[2]] - p0));
+				if(!(area > m_Specification.MinTriangleArea))
+					statuses[iTriangle] = Degenerate;
+			});
+
+		// Triangles with the same vertices in any order are consecutive once sorted, the lowest one is kept.
+		std::vector<std::pair<Corners, uint32_t>> sortedTriangles;
+		sortedTriangles.reserve(triangleCount);
+		for(size_t iTriangle = 0; iTriangle < triangleCount; ++iTriangle)
+		{
+			if(statuses[iTriangle] != Kept)
+				continue;
+			Corners vertices = mesh.GetTriangleData(static_cast<TriangleIndex>(iTriangle)).Vertices;
+			std::sort(vertices.begin(), vertices.end());
+			sortedTriangles.emplace_back(vertices, static_cast<uint32_t>(iTriangle));
+		}
+		std::sort(sortedTriangles.begin(), sortedTriangles.end());
+		for(size_t iSorted = 1; iSorted < sortedTriangles.size(); ++iSorted)
+			if(sortedTriangles[iSorted].first == sortedTriangles[iSorted - 1].first)
+				statuses[sortedTriangles[iSorted].second] = Duplicated;
+
+		m_Triangles.reserve(sortedTriangles.size());
+		for(size_t iTriangle = 0; iTriangle < triangleCount; ++iTriangle)
+		{
+			switch(statuses[iTriangle])
+			{
+			case Kept:
+				m_Triangles.push_back(mesh.GetTriangleData(static_cast<TriangleIndex>(iTriangle)).Vertices);
+				break;
+			case Invalid:
+				++m_Summary.InvalidTriangleCount;
+				break;
+			case Degenerate:
+				++m_Summary.DegenerateTriangleCount;
+				break;
+			case Duplicated:
+				++m_Summary.DuplicatedTriangleCount;
+				break;
+			default:
+				break;
+			}
+		}
+	}
+
+	/// @brief Neighbors of the triangles, only the edges shared by exactly two triangles are linked.
+	/// @param requireOppositeDirections Only link the triangles running through their edge in opposite directions.
+	std::vector<Corners> LinkNeighbors(const bool requireOppositeDirections) const
+	{
+		std::vector<EdgeEntry> entries(m_Triangles.size() * 3);
+		ParallelFor(
+			0,
+			m_Triangles.size(),
+			[&](const size_t iTriangle)
+			{
+				const Corners& triangle = m_Triangles[iTriangle];
+				for(EdgeIndex iEdge = 0; iEdge < 3; ++iEdge)
+				{
+					const uint64_t key =
+						GetEdgeKey(triangle[IndexHelpers::Next[iEdge]], triangle[IndexHelpers::Previous[iEdge]]);
+					entries[3 * iTriangle + iEdge] = { key, static_cast<uint32_t>(iTriangle), iEdge };
+				}
+			});
+		std::sort(entries.begin(), entries.end());
+
+		std::vector<Corners> neighbors(m_Triangles.size(), Corners{ -1, -1, -1 });
+		ParallelFor(
+			0,
+			entries.size(),
+			[&](const size_t iEntry)
+			{
+				// Each run of entries is handled from its first entry.
+				if(iEntry > 0 && entries[iEntry - 1].Key == entries[iEntry].Key)
+					return;
+				if(iEntry + 1 >= entries.size() || entries[iEntry + 1].Key != entries[iEntry].Key
+				   || (iEntry + 2 < entries.size() && entries[iEntry + 2].Key == entries[iEntry].Key))
+					return;
+
+				const EdgeEntry& first = entries[iEntry];
+				const EdgeEntry& second = entries[iEntry + 1];
+				const Corners& firstTriangle = m_Triangles[first.TriangleIdx];
+				if(requireOppositeDirections
+				   && !HaveOppositeDirections(firstTriangle, first.EdgeIdx, m_Triangles[second.TriangleIdx]))
+					return;
+				neighbors[first.TriangleIdx][first.EdgeIdx] = static_cast<int>(second.TriangleIdx);
+				neighbors[second.TriangleIdx][second.EdgeIdx] = static_cast<int>(first.TriangleIdx);
+			});
+		return neighbors;
+	}
+
+	/// @brief Triangles to flip so that each connected component is consistently oriented.
+	std::vector<uint8_t> ComputeFlipFlags() const
+	{
+		// Breadth-first traversal of each component, a triangle is flipped relatively to the one reaching it if both
+		// run through their common edge in the same direction. The triangles are listed component by component.
+		std::vector<uint8_t> flipFlags(m_Triangles.size(), 0);
+		std::vector<uint8_t> visitedFlags(m_Triangles.size(), 0);
+		std::vector<uint32_t> componentTriangles;
+		componentTriangles.reserve(m_Triangles.size());
+		std::vector<uint32_t> componentOffsets{ 0 };
+		for(uint32_t iSeed = 0; iSeed < m_Triangles.size(); ++iSeed)
+		{
+			if(visitedFlags[iSeed] != 0)
+				continue;
+			visitedFlags[iSeed] = 1;
+			componentTriangles.push_back(iSeed);
+			for(size_t iQueue = componentOffsets.back(); iQueue < componentTriangles.size(); ++iQueue)
+			{
+				const uint32_t triangleIdx = componentTriangles[iQueue];
+				for(EdgeIndex iEdge = 0; iEdge < 3; ++iEdge)
+				{
+					const int neighborIdx = m_Neighbors[triangleIdx][iEdge];
+					if(neighborIdx == -1 || visitedFlags[neighborIdx] != 0)
+						continue;
+					visitedFlags[neighborIdx] = 1;
+					const bool isOpposite =
+						HaveOppositeDirections(m_Triangles[triangleIdx], iEdge, m_Triangles[neighborIdx]);
+					flipFlags[neighborIdx] = flipFlags[triangleIdx] ^ (isOpposite ? 0 : 1);
+					componentTriangles.push_back(static_cast<uint32_t>(neighborIdx));
+				}
+			}
+			componentOffsets.push_back(static_cast<uint32_t>(componentTriangles.size()));
+		}
+
+		// Closed components are turned outwards (positive volume), the other ones flip as few triangles as possible.
+		ParallelFor(
+			0,
+			componentOffsets.size() - 1,
+			[&](const size_t iComponent)
+			{
+				const auto componentBegin = componentTriangles.begin() + componentOffsets[iComponent];
+				const auto componentEnd = componentTriangles.begin() + componentOffsets[iComponent + 1];
+
+				bool isClosed = true;
+				double signedVolume = 0.;
+				size_t flipCount = 0;
+				for(auto it = componentBegin; it != componentEnd; ++it)
+				{
+					const Corners& triangle = m_Triangles[*it];
+					const Corners& neighbors = m_Neighbors[*it];
+					isClosed &= neighbors[0] != -1 && neighbors[1] != -1 && neighbors[2] != -1;
+					const double volume =
+						Dot(m_Positions[triangle[0]], Cross(m_Positions[triangle[1]], m_Positions[triangle[2]]));
+					signedVolume += flipFlags[*it] != 0 ? -volume : volume;
+					flipCount += flipFlags[*it];
+				}
+
+				const size_t triangleCount = static_cast<size_t>(componentEnd - componentBegin);
+				const bool isReversed = isClosed ? signedVolume < 0. : 2 * flipCount > triangleCount;
+				if(isReversed)
+					for(auto it = componentBegin; it != componentEnd; ++it)
+						flipFlags[*it] ^= 1;
+			},
+			1);
+		return flipFlags;
+	}
+
+	/// @brief Sorted corners (3 * triangle + local index) around each vertex, in compressed rows.
+	void BuildStars()
+	{
+		const size_t vertexCount = m_Positions.size();
+		m_StarOffsets.assign(vertexCount + 1, 0);
+		ParallelFor(
+			0,
+			m_Triangles.size(),
+			[&](const size_t iTriangle)
+			{
+				for(const int vertexIdx : m_Triangles[iTriangle])
+					std::atomic_ref<uint32_t>(m_StarOffsets[vertexIdx + 1]).fetch_add(1, std::memory_order_relaxed);
+			});
+		std::inclusive_scan(m_StarOffsets.begin(), m_StarOffsets.end(), m_StarOffsets.begin());
+
+		std::vector<uint32_t> insertionIndices(m_StarOffsets.begin(), m_StarOffsets.end() - 1);
+		m_StarCorners.resize(m_StarOffsets.back());
+		ParallelFor(
+			0,
+			m_Triangles.size(),
+			[&](const size_t iTriangle)
+			{
+				for(uint32_t iCorner = 0; iCorner < 3; ++iCorner)
+				{
+					std::atomic_ref<uint32_t> insertionIdx(insertionIndices[m_Triangles[iTriangle][iCorner]]);
+					m_StarCorners[insertionIdx.fetch_add(1, std::memory_order_relaxed)] =
+						3 * static_cast<uint32_t>(iTriangle) + iCorner;
+				}
+			});
+
+		// The insertion order depends on the threads, sorting keeps the repair deterministic.
+		ParallelFor(
+			0,
+			vertexCount,
+			[&](const size_t iVertex)
+			{
+				std::sort(m_StarCorners.begin() + m_StarOffsets[iVertex],
+						  m_StarCorners.begin() + m_StarOffsets[iVertex + 1]);
+			});
+	}
+
+	/// @brief Boundary loops with at most MaxHoleEdgeCount edges, in the direction of the missing triangles.
+	/// @note The loops going through a vertex with several boundaries (cut edges) are left open, as well as the
+	/// boundaries of isolated triangles.
+	std::vector<std::vector<int>> CollectHoles() const
+	{
+		// The hole runs through each boundary edge in the opposite direction of its triangle.
+		const size_t vertexCount = m_Positions.size();
+		std::vector<int> nextVertexIndices(vertexCount, -1);
+		std::vector<uint32_t> outgoingCounts(vertexCount, 0);
+		std::vector<int> boundaryTriangleIndices(vertexCount, -1);
+		ParallelFor(
+			0,
+			m_Triangles.size(),
+			[&](const size_t iTriangle)
+			{
+				for(EdgeIndex iEdge = 0; iEdge < 3; ++iEdge)
+				{
+					if(m_Neighbors[iTriangle][iEdge] != -1)
+						continue;
+					const int firstVertexIdx = m_Triangles[iTriangle][IndexHelpers::Previous[iEdge]];
+					const int secondVertexIdx = m_Triangles[iTriangle][IndexHelpers::Next[iEdge]];
+					std::atomic_ref<uint32_t>(outgoingCounts[firstVertexIdx]).fetch_add(1, std::memory_order_relaxed);
+					std::atomic_ref<int>(nextVertexIndices[firstVertexIdx])
+						.store(secondVertexIdx, std::memory_order_relaxed);
+					std::atomic_ref<int>(boundaryTriangleIndices[firstVertexIdx])
+						.store(static_cast<int>(iTriangle), std::memory_order_relaxed);
+				}
+			});
+
+		std::vector<std::vector<int>> holes;
+		std::vector<uint8_t> visitedFlags(vertexCount, 0);
+		std::vector<int> loop;
+		for(size_t iVertex = 0; iVertex < vertexCount; ++iVertex)
+		{
+			if(visitedFlags[iVertex] != 0 || outgoingCounts[iVertex] != 1)
+				continue;
+
+			loop.clear();
+			int curVertexIdx = static_cast<int>(iVertex);
+			while(visitedFlags[curVertexIdx] == 0 && outgoingCounts[curVertexIdx] == 1)
+			{
+				visitedFlags[curVertexIdx] = 1;
+				loop.push_back(curVertexIdx);
+				curVertexIdx = nextVertexIndices[curVertexIdx];
+			}
+			if(curVertexIdx != static_cast<int>(iVertex) || loop.size() < 3
+			   || loop.size() > m_Specification.MaxHoleEdgeCount)
+				continue;
+
+			// The boundary of an isolated triangle would be filled with the same triangle, reversed.
+			const bool isIsolatedTriangle = loop.size() == 3
+				&& boundaryTriangleIndices[loop[0]] == boundaryTriangleIndices[loop[1]]
+				&& boundaryTriangleIndices[loop[1]] == boundaryTriangleIndices[loop[2]];
+			if(!isIsolatedTriangle)
+				holes.push_back(loop);
+		}
+		return holes;
+	}
+
+	/// @brief Minimum area triangulation of a hole (dynamic programming over its sub-polygons).
+	/// @param edgeKeys Sorted keys of the edges of the mesh.
+	/// @return The triangles, oriented like the loop, or nothing if every triangulation has a degenerate triangle or
+	/// an edge already in the mesh.
+	std::vector<Corners> TriangulateHole(const std::vector<int>& loop, const std::vector<uint64_t>& edgeKeys) const
+	{
+		const size_t n = loop.size();
+		constexpr double infinity = std::numeric_limits<double>::infinity();
+
+		// The loop edges belong to the mesh, the other ones (chords) must not.
+		const auto isEdgeAllowed = [&](const size_t i, const size_t j)
+		{
+			if(j == i + 1 || (i == 0 && j == n - 1))
+				return true;
+			return !std::binary_search(edgeKeys.begin(), edgeKeys.end(), GetEdgeKey(loop[i], loop[j]));
+		};
+
+		// Area of the best triangulation of the sub-polygon (i, ..., j) and the apex of its triangle on (i, j).
+		std::vector<double> areas(n * n, 0.);
+		std::vector<size_t> apexIndices(n * n, 0);
+		for(size_t gap = 2; gap < n; ++gap)
+		{
+			for(size_t i = 0; i + gap < n; ++i)
+			{
+				const size_t j = i + gap;
+				double bestArea = infinity;
+				if(isEdgeAllowed(i, j))
+				{
+					for(size_t m = i + 1; m < j; ++m)
+					{
+						const double subArea = areas[i * n + m] + areas[m * n + j];
+						if(subArea == infinity || !isEdgeAllowed(i, m) || !isEdgeAllowed(m, j))
+							continue;
+
+						const Vec3& p0 = m_Positions[loop[i]];
+						const float area =
+							0.5f * Length(Cross(m_Positions[loop[m]] - p0, m_Positions[loop[j]] - p0));
+						if(area > m_Specification.MinTriangleArea && subArea + area < bestArea)
+						{
+							bestArea = subArea + area;
+							apexIndices[i * n + j] = m;
+						}
+					}
+				}
+				areas[i * n + j] = bestArea;
+			}
+		}
+		if(areas[n - 1] == infinity)
+			return {};
+
+		std::vector<Corners> triangles;
+		triangles.reserve(n - 2);
+		std::vector<std::pair<size_t, size_t>> stack{ { 0, n - 1 } };
+		while(!stack.empty())
+		{
+			const auto [i, j] = stack.back();
+			stack.pop_back();
+			if(j < i + 2)
+				continue;
+			const size_t m = apexIndices[i * n + j];
+			triangles.push_back({ loop[i], loop[m], loop[j] });
+			stack.emplace_back(i, m);
+			stack.emplace_back(m, j);
+		}
+		return triangles;
+	}
+
+private:
+	const RepairSpecification& m_Specification;
+	RepairSummary& m_Summary;
+
+	std::vector<Vec3> m_Positions{};
+	std::vector<Corners> m_Triangles{};
+	std::vector<Corners> m_Neighbors{};
+
+	/// @brief Corners around each vertex, see BuildStars.
+	std::vector<uint32_t> m_StarOffsets{};
+	std::vector<uint32_t> m_StarCorners{};
+};
+} // namespace
+
+namespace Utilitary::Surface
+{
+RepairSummary MeshRepairer::Repair(Mesh& mesh, const RepairSpecification& specification)
+{
+	ProfileScope("MeshRepairer::Repair");
+	assert(specification.MinTriangleArea >= 0.f);
+
+	RepairSummary summary;
+	RepairPipeline pipeline(mesh, specification, summary);
+	pipeline.FixOrientation();
+	pipeline.SplitNonManifoldVertices();
+	pipeline.FillHoles();
+	pipeline.Finalize();
+
+	const std::vector<Vec3>& positions = pipeline.GetPositions();
+	const std::vector<std::array<int, 3>>& triangles = pipeline.GetTriangles();
+	const std::vector<std::array<int, 3>>& neighbors = pipeline.GetNeighbors();
+
+	mesh.m_Vertices.assign(positions.size(), Vertex{});
+	mesh.m_Triangles.resize(triangles.size());
+	ParallelFor(
+		0,
+		positions.size(),
+		[&](const size_t iVertex)
+		{
+			mesh.m_Vertices[iVertex].Position = positions[iVertex];
+		});
+	ParallelFor(
+		0,
+		triangles.size(),
+		[&](const size_t iTriangle)
+		{
+			mesh.m_Triangles[iTriangle] = { .Vertices = triangles[iTriangle], .Neighbors = neighbors[iTriangle] };
+		});
+
+	// The lowest triangle around each vertex is its incident triangle.
+	for(size_t iTriangle = triangles.size(); iTriangle-- > 0;)
+		for(const int vertexIdx : triangles[iTriangle])
+			mesh.m_Vertices[vertexIdx].IncidentTriangleIdx = static_cast<int>(iTriangle);
+
+	// The elements are rebuilt, so their extra data cannot be carried over.
+	mesh.m_VerticesExtraDataContainer.clear();
+	mesh.m_TrianglesExtraDataContainer.clear();
+	mesh.m_DeletedVertices.clear();
+	mesh.m_DeletedTriangles.clear();
+	mesh.m_FreeVertices.clear();
+	mesh.m_FreeTriangles.clear();
+	mesh.NotifyTopologyChanged();
+
+	return summary;
+}
+} // namespace Utilitary::Surface
@@ -0,0 +1,167 @@
+#include "Application/MeshStatistics.h"
+
+#include "Core/MathHelpers.h"
+#include "Core/Parallel.h"
+#include "Core/Profiler.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <numbers>
+
+using namespace Core::BaseType;
+using namespace Core::Math::Geometry;
+using namespace Core::Parallel;
+using namespace Data::Primitive;
+using namespace Data::Surface;
+
+namespace
+{
+/// @brief Minimum number of triangles of a range, smaller meshes are processed by fewer threads.
+constexpr size_t MinRangeSize = 4096;
+
+/// @brief Statistics accumulated by a range of triangles, for the vertices [FirstVertexIdx, FirstVertexIdx + size).
+struct RangeAccumulators
+{
+	VertexIndex FirstVertexIdx{ 0 };
+	std::vector<uint32_t> Valences{};
+	std::vector<uint32_t> TriangleCounts{};
+	std::vector<float> Areas{};
+	std::vector<float> AngleSums{};
+
+	/// @brief Allocate null statistics for the given number of vertices.
+	void Resize(const size_t vertexCount)
+	{
+		Valences.assign(vertexCount, 0);
+		TriangleCounts.assign(vertexCount, 0);
+		Areas.assign(vertexCount, 0.f);
+		AngleSums.assign(vertexCount, 0.f);
+	}
+};
+
+/// @brief Angle between two vectors, accurate for both small and flat angles.
+float ComputeAngle(const Vec3& u, const Vec3& v)
+{
+	return std::atan2(Length(Cross(u, v)), Dot(u, v));
+}
+
+/// @brief Accumulate the statistics of the triangles [begin, end).
+void AccumulateRange(const Mesh& mesh, const size_t begin, const size_t end, RangeAccumulators& accumulators)
+{
+	const std::vector<Vertex>& vertices = mesh.GetVertices();
+	const std::vector<Triangle>& triangles = mesh.GetTriangles();
+
+	// Only the vertices referenced by the range are accumulated.
+	int minVertexIdx = std::numeric_limits<int>::max();
+	int maxVertexIdx = -1;
+	for(size_t iTriangle = begin; iTriangle < end; ++iTriangle)
+	{
+		if(mesh.IsTriangleDeleted(static_cast<TriangleIndex>(iTriangle)))
+			continue;
+		const auto& triangleVertices = triangles[iTriangle].Vertices;
+		minVertexIdx = std::min({ minVertexIdx, triangleVertices[0], triangleVertices[1], triangleVertices[2] });
+		maxVertexIdx = std::max({ maxVertexIdx, triangleVertices[0], triangleVertices[1], triangleVertices[2] });
+	}
+	if(maxVertexIdx == -1)
+		return;
+	accumulators.FirstVertexIdx = static_cast<VertexIndex>(minVertexIdx);
+	accumulators.Resize(static_cast<size_t>(maxVertexIdx - minVertexIdx) + 1);
+
+	for(size_t iTriangle = begin; iTriangle < end; ++iTriangle)
+	{
+		if(mesh.IsTriangleDeleted(static_cast<TriangleIndex>(iTriangle)))
+			continue;
+
+		const Triangle& triangle = triangles[iTriangle];
+		const std::array<Vec3, 3> positions{ vertices[triangle.Vertices[0]].Position,
+											 vertices[triangle.Vertices[1]].Position,
+											 vertices[triangle.Vertices[2]].Position };
+		const float area = 0.5f * Length(Cross(positions[1] - positions[0], positions[2] - positions[0]));
+
+		std::array<size_t, 3> localIndices;
+		for(EdgeIndex iCorner = 0; iCorner < 3; ++iCorner)
+			localIndices[iCorner] = static_cast<size_t>(triangle.Vertices[iCorner] - minVertexIdx);
+
+		for(EdgeIndex iCorner = 0; iCorner < 3; ++iCorner)
+		{
+			const size_t localIdx = localIndices[iCorner];
+			const Vec3& position = positions[iCorner];
+			++accumulators.TriangleCounts[localIdx];
+			accumulators.Areas[localIdx] += area;
+			accumulators.AngleSums[localIdx] += ComputeAngle(positions[IndexHelpers::Next[iCorner]] - position,
+															 positions[IndexHelpers::Previous[iCorner]] - position);
+
+			// The edge opposite to the corner is counted by its lowest triangle.
+			const int neighborIdx = triangle.Neighbors[iCorner];
+			if(neighborIdx == -1 || neighborIdx > static_cast<int>(iTriangle))
+			{
+				++accumulators.Valences[localIndices[IndexHelpers::Next[iCorner]]];
+				++accumulators.Valences[localIndices[IndexHelpers::Previous[iCorner]]];
+			}
+		}
+	}
+}
+} // namespace
+
+namespace Utilitary::Surface
+{
+float OneRingStatistics::GetAngleDefect(const VertexIndex index) const
+{
+	if(TriangleCounts[index] == 0)
+		return 0.f;
+	const float fullAngle = IsBoundaryVertex(index) ? std::numbers::pi_v<float> : 2.f * std::numbers::pi_v<float>;
+	return fullAngle - AngleSums[index];
+}
+
+OneRingStatistics MeshStatistics::ComputeOneRingStatistics(const Mesh& mesh)
+{
+	ProfileScope("MeshStatistics::ComputeOneRingStatistics");
+
+	// One range of triangles per thread, each with its own accumulators.
+	const size_t triangleCount = mesh.GetTriangleCount();
+	const size_t rangeCount = std::clamp<size_t>(triangleCount / MinRangeSize, 1, GetThreadCount());
+	const size_t rangeSize = (triangleCount + rangeCount - 1) / rangeCount;
+	std::vector<RangeAccumulators> accumulators(rangeCount);
+	ParallelFor(
+		0,
+		rangeCount,
+		[&](const size_t iRange)
+		{
+			const size_t begin = std::min(triangleCount, iRange * rangeSize);
+			AccumulateRange(mesh, begin, std::min(triangleCount, begin + rangeSize), accumulators[iRange]);
+		},
+		1);
+
+	// Sum the accumulators of the ranges overlapping each chunk of vertices.
+	const size_t vertexCount = mesh.GetVertexCount();
+	OneRingStatistics statistics;
+	statistics.Valences.resize(vertexCount, 0);
+	statistics.TriangleCounts.resize(vertexCount, 0);
+	statistics.Areas.resize(vertexCount, 0.f);
+	statistics.AngleSums.resize(vertexCount, 0.f);
+	ParallelForRange(
+		0,
+		vertexCount,
+		[&](const size_t chunkBegin, const size_t chunkEnd)
+		{
+			for(const RangeAccumulators& rangeAccumulators : accumulators)
+			{
+				const size_t firstVertexIdx = rangeAccumulators.FirstVertexIdx;
+				const size_t begin = std::max(chunkBegin, firstVertexIdx);
+				const size_t end = std::min(chunkEnd, firstVertexIdx + rangeAccumulators.Valences.size());
+				for(size_t iVertex = begin; iVertex < end; ++iVertex)
+				{
+					const size_t localIdx = iVertex - firstVertexIdx;
+					statistics.Valences[iVertex] += rangeAccumulators.Valences[localIdx];
+					statistics.TriangleCounts[iVertex] += rangeAccumulators.TriangleCounts[localIdx];
+					statistics.Areas[iVertex] += rangeAccumulators.Areas[localIdx];
+					statistics.AngleSums[iVertex] += rangeAccumulators.AngleSums[localIdx];
+				}
+			}
+		},
+		4096);
+
+	return statistics;
+}
+} // namespace Utilitary::Surface
@@ -0,0 +1,463 @@
+#include "Application/MeshViewerLayer.h"
+
+#include "Application/MeshGenerator.h"
+#include "Application/MeshGeometry.h"
+#include "Application/MeshLoader.h"
+#include "Core/MathHelpers.h"
+#include "Core/Parallel.h"
+#include "Core/PrintHelpers.h"
+#include "Core/Profiler.h"
+#include "Core/Renderer/Shader.h"
+#include "imgui.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <numbers>
+#include <span>
+#include <stdexcept>
+#include <thread>
+
+using namespace Core::BaseType;
+using namespace Core::Math::Geometry;
+using namespace Utilitary::Surface;
+
+namespace
+{
+/// @brief Vertical field of view of the camera.
+constexpr float FieldOfView = std::numbers::pi_v<float> / 4.f;
+
+/// @brief Bytes uploaded per frame at most, so that a large mesh never stalls the presentation.
+constexpr size_t UploadBudget = size_t{ 16 } << 20;
+
+/// @brief Share of the reading of the file in the progress of a loading, the rest being the preparation.
+constexpr float LoadingProgressShare = 0.6f;
+
+/// @brief Upload the next bytes of a staging array into a buffer of the same size, within a budget.
+/// @return The number of bytes uploaded.
+size_t UploadNextBytes(
+	const uint32_t buffer, const std::span<const std::byte> data, size_t& uploadedSize, const size_t budget)
+{
+	const size_t size = std::min(data.size() - uploadedSize, budget);
+	if(size > 0)
+	{
+		glNamedBufferSubData(buffer,
+			static_cast<GLintptr>(uploadedSize),
+			static_cast<GLsizeiptr>(size),
+			data.data() + uploadedSize);
+	}
+	uploadedSize += size;
+	return size;
+}
+} // namespace
+
+namespace Application
+{
+MeshViewerLayer::MeshViewerLayer()
+	: m_Jobs(std::max(std::thread::hardware_concurrency(), 3u) - 1)
+{
+	m_Shader = Renderer::CreateGraphicsShader("Data/Shaders/MeshVertex.glsl", "Data/Shaders/MeshFragment.glsl");
+	SetMesh(MeshGenerator::CreateTerrain(256, 256));
+}
+
+MeshViewerLayer::~MeshViewerLayer()
+{
+	ReleaseLevels();
+	ReleasePendingMesh();
+	glDeleteProgram(m_Shader);
+	if(m_ColorTexture.Handle != 0)
+	{
+		glDeleteTextures(1, &m_ColorTexture.Handle);
+		glDeleteFramebuffers(1, &m_Framebuffer.Handle);
+		glDeleteRenderbuffers(1, &m_DepthBuffer);
+	}
+}
+
+void MeshViewerLayer::SetMesh(std::unique_ptr<Data::Surface::Mesh> mesh)
+{
+	ProfileScope("MeshViewerLayer::SetMesh");
+
+	ReleasePendingMesh();
+	m_PendingMesh = PrepareMesh(std::move(mesh), {}, {});
+	UploadPendingMesh(std::numeric_limits<size_t>::max());
+}
+
+void MeshViewerLayer::LoadMesh(const std::filesystem::path& filepath)
+{
+	if(m_LoadJob)
+		m_LoadJob->Cancel();
+
+	m_LoadJob = m_Jobs.Submit(
+		[this, filepath](const Core::Parallel::CancellationToken& cancellation,
+			const Core::Parallel::ProgressCallback& progress)
+		{
+			const Core::Parallel::ProgressCallback loadingProgress = [&progress](const float value)
+			{
+				progress(LoadingProgressShare * value);
+			};
+			std::unique_ptr<Data::Surface::Mesh> mesh = filepath.extension() == ".off"
+				? MeshLoader::LoadOFF(filepath, loadingProgress, cancellation)
+				: MeshLoader::LoadOBJ(filepath, loadingProgress, cancellation);
+			if(cancellation.IsCancelled())
+				return;
+			if(!mesh)
+				throw std::runtime_error("Failed to load " + filepath.string());
+
+			std::unique_ptr<PreparedMesh> prepared = PrepareMesh(std::move(mesh),
+				cancellation,
+				[&progress](const float value)
+				{
+					progress(LoadingProgressShare + (1.f - LoadingProgressShare) * value);
+				});
+
+			// The render thread takes the prepared meshes once per frame.
+			while(prepared && !m_PreparedMeshes.TryPush(std::move(prepared)))
+			{
+				if(cancellation.IsCancelled())
+					return;
+				std::this_thread::yield();
+			}
+		});
+}
+
+std::unique_ptr<MeshViewerLayer::PreparedMesh> MeshViewerLayer::PrepareMesh(
+	std::unique_ptr<Data::Surface::Mesh> mesh,
+	const Core::Parallel::CancellationToken& cancellation,
+	const Core::Parallel::ProgressCallback& progress)
+{
+	ProfileScope("MeshViewerLayer::PrepareMesh");
+
+	// The packed indices of a triangle are found from its index, the mesh must be compact. The loader already built the
+	// connectivity, which the garbage collection keeps.
+	auto prepared = std::make_unique<PreparedMesh>();
+	prepared->Mesh = std::move(mesh);
+	Data::Surface::Mesh& sourceMesh = *prepared->Mesh;
+	if(sourceMesh.HasGarbage())
+		sourceMesh.GarbageCollect();
+	prepared->BoundingBox = MeshGeometry::ComputeBoundingBox(*sourceMesh.GetPositionBuffers());
+	if(cancellation.IsCancelled())
+		return nullptr;
+
+	// The hierarchy takes about half of the preparation, the packing of the levels the other half.
+	prepared->Hierarchy = MeshClusters::BuildHierarchy(sourceMesh);
+	if(progress)
+		progress(0.5f);
+
+	const size_t levelCount = prepared->Hierarchy.Levels.size();
+	prepared->Levels.resize(levelCount);
+	for(size_t iLevel = 0; iLevel < levelCount; ++iLevel)
+	{
+		if(cancellation.IsCancelled())
+			return nullptr;
+
+		// The source mesh belongs to the layer as well, every level gets its own smooth normals.
+		const ClusterLevel& level = prepared->Hierarchy.Levels[iLevel];
+		Data::Surface::Mesh& levelMesh = level.OwnedMesh ? *level.OwnedMesh : sourceMesh;
+		levelMesh.ComputeSmoothVertexNormals(true);
+		const PackedMeshLayout layout = MeshPacker::ComputeLayout(levelMesh);
+
+		PreparedLevel& preparedLevel = prepared->Levels[iLevel];
+		preparedLevel.Vertices.resize(layout.GetVertexCount());
+		MeshPacker::PackVertices(levelMesh, layout, preparedLevel.Vertices);
+
+		// The indices follow the triangles of the clusters, so that each cluster is a contiguous range.
+		std::vector<uint32_t>& indices = preparedLevel.Indices;
+		indices.resize(layout.GetIndexCount());
+		Core::Parallel::ParallelFor(
+			0,
+			level.Triangles.size(),
+			[&](const size_t iPosition)
+			{
+				const TriangleIndex iTriangle = level.Triangles[iPosition];
+				for(size_t iCorner = 0; iCorner < 3; ++iCorner)
+					indices[3 * iPosition + iCorner] = layout.Indices[3 * iTriangle + iCorner];
+			});
+		if(progress)
+			progress(0.5f + 0.5f * static_cast<float>(iLevel + 1) / static_cast<float>(levelCount));
+	}
+	return prepared;
+}
+
+void MeshViewerLayer::ReceivePreparedMeshes()
+{
+	std::unique_ptr<PreparedMesh> prepared;
+	while(m_PreparedMeshes.TryPop(prepared))
+	{
+		ReleasePendingMesh();
+		m_PendingMesh = std::move(prepared);
+	}
+}
+
+void MeshViewerLayer::UploadPendingMesh(size_t budget)
+{
+	ProfileScope("MeshViewerLayer::UploadPendingMesh");
+
+	PreparedMesh& pending = *m_PendingMesh;
+	while(pending.UploadedLevelCount < pending.Levels.size() && budget > 0)
+	{
+		PreparedLevel& level = pending.Levels[pending.UploadedLevelCount];
+		const std::span<const std::byte> vertexBytes = std::as_bytes(std::span(level.Vertices));
+		const std::span<const std::byte> indexBytes = std::as_bytes(std::span(level.Indices));
+		LevelBuffers& buffers = level.Buffers;
+		if(buffers.VertexArray == 0)
+		{
+			glCreateBuffers(1, &buffers.VertexBuffer);
+			glNamedBufferStorage(buffers.VertexBuffer,
+				static_cast<GLsizeiptr>(std::max<size_t>(vertexBytes.size(), 1)),
+				nullptr,
+				GL_DYNAMIC_STORAGE_BIT);
+			glCreateBuffers(1, &buffers.IndexBuffer);
+			glNamedBufferStorage(buffers.IndexBuffer,
+				static_cast<GLsizeiptr>(std::max<size_t>(indexBytes.size(), 1)),
+				nullptr,
+				GL_DYNAMIC_STORAGE_BIT);
+
+			glCreateVertexArrays(1, &buffers.VertexArray);
+			glVertexArrayVertexBuffer(buffers.VertexArray, 0, buffers.VertexBuffer, 0, sizeof(PackedVertex));
+			glVertexArrayElementBuffer(buffers.VertexArray, buffers.IndexBuffer);
+			glEnableVertexArrayAttrib(buffers.VertexArray, 0); // position
+			glEnableVertexArrayAttrib(buffers.VertexArray, 1); // normal
+			glEnableVertexArrayAttrib(buffers.VertexArray, 2); // uv
+			glVertexArrayAttribFormat(
+				buffers.VertexArray, 0, 3, GL_FLOAT, GL_FALSE, static_cast<GLuint>(offsetof(PackedVertex, Position)));
+			glVertexArrayAttribFormat(
+				buffers.VertexArray, 1, 3, GL_FLOAT, GL_FALSE, static_cast<GLuint>(offsetof(PackedVertex, Normal)));
+			glVertexArrayAttribFormat(
+				buffers.VertexArray, 2, 2, GL_FLOAT, GL_FALSE, static_cast<GLuint>(offsetof(PackedVertex, TexCoords)));
+			for(GLuint iAttribute = 0; iAttribute < 3; ++iAttribute)
+				glVertexArrayAttribBinding(buffers.VertexArray, iAttribute, 0);
+		}
+
+		budget -= UploadNextBytes(buffers.VertexBuffer, vertexBytes, level.UploadedVertexSize, budget);
+		budget -= UploadNextBytes(buffers.IndexBuffer, indexBytes, level.UploadedIndexSize, budget);
+		if(level.UploadedVertexSize == vertexBytes.size() && level.UploadedIndexSize == indexBytes.size())
+		{
+			// The staging copy is no longer needed.
+			level.Vertices = {};
+			level.Indices = {};
+			++pending.UploadedLevelCount;
+		}
+	}
+
+	if(pending.UploadedLevelCount == pending.Levels.size())
+		SwapPendingMesh();
+}
+
+void MeshViewerLayer::SwapPendingMesh()
+{
+	ProfileScope("MeshViewerLayer::SwapPendingMesh");
+
+	// Freeing a large mesh takes a while, a job does it in the background.
+	auto previous = std::make_shared<PreparedMesh>();
+	previous->Mesh = std::move(m_Mesh);
+	previous->Hierarchy = std::move(m_Hierarchy);
+	m_Jobs.Submit([previous](const Core::Parallel::CancellationToken&, const Core::Parallel::ProgressCallback&) mutable
+		{ previous.reset(); });
+
+	ReleaseLevels();
+	PreparedMesh& pending = *m_PendingMesh;
+	for(const PreparedLevel& level : pending.Levels)
+		m_Levels.push_back(level.Buffers);
+	m_Mesh = std::move(pending.Mesh);
+	m_Hierarchy = std::move(pending.Hierarchy);
+
+	const AxisAlignedBox& boundingBox = pending.BoundingBox;
+	m_Target = boundingBox.IsEmpty() ? Vec3{ 0.f } : 0.5f * (boundingBox.Min + boundingBox.Max);
+	m_SceneRadius = std::max(0.5f * Length(boundingBox.GetExtent()), 1e-3f);
+	m_Distance = 2.5f * m_SceneRadius;
+	m_Selection = ClusterSelection{};
+	Info("Mesh of {} triangles split into {} clusters over {} levels",
+		m_Mesh->GetTriangleCount(),
+		m_Hierarchy.GetClusterCount(),
+		m_Hierarchy.Levels.size());
+	m_PendingMesh.reset();
+}
+
+void MeshViewerLayer::ReleaseBuffers(const LevelBuffers& buffers)
+{
+	glDeleteVertexArrays(1, &buffers.VertexArray);
+	glDeleteBuffers(1, &buffers.VertexBuffer);
+	glDeleteBuffers(1, &buffers.IndexBuffer);
+}
+
+void MeshViewerLayer::ReleasePendingMesh()
+{
+	if(!m_PendingMesh)
+		return;
+	for(const PreparedLevel& level : m_PendingMesh->Levels)
+		ReleaseBuffers(level.Buffers);
+	m_PendingMesh.reset();
+}
+
+void MeshViewerLayer::ReleaseLevels()
+{
+	for(const LevelBuffers& buffers : m_Levels)
+		ReleaseBuffers(buffers);
+	m_Levels.clear();
+}
+
+void MeshViewerLayer::ResizeTargets(const uint32_t width, const uint32_t height)
+{
+	if(m_ColorTexture.Width == width && m_ColorTexture.Height == height)
+		return;
+
+	if(m_ColorTexture.Handle != 0)
+	{
+		glDeleteTextures(1, &m_ColorTexture.Handle);
+		glDeleteFramebuffers(1, &m_Framebuffer.Handle);
+		glDeleteRenderbuffers(1, &m_DepthBuffer);
+	}
+	m_ColorTexture = Renderer::CreateTexture(static_cast<int>(width), static_cast<int>(height));
+	m_Framebuffer = Renderer::CreateFramebufferWithTexture(m_ColorTexture);
+	glCreateRenderbuffers(1, &m_DepthBuffer);
+	glNamedRenderbufferStorage(
+		m_DepthBuffer, GL_DEPTH_COMPONENT32F, static_cast<GLsizei>(width), static_cast<GLsizei>(height));
+	glNamedFramebufferRenderbuffer(m_Framebuffer.Handle, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, m_DepthBuffer);
+}
+
+void MeshViewerLayer::OnRender()
+{
+	ReceivePreparedMeshes();
+	if(m_PendingMesh)
+		UploadPendingMesh(UploadBudget);
+
+	ImGui::Begin("Mesh Viewer");
+
+	ImGui::InputText("File", m_PathInput.data(), m_PathInput.size());
+	ImGui::SameLine();
+	if(ImGui::Button("Load") && m_PathInput[0] != '\0')
+		LoadMesh(m_PathInput.data());
+	if(m_LoadJob && !m_LoadJob->IsDone())
+	{
+		ImGui::ProgressBar(m_LoadJob->GetProgress(), ImVec2(-80.f, 0.f));
+		ImGui::SameLine();
+		if(ImGui::Button("Cancel"))
+			m_LoadJob->Cancel();
+	}
+	else if(m_LoadJob && m_LoadJob->GetStatus() == Core::Parallel::JobStatus::Failed)
+	{
+		ImGui::TextColored(ImVec4(1.f, 0.4f, 0.4f, 1.f), "%s", m_LoadJob->GetError().c_str());
+	}
+	if(m_PendingMesh)
+		ImGui::Text("Uploading level %zu of %zu", m_PendingMesh->UploadedLevelCount + 1, m_PendingMesh->Levels.size());
+
+	ImGui::Text("%u triangles, %zu levels, %u clusters",
+		m_Mesh->GetTriangleCount(),
+		m_Hierarchy.Levels.size(),
+		m_Hierarchy.GetClusterCount());
+	ImGui::Text("Visible %u, tested %u, frustum culled %u, backface culled %u (%.3f ms)",
+		m_Selection.GetVisibleClusterCount(),
+		m_Selection.TestedClusterCount,
+		m_Selection.FrustumCulledCount,
+		m_Selection.BackfaceCulledCount,
+		m_SelectionTime);
+	ImGui::SliderFloat("Max error (pixels)", &m_MaxScreenError, 0.25f, 16.f, "%.2f", ImGuiSliderFlags_Logarithmic);
+	ImGui::Checkbox("Frustum culling", &m_FrustumCulling);
+	ImGui::SameLine();
+	ImGui::Checkbox("Backface culling", &m_BackfaceCulling);
+	ImGui::SameLine();
+	ImGui::Checkbox("Freeze selection", &m_FreezeSelection);
+	ImGui::SameLine();
+	ImGui::Checkbox("Show clusters", &m_ShowClusters);
+
+	const ImVec2 size = ImGui::GetContentRegionAvail();
+	if(size.x < 1.f || size.y < 1.f)
+	{
+		ImGui::End();
+		return;
+	}
+	const uint32_t width = static_cast<uint32_t>(size.x);
+	const uint32_t height = static_cast<uint32_t>(size.y);
+
+	// Orbit with the left button, zoom with the wheel.
+	const ImVec2 pos = ImGui::GetCursorScreenPos();
+	ImGui::InvisibleButton("Viewport", size);
+	const ImGuiIO& io = ImGui::GetIO();
+	if(ImGui::IsItemActive())
+	{
+		m_Yaw -= 0.01f * io.MouseDelta.x;
+		m_Pitch = std::clamp(m_Pitch + 0.01f * io.MouseDelta.y, -1.55f, 1.55f);
+	}
+	if(ImGui::IsItemHovered() && io.MouseWheel != 0.f)
+	{
+		m_Distance =
+			std::clamp(m_Distance * std::pow(0.9f, io.MouseWheel), 1e-3f * m_SceneRadius, 20.f * m_SceneRadius);
+	}
+
+	ResizeTargets(width, height);
+	ImGui::GetWindowDrawList()->AddImage(reinterpret_cast<void*>(static_cast<uintptr_t>(m_ColorTexture.Handle)),
+		pos,
+		ImVec2(pos.x + size.x, pos.y + size.y),
+		ImVec2(0, 1),
+		ImVec2(1, 0));
+	ImGui::End();
+
+	DrawClusters(width, height);
+}
+
+void MeshViewerLayer::DrawClusters(const uint32_t width, const uint32_t height)
+{
+	ProfileScope("MeshViewerLayer::DrawClusters");
+
+	const Vec3 direction{ std::cos(m_Pitch) * std::cos(m_Yaw), std::cos(m_Pitch) * std::sin(m_Yaw), std::sin(m_Pitch) };
+	const Vec3 cameraPosition = m_Target + m_Distance * direction;
+	const float aspect = static_cast<float>(width) / static_cast<float>(height);
+	const Mat4 viewProjection =
+		Perspective(FieldOfView, aspect, 1e-3f * m_Distance, m_Distance + 2.f * m_SceneRadius)
+		* LookAt(cameraPosition, m_Target, Vec3{ 0.f, 0.f, 1.f });
+
+	if(!m_FreezeSelection)
+	{
+		m_SelectionView.ViewProjection = viewProjection;
+		m_SelectionView.CameraPosition = cameraPosition;
+		m_SelectionView.ProjectionScale = static_cast<float>(height) / (2.f * std::tan(0.5f * FieldOfView));
+	}
+	m_SelectionView.MaxScreenError = m_MaxScreenError;
+	m_SelectionView.FrustumCulling = m_FrustumCulling;
+	m_SelectionView.BackfaceCulling = m_BackfaceCulling;
+	const auto selectionStart = std::chrono::steady_clock::now();
+	m_Selection = MeshClusters::SelectClusters(m_Hierarchy, m_SelectionView);
+	m_SelectionTime =
+		std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - selectionStart).count();
+
+	glBindFramebuffer(GL_FRAMEBUFFER, m_Framebuffer.Handle);
+	glViewport(0, 0, static_cast<GLsizei>(width), static_cast<GLsizei>(height));
+	glClearColor(0.1f, 0.1f, 0.12f, 1.0f);
+	glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+	glEnable(GL_DEPTH_TEST);
+
+	glUseProgram(m_Shader);
+	glUniformMatrix4fv(0, 1, GL_FALSE, glm::value_ptr(viewProjection));
+	glUniform3f(1, cameraPosition.x, cameraPosition.y, cameraPosition.z);
+	glUniform1i(2, m_ShowClusters ? 1 : 0);
+
+	// One call per level, each visible cluster being a range of its index buffer.
+	for(size_t iLevel = 0; iLevel < m_Levels.size(); ++iLevel)
+	{
+		const std::vector<uint32_t>& visibleClusters = m_Selection.VisibleClusters[iLevel];
+		if(visibleClusters.empty())
+			continue;
+
+		m_DrawCounts.clear();
+		m_DrawOffsets.clear();
+		for(const uint32_t iCluster : visibleClusters)
+		{
+			const MeshCluster& cluster = m_Hierarchy.Levels[iLevel].Clusters[iCluster];
+			m_DrawCounts.push_back(static_cast<GLsizei>(3 * cluster.TriangleCount));
+			m_DrawOffsets.push_back(
+				reinterpret_cast<const void*>(size_t{ 3 } * cluster.FirstTriangle * sizeof(uint32_t)));
+		}
+		glBindVertexArray(m_Levels[iLevel].VertexArray);
+		glMultiDrawElements(GL_TRIANGLES,
+			m_DrawCounts.data(),
+			GL_UNSIGNED_INT,
+			m_DrawOffsets.data(),
+			static_cast<GLsizei>(m_DrawCounts.size()));
+	}
+
+	glBindVertexArray(0);
+	glDisable(GL_DEPTH_TEST);
+	glBindFramebuffer(GL_FRAMEBUFFER, 0);
+}
+} // namespace Application
@@ -1,5 +1,9 @@
 #include "Application/AppLayer.h"
+#include "Application/BatchViewerLayer.h"
+#include "Application/MeshViewerLayer.h"
 #include "Core/Application.h"
+#include "Core/PrintHelpers.h"
+#include "Core/Profiler.h"
 #include "imgui.h"
 #include "imgui_impl_glfw.h"
 #include "imgui_impl_opengl3.h"
@@ -17,17 +21,33 @@ std::unique_ptr<Core::Application> CreateApplication(int argc, char** argv)
 
 	auto app = std::make_unique<Core::Application>(appSpec);
 	app->PushLayer<Application::AppLayer>();
+	app->PushLayer<Application::MeshViewerLayer>();
+	app->PushLayer<Application::BatchViewerLayer>();
 	app->SetMenubarCallback(
 		[&app]()
 		{
 			if(ImGui::BeginMenu("File"))
 			{
+				if(ImGui::MenuItem("Save Profiling Trace"))
+				{
+					// Open it in chrome://tracing or ui.perfetto.dev.
+					if(Core::Profiler::WriteChromeTrace("ProfilingTrace.json"))
+						Info("Profiling trace written to ProfilingTrace.json");
+					else
+						Error("Failed to write the profiling trace");
+				}
 				if(ImGui::MenuItem("Exit"))
 				{
 					app->Stop();
 				}
 				ImGui::EndMenu();
 			}
+			if(ImGui::BeginMenu("View"))
+			{
+				if(ImGui::MenuItem("Frame Statistics", nullptr, app->IsFrameStatsVisible()))
+					app->SetFrameStatsVisible(!app->IsFrameStatsVisible());
+				ImGui::EndMenu();
+			}
 		});
 
 	return app;
@@ -0,0 +1,87 @@
+#include "Core/FrameStats.h"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+using namespace Core::Profiler;
+
+TEST(FrameStatsTest, ComputeSummary_ShouldGiveTheNearestRankPercentiles)
+{
+	TimingHistory history;
+	EXPECT_EQ(history.ComputeSummary().SampleCount, 0);
+	EXPECT_EQ(history.GetLastSample(), 0.f);
+
+	// Shuffled 1 to 100 ms.
+	for(uint32_t iSample = 0; iSample < 100; ++iSample)
+		history.AddSample(static_cast<float>((iSample * 37) % 100 + 1));
+
+	const TimingSummary summary = history.ComputeSummary();
+	EXPECT_EQ(summary.SampleCount, 100);
+	EXPECT_FLOAT_EQ(summary.Mean, 50.5f);
+	EXPECT_EQ(summary.P50, 50.f);
+	EXPECT_EQ(summary.P95, 95.f);
+	EXPECT_EQ(summary.P99, 99.f);
+	EXPECT_EQ(summary.Max, 100.f);
+	EXPECT_EQ(history.GetLastSample(), static_cast<float>((99 * 37) % 100 + 1));
+}
+
+TEST(FrameStatsTest, AddSample_WhenTheHistoryIsFull_ShouldReplaceTheOldestSample)
+{
+	TimingHistory history;
+	for(uint32_t iSample = 0; iSample < FrameHistorySize; ++iSample)
+		history.AddSample(100.f);
+	for(uint32_t iSample = 0; iSample < FrameHistorySize / 2; ++iSample)
+		history.AddSample(1.f);
+
+	EXPECT_EQ(history.GetSampleCount(), FrameHistorySize);
+	EXPECT_EQ(history.GetSamples()[history.GetOldestIndex()], 100.f);
+	EXPECT_EQ(history.GetLastSample(), 1.f);
+	EXPECT_EQ(history.ComputeSummary().P50, 1.f);
+	EXPECT_EQ(history.ComputeSummary().P95, 100.f);
+
+	// The slowest frames are counted in the last bin.
+	std::array<float, 4> binCounts{};
+	history.ComputeHistogram(binCounts, 8.f);
+	EXPECT_EQ(binCounts[0], static_cast<float>(FrameHistorySize / 2));
+	EXPECT_EQ(binCounts[1], 0.f);
+	EXPECT_EQ(binCounts[3], static_cast<float>(FrameHistorySize / 2));
+
+	history.Clear();
+	EXPECT_EQ(history.GetSampleCount(), 0);
+}
+
+TEST(FrameStatsTest, WriteCsv_ShouldWriteARowPerSectionAndClock)
+{
+	FrameStats stats;
+	const uint32_t frame = stats.GetSectionIndex("Frame");
+	const uint32_t layer = stats.GetSectionIndex("Layer::OnRender");
+	EXPECT_EQ(stats.GetSectionIndex("Frame"), frame);
+	EXPECT_EQ(stats.GetSections().size(), 2);
+
+	for(uint32_t iFrame = 0; iFrame < 10; ++iFrame)
+	{
+		stats.AddCpuSample(frame, 16.f);
+		stats.AddCpuSample(layer, 2.f);
+		stats.AddGpuSample(layer, 1.f);
+	}
+	ASSERT_TRUE(stats.WriteCsv("FrameStats.csv"));
+
+	std::ifstream file("FrameStats.csv");
+	std::stringstream content;
+	content << file.rdbuf();
+	EXPECT_EQ(content.str(),
+		"Section,Clock,Samples,Mean (ms),P50 (ms),P95 (ms),P99 (ms),Max (ms)\n"
+		"\"Frame\",CPU,10,16.0000,16.0000,16.0000,16.0000,16.0000\n"
+		"\"Layer::OnRender\",CPU,10,2.0000,2.0000,2.0000,2.0000,2.0000\n"
+		"\"Layer::OnRender\",GPU,10,1.0000,1.0000,1.0000,1.0000,1.0000\n");
+
+	// The sections stay, their samples are dropped.
+	stats.Clear();
+	EXPECT_EQ(stats.GetSections().size(), 2);
+	EXPECT_EQ(stats.GetSections()[frame].Cpu.GetSampleCount(), 0);
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <GLFW/glfw3.h>
+#include <glad/gl.h>
+#include <gtest/gtest.h>
+
+namespace TestHelpers
+{
+/// @brief Base of the tests with a hidden window holding an OpenGL 4.5 context, skipped when none can be created.
+/// @note Headless machines can run them on Mesa's software rasterizer (llvmpipe), under a virtual display.
+class GLTestFixture : public ::testing::Test
+{
+protected:
+	static void SetUpTestSuite()
+	{
+		if(glfwInit() == GLFW_FALSE)
+			return;
+		glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+		glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
+		glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 5);
+		glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+		s_Window = glfwCreateWindow(16, 16, "GLTestFixture", nullptr, nullptr);
+		if(s_Window == nullptr)
+			return;
+		glfwMakeContextCurrent(s_Window);
+		if(gladLoadGL(glfwGetProcAddress) == 0)
+		{
+			glfwDestroyWindow(s_Window);
+			s_Window = nullptr;
+		}
+	}
+
+	static void TearDownTestSuite()
+	{
+		if(s_Window != nullptr)
+			glfwDestroyWindow(s_Window);
+		s_Window = nullptr;
+		glfwTerminate();
+	}
+
+	void SetUp() override
+	{
+		if(s_Window == nullptr)
+			GTEST_SKIP() << "No OpenGL 4.5 context available";
+	}
+
+	/// @brief Window of the context, null when none could be created.
+	static inline GLFWwindow* s_Window = nullptr;
+};
+} // namespace TestHelpers
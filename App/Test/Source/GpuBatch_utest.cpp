@@ -0,0 +1,166 @@
+#include "Application/GpuBatch.h"
+#include "Application/MeshBatch.h"
+#include "Application/MeshGenerator.h"
+#include "GLTestFixture.h"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <utility>
+#include <vector>
+
+using namespace Core::BaseType;
+using namespace Utilitary::Surface;
+using namespace Application;
+
+namespace
+{
+class GpuBatchTest : public TestHelpers::GLTestFixture
+{
+protected:
+	/// @brief Check that the start of a buffer holds the given values.
+	template<typename T>
+	static bool HasContent(const GLuint buffer, const std::span<const T> values)
+	{
+		std::vector<std::byte> content(values.size_bytes());
+		glGetNamedBufferSubData(buffer, 0, static_cast<GLsizeiptr>(content.size()), content.data());
+		return std::memcmp(content.data(), values.data(), content.size()) == 0;
+	}
+
+	/// @brief Get a translation matrix.
+	static Mat4 CreateTranslation(const float x, const float y = 0.f)
+	{
+		Mat4 transform{ 1.f };
+		transform[3] = Vec4{ x, y, 0.f, 1.f };
+		return transform;
+	}
+
+	/// @brief Compile a program placing the vertices in clip space with the transform of their instance.
+	/// @return The program, 0 when the context lacks ARB_shader_draw_parameters (gl_BaseInstance before GLSL 4.60).
+	static GLuint CreateInstanceProgram()
+	{
+		const char* vertexSource = R"(#version 450 core
+			#extension GL_ARB_shader_draw_parameters : require
+			layout(location = 0) in vec3 a_Position;
+			layout(std430, binding = 0) readonly buffer InstanceTransforms { mat4 u_Transforms[]; };
+			void main() { gl_Position = u_Transforms[gl_BaseInstanceARB + gl_InstanceID] * vec4(a_Position, 1.0); })";
+		const char* fragmentSource = R"(#version 450 core
+			layout(location = 0) out vec4 fragColor;
+			void main() { fragColor = vec4(1.0); })";
+
+		const GLuint program = glCreateProgram();
+		for(const auto& [type, source] : { std::pair{ GL_VERTEX_SHADER, vertexSource },
+				 std::pair{ GL_FRAGMENT_SHADER, fragmentSource } })
+		{
+			const GLuint shader = glCreateShader(type);
+			glShaderSource(shader, 1, &source, nullptr);
+			glCompileShader(shader);
+			glAttachShader(program, shader);
+			glDeleteShader(shader);
+		}
+		glLinkProgram(program);
+		GLint isLinked = GL_FALSE;
+		glGetProgramiv(program, GL_LINK_STATUS, &isLinked);
+		if(isLinked == GL_FALSE)
+		{
+			glDeleteProgram(program);
+			return 0;
+		}
+		return program;
+	}
+};
+} // namespace
+
+TEST_F(GpuBatchTest, Update_ShouldUploadTheCommandsAndTheTransforms)
+{
+	MeshBatch batch;
+	batch.AddPart(*MeshGenerator::CreateIcosphere(1));
+	batch.AddPart(*MeshGenerator::CreateTorus(8, 4));
+	for(uint32_t iInstance = 0; iInstance < 3 * MeshBatch::InstanceChunkSize; ++iInstance)
+		batch.AddInstance(iInstance % 2, CreateTranslation(static_cast<float>(iInstance)));
+
+	GpuBatch gpuBatch;
+	gpuBatch.Update(batch);
+	EXPECT_TRUE(HasContent(gpuBatch.GetCommandBuffer(), batch.GetCommands()));
+	EXPECT_TRUE(HasContent(gpuBatch.GetTransformBuffer(), batch.GetTransforms()));
+	EXPECT_EQ(glGetError(), static_cast<GLenum>(GL_NO_ERROR));
+
+	// Nothing changed, nothing uploaded.
+	gpuBatch.Update(batch);
+	EXPECT_EQ(gpuBatch.GetUploadedSize(), 0);
+}
+
+TEST_F(GpuBatchTest, Update_ShouldOnlyUploadTheChangedChunks)
+{
+	MeshBatch batch;
+	batch.AddPart(*MeshGenerator::CreateIcosphere(1));
+	for(uint32_t iInstance = 0; iInstance < 4 * MeshBatch::InstanceChunkSize; ++iInstance)
+		batch.AddInstance(0, CreateTranslation(static_cast<float>(iInstance)));
+	GpuBatch gpuBatch;
+	gpuBatch.Update(batch);
+
+	// One chunk of commands and transforms.
+	batch.SetTransform(2 * MeshBatch::InstanceChunkSize + 5, CreateTranslation(-1.f));
+	batch.SetVisible(2 * MeshBatch::InstanceChunkSize + 6, false);
+	gpuBatch.Update(batch);
+	EXPECT_EQ(gpuBatch.GetUploadedSize(),
+		MeshBatch::InstanceChunkSize * (sizeof(DrawElementsIndirectCommand) + sizeof(Mat4)));
+	EXPECT_TRUE(HasContent(gpuBatch.GetCommandBuffer(), batch.GetCommands()));
+	EXPECT_TRUE(HasContent(gpuBatch.GetTransformBuffer(), batch.GetTransforms()));
+
+	// The new part and the new instance are appended.
+	batch.AddInstance(batch.AddPart(*MeshGenerator::CreateIcosphere(0)), CreateTranslation(-2.f));
+	gpuBatch.Update(batch);
+	EXPECT_TRUE(HasContent(gpuBatch.GetCommandBuffer(), batch.GetCommands()));
+	EXPECT_TRUE(HasContent(gpuBatch.GetTransformBuffer(), batch.GetTransforms()));
+	EXPECT_EQ(glGetError(), static_cast<GLenum>(GL_NO_ERROR));
+}
+
+TEST_F(GpuBatchTest, Draw_ShouldPlaceEachVisibleInstance)
+{
+	const GLuint program = CreateInstanceProgram();
+	if(program == 0)
+		GTEST_SKIP() << "No ARB_shader_draw_parameters";
+
+	// Unit squares on three quarters of the clip space, the top left one hidden.
+	MeshBatch batch;
+	batch.AddPart(*MeshGenerator::CreateIcosphere(0));
+	const uint32_t square = batch.AddPart(*MeshGenerator::CreateGrid(1, 1));
+	batch.AddInstance(square, CreateTranslation(-1.f, -1.f));
+	batch.AddInstance(square, CreateTranslation(0.f, 0.f));
+	batch.SetVisible(batch.AddInstance(square, CreateTranslation(-1.f, 0.f)), false);
+	GpuBatch gpuBatch;
+	gpuBatch.Update(batch);
+
+	constexpr GLsizei size = 8;
+	GLuint texture = 0;
+	GLuint framebuffer = 0;
+	glCreateTextures(GL_TEXTURE_2D, 1, &texture);
+	glTextureStorage2D(texture, 1, GL_R8, size, size);
+	glCreateFramebuffers(1, &framebuffer);
+	glNamedFramebufferTexture(framebuffer, GL_COLOR_ATTACHMENT0, texture, 0);
+	glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+	glViewport(0, 0, size, size);
+	glClearColor(0.f, 0.f, 0.f, 0.f);
+	glClear(GL_COLOR_BUFFER_BIT);
+	glUseProgram(program);
+	gpuBatch.Draw();
+
+	std::vector<uint8_t> pixels(size * size);
+	glReadPixels(0, 0, size, size, GL_RED, GL_UNSIGNED_BYTE, pixels.data());
+	auto isCovered = [&](const int x, const int y) { return pixels[y * size + x] != 0; };
+	EXPECT_TRUE(isCovered(2, 2));
+	EXPECT_TRUE(isCovered(6, 6));
+	EXPECT_FALSE(isCovered(2, 6));
+	EXPECT_FALSE(isCovered(6, 2));
+	EXPECT_EQ(glGetError(), static_cast<GLenum>(GL_NO_ERROR));
+
+	glUseProgram(0);
+	glBindFramebuffer(GL_FRAMEBUFFER, 0);
+	glDeleteFramebuffers(1, &framebuffer);
+	glDeleteTextures(1, &texture);
+	glDeleteProgram(program);
+}
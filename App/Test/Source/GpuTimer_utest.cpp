@@ -0,0 +1,50 @@
+#include "Core/Renderer/GpuTimer.h"
+#include "GLTestFixture.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+using namespace Renderer;
+
+namespace
+{
+class GpuTimerTest : public TestHelpers::GLTestFixture
+{
+};
+} // namespace
+
+TEST_F(GpuTimerTest, EndFrame_ShouldGiveTheTimesOfAFrameFrameLatencyMinusOneFramesLater)
+{
+	GpuTimer timer(2);
+	GLuint buffer = 0;
+	glCreateBuffers(1, &buffer);
+	glNamedBufferStorage(buffer, 1 << 20, nullptr, 0);
+
+	// The sections 0 and 1 are nested, the section 2 is out of range.
+	timer.Begin(0);
+	timer.Begin(1);
+	glClearNamedBufferData(buffer, GL_R32UI, GL_RED_INTEGER, GL_UNSIGNED_INT, nullptr);
+	timer.End(1);
+	timer.Begin(2);
+	timer.End(2);
+	timer.End(0);
+	for(uint32_t iFrame = 0; iFrame + 1 < GpuTimer::FrameLatency; ++iFrame)
+		EXPECT_TRUE(timer.EndFrame().empty());
+
+	glFinish();
+	const std::span<const GpuSectionTime> frameTimes = timer.EndFrame();
+	const std::vector<GpuSectionTime> times(frameTimes.begin(), frameTimes.end());
+	ASSERT_EQ(times.size(), 2);
+	EXPECT_EQ(times[0].Section, 1);
+	EXPECT_EQ(times[1].Section, 0);
+	EXPECT_GE(times[0].Milliseconds, 0.f);
+	EXPECT_GE(times[1].Milliseconds, times[0].Milliseconds);
+
+	// The queries are reused by the next frames.
+	EXPECT_TRUE(timer.EndFrame().empty());
+	EXPECT_EQ(glGetError(), static_cast<GLenum>(GL_NO_ERROR));
+	glDeleteBuffers(1, &buffer);
+}
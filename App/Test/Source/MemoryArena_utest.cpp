@@ -0,0 +1,143 @@
+#include "Core/MemoryArena.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory_resource>
+#include <unordered_map>
+#include <vector>
+
+using namespace Core::Memory;
+
+namespace
+{
+/// @brief Upstream resource counting the blocks it gives.
+class CountingResource : public std::pmr::memory_resource
+{
+public:
+	size_t AllocationCount = 0;
+	size_t LiveAllocationCount = 0;
+
+private:
+	void* do_allocate(const size_t bytes, const size_t alignment) override
+	{
+		++AllocationCount;
+		++LiveAllocationCount;
+		return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+	}
+
+	void do_deallocate(void* ptr, const size_t bytes, const size_t alignment) override
+	{
+		--LiveAllocationCount;
+		std::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment);
+	}
+
+	bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+};
+
+/// @brief Make allocations of the given size in the arena.
+void AllocateRepeatedly(MonotonicArena& arena, const int allocationCount, const size_t bytes)
+{
+	for(int iAllocation = 0; iAllocation < allocationCount; ++iAllocation)
+		EXPECT_NE(arena.allocate(bytes), nullptr);
+}
+} // namespace
+
+TEST(MemoryArenaTest, Allocate_ShouldRespectAlignmentAndGrow)
+{
+	CountingResource upstream;
+	{
+		MonotonicArena arena(256, &upstream);
+		EXPECT_EQ(arena.GetBlockCount(), 0);
+
+		for(const size_t alignment : { 1, 4, 16, 64 })
+		{
+			void* ptr = arena.allocate(3, alignment);
+			EXPECT_EQ(reinterpret_cast<uintptr_t>(ptr) % alignment, 0);
+		}
+		EXPECT_EQ(arena.GetBlockCount(), 1);
+
+		// An allocation larger than the next block gets its own block.
+		AllocateRepeatedly(arena, 1, 4096);
+		EXPECT_EQ(arena.GetBlockCount(), 2);
+		EXPECT_GE(arena.GetCapacity(), 256 + 4096);
+		EXPECT_EQ(upstream.LiveAllocationCount, 2);
+	}
+	EXPECT_EQ(upstream.LiveAllocationCount, 0);
+}
+
+TEST(MemoryArenaTest, Rewind_ShouldReuseTheBlocks)
+{
+	CountingResource upstream;
+	MonotonicArena arena(1024, &upstream);
+	void* firstPtr = arena.allocate(100);
+
+	const MonotonicArena::Marker marker = arena.GetMarker();
+	void* secondPtr = arena.allocate(100);
+	AllocateRepeatedly(arena, 100, 100);
+	const size_t allocationCount = upstream.AllocationCount;
+
+	// The same allocations after a rewind take the same addresses without touching the upstream resource.
+	arena.Rewind(marker);
+	EXPECT_EQ(arena.allocate(100), secondPtr);
+	AllocateRepeatedly(arena, 100, 100);
+	EXPECT_EQ(upstream.AllocationCount, allocationCount);
+	EXPECT_NE(firstPtr, secondPtr);
+
+	// The reset merges the blocks into a single one fitting all the allocations.
+	const size_t capacity = arena.GetCapacity();
+	arena.Reset();
+	EXPECT_EQ(arena.GetBlockCount(), 1);
+	EXPECT_EQ(arena.GetCapacity(), capacity);
+	AllocateRepeatedly(arena, 102, 100);
+	EXPECT_EQ(arena.GetBlockCount(), 1);
+
+	arena.Release();
+	EXPECT_EQ(arena.GetBlockCount(), 0);
+	EXPECT_EQ(upstream.LiveAllocationCount, 0);
+}
+
+TEST(MemoryArenaTest, ScratchScope_ShouldFreeItsAllocationsAtTheEnd)
+{
+	MonotonicArena& arena = GetThreadScratchArena();
+	{
+		const ScratchScope outerScope;
+		std::pmr::vector<int> outerValues({ 1, 2, 3 }, outerScope.GetResource());
+		const MonotonicArena::Marker outerMarker = arena.GetMarker();
+		{
+			const ScratchScope innerScope;
+			std::pmr::unordered_map<int, int> innerMap(innerScope.GetResource());
+			for(int iValue = 0; iValue < 1000; ++iValue)
+				innerMap[iValue] = iValue;
+			EXPECT_EQ(innerMap.size(), 1000);
+		}
+
+		// The inner scope gives its memory back, the outer allocations being kept.
+		const MonotonicArena::Marker marker = arena.GetMarker();
+		EXPECT_EQ(marker.BlockIdx, outerMarker.BlockIdx);
+		EXPECT_EQ(marker.Offset, outerMarker.Offset);
+		EXPECT_EQ(outerValues, std::pmr::vector<int>({ 1, 2, 3 }));
+	}
+
+	// The outermost scope leaves the arena empty, in a single block.
+	EXPECT_EQ(arena.GetMarker().Offset, 0);
+	EXPECT_EQ(arena.GetBlockCount(), 1);
+}
+
+TEST(MemoryArenaTest, ScratchScope_WhenTheArenaGrewPastTheMaxCapacity_ShouldReleaseIt)
+{
+	MonotonicArena& arena = GetThreadScratchArena();
+	{
+		const ScratchScope scope;
+		EXPECT_NE(scope.GetResource()->allocate(MaxScratchCapacity + 1), nullptr);
+	}
+	EXPECT_EQ(arena.GetBlockCount(), 0);
+
+	// The growth starts again from the first block size.
+	{
+		const ScratchScope scope;
+		EXPECT_NE(scope.GetResource()->allocate(64), nullptr);
+	}
+	EXPECT_EQ(arena.GetBlockCount(), 1);
+	EXPECT_EQ(arena.GetCapacity(), DefaultArenaBlockSize);
+}
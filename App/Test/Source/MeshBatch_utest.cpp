@@ -0,0 +1,161 @@
+#include "Application/Mesh.h"
+#include "Application/MeshBatch.h"
+#include "Application/MeshGenerator.h"
+#include "Core/Parallel.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
+using namespace Core::BaseType;
+using namespace Utilitary::Surface;
+using namespace Data::Surface;
+
+namespace
+{
+/// @brief Get a translation matrix.
+Mat4 CreateTranslation(const float x)
+{
+	Mat4 transform{ 1.f };
+	transform[3] = Vec4{ x, 0.f, 0.f, 1.f };
+	return transform;
+}
+
+/// @brief Regenerate the changed commands of a batch, and get the chunks regenerated.
+std::vector<uint32_t> UpdateCommands(MeshBatch& batch)
+{
+	const std::span<const uint32_t> updatedChunks = batch.UpdateCommands();
+	return { updatedChunks.begin(), updatedChunks.end() };
+}
+} // namespace
+
+TEST(MeshBatchTest, AddPart_ShouldPackThePartsOneAfterTheOther)
+{
+	const std::unique_ptr<Mesh> grid = MeshGenerator::CreateGrid(2, 3);
+	const std::unique_ptr<Mesh> sphere = MeshGenerator::CreateIcosphere(1);
+	MeshBatch batch;
+	EXPECT_EQ(batch.AddPart(*grid), 0);
+	EXPECT_EQ(batch.AddPart(*sphere), 1);
+
+	ASSERT_EQ(batch.GetParts().size(), 2);
+	const BatchPart& gridPart = batch.GetParts()[0];
+	const BatchPart& spherePart = batch.GetParts()[1];
+	EXPECT_EQ(gridPart.FirstIndex, 0);
+	EXPECT_EQ(gridPart.IndexCount, 3 * grid->GetTriangleCount());
+	EXPECT_EQ(gridPart.BaseVertex, 0);
+	EXPECT_EQ(gridPart.VertexCount, grid->GetVertexCount());
+	EXPECT_EQ(spherePart.FirstIndex, gridPart.IndexCount);
+	EXPECT_EQ(spherePart.IndexCount, 3 * sphere->GetTriangleCount());
+	EXPECT_EQ(spherePart.BaseVertex, static_cast<int32_t>(gridPart.VertexCount));
+	EXPECT_EQ(batch.GetVertices().size(), grid->GetVertexCount() + sphere->GetVertexCount());
+	EXPECT_EQ(batch.GetIndices().size(), gridPart.IndexCount + spherePart.IndexCount);
+
+	// The indices stay relative to the first vertex of their part.
+	for(TriangleIndex iTriangle = 0; iTriangle < sphere->GetTriangleCount(); ++iTriangle)
+	{
+		for(uint32_t iCorner = 0; iCorner < 3; ++iCorner)
+		{
+			const uint32_t index = batch.GetIndices()[spherePart.FirstIndex + 3 * iTriangle + iCorner];
+			const VertexIndex iVertex = sphere->GetTriangleData(iTriangle).Vertices[iCorner];
+			EXPECT_EQ(batch.GetVertices()[spherePart.BaseVertex + index].Position,
+				sphere->GetVertexData(iVertex).Position);
+		}
+	}
+}
+
+TEST(MeshBatchTest, UpdateCommands_ShouldDrawEachInstanceFromItsSlot)
+{
+	MeshBatch batch;
+	batch.AddPart(*MeshGenerator::CreateGrid(1, 1));
+	batch.AddPart(*MeshGenerator::CreateIcosphere(0));
+	EXPECT_EQ(batch.AddInstance(1, CreateTranslation(1.f)), 0);
+	EXPECT_EQ(batch.AddInstance(0, CreateTranslation(2.f)), 1);
+	EXPECT_EQ(batch.AddInstance(1, CreateTranslation(3.f)), 2);
+	batch.SetVisible(1, false);
+
+	EXPECT_EQ(UpdateCommands(batch), std::vector<uint32_t>({ 0 }));
+	ASSERT_EQ(batch.GetCommands().size(), 3);
+	const BatchPart& spherePart = batch.GetParts()[1];
+	for(const uint32_t iSlot : { 0u, 2u })
+	{
+		const DrawElementsIndirectCommand& command = batch.GetCommands()[iSlot];
+		EXPECT_EQ(command.Count, spherePart.IndexCount);
+		EXPECT_EQ(command.InstanceCount, 1);
+		EXPECT_EQ(command.FirstIndex, spherePart.FirstIndex);
+		EXPECT_EQ(command.BaseVertex, spherePart.BaseVertex);
+		EXPECT_EQ(command.BaseInstance, iSlot);
+		EXPECT_EQ(batch.GetTransforms()[iSlot], CreateTranslation(static_cast<float>(iSlot + 1)));
+	}
+	EXPECT_EQ(batch.GetCommands()[1].Count, 6);
+	EXPECT_EQ(batch.GetCommands()[1].InstanceCount, 0);
+
+	// A removed instance draws nothing, and its slot is the next one used.
+	batch.RemoveInstance(0);
+	batch.UpdateCommands();
+	EXPECT_EQ(batch.GetCommands()[0].Count, 0);
+	EXPECT_EQ(batch.GetCommands()[0].InstanceCount, 0);
+	EXPECT_EQ(batch.GetInstanceCount(), 2);
+	EXPECT_EQ(batch.AddInstance(0, CreateTranslation(4.f)), 0);
+	EXPECT_EQ(batch.GetSlotCount(), 3);
+}
+
+TEST(MeshBatchTest, UpdateCommands_ShouldOnlyRegenerateTheChangedChunks)
+{
+	MeshBatch batch;
+	batch.AddPart(*MeshGenerator::CreateIcosphere(0));
+	const uint32_t instanceCount = 5 * MeshBatch::InstanceChunkSize + 10;
+	for(uint32_t iInstance = 0; iInstance < instanceCount; ++iInstance)
+		batch.AddInstance(0, CreateTranslation(static_cast<float>(iInstance)));
+	EXPECT_EQ(batch.GetChunkCount(), 6);
+	EXPECT_EQ(batch.UpdateCommands().size(), 6);
+	EXPECT_TRUE(batch.UpdateCommands().empty());
+
+	// The chunks come back sorted, each one once.
+	batch.SetTransform(4 * MeshBatch::InstanceChunkSize + 3, CreateTranslation(-1.f));
+	batch.SetTransform(MeshBatch::InstanceChunkSize, CreateTranslation(-2.f));
+	batch.SetTransform(MeshBatch::InstanceChunkSize + 1, CreateTranslation(-3.f));
+	batch.SetVisible(instanceCount - 1, false);
+	EXPECT_EQ(UpdateCommands(batch), std::vector<uint32_t>({ 1, 4, 5 }));
+	EXPECT_EQ(batch.GetTransforms()[MeshBatch::InstanceChunkSize + 1], CreateTranslation(-3.f));
+	EXPECT_EQ(batch.GetTransforms()[4 * MeshBatch::InstanceChunkSize + 3], CreateTranslation(-1.f));
+	EXPECT_EQ(batch.GetCommands()[instanceCount - 1].InstanceCount, 0);
+
+	// Showing a visible instance changes nothing.
+	batch.SetVisible(0, true);
+	EXPECT_TRUE(batch.UpdateCommands().empty());
+}
+
+TEST(MeshBatchTest, UpdateCommands_ShouldNotDependOnTheThreadCount)
+{
+	auto createCommands = [](const uint32_t threadCount)
+	{
+		Core::Parallel::SetThreadCount(threadCount);
+		MeshBatch batch;
+		batch.AddPart(*MeshGenerator::CreateIcosphere(0));
+		batch.AddPart(*MeshGenerator::CreateTorus(8, 4));
+		for(uint32_t iInstance = 0; iInstance < 20 * MeshBatch::InstanceChunkSize; ++iInstance)
+			batch.AddInstance(iInstance % 2, CreateTranslation(static_cast<float>(iInstance)));
+		for(uint32_t iInstance = 0; iInstance < batch.GetSlotCount(); iInstance += 3)
+			batch.SetVisible(iInstance, false);
+		batch.UpdateCommands();
+
+		std::vector<uint32_t> commandWords;
+		for(const DrawElementsIndirectCommand& command : batch.GetCommands())
+		{
+			commandWords.insert(commandWords.end(),
+				{ command.Count,
+					command.InstanceCount,
+					command.FirstIndex,
+					static_cast<uint32_t>(command.BaseVertex),
+					command.BaseInstance });
+		}
+		return commandWords;
+	};
+
+	const std::vector<uint32_t> reference = createCommands(1);
+	EXPECT_EQ(createCommands(4), reference);
+	Core::Parallel::SetThreadCount(0);
+}
@@ -0,0 +1,154 @@
+#include "Application/Mesh.h"
+#include "Application/MeshBoundary.h"
+#include "Application/MeshGenerator.h"
+#include "Application/TestHelpers.h"
+#include "Core/Parallel.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+using namespace Core::BaseType;
+using namespace Utilitary::Surface;
+using namespace Data::Surface;
+
+namespace
+{
+/// @brief Check that each loop edge is a boundary edge running to the first vertex of the next edge of its loop.
+void ExpectConsistentLoops(const Mesh& mesh, const BoundaryLoops& boundary)
+{
+	ASSERT_EQ(boundary.LoopVertices.size(), boundary.GetEdgeCount());
+	ASSERT_EQ(boundary.LoopTriangles.size(), boundary.GetEdgeCount());
+	ASSERT_EQ(boundary.LoopEdges.size(), boundary.GetEdgeCount());
+	for(uint32_t iLoop = 0; iLoop < boundary.GetLoopCount(); ++iLoop)
+	{
+		const uint32_t loopBegin = boundary.LoopOffsets[iLoop];
+		const uint32_t loopEnd = boundary.LoopOffsets[iLoop + 1];
+		for(uint32_t iEdge = loopBegin; iEdge < loopEnd; ++iEdge)
+		{
+			const uint32_t nextEdge = iEdge + 1 < loopEnd ? iEdge + 1 : loopBegin;
+			const auto& triangle = mesh.GetTriangleData(boundary.LoopTriangles[iEdge]);
+			const EdgeIndex edgeIdx = boundary.LoopEdges[iEdge];
+			EXPECT_EQ(triangle.Neighbors[edgeIdx], -1);
+			EXPECT_EQ(triangle.Vertices[IndexHelpers::Next[edgeIdx]], boundary.LoopVertices[iEdge]);
+			EXPECT_EQ(triangle.Vertices[IndexHelpers::Previous[edgeIdx]], boundary.LoopVertices[nextEdge]);
+			EXPECT_TRUE(boundary.IsBoundaryVertex(boundary.LoopVertices[iEdge]));
+		}
+	}
+}
+} // namespace
+
+TEST(MeshBoundaryTest, ExtractBoundaryLoops_OnClosedMesh_ShouldBeEmpty)
+{
+	const std::unique_ptr<Mesh> mesh = MeshGenerator::CreateTorus(20, 10);
+
+	const BoundaryLoops boundary = MeshBoundary::ExtractBoundaryLoops(*mesh);
+
+	EXPECT_EQ(boundary.GetLoopCount(), 0);
+	EXPECT_EQ(boundary.GetEdgeCount(), 0);
+	EXPECT_EQ(boundary.VertexFlags.GetSize(), mesh->GetVertexCount());
+	EXPECT_EQ(boundary.VertexFlags.Count(), 0);
+}
+
+TEST(MeshBoundaryTest, ExtractBoundaryLoops_ShouldFollowTrianglesDirection)
+{
+	const Mesh mesh = TestHelpers::CreateValidMesh();
+
+	const BoundaryLoops boundary = MeshBoundary::ExtractBoundaryLoops(mesh);
+
+	ASSERT_EQ(boundary.GetLoopCount(), 1);
+	EXPECT_EQ(boundary.LoopVertices, (std::vector<VertexIndex>{ 1, 2, 3, 0 }));
+	EXPECT_EQ(boundary.LoopTriangles, (std::vector<TriangleIndex>{ 0, 1, 1, 0 }));
+	EXPECT_EQ(boundary.LoopEdges, (std::vector<EdgeIndex>{ 0, 0, 1, 2 }));
+	EXPECT_EQ(boundary.VertexFlags.Count(), 4);
+	ExpectConsistentLoops(mesh, boundary);
+}
+
+TEST(MeshBoundaryTest, ExtractBoundaryLoops_ShouldSeparateOuterBoundaryAndHoles)
+{
+	std::unique_ptr<Mesh> mesh = MeshGenerator::CreateGrid(6, 8);
+
+	// Remove the star of two vertices far from each other and from the grid sides.
+	mesh->DeleteVertex(20);
+	mesh->DeleteVertex(42);
+
+	const BoundaryLoops boundary = MeshBoundary::ExtractBoundaryLoops(*mesh);
+
+	ASSERT_EQ(boundary.GetLoopCount(), 3);
+	EXPECT_EQ(boundary.GetLoopVertices(0).size(), 28);
+	EXPECT_EQ(boundary.GetLoopVertices(1).size(), 6);
+	EXPECT_EQ(boundary.GetLoopVertices(2).size(), 6);
+	EXPECT_FALSE(boundary.IsBoundaryVertex(20));
+	EXPECT_FALSE(boundary.IsBoundaryVertex(42));
+	EXPECT_EQ(boundary.VertexFlags.Count(), 28 + 6 + 6);
+	ExpectConsistentLoops(*mesh, boundary);
+}
+
+TEST(MeshBoundaryTest, ExtractBoundaryLoops_ShouldSplitLoopsAtNonManifoldVertex)
+{
+	Mesh mesh = TestHelpers::CreateBowtieMesh();
+
+	const BoundaryLoops boundary = MeshBoundary::ExtractBoundaryLoops(mesh);
+
+	ASSERT_EQ(boundary.GetLoopCount(), 2);
+	EXPECT_EQ(boundary.GetLoopTriangles(0).front(), 0);
+	EXPECT_EQ(boundary.GetLoopTriangles(1).front(), 1);
+	EXPECT_EQ(boundary.GetLoopVertices(0).size(), 3);
+	EXPECT_EQ(boundary.GetLoopVertices(1).size(), 3);
+	ExpectConsistentLoops(mesh, boundary);
+}
+
+TEST(MeshBoundaryTest, GetBoundaryLoops_ShouldBeCachedUntilTopologyChanges)
+{
+	std::unique_ptr<Mesh> mesh = MeshGenerator::CreateIcosphere(2);
+
+	const auto closedBoundary = mesh->GetBoundaryLoops();
+	EXPECT_EQ(mesh->GetBoundaryLoops(), closedBoundary);
+	EXPECT_EQ(closedBoundary->GetLoopCount(), 0);
+
+	// Moving a vertex keeps the topology.
+	mesh->GetVertexData(0).Position *= 2.f;
+	EXPECT_EQ(mesh->GetBoundaryLoops(), closedBoundary);
+
+	const uint64_t revision = mesh->GetTopologyRevision();
+	mesh->DeleteTriangle(10);
+	EXPECT_GT(mesh->GetTopologyRevision(), revision);
+
+	const auto openBoundary = mesh->GetBoundaryLoops();
+	EXPECT_NE(openBoundary, closedBoundary);
+	EXPECT_EQ(openBoundary->GetLoopCount(), 1);
+	EXPECT_EQ(closedBoundary->GetLoopCount(), 0);
+
+	// The copies share the cached loops, the direct edits must be notified.
+	const Mesh copiedMesh(*mesh);
+	EXPECT_EQ(copiedMesh.GetBoundaryLoops(), openBoundary);
+	mesh->NotifyTopologyChanged();
+	EXPECT_NE(mesh->GetBoundaryLoops(), openBoundary);
+
+	mesh->GarbageCollect();
+	const auto collectedBoundary = mesh->GetBoundaryLoops();
+	EXPECT_EQ(collectedBoundary->VertexFlags.GetSize(), mesh->GetVertexCount());
+	EXPECT_EQ(collectedBoundary->GetEdgeCount(), 3);
+	ExpectConsistentLoops(*mesh, *collectedBoundary);
+}
+
+TEST(MeshBoundaryTest, ExtractBoundaryLoops_ShouldNotDependOnThreadCount)
+{
+	std::unique_ptr<Mesh> mesh = MeshGenerator::CreateTorus(120, 60);
+	for(TriangleIndex iTriangle = 3; iTriangle < mesh->GetTriangleCount(); iTriangle += 97)
+		mesh->DeleteTriangle(iTriangle);
+
+	Core::Parallel::SetThreadCount(1);
+	const BoundaryLoops serialBoundary = MeshBoundary::ExtractBoundaryLoops(*mesh);
+	Core::Parallel::SetThreadCount(4);
+	const BoundaryLoops parallelBoundary = MeshBoundary::ExtractBoundaryLoops(*mesh);
+	Core::Parallel::SetThreadCount(0);
+
+	EXPECT_GT(serialBoundary.GetLoopCount(), 1);
+	EXPECT_EQ(parallelBoundary.VertexFlags, serialBoundary.VertexFlags);
+	EXPECT_EQ(parallelBoundary.LoopOffsets, serialBoundary.LoopOffsets);
+	EXPECT_EQ(parallelBoundary.LoopVertices, serialBoundary.LoopVertices);
+	EXPECT_EQ(parallelBoundary.LoopTriangles, serialBoundary.LoopTriangles);
+	ExpectConsistentLoops(*mesh, serialBoundary);
+}
@@ -1,8 +1,14 @@
 #include "Application/Mesh.h"
+#include "Application/MeshBoundary.h"
 #include "Application/TestHelpers.h"
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <iterator>
+#include <ranges>
+#include <vector>
+
 using namespace Core::BaseType;
 using namespace Utilitary::Surface;
 using namespace Data::Surface;
@@ -129,3 +135,109 @@ TEST(MeshCirculatorTest, GetFacesAroundVertex_CirculatorWithClosedRing_ShouldIte
 	std::vector<TriangleIndex> expectedFaces = { 0, 3, 6, 7, 4, 1 };
 	EXPECT_EQ(collectedFaces, expectedFaces);
 }
+
+static_assert(std::ranges::forward_range<VerticesAroundVertexView>);
+static_assert(std::ranges::view<TrianglesAroundVertexView>);
+static_assert(std::ranges::borrowed_range<TrianglesAroundVertexView>);
+
+namespace
+{
+/// @brief Check that the views visit the one-ring of every vertex in the order of the circulators.
+void ExpectViewsMatchCirculators(const Mesh& mesh)
+{
+	for(VertexIndex iVertex = 0; iVertex < mesh.GetVertexCount(); ++iVertex)
+	{
+		if(mesh.IsVertexDeleted(iVertex) || mesh.GetVertexData(iVertex).IncidentTriangleIdx == -1)
+			continue;
+
+		const auto vertexRange = mesh.GetVerticesAroundVertex(iVertex);
+		std::vector<VertexIndex> expectedVertices;
+		std::copy(vertexRange.begin(), vertexRange.end(), std::back_inserter(expectedVertices));
+		std::vector<VertexIndex> collectedVertices;
+		std::ranges::copy(mesh.GetVerticesAroundVertexView(iVertex), std::back_inserter(collectedVertices));
+		ASSERT_EQ(collectedVertices, expectedVertices) << "Vertex " << iVertex;
+
+		const auto triangleRange = mesh.GetTrianglesAroundVertex(iVertex);
+		std::vector<TriangleIndex> expectedTriangles;
+		std::copy(triangleRange.begin(), triangleRange.end(), std::back_inserter(expectedTriangles));
+		std::vector<TriangleIndex> collectedTriangles;
+		std::ranges::copy(mesh.GetTrianglesAroundVertexView(iVertex), std::back_inserter(collectedTriangles));
+		ASSERT_EQ(collectedTriangles, expectedTriangles) << "Vertex " << iVertex;
+	}
+}
+} // namespace
+
+TEST(MeshCirculatorTest, AroundVertexViews_ShouldIterateInCirculatorOrder)
+{
+	Mesh triangle;
+	triangle.AddVertex({ .Position = { 0., 0., 0. }, .IncidentTriangleIdx = 0 });
+	triangle.AddVertex({ .Position = { 1., 0., 0. }, .IncidentTriangleIdx = 0 });
+	triangle.AddVertex({ .Position = { 1., 1., 0. }, .IncidentTriangleIdx = 0 });
+	triangle.AddTriangle({ .Vertices = { 0, 1, 2 } });
+	ExpectViewsMatchCirculators(triangle);
+
+	ExpectViewsMatchCirculators(TestHelpers::CreateGridMesh(4, 5));
+
+	// The holes leave fans whose incident triangle is in the middle, the walk goes back to it at the boundary.
+	Mesh torus = TestHelpers::CreateTorusMesh(24, 12);
+	for(TriangleIndex iTriangle = 5; iTriangle < torus.GetTriangleCount(); iTriangle += 13)
+		torus.DeleteTriangle(iTriangle);
+	ExpectViewsMatchCirculators(torus);
+}
+
+TEST(MeshCirculatorTest, AroundVertexViews_ShouldComposeWithRangeAdaptors)
+{
+	const Mesh mesh = TestHelpers::CreateGridMesh(2, 2);
+
+	// Vertex 4 is the center of the grid, with a closed one-ring.
+	std::vector<VertexIndex> doubledVertices;
+	std::ranges::copy(
+		mesh.GetVerticesAroundVertexView(4) | std::views::transform([](VertexIndex index) { return 2 * index; }),
+		std::back_inserter(doubledVertices));
+	std::vector<VertexIndex> expectedVertices;
+	for(VertexIndex vertexIdx : mesh.GetVerticesAroundVertex(4))
+		expectedVertices.push_back(2 * vertexIdx);
+	EXPECT_EQ(doubledVertices, expectedVertices);
+
+	size_t triangleCount = 0;
+	std::ranges::for_each(mesh.GetTrianglesAroundVertexView(4), [&](TriangleIndex) { ++triangleCount; });
+	EXPECT_EQ(triangleCount, 6);
+	EXPECT_EQ(std::ranges::distance(mesh.GetTrianglesAroundVertexView(4) | std::views::take(2)), 2);
+	EXPECT_TRUE(std::ranges::empty(TrianglesAroundVertexView()));
+}
+
+TEST(MeshCirculatorTest, UpdateBoundaryIncidentTriangles_ShouldWalkBoundaryFansInOneSweep)
+{
+	Mesh mesh = TestHelpers::CreateGridMesh(3, 3);
+	const auto boundaryLoops = mesh.GetBoundaryLoops();
+	std::vector<std::vector<TriangleIndex>> fans(mesh.GetVertexCount());
+	for(VertexIndex iVertex = 0; iVertex < mesh.GetVertexCount(); ++iVertex)
+		std::ranges::copy(mesh.GetTrianglesAroundVertexView(iVertex), std::back_inserter(fans[iVertex]));
+
+	mesh.UpdateBoundaryIncidentTriangles();
+
+	for(VertexIndex iVertex = 0; iVertex < mesh.GetVertexCount(); ++iVertex)
+	{
+		std::vector<TriangleIndex> fan;
+		std::ranges::copy(mesh.GetTrianglesAroundVertexView(iVertex), std::back_inserter(fan));
+		if(!boundaryLoops->IsBoundaryVertex(iVertex))
+		{
+			EXPECT_EQ(fan, fans[iVertex]);
+			continue;
+		}
+
+		// The fan starts at the outgoing boundary edge and each triangle is adjacent to the previous one.
+		const Triangle& firstTriangle = mesh.GetTriangleData(fan.front());
+		const int localIdx = Utilitary::Primitive::GetVertexLocalIndex(firstTriangle, iVertex);
+		EXPECT_EQ(firstTriangle.Neighbors[IndexHelpers::Previous[localIdx]], -1);
+		for(size_t iTriangle = 1; iTriangle < fan.size(); ++iTriangle)
+		{
+			const auto& neighbors = mesh.GetTriangleData(fan[iTriangle - 1]).Neighbors;
+			EXPECT_NE(std::ranges::find(neighbors, static_cast<int>(fan[iTriangle])), neighbors.end());
+		}
+		std::ranges::sort(fan);
+		std::ranges::sort(fans[iVertex]);
+		EXPECT_EQ(fan, fans[iVertex]);
+	}
+	ExpectViewsMatchCirculators(mesh);
+}
@@ -0,0 +1,223 @@
+#include "Application/Mesh.h"
+#include "Application/MeshClusters.h"
+#include "Application/MeshGenerator.h"
+#include "Core/MathHelpers.h"
+#include "Core/Parallel.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include <vector>
+
+using namespace Core::BaseType;
+using namespace Core::Math::Geometry;
+using namespace Utilitary::Surface;
+using namespace Data::Surface;
+
+namespace
+{
+/// @brief View of a camera looking at the origin, with a 90 degrees field of view on a 1000 pixels high viewport.
+ClusterView CreateView(const Vec3& cameraPosition)
+{
+	ClusterView view;
+	view.CameraPosition = cameraPosition;
+	view.ViewProjection =
+		Perspective(glm::radians(90.f), 1.f, 0.1f, 1000.f) * LookAt(cameraPosition, Vec3{ 0.f }, Vec3{ 0.f, 1.f, 0.f });
+	view.ProjectionScale = 1000.f / (2.f * std::tan(glm::radians(45.f)));
+	return view;
+}
+} // namespace
+
+TEST(MeshClustersTest, BuildHierarchy_ShouldSplitEachLevelIntoBoundedClusters)
+{
+	std::unique_ptr<Mesh> mesh = MeshGenerator::CreateIcosphere(4);
+	mesh->UpdateMeshConnectivity();
+	const ClusterHierarchy hierarchy = MeshClusters::BuildHierarchy(*mesh, { .MinLevelTriangleCount = 500 });
+	EXPECT_EQ(hierarchy.CellsPerAxis, 8);
+	EXPECT_EQ(hierarchy.GetCellCount(), 512);
+	ASSERT_GE(hierarchy.Levels.size(), 3);
+	EXPECT_EQ(hierarchy.Levels[0].LevelMesh, mesh.get());
+
+	for(size_t iLevel = 0; iLevel < hierarchy.Levels.size(); ++iLevel)
+	{
+		const ClusterLevel& level = hierarchy.Levels[iLevel];
+		const Mesh& levelMesh = *level.LevelMesh;
+		if(iLevel > 0)
+		{
+			// Each level halves the triangles of the previous one down to the minimum, with a larger error.
+			const ClusterLevel& previousLevel = hierarchy.Levels[iLevel - 1];
+			EXPECT_LE(level.Triangles.size(), std::max<size_t>(previousLevel.Triangles.size() / 2, 500));
+			EXPECT_GT(level.Error, previousLevel.Error);
+		}
+
+		// The clusters cover every triangle once, in order.
+		std::vector<TriangleIndex> triangles = level.Triangles;
+		std::ranges::sort(triangles);
+		std::vector<TriangleIndex> expectedTriangles(levelMesh.GetTriangleCount());
+		std::iota(expectedTriangles.begin(), expectedTriangles.end(), 0);
+		EXPECT_EQ(triangles, expectedTriangles);
+		ASSERT_EQ(level.CellClusterOffsets.size(), hierarchy.GetCellCount() + 1);
+		EXPECT_EQ(level.CellClusterOffsets.back(), level.Clusters.size());
+
+		uint32_t nextTriangle = 0;
+		for(const MeshCluster& cluster : level.Clusters)
+		{
+			EXPECT_EQ(cluster.FirstTriangle, nextTriangle);
+			EXPECT_GT(cluster.TriangleCount, 0);
+			EXPECT_LE(cluster.TriangleCount, 128);
+			nextTriangle += cluster.TriangleCount;
+
+			// The sphere bounds the vertices and the cone holds the normals of the triangles.
+			for(uint32_t iPosition = cluster.FirstTriangle; iPosition < nextTriangle; ++iPosition)
+			{
+				const std::array<int, 3>& corners = levelMesh.GetTriangleData(level.Triangles[iPosition]).Vertices;
+				std::array<Vec3, 3> positions;
+				for(int iCorner = 0; iCorner < 3; ++iCorner)
+				{
+					positions[iCorner] = levelMesh.GetVertexData(corners[iCorner]).Position;
+					EXPECT_LE(Length(positions[iCorner] - cluster.Bounds.Center), cluster.Bounds.Radius + 1e-5f);
+				}
+				const Vec3 normal = Normalize(Cross(positions[1] - positions[0], positions[2] - positions[0]));
+				EXPECT_GE(Dot(normal, cluster.Cone.Axis), cluster.Cone.Cutoff - 1e-5f);
+			}
+			EXPECT_GT(cluster.Cone.Cutoff, 0.f);
+		}
+		EXPECT_EQ(nextTriangle, level.Triangles.size());
+
+		// The clusters stay in the sphere of their cell.
+		for(uint32_t iCell = 0; iCell < hierarchy.GetCellCount(); ++iCell)
+		{
+			const BoundingSphere& cellBounds = hierarchy.CellBounds[iCell];
+			for(uint32_t iCluster = level.CellClusterOffsets[iCell]; iCluster < level.CellClusterOffsets[iCell + 1];
+				++iCluster)
+			{
+				const BoundingSphere& bounds = level.Clusters[iCluster].Bounds;
+				EXPECT_LE(Length(bounds.Center - cellBounds.Center) + bounds.Radius, cellBounds.Radius + 1e-5f);
+			}
+		}
+	}
+}
+
+TEST(MeshClustersTest, IsSphereInFrustum_ShouldRejectTheSpheresOutsideAPlane)
+{
+	const ClusterView view = CreateView(Vec3{ 0.f, 0.f, 5.f });
+	const std::array<Vec4, 6> planes = MeshClusters::ExtractFrustumPlanes(view.ViewProjection);
+	for(const Vec4& plane : planes)
+		EXPECT_NEAR(Length(Vec3{ plane }), 1.f, 1e-5f);
+
+	EXPECT_TRUE(MeshClusters::IsSphereInFrustum(planes, { Vec3{ 0.f }, 1.f }));
+	EXPECT_TRUE(MeshClusters::IsSphereInFrustum(planes, { Vec3{ 0.f, 0.f, -900.f }, 1.f }));
+	EXPECT_FALSE(MeshClusters::IsSphereInFrustum(planes, { Vec3{ 0.f, 0.f, 10.f }, 1.f }));
+	EXPECT_FALSE(MeshClusters::IsSphereInFrustum(planes, { Vec3{ 0.f, 0.f, -1100.f }, 1.f }));
+
+	// The side planes pass through the camera at 45 degrees.
+	EXPECT_FALSE(MeshClusters::IsSphereInFrustum(planes, { Vec3{ 7.f, 0.f, 0.f }, 1.f }));
+	EXPECT_TRUE(MeshClusters::IsSphereInFrustum(planes, { Vec3{ 7.f, 0.f, 0.f }, 1.5f }));
+	EXPECT_FALSE(MeshClusters::IsSphereInFrustum(planes, { Vec3{ 0.f, -7.f, 0.f }, 1.f }));
+	EXPECT_FALSE(MeshClusters::IsSphereInFrustum(planes, BoundingSphere{}));
+}
+
+TEST(MeshClustersTest, IsBackfacing_ShouldWidenTheConeByTheSphere)
+{
+	const BoundingSphere sphere{ Vec3{ 0.f }, 1.f };
+	const NormalCone cone{ Vec3{ 0.f, 0.f, 1.f }, std::cos(glm::radians(30.f)) };
+	EXPECT_TRUE(MeshClusters::IsBackfacing(sphere, cone, Vec3{ 0.f, 0.f, -10.f }));
+	EXPECT_FALSE(MeshClusters::IsBackfacing(sphere, cone, Vec3{ 0.f, 0.f, 10.f }));
+	EXPECT_FALSE(MeshClusters::IsBackfacing(sphere, cone, Vec3{ 0.f, 0.f, -0.5f }));
+
+	// The sphere is seen under 30 degrees from a distance of 2, so the camera must be 60 degrees below the plane.
+	const auto cameraAt = [](const float degrees)
+	{ return 2.f * Vec3{ std::cos(glm::radians(degrees)), 0.f, -std::sin(glm::radians(degrees)) }; };
+	EXPECT_TRUE(MeshClusters::IsBackfacing(sphere, cone, cameraAt(61.f)));
+	EXPECT_FALSE(MeshClusters::IsBackfacing(sphere, cone, cameraAt(59.f)));
+
+	// From a distance of 20, under less than 3 degrees.
+	EXPECT_TRUE(MeshClusters::IsBackfacing(sphere, cone, 10.f * cameraAt(34.f)));
+	EXPECT_FALSE(MeshClusters::IsBackfacing(sphere, cone, 10.f * cameraAt(32.f)));
+
+	// Cones of half angle 90 degrees or more never cull.
+	EXPECT_FALSE(MeshClusters::IsBackfacing(sphere, NormalCone{ cone.Axis, 0.f }, Vec3{ 0.f, 0.f, -10.f }));
+}
+
+TEST(MeshClustersTest, SelectClusters_ShouldKeepTheTrianglesFacingTheCamera)
+{
+	std::unique_ptr<Mesh> mesh = MeshGenerator::CreateIcosphere(5);
+	mesh->UpdateMeshConnectivity();
+	const ClusterHierarchy hierarchy = MeshClusters::BuildHierarchy(*mesh, { .MaxLevelCount = 1 });
+	const ClusterLevel& level = hierarchy.Levels[0];
+
+	ClusterView view = CreateView(Vec3{ 0.f, 0.f, 3.f });
+	Core::Parallel::SetThreadCount(1);
+	const ClusterSelection sequentialSelection = MeshClusters::SelectClusters(hierarchy, view);
+	Core::Parallel::SetThreadCount(3);
+	const ClusterSelection selection = MeshClusters::SelectClusters(hierarchy, view);
+	Core::Parallel::SetThreadCount(0);
+	EXPECT_EQ(selection.VisibleClusters, sequentialSelection.VisibleClusters);
+	EXPECT_EQ(selection.BackfaceCulledCount, sequentialSelection.BackfaceCulledCount);
+
+	// About half the sphere faces the camera, the cells of the far side are tested and culled by their cones.
+	const std::vector<uint32_t>& visibleClusters = selection.VisibleClusters[0];
+	EXPECT_TRUE(std::ranges::is_sorted(visibleClusters));
+	EXPECT_EQ(
+		selection.GetVisibleClusterCount() + selection.FrustumCulledCount + selection.BackfaceCulledCount,
+		level.Clusters.size());
+	EXPECT_GT(selection.BackfaceCulledCount, level.Clusters.size() / 4);
+	EXPECT_LT(selection.GetVisibleClusterCount(), level.Clusters.size() * 3 / 4);
+
+	// Every triangle facing the camera belongs to a visible cluster.
+	std::vector<bool> isVisible(mesh->GetTriangleCount(), false);
+	for(const uint32_t iCluster : visibleClusters)
+	{
+		const MeshCluster& cluster = level.Clusters[iCluster];
+		for(uint32_t iPosition = cluster.FirstTriangle; iPosition < cluster.FirstTriangle + cluster.TriangleCount;
+			++iPosition)
+			isVisible[level.Triangles[iPosition]] = true;
+	}
+	for(TriangleIndex iTriangle = 0; iTriangle < mesh->GetTriangleCount(); ++iTriangle)
+	{
+		const std::array<int, 3>& corners = mesh->GetTriangleData(iTriangle).Vertices;
+		const Vec3& a = mesh->GetVertexData(corners[0]).Position;
+		const Vec3& b = mesh->GetVertexData(corners[1]).Position;
+		const Vec3& c = mesh->GetVertexData(corners[2]).Position;
+		if(Dot(Cross(b - a, c - a), view.CameraPosition - a) > 0.f)
+		{
+			EXPECT_TRUE(isVisible[iTriangle]) << "Triangle " << iTriangle;
+		}
+	}
+
+	// Without culling, every cluster is drawn.
+	view.FrustumCulling = false;
+	view.BackfaceCulling = false;
+	EXPECT_EQ(MeshClusters::SelectClusters(hierarchy, view).GetVisibleClusterCount(), level.Clusters.size());
+}
+
+TEST(MeshClustersTest, SelectClusters_ShouldCoarsenWithTheDistance)
+{
+	std::unique_ptr<Mesh> mesh = MeshGenerator::CreateIcosphere(4);
+	mesh->UpdateMeshConnectivity();
+	const ClusterHierarchy hierarchy =
+		MeshClusters::BuildHierarchy(*mesh, { .CellGridDepth = 2, .MinLevelTriangleCount = 500 });
+	ASSERT_GE(hierarchy.Levels.size(), 3);
+
+	// The first level is drawn up close, the coarsest one from far away.
+	ClusterView view = CreateView(Vec3{ 0.f, 0.f, 1.5f });
+	view.BackfaceCulling = false;
+	ClusterSelection selection = MeshClusters::SelectClusters(hierarchy, view);
+	EXPECT_FALSE(selection.VisibleClusters[0].empty());
+	EXPECT_TRUE(selection.VisibleClusters.back().empty());
+
+	view = CreateView(Vec3{ 0.f, 0.f, 900.f });
+	view.BackfaceCulling = false;
+	selection = MeshClusters::SelectClusters(hierarchy, view);
+	EXPECT_TRUE(selection.VisibleClusters[0].empty());
+	EXPECT_EQ(selection.VisibleClusters.back().size(), hierarchy.Levels.back().Clusters.size());
+
+	// Without projection scale, the first level is kept at any distance.
+	view.ProjectionScale = 0.f;
+	selection = MeshClusters::SelectClusters(hierarchy, view);
+	EXPECT_EQ(selection.VisibleClusters[0].size(), hierarchy.Levels[0].Clusters.size());
+}
@@ -0,0 +1,164 @@
+#include "Application/Mesh.h"
+#include "Application/MeshComponents.h"
+#include "Application/MeshGenerator.h"
+#include "Application/MeshIntegrity.h"
+#include "Application/MeshRepairer.h"
+#include "Application/TestHelpers.h"
+#include "Core/Parallel.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <utility>
+#include <vector>
+
+using namespace Core::BaseType;
+using namespace Utilitary::Surface;
+using namespace Data::Surface;
+
+namespace
+{
+/// @brief Check that two meshes have the same elements, stored in the same order.
+void ExpectSameElements(const Mesh& mesh, const Mesh& expectedMesh)
+{
+	ASSERT_EQ(mesh.GetVertexCount(), expectedMesh.GetVertexCount());
+	ASSERT_EQ(mesh.GetTriangleCount(), expectedMesh.GetTriangleCount());
+	for(VertexIndex iVertex = 0; iVertex < mesh.GetVertexCount(); ++iVertex)
+	{
+		const auto& expectedVertex = expectedMesh.GetVertexData(iVertex);
+		EXPECT_EQ(mesh.GetVertexData(iVertex).Position, expectedVertex.Position);
+		EXPECT_EQ(mesh.GetVertexData(iVertex).IncidentTriangleIdx, expectedVertex.IncidentTriangleIdx);
+	}
+	for(TriangleIndex iTriangle = 0; iTriangle < mesh.GetTriangleCount(); ++iTriangle)
+	{
+		EXPECT_EQ(mesh.GetTriangleData(iTriangle).Vertices, expectedMesh.GetTriangleData(iTriangle).Vertices);
+		EXPECT_EQ(mesh.GetTriangleData(iTriangle).Neighbors, expectedMesh.GetTriangleData(iTriangle).Neighbors);
+	}
+}
+
+/// @brief A torus, a sphere and a grid merged into a single mesh.
+std::vector<std::unique_ptr<Mesh>> CreateParts()
+{
+	std::vector<std::unique_ptr<Mesh>> parts;
+	parts.push_back(MeshGenerator::CreateTorus(12, 6));
+	parts.push_back(MeshGenerator::CreateIcosphere(2));
+	parts.push_back(MeshGenerator::CreateGrid(4, 5));
+	return parts;
+}
+} // namespace
+
+TEST(MeshComponentsTest, ExtractComponents_ShouldRestoreMergedParts)
+{
+	const std::vector<std::unique_ptr<Mesh>> parts = CreateParts();
+	const std::unique_ptr<Mesh> mesh = MeshComponents::MergeComponents(parts);
+	EXPECT_EQ(MeshIntegrity::CheckIntegrity(*mesh), MeshIntegrity::ExitCode::MeshOK);
+
+	const ComponentLabeling labeling = MeshComponents::LabelComponents(*mesh);
+	ASSERT_EQ(labeling.GetComponentCount(), 3);
+	EXPECT_EQ(labeling.GetTriangles(0).size(), parts[0]->GetTriangleCount());
+	EXPECT_EQ(labeling.GetTriangles(1).front(), parts[0]->GetTriangleCount());
+	EXPECT_EQ(labeling.TriangleLabels.back(), 2);
+
+	const std::vector<std::unique_ptr<Mesh>> components = MeshComponents::ExtractComponents(*mesh, labeling);
+	ASSERT_EQ(components.size(), 3);
+	for(size_t iComponent = 0; iComponent < components.size(); ++iComponent)
+		ExpectSameElements(*components[iComponent], *parts[iComponent]);
+}
+
+TEST(MeshComponentsTest, LabelComponents_ShouldSkipDeletedTriangles)
+{
+	std::unique_ptr<Mesh> mesh = MeshGenerator::CreateGrid(4, 5);
+
+	// Remove the third row of triangles.
+	for(TriangleIndex iTriangle = 20; iTriangle < 30; ++iTriangle)
+		mesh->DeleteTriangle(iTriangle);
+
+	const ComponentLabeling labeling = MeshComponents::LabelComponents(*mesh);
+	ASSERT_EQ(labeling.GetComponentCount(), 2);
+	EXPECT_EQ(labeling.GetTriangles(0).size(), 20);
+	EXPECT_EQ(labeling.GetTriangles(1).size(), 10);
+	EXPECT_EQ(labeling.TriangleLabels[25], ComponentLabeling::InvalidLabel);
+
+	const std::unique_ptr<Mesh> component = MeshComponents::ExtractComponent(*mesh, labeling, 1);
+	EXPECT_EQ(component->GetTriangleCount(), 10);
+	EXPECT_EQ(component->GetVertexCount(), 12);
+	EXPECT_EQ(MeshIntegrity::CheckIntegrity(*component), MeshIntegrity::ExitCode::MeshOK);
+}
+
+TEST(MeshComponentsTest, ExtractComponent_ShouldCopySharedVertexInEachComponent)
+{
+	Mesh mesh = TestHelpers::CreateBowtieMesh();
+
+	const ComponentLabeling labeling = MeshComponents::LabelComponents(mesh);
+	ASSERT_EQ(labeling.GetComponentCount(), 2);
+
+	for(uint32_t iComponent = 0; iComponent < 2; ++iComponent)
+	{
+		const std::unique_ptr<Mesh> component = MeshComponents::ExtractComponent(mesh, labeling, iComponent);
+		ASSERT_EQ(component->GetVertexCount(), 3);
+		EXPECT_EQ(component->GetVertexData(0).Position, Vec3(0.f));
+		EXPECT_EQ(component->GetVertexData(0).IncidentTriangleIdx, 0);
+		EXPECT_EQ(MeshIntegrity::CheckIntegrity(*component), MeshIntegrity::ExitCode::MeshOK);
+	}
+}
+
+TEST(MeshComponentsTest, LabelComponents_ShouldNotDependOnThreadCount)
+{
+	// Each triangle of the soup is its own component, the grids merge large sets concurrently.
+	std::vector<std::unique_ptr<Mesh>> parts;
+	parts.push_back(MeshGenerator::CreateTriangleSoup(3000));
+	for(uint32_t iGrid = 0; iGrid < 4; ++iGrid)
+		parts.push_back(MeshGenerator::CreateGrid(60 + iGrid, 50));
+	const std::unique_ptr<Mesh> mesh = MeshComponents::MergeComponents(parts);
+
+	Core::Parallel::SetThreadCount(1);
+	const ComponentLabeling serialLabeling = MeshComponents::LabelComponents(*mesh);
+	Core::Parallel::SetThreadCount(4);
+	const ComponentLabeling parallelLabeling = MeshComponents::LabelComponents(*mesh);
+	Core::Parallel::SetThreadCount(0);
+
+	EXPECT_EQ(serialLabeling.GetComponentCount(), 3004);
+	EXPECT_EQ(parallelLabeling.TriangleLabels, serialLabeling.TriangleLabels);
+	EXPECT_EQ(parallelLabeling.TriangleOffsets, serialLabeling.TriangleOffsets);
+	EXPECT_EQ(parallelLabeling.Triangles, serialLabeling.Triangles);
+}
+
+TEST(MeshComponentsTest, ForEachComponent_ShouldRepairComponentsConcurrently)
+{
+	// Flip every triangle of the spheres so that they are turned inwards.
+	std::vector<std::unique_ptr<Mesh>> parts;
+	for(uint32_t iPart = 0; iPart < 16; ++iPart)
+	{
+		parts.push_back(MeshGenerator::CreateIcosphere(1 + iPart % 3));
+		for(TriangleIndex iTriangle = 0; iTriangle < parts.back()->GetTriangleCount(); ++iTriangle)
+		{
+			auto& vertices = parts.back()->GetTriangleData(iTriangle).Vertices;
+			std::swap(vertices[1], vertices[2]);
+		}
+	}
+	const std::unique_ptr<Mesh> mesh = MeshComponents::MergeComponents(parts);
+	std::vector<std::unique_ptr<Mesh>> components =
+		MeshComponents::ExtractComponents(*mesh, MeshComponents::LabelComponents(*mesh));
+
+	std::atomic<uint32_t> flippedCount{ 0 };
+	std::atomic<uint32_t> nestedCount{ 0 };
+	Core::Parallel::SetThreadCount(4);
+	MeshComponents::ForEachComponent(
+		components,
+		[&](Mesh& component)
+		{
+			nestedCount += Core::Parallel::IsInParallelLoop() ? 1 : 0;
+			flippedCount += MeshRepairer::Repair(component).FlippedTriangleCount;
+		},
+		200);
+	Core::Parallel::SetThreadCount(0);
+
+	// Only the six spheres with 80 triangles are repaired concurrently.
+	EXPECT_EQ(flippedCount, mesh->GetTriangleCount());
+	EXPECT_EQ(nestedCount, 6);
+
+	const std::unique_ptr<Mesh> repairedMesh = MeshComponents::MergeComponents(components);
+	EXPECT_EQ(repairedMesh->GetTriangleCount(), mesh->GetTriangleCount());
+	EXPECT_TRUE(MeshIntegrity::BuildReport(*repairedMesh).IsValid());
+}
@@ -0,0 +1,106 @@
+#include "Application/ExtraDataType.h"
+#include "Application/Mesh.h"
+#include "Application/MeshDecimator.h"
+#include "Application/MeshIntegrity.h"
+#include "Application/TestHelpers.h"
+#include "Core/Parallel.h"
+
+#include <gtest/gtest.h>
+
+using namespace Core::BaseType;
+using namespace Utilitary::Surface;
+using namespace Data::Surface;
+using namespace Data::ExtraData;
+
+TEST(MeshDecimatorTest, DecimateParallel_ClosedMesh_ShouldReachTargetAndKeepIntegrity)
+{
+	Mesh mesh = TestHelpers::CreateTorusMesh(32, 16);
+	ASSERT_EQ(mesh.GetTriangleCount(), 1024);
+
+	const uint32_t collapseCount = MeshDecimator::DecimateParallel(mesh, { .TargetTriangleCount = 300 });
+
+	// Each collapse on a closed mesh removes one vertex and two triangles.
+	EXPECT_GT(collapseCount, 0);
+	EXPECT_EQ(mesh.GetTriangleCount(), 1024 - 2 * collapseCount);
+	EXPECT_EQ(mesh.GetVertexCount(), 512 - collapseCount);
+	EXPECT_LE(mesh.GetTriangleCount(), 300);
+	EXPECT_EQ(MeshIntegrity::CheckIntegrity(mesh), MeshIntegrity::ExitCode::MeshOK);
+
+	// The Euler characteristic of the torus must be preserved.
+	const int euler = static_cast<int>(mesh.GetVertexCount()) - static_cast<int>(mesh.GetTriangleCount()) * 3 / 2
+		+ static_cast<int>(mesh.GetTriangleCount());
+	EXPECT_EQ(euler, 0);
+}
+
+TEST(MeshDecimatorTest, DecimateParallel_FlatGrid_ShouldPreserveBoundary)
+{
+	Mesh mesh = TestHelpers::CreateGridMesh(10, 10);
+
+	MeshDecimator::DecimateParallel(mesh, { .TargetTriangleCount = 0 });
+
+	EXPECT_LT(mesh.GetTriangleCount(), 200);
+	EXPECT_EQ(MeshIntegrity::CheckIntegrity(mesh), MeshIntegrity::ExitCode::MeshOK);
+
+	// The 40 boundary vertices are never removed nor moved.
+	mesh.UpdateVerticesBoundaryStatus();
+	uint32_t boundaryVertexCount = 0;
+	for(VertexIndex iVertex = 0; iVertex < mesh.GetVertexCount(); ++iVertex)
+	{
+		if(!mesh.GetVertex(iVertex).GetExtraData<IsBoundaryVertexExtraData>()->IsBoundary())
+			continue;
+
+		++boundaryVertexCount;
+		const Vec3& position = mesh.GetVertexData(iVertex).Position;
+		EXPECT_TRUE(position.x == 0.f || position.x == 10.f || position.y == 0.f || position.y == 10.f);
+	}
+	EXPECT_EQ(boundaryVertexCount, 40);
+
+	// The grid is flat, so every vertex stays in its plane.
+	for(auto&& curVertex : mesh.GetVertices())
+		EXPECT_FLOAT_EQ(curVertex.Position.z, 0.f);
+}
+
+TEST(MeshDecimatorTest, DecimateParallel_MaxError_ShouldStopOnCurvedRegions)
+{
+	Mesh mesh = TestHelpers::CreateTorusMesh(32, 16);
+
+	const uint32_t collapseCount = MeshDecimator::DecimateParallel(mesh, { .MaxError = 0.f });
+
+	// No edge of the torus can be collapsed without error.
+	EXPECT_EQ(collapseCount, 0);
+	EXPECT_EQ(mesh.GetTriangleCount(), 1024);
+}
+
+TEST(MeshDecimatorTest, DecimateParallel_ShouldNotDependOnThreadCount)
+{
+	Mesh serialMesh = TestHelpers::CreateTorusMesh(24, 12);
+	Mesh parallelMesh = serialMesh;
+
+	Core::Parallel::SetThreadCount(1);
+	MeshDecimator::DecimateParallel(serialMesh, { .TargetTriangleCount = 200 });
+	Core::Parallel::SetThreadCount(8);
+	MeshDecimator::DecimateParallel(parallelMesh, { .TargetTriangleCount = 200 });
+	Core::Parallel::SetThreadCount(0);
+
+	ASSERT_EQ(serialMesh.GetVertexCount(), parallelMesh.GetVertexCount());
+	ASSERT_EQ(serialMesh.GetTriangleCount(), parallelMesh.GetTriangleCount());
+	for(VertexIndex iVertex = 0; iVertex < serialMesh.GetVertexCount(); ++iVertex)
+		EXPECT_EQ(serialMesh.GetVertexData(iVertex).Position, parallelMesh.GetVertexData(iVertex).Position);
+	for(TriangleIndex iTriangle = 0; iTriangle < serialMesh.GetTriangleCount(); ++iTriangle)
+		EXPECT_EQ(serialMesh.GetTriangleData(iTriangle).Vertices, parallelMesh.GetTriangleData(iTriangle).Vertices);
+}
+
+TEST(MeshDecimatorTest, DecimateParallel_WithExtraData_ShouldCompactContainers)
+{
+	Mesh mesh = TestHelpers::CreateTorusMesh(16, 8);
+	mesh.ComputeTriangleNormals(true);
+	mesh.ComputeSmoothVertexNormals(true);
+
+	MeshDecimator::DecimateParallel(mesh, { .TargetTriangleCount = 100 });
+
+	ASSERT_TRUE(mesh.HasTrianglesExtraDataContainer());
+	for(TriangleIndex iTriangle = 0; iTriangle < mesh.GetTriangleCount(); ++iTriangle)
+		EXPECT_TRUE(mesh.GetTriangle(iTriangle).HasExtraData<TriangleNormalExtraData>());
+	for(VertexIndex iVertex = 0; iVertex < mesh.GetVertexCount(); ++iVertex)
+		EXPECT_TRUE(mesh.GetVertex(iVertex).HasExtraData<SmoothVertexNormalExtraData>());
+}
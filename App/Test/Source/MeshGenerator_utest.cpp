@@ -0,0 +1,144 @@
+#include "Application/Mesh.h"
+#include "Application/MeshGenerator.h"
+#include "Application/MeshIntegrity.h"
+#include "Application/TestHelpers.h"
+#include "Core/MathHelpers.h"
+#include "Core/Parallel.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+using namespace Core::BaseType;
+using namespace Core::Math::Geometry;
+using namespace Utilitary::Surface;
+using namespace Data::Surface;
+
+namespace
+{
+/// @brief Check that the generated neighbors are the ones found by UpdateMeshConnectivity.
+void ExpectConnectivityMatchesRebuild(const Mesh& mesh)
+{
+	Mesh rebuiltMesh(mesh);
+	for(TriangleIndex iTriangle = 0; iTriangle < rebuiltMesh.GetTriangleCount(); ++iTriangle)
+		rebuiltMesh.GetTriangleData(iTriangle).Neighbors = { -1, -1, -1 };
+	rebuiltMesh.UpdateMeshConnectivity();
+
+	for(TriangleIndex iTriangle = 0; iTriangle < mesh.GetTriangleCount(); ++iTriangle)
+		ASSERT_EQ(mesh.GetTriangleData(iTriangle).Neighbors, rebuiltMesh.GetTriangleData(iTriangle).Neighbors)
+			<< "Triangle " << iTriangle;
+}
+
+/// @brief Check that two meshes have the same positions and triangles, stored in the same order.
+void ExpectSameElements(const Mesh& mesh, const Mesh& expectedMesh)
+{
+	ASSERT_EQ(mesh.GetVertexCount(), expectedMesh.GetVertexCount());
+	ASSERT_EQ(mesh.GetTriangleCount(), expectedMesh.GetTriangleCount());
+	for(VertexIndex iVertex = 0; iVertex < mesh.GetVertexCount(); ++iVertex)
+		EXPECT_EQ(mesh.GetVertexData(iVertex).Position, expectedMesh.GetVertexData(iVertex).Position);
+	for(TriangleIndex iTriangle = 0; iTriangle < mesh.GetTriangleCount(); ++iTriangle)
+	{
+		EXPECT_EQ(mesh.GetTriangleData(iTriangle).Vertices, expectedMesh.GetTriangleData(iTriangle).Vertices);
+		EXPECT_EQ(mesh.GetTriangleData(iTriangle).Neighbors, expectedMesh.GetTriangleData(iTriangle).Neighbors);
+	}
+}
+} // namespace
+
+TEST(MeshGeneratorTest, CreateGrid_ShouldMatchTestHelpersGrid)
+{
+	auto mesh = MeshGenerator::CreateGrid(5, 7);
+
+	EXPECT_EQ(MeshIntegrity::CheckIntegrity(*mesh), MeshIntegrity::ExitCode::MeshOK);
+	ExpectSameElements(*mesh, TestHelpers::CreateGridMesh(5, 7));
+}
+
+TEST(MeshGeneratorTest, CreateTorus_ShouldMatchTestHelpersTorus)
+{
+	auto mesh = MeshGenerator::CreateTorus(12, 5);
+
+	EXPECT_EQ(MeshIntegrity::CheckIntegrity(*mesh), MeshIntegrity::ExitCode::MeshOK);
+	ExpectSameElements(*mesh, TestHelpers::CreateTorusMesh(12, 5));
+}
+
+TEST(MeshGeneratorTest, CreateIcosphere_ShouldBeClosedSphere)
+{
+	constexpr float radius = 2.f;
+	auto mesh = MeshGenerator::CreateIcosphere(3, radius);
+
+	EXPECT_EQ(MeshIntegrity::CheckIntegrity(*mesh), MeshIntegrity::ExitCode::MeshOK);
+	EXPECT_EQ(mesh->GetVertexCount(), 10 * 64 + 2);
+	EXPECT_EQ(mesh->GetTriangleCount(), 20 * 64);
+	for(VertexIndex iVertex = 0; iVertex < mesh->GetVertexCount(); ++iVertex)
+		EXPECT_NEAR(Length(mesh->GetVertexData(iVertex).Position), radius, 1e-5f);
+
+	// Closed mesh: no boundary edge.
+	for(TriangleIndex iTriangle = 0; iTriangle < mesh->GetTriangleCount(); ++iTriangle)
+		for(int neighborIdx : mesh->GetTriangleData(iTriangle).Neighbors)
+			EXPECT_NE(neighborIdx, -1);
+
+	ExpectConnectivityMatchesRebuild(*mesh);
+}
+
+TEST(MeshGeneratorTest, CreateIcosphere_ShouldNotDependOnThreadCount)
+{
+	auto mesh = MeshGenerator::CreateIcosphere(4);
+	Core::Parallel::SetThreadCount(1);
+	auto serialMesh = MeshGenerator::CreateIcosphere(4);
+	Core::Parallel::SetThreadCount(0);
+
+	ExpectSameElements(*mesh, *serialMesh);
+	for(VertexIndex iVertex = 0; iVertex < mesh->GetVertexCount(); ++iVertex)
+		EXPECT_EQ(
+			mesh->GetVertexData(iVertex).IncidentTriangleIdx, serialMesh->GetVertexData(iVertex).IncidentTriangleIdx);
+}
+
+TEST(MeshGeneratorTest, CreateTerrain_ShouldDisplaceGrid)
+{
+	constexpr float amplitude = 4.f;
+	auto mesh = MeshGenerator::CreateTerrain(40, 30, amplitude, 0.1f, 4, 7);
+
+	EXPECT_EQ(MeshIntegrity::CheckIntegrity(*mesh), MeshIntegrity::ExitCode::MeshOK);
+	EXPECT_EQ(mesh->GetVertexCount(), 41 * 31);
+	EXPECT_EQ(mesh->GetTriangleCount(), 2 * 40 * 30);
+	ExpectConnectivityMatchesRebuild(*mesh);
+
+	float minHeight = 0.f;
+	float maxHeight = 0.f;
+	for(VertexIndex iVertex = 0; iVertex < mesh->GetVertexCount(); ++iVertex)
+	{
+		const float height = mesh->GetVertexData(iVertex).Position.z;
+		minHeight = std::min(minHeight, height);
+		maxHeight = std::max(maxHeight, height);
+	}
+	EXPECT_GT(maxHeight - minHeight, amplitude * 0.5f);
+	EXPECT_LT(std::max(-minHeight, maxHeight), 2.f * amplitude);
+
+	// Same seed gives the same terrain, another seed a different one.
+	auto sameMesh = MeshGenerator::CreateTerrain(40, 30, amplitude, 0.1f, 4, 7);
+	auto otherMesh = MeshGenerator::CreateTerrain(40, 30, amplitude, 0.1f, 4, 8);
+	EXPECT_EQ(mesh->GetVertexData(100).Position, sameMesh->GetVertexData(100).Position);
+	EXPECT_NE(mesh->GetVertexData(100).Position, otherMesh->GetVertexData(100).Position);
+}
+
+TEST(MeshGeneratorTest, CreateTriangleSoup_ShouldHaveDisconnectedTriangles)
+{
+	auto mesh = MeshGenerator::CreateTriangleSoup(1000, 3);
+
+	EXPECT_EQ(MeshIntegrity::CheckIntegrity(*mesh), MeshIntegrity::ExitCode::MeshOK);
+	EXPECT_EQ(mesh->GetVertexCount(), 3000);
+	EXPECT_EQ(mesh->GetTriangleCount(), 1000);
+	for(TriangleIndex iTriangle = 0; iTriangle < mesh->GetTriangleCount(); ++iTriangle)
+	{
+		const auto& triangle = mesh->GetTriangleData(iTriangle);
+		EXPECT_EQ(triangle.Neighbors, (std::array<int, 3>{ -1, -1, -1 }));
+
+		// Triangles are about 1/cbrt(1000) wide.
+		const Vec3& posA = mesh->GetVertexData(triangle.Vertices[0]).Position;
+		EXPECT_LT(Length(mesh->GetVertexData(triangle.Vertices[1]).Position - posA), 0.2f);
+		EXPECT_GT(Length(Cross(mesh->GetVertexData(triangle.Vertices[1]).Position - posA,
+							   mesh->GetVertexData(triangle.Vertices[2]).Position - posA)),
+				  0.f);
+	}
+}
@@ -0,0 +1,200 @@
+#include "Application/ExtraDataType.h"
+#include "Application/Mesh.h"
+#include "Application/MeshGenerator.h"
+#include "Application/MeshGeometry.h"
+#include "Application/PrimitiveProxy.h"
+#include "Core/Parallel.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <numbers>
+#include <utility>
+
+using namespace Core::BaseType;
+using namespace Utilitary::Surface;
+using namespace Data::ExtraData;
+using namespace Data::Primitive;
+using namespace Data::Surface;
+
+namespace
+{
+/// @brief Check that two vectors are equal up to a tolerance.
+void ExpectNear(const Vec3& actual, const Vec3& expected, const float tolerance)
+{
+	EXPECT_NEAR(actual.x, expected.x, tolerance);
+	EXPECT_NEAR(actual.y, expected.y, tolerance);
+	EXPECT_NEAR(actual.z, expected.z, tolerance);
+}
+} // namespace
+
+TEST(MeshGeometryTest, BuildPositionBuffers_ShouldPadWithALivePosition)
+{
+	std::unique_ptr<Mesh> mesh = MeshGenerator::CreateGrid(4, 5);
+	mesh->DeleteVertex(0);
+	const PositionBuffers buffers = MeshGeometry::BuildPositionBuffers(*mesh);
+
+	EXPECT_EQ(buffers.VertexCount, mesh->GetVertexCount());
+	EXPECT_EQ(buffers.LiveVertexCount, mesh->GetVertexCount() - 1);
+	EXPECT_EQ(buffers.GetPaddedCount() % PositionBuffers::PositionLaneCount, 0);
+	EXPECT_GE(buffers.GetPaddedCount(), buffers.VertexCount);
+	for(const auto* coordinates : { &buffers.X, &buffers.Y, &buffers.Z })
+		EXPECT_EQ(reinterpret_cast<uintptr_t>(coordinates->data()) % Core::Memory::CacheLineSize, 0);
+
+	// The deleted vertex and the padding hold the first live position.
+	EXPECT_EQ(buffers.FillPosition, mesh->GetVertexData(1).Position);
+	EXPECT_EQ(buffers.GetPosition(0), buffers.FillPosition);
+	for(size_t iSlot = buffers.VertexCount; iSlot < buffers.GetPaddedCount(); ++iSlot)
+		EXPECT_EQ(buffers.GetPosition(static_cast<VertexIndex>(iSlot)), buffers.FillPosition);
+	for(VertexIndex iVertex = 1; iVertex < mesh->GetVertexCount(); ++iVertex)
+		EXPECT_EQ(buffers.GetPosition(iVertex), mesh->GetVertexData(iVertex).Position);
+	EXPECT_EQ(buffers.GetAxis(1).size(), buffers.VertexCount);
+}
+
+TEST(MeshGeometryTest, ComputeBoundingBox_ShouldMatchTheVertices)
+{
+	std::unique_ptr<Mesh> mesh = MeshGenerator::CreateTerrain(90, 70);
+	Vec3 minCorner{ std::numeric_limits<float>::max() };
+	Vec3 maxCorner{ std::numeric_limits<float>::lowest() };
+	for(const auto& vertex : mesh->GetVertices())
+	{
+		minCorner = glm::min(minCorner, vertex.Position);
+		maxCorner = glm::max(maxCorner, vertex.Position);
+	}
+
+	Core::Parallel::SetThreadCount(3);
+	const AxisAlignedBox box = MeshGeometry::ComputeBoundingBox(*mesh->GetPositionBuffers());
+	Core::Parallel::SetThreadCount(0);
+	EXPECT_EQ(box.Min, minCorner);
+	EXPECT_EQ(box.Max, maxCorner);
+	EXPECT_EQ(box.GetExtent(), maxCorner - minCorner);
+
+	EXPECT_TRUE(MeshGeometry::ComputeBoundingBox(PositionBuffers{}).IsEmpty());
+}
+
+TEST(MeshGeometryTest, GetPositionBuffers_ShouldBeCachedUntilGeometryChanges)
+{
+	std::unique_ptr<Mesh> mesh = MeshGenerator::CreateIcosphere(2);
+	const std::shared_ptr<const PositionBuffers> buffers = mesh->GetPositionBuffers();
+	EXPECT_EQ(mesh->GetPositionBuffers(), buffers);
+
+	mesh->SetVertexPosition(3, Vec3{ 5.f, 6.f, 7.f });
+	const std::shared_ptr<const PositionBuffers> movedBuffers = mesh->GetPositionBuffers();
+	EXPECT_NE(movedBuffers, buffers);
+	EXPECT_EQ(movedBuffers->GetPosition(3), Vec3(5.f, 6.f, 7.f));
+
+	// The topology changes invalidate the buffers as well, the previous ones staying valid.
+	const VertexIndex newVertexIdx = mesh->SplitTriangle(0, Vec3{ 1.f, 2.f, 3.f });
+	const std::shared_ptr<const PositionBuffers> splitBuffers = mesh->GetPositionBuffers();
+	EXPECT_EQ(splitBuffers->VertexCount, movedBuffers->VertexCount + 1);
+	EXPECT_EQ(splitBuffers->GetPosition(newVertexIdx), Vec3(1.f, 2.f, 3.f));
+	EXPECT_EQ(movedBuffers->GetPosition(3), Vec3(5.f, 6.f, 7.f));
+
+	// The copies share the cache.
+	const std::unique_ptr<Mesh> clone = mesh->Clone();
+	EXPECT_EQ(clone->GetPositionBuffers(), splitBuffers);
+}
+
+TEST(MeshGeometryTest, ComputeMeasures_ShouldMatchTheSphere)
+{
+	const float radius = 2.f;
+	std::unique_ptr<Mesh> mesh = MeshGenerator::CreateIcosphere(4, radius);
+	const GeometryMeasures measures = MeshGeometry::ComputeMeasures(*mesh);
+
+	const float pi = std::numbers::pi_v<float>;
+	EXPECT_NEAR(measures.SurfaceArea, 4.f * pi * radius * radius, 0.01f * measures.SurfaceArea);
+	EXPECT_NEAR(measures.Volume, 4.f / 3.f * pi * radius * radius * radius, 0.01f * measures.Volume);
+	ExpectNear(measures.VertexCentroid, Vec3{ 0.f }, 1e-4f);
+	ExpectNear(measures.SurfaceCentroid, Vec3{ 0.f }, 1e-4f);
+	ExpectNear(measures.BoundingBox.Min, Vec3{ -radius }, 0.05f);
+	ExpectNear(measures.BoundingBox.Max, Vec3{ radius }, 0.05f);
+	ExpectNear(measures.OrientedBoundingBox.HalfExtents, Vec3{ radius }, 0.05f);
+
+	// The flipped triangles enclose a negative volume.
+	for(Triangle& triangle : mesh->GetTriangles())
+		std::swap(triangle.Vertices[1], triangle.Vertices[2]);
+	mesh->NotifyTopologyChanged();
+	EXPECT_NEAR(MeshGeometry::ComputeMeasures(*mesh).Volume, -measures.Volume, 1e-3f);
+}
+
+TEST(MeshGeometryTest, ComputeOrientedBoundingBox_ShouldFitARotatedGrid)
+{
+	// Grid of 20 x 4 in the plane z = 0, rotated around z and translated.
+	std::unique_ptr<Mesh> mesh = MeshGenerator::CreateGrid(4, 20);
+	const Mat4 transform = glm::translate(Vec3{ 1.f, -2.f, 3.f }) * glm::rotate(0.5f, Vec3{ 0.f, 0.f, 1.f });
+	MeshGeometry::Transform(*mesh, transform);
+
+	const OrientedBox box = MeshGeometry::ComputeOrientedBoundingBox(*mesh->GetPositionBuffers());
+	ExpectNear(box.Center, Vec3{ transform * Vec4{ 10.f, 2.f, 0.f, 1.f } }, 1e-4f);
+	ExpectNear(box.HalfExtents, Vec3{ 10.f, 2.f, 0.f }, 1e-4f);
+	EXPECT_NEAR(std::abs(glm::dot(box.Axes[0], Vec3{ transform[0] })), 1.f, 1e-5f);
+	EXPECT_NEAR(std::abs(glm::dot(box.Axes[1], Vec3{ transform[1] })), 1.f, 1e-5f);
+	EXPECT_NEAR(glm::dot(glm::cross(box.Axes[0], box.Axes[1]), box.Axes[2]), 1.f, 1e-5f);
+	EXPECT_EQ(box.GetVolume(), 0.f);
+}
+
+TEST(MeshGeometryTest, Transform_ShouldMoveThePositionsAndTheNormals)
+{
+	std::unique_ptr<Mesh> mesh = MeshGenerator::CreateIcosphere(2);
+	mesh->ComputeTriangleNormals(true);
+	mesh->ComputeSmoothVertexNormals(true);
+	const std::unique_ptr<Mesh> original = mesh->Clone();
+	const float originalVolume = mesh->GetGeometryMeasures()->Volume;
+
+	const Mat4 transform = glm::translate(Vec3{ 3.f, 0.f, -1.f }) * glm::scale(Vec3{ 2.f, 1.f, 0.5f });
+	MeshGeometry::Transform(*mesh, transform, true);
+	for(VertexIndex iVertex = 0; iVertex < mesh->GetVertexCount(); ++iVertex)
+	{
+		const Vec3 expected{ transform * Vec4{ original->GetVertexData(iVertex).Position, 1.f } };
+		ExpectNear(mesh->GetVertexData(iVertex).Position, expected, 1e-5f);
+	}
+
+	// The normals stay orthogonal to the transformed triangles.
+	const std::unique_ptr<Mesh> recomputed = mesh->Clone();
+	recomputed->ComputeTriangleNormals(true);
+	for(TriangleIndex iTriangle = 0; iTriangle < mesh->GetTriangleCount(); ++iTriangle)
+	{
+		const Vec3& normal = mesh->GetTriangle(iTriangle).GetExtraData<TriangleNormalExtraData>()->GetData();
+		const Vec3& expected = recomputed->GetTriangle(iTriangle).GetExtraData<TriangleNormalExtraData>()->GetData();
+		ExpectNear(normal, expected, 1e-5f);
+	}
+	const Vec3& smoothNormal = mesh->GetVertex(0).GetExtraData<SmoothVertexNormalExtraData>()->GetData();
+	EXPECT_NEAR(glm::length(smoothNormal), 1.f, 1e-5f);
+
+	// The transformed buffers are cached, and the measures follow the transform.
+	const std::shared_ptr<const PositionBuffers> buffers = mesh->GetPositionBuffers();
+	EXPECT_EQ(mesh->GetPositionBuffers(), buffers);
+	for(VertexIndex iVertex = 0; iVertex < mesh->GetVertexCount(); ++iVertex)
+		EXPECT_EQ(buffers->GetPosition(iVertex), mesh->GetVertexData(iVertex).Position);
+	EXPECT_NEAR(mesh->GetGeometryMeasures()->Volume, originalVolume, 1e-4f);
+
+	// A quarter turn around z.
+	MeshGeometry::Transform(*mesh, glm::angleAxis(std::numbers::pi_v<float> / 2.f, Vec3{ 0.f, 0.f, 1.f }));
+	const Vec3 moved{ transform * Vec4{ original->GetVertexData(0).Position, 1.f } };
+	ExpectNear(mesh->GetVertexData(0).Position, Vec3{ -moved.y, moved.x, moved.z }, 1e-5f);
+}
+
+TEST(MeshGeometryTest, GetGeometryMeasures_ShouldBeCachedAndNotDependOnTheThreads)
+{
+	std::unique_ptr<Mesh> mesh = MeshGenerator::CreateTerrain(120, 80);
+	Core::Parallel::SetThreadCount(1);
+	const GeometryMeasures sequentialMeasures = MeshGeometry::ComputeMeasures(*mesh);
+	Core::Parallel::SetThreadCount(3);
+	const std::shared_ptr<const GeometryMeasures> measures = mesh->GetGeometryMeasures();
+	Core::Parallel::SetThreadCount(0);
+
+	EXPECT_EQ(measures->SurfaceArea, sequentialMeasures.SurfaceArea);
+	EXPECT_EQ(measures->Volume, sequentialMeasures.Volume);
+	EXPECT_EQ(measures->VertexCentroid, sequentialMeasures.VertexCentroid);
+	EXPECT_EQ(measures->SurfaceCentroid, sequentialMeasures.SurfaceCentroid);
+	EXPECT_EQ(measures->OrientedBoundingBox.HalfExtents, sequentialMeasures.OrientedBoundingBox.HalfExtents);
+	EXPECT_EQ(mesh->GetGeometryMeasures(), measures);
+
+	mesh->SetVertexPosition(0, mesh->GetVertexData(0).Position + Vec3{ 0.f, 0.f, 100.f });
+	const std::shared_ptr<const GeometryMeasures> movedMeasures = mesh->GetGeometryMeasures();
+	EXPECT_NE(movedMeasures, measures);
+	EXPECT_EQ(movedMeasures->BoundingBox.Max.z, mesh->GetVertexData(0).Position.z);
+}
@@ -1,8 +1,14 @@
+#include "Application/MeshGenerator.h"
 #include "Application/MeshIntegrity.h"
 #include "Application/TestHelpers.h"
+#include "Core/Parallel.h"
 
 #include <gtest/gtest.h>
 
+#include <memory>
+#include <string>
+#include <vector>
+
 using namespace Utilitary::Surface;
 using namespace Data::Surface;
 
@@ -132,3 +138,100 @@ TEST(MeshIntegrityTest, InvalidMesh_ShouldReturnInvalidNeighborTriangleIndex)
 
 	EXPECT_EQ(MeshIntegrity::CheckIntegrity(mesh), MeshIntegrity::ExitCode::InvalidNeighborTriangleIndex);
 }
+
+TEST(MeshIntegrityTest, BuildReport_OnValidMeshes_ShouldBeValid)
+{
+	EXPECT_TRUE(MeshIntegrity::BuildReport(TestHelpers::CreateValidMesh()).IsValid());
+	EXPECT_TRUE(MeshIntegrity::BuildReport(*MeshGenerator::CreateTorus(40, 20)).IsValid());
+	EXPECT_TRUE(MeshIntegrity::BuildReport(*MeshGenerator::CreateIcosphere(3)).IsValid());
+	EXPECT_EQ(MeshIntegrity::BuildReport(TestHelpers::CreateValidMesh()).ToString(), "MeshOK\n");
+}
+
+TEST(MeshIntegrityTest, BuildReport_ShouldGatherEveryViolation)
+{
+	Mesh mesh = TestHelpers::CreateValidMesh();
+
+	// Invalidate two vertices and add two invalid triangles.
+	mesh.GetVertexData(0).IncidentTriangleIdx = -1;
+	mesh.GetVertexData(3).IncidentTriangleIdx = -1;
+	mesh.AddTriangle({ .Vertices = { 0, 1, 1 }, .Neighbors = { -1, -1, -1 } });
+	mesh.AddTriangle({ .Vertices = { 0, 1, 7 }, .Neighbors = { -1, -1, -1 } });
+
+	const MeshIntegrity::Report report = MeshIntegrity::BuildReport(mesh);
+	EXPECT_FALSE(report.IsValid());
+	EXPECT_EQ(report.GetCount(MeshIntegrity::ExitCode::VertexHasNullIncidentTriangle), 2);
+	EXPECT_EQ(report.GetElements(MeshIntegrity::ExitCode::VertexHasNullIncidentTriangle),
+			  (std::vector<uint32_t>{ 0, 3 }));
+	EXPECT_EQ(report.GetCount(MeshIntegrity::ExitCode::TriangleHasDuplicatedVertices), 1);
+	EXPECT_EQ(report.GetElements(MeshIntegrity::ExitCode::TriangleHasDuplicatedVertices), (std::vector<uint32_t>{ 2 }));
+	EXPECT_EQ(report.GetCount(MeshIntegrity::ExitCode::InvalidVertexIndex), 1);
+	EXPECT_EQ(report.GetElements(MeshIntegrity::ExitCode::InvalidVertexIndex), (std::vector<uint32_t>{ 3 }));
+	EXPECT_NE(report.ToString().find("VertexHasNullIncidentTriangle: 2 (0, 3)"), std::string::npos);
+
+	// The fast mode stops at the first violation.
+	EXPECT_EQ(MeshIntegrity::CheckIntegrity(mesh), MeshIntegrity::ExitCode::VertexHasNullIncidentTriangle);
+}
+
+TEST(MeshIntegrityTest, BuildReport_ShouldReturnInconsistentOrientation)
+{
+	Mesh mesh = TestHelpers::CreateValidMesh();
+
+	// Flip the second triangle, both triangles now run through their common edge from vertex 2 to vertex 0.
+	mesh.GetTriangleData(1) = { .Vertices = { 0, 3, 2 }, .Neighbors = { -1, 0, -1 } };
+
+	const MeshIntegrity::Report report = MeshIntegrity::BuildReport(mesh);
+	EXPECT_EQ(report.GetCount(MeshIntegrity::ExitCode::InconsistentOrientation), 2);
+	EXPECT_EQ(report.GetElements(MeshIntegrity::ExitCode::InconsistentOrientation), (std::vector<uint32_t>{ 0, 1 }));
+	EXPECT_TRUE(MeshIntegrity::BuildReport(mesh, false).IsValid());
+	EXPECT_EQ(MeshIntegrity::CheckIntegrity(mesh), MeshIntegrity::ExitCode::MeshOK);
+}
+
+TEST(MeshIntegrityTest, BuildReport_ShouldReturnNonManifoldEdge)
+{
+	Mesh mesh = TestHelpers::CreateValidMesh();
+
+	// A third triangle on the edge from vertex 0 to vertex 2.
+	mesh.AddVertex({ .Position = { 1., 0., 1. }, .IncidentTriangleIdx = { 2 } });
+	mesh.AddTriangle({ .Vertices = { 2, 0, 4 }, .Neighbors = { -1, -1, -1 } });
+
+	const MeshIntegrity::Report report = MeshIntegrity::BuildReport(mesh);
+	EXPECT_EQ(report.GetCount(MeshIntegrity::ExitCode::NonManifoldEdge), 3);
+	EXPECT_EQ(report.GetElements(MeshIntegrity::ExitCode::NonManifoldEdge), (std::vector<uint32_t>{ 0, 1, 2 }));
+	EXPECT_EQ(MeshIntegrity::CheckIntegrity(mesh), MeshIntegrity::ExitCode::MeshOK);
+}
+
+TEST(MeshIntegrityTest, BuildReport_ShouldReturnNonManifoldVertex)
+{
+	Mesh mesh = TestHelpers::CreateBowtieMesh();
+
+	const MeshIntegrity::Report report = MeshIntegrity::BuildReport(mesh);
+	EXPECT_EQ(report.GetCount(MeshIntegrity::ExitCode::NonManifoldVertex), 1);
+	EXPECT_EQ(report.GetElements(MeshIntegrity::ExitCode::NonManifoldVertex), (std::vector<uint32_t>{ 0 }));
+	EXPECT_EQ(MeshIntegrity::CheckIntegrity(mesh), MeshIntegrity::ExitCode::MeshOK);
+}
+
+TEST(MeshIntegrityTest, BuildReport_ShouldNotDependOnThreadCount)
+{
+	std::unique_ptr<Mesh> mesh = MeshGenerator::CreateTorus(200, 100);
+
+	// Spread violations over the whole mesh.
+	for(uint32_t iTriangle = 7; iTriangle < mesh->GetTriangleCount(); iTriangle += 997)
+		mesh->GetTriangleData(iTriangle).Neighbors[iTriangle % 3] = -1;
+	for(uint32_t iVertex = 11; iVertex < mesh->GetVertexCount(); iVertex += 1499)
+		mesh->GetVertexData(iVertex).IncidentTriangleIdx = -1;
+
+	Core::Parallel::SetThreadCount(1);
+	const MeshIntegrity::ExitCode serialCode = MeshIntegrity::CheckIntegrity(*mesh);
+	const MeshIntegrity::Report serialReport = MeshIntegrity::BuildReport(*mesh, true, 5);
+	Core::Parallel::SetThreadCount(4);
+	const MeshIntegrity::ExitCode parallelCode = MeshIntegrity::CheckIntegrity(*mesh);
+	const MeshIntegrity::Report parallelReport = MeshIntegrity::BuildReport(*mesh, true, 5);
+	Core::Parallel::SetThreadCount(0);
+
+	EXPECT_EQ(serialCode, MeshIntegrity::ExitCode::VertexHasNullIncidentTriangle);
+	EXPECT_EQ(parallelCode, serialCode);
+	EXPECT_EQ(parallelReport.Counts, serialReport.Counts);
+	EXPECT_EQ(parallelReport.Elements, serialReport.Elements);
+	EXPECT_GT(serialReport.GetCount(MeshIntegrity::ExitCode::TriangleNeighborNotReciprocal), 5);
+	EXPECT_EQ(serialReport.GetElements(MeshIntegrity::ExitCode::TriangleNeighborNotReciprocal).size(), 5);
+}
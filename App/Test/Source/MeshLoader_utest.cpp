@@ -6,6 +6,12 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
 using namespace Utilitary::Surface;
 using namespace Data::ExtraData;
 using namespace Data::Primitive;
@@ -58,6 +64,89 @@ TEST(MeshLoaderTest, LoadOBJ_InvalidFile_ShouldReturnNullptr)
 	}
 }
 
+TEST(MeshLoaderTest, Load_ShouldReportTheProgress)
+{
+	std::vector<float> progressValues;
+	const Core::Parallel::ProgressCallback progress = [&](const float value) { progressValues.push_back(value); };
+	ASSERT_NE(MeshLoader::LoadOFF("TestFiles/Off/cube.off", progress), nullptr);
+	ASSERT_FALSE(progressValues.empty());
+	EXPECT_TRUE(std::ranges::is_sorted(progressValues));
+	EXPECT_EQ(progressValues.back(), 1.f);
+
+	progressValues.clear();
+	ASSERT_NE(MeshLoader::LoadOBJ("TestFiles/Obj/cube.obj", progress), nullptr);
+	ASSERT_FALSE(progressValues.empty());
+	EXPECT_TRUE(std::ranges::is_sorted(progressValues));
+	EXPECT_EQ(progressValues.back(), 1.f);
+}
+
+TEST(MeshLoaderTest, Load_WhenCancelled_ShouldReturnNullptr)
+{
+	const Core::Parallel::CancellationToken cancellation = Core::Parallel::CancellationToken::Create();
+	cancellation.Cancel();
+	EXPECT_EQ(MeshLoader::LoadOFF("TestFiles/Off/cube.off", {}, cancellation), nullptr);
+	EXPECT_EQ(MeshLoader::LoadOBJ("TestFiles/Obj/cube.obj", {}, cancellation), nullptr);
+}
+
+TEST(MeshLoaderTest, Load_WhenCancelledWhileReading_ShouldStopAtTheCheck)
+{
+	// Files of more records than a check, the first progress report cancelling the loading.
+	constexpr uint32_t recordCount = MeshLoader::RecordsPerCheck + 100;
+	const std::filesystem::path manyVerticesOFF = "TestFiles/Off/manyVertices.off";
+	const std::filesystem::path manyFacesOFF = "TestFiles/Off/manyFaces.off";
+	const std::filesystem::path manyVerticesOBJ = "TestFiles/Obj/manyVertices.obj";
+	{
+		// Integer coordinates, read as faces of 5 vertices if the reading went on with the faces.
+		std::ofstream file(manyVerticesOFF);
+		file << "OFF\n" << recordCount << " " << recordCount << " 0\n";
+		for(uint32_t iVertex = 0; iVertex < recordCount; ++iVertex)
+			file << "5 5 5\n";
+		for(uint32_t iFace = 0; iFace < recordCount; ++iFace)
+			file << "3 0 1 2\n";
+	}
+	{
+		std::ofstream file(manyFacesOFF);
+		file << "OFF\n3 " << recordCount << " 0\n0 0 0\n1 0 0\n0 1 0\n";
+		for(uint32_t iFace = 0; iFace < recordCount; ++iFace)
+			file << "3 0 1 2\n";
+	}
+	{
+		std::ofstream file(manyVerticesOBJ);
+		for(uint32_t iVertex = 0; iVertex < recordCount; ++iVertex)
+			file << "v 5 5 5\n";
+		file << "f 1 2 3\n";
+	}
+
+	for(const std::filesystem::path& filepath : { manyVerticesOFF, manyFacesOFF, manyVerticesOBJ })
+	{
+		const Core::Parallel::CancellationToken cancellation = Core::Parallel::CancellationToken::Create();
+		uint32_t progressCount = 0;
+		const Core::Parallel::ProgressCallback progress = [&](const float)
+		{
+			++progressCount;
+			cancellation.Cancel();
+		};
+		const std::unique_ptr<Mesh> mesh = filepath.extension() == ".off"
+			? MeshLoader::LoadOFF(filepath, progress, cancellation)
+			: MeshLoader::LoadOBJ(filepath, progress, cancellation);
+		EXPECT_EQ(mesh, nullptr) << filepath;
+		EXPECT_EQ(progressCount, 1) << filepath;
+		std::filesystem::remove(filepath);
+	}
+}
+
+TEST(MeshLoaderTest, LoadOBJ_OBJWithoutVtAndVn_ShouldBeLoaded)
+{
+	std::unique_ptr<Data::Surface::Mesh> mesh = MeshLoader::LoadOBJ("TestFiles/Obj/cube_plain.obj");
+	ASSERT_NE(mesh, nullptr);
+	EXPECT_EQ(mesh->GetVertexCount(), 8);
+	ASSERT_EQ(mesh->GetTriangleCount(), 12);
+	EXPECT_EQ(mesh->GetTriangleData(0).Vertices, (std::array<int, 3>{ 2, 6, 7 }));
+	EXPECT_EQ(mesh->GetTriangleData(11).Vertices, (std::array<int, 3>{ 0, 2, 3 }));
+	EXPECT_FALSE(mesh->GetTriangle(0).HasExtraData<VerticesTexCoordsExtraData>());
+	EXPECT_EQ(MeshIntegrity::CheckIntegrity(*mesh), MeshIntegrity::ExitCode::MeshOK);
+}
+
 TEST(MeshLoaderTest, LoadOBJ_OBJWithVtAndVn_ShouldBeCorrect)
 {
 	std::unique_ptr<Data::Surface::Mesh> mesh = MeshLoader::LoadOBJ("TestFiles/Obj/cube_vtvn.obj");
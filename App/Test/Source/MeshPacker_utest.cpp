@@ -0,0 +1,120 @@
+#include "Application/ExtraDataType.h"
+#include "Application/Mesh.h"
+#include "Application/MeshGenerator.h"
+#include "Application/MeshPacker.h"
+#include "Application/PrimitiveProxy.h"
+#include "Application/TestHelpers.h"
+#include "Core/Parallel.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+using namespace Core::BaseType;
+using namespace Utilitary::Surface;
+using namespace Data::ExtraData;
+using namespace Data::Surface;
+
+TEST(MeshPackerTest, ComputeLayout_ShouldKeepTheVerticesWithoutAttributes)
+{
+	std::unique_ptr<Mesh> mesh = MeshGenerator::CreateGrid(6, 7);
+	const PackedMeshLayout layout = MeshPacker::ComputeLayout(*mesh);
+	EXPECT_EQ(layout.GetVertexCount(), mesh->GetVertexCount());
+	EXPECT_EQ(layout.GetIndexCount(), 3 * mesh->GetTriangleCount());
+	EXPECT_EQ(layout.GetIndexFormat(), PackedIndexFormat::UInt16);
+	EXPECT_EQ(layout.GetVertexBufferSize(), 32 * layout.GetVertexCount());
+	EXPECT_EQ(layout.GetIndexBufferSize(), 2 * layout.GetIndexCount());
+
+	std::vector<PackedVertex> vertices(layout.GetVertexCount());
+	std::vector<uint16_t> indices(layout.GetIndexCount());
+	MeshPacker::PackVertices(*mesh, layout, vertices);
+	MeshPacker::PackIndices(layout, indices);
+	for(TriangleIndex iTriangle = 0; iTriangle < mesh->GetTriangleCount(); ++iTriangle)
+	{
+		for(int iCorner = 0; iCorner < 3; ++iCorner)
+		{
+			const PackedVertex& vertex = vertices[indices[3 * iTriangle + iCorner]];
+			const VertexIndex iVertex = mesh->GetTriangleData(iTriangle).Vertices[iCorner];
+			EXPECT_EQ(vertex.Position, mesh->GetVertexData(iVertex).Position);
+			EXPECT_EQ(vertex.Normal, Vec3{ 0.f });
+			EXPECT_EQ(vertex.TexCoords, Vec2{ 0.f });
+		}
+	}
+}
+
+TEST(MeshPackerTest, ComputeLayout_ShouldSplitTheVerticesOnTheSeams)
+{
+	Mesh mesh = TestHelpers::CreateValidMeshWithED();
+	EXPECT_EQ(MeshPacker::ComputeLayout(mesh, PackedNormalSource::Triangle).GetVertexCount(), 4);
+
+	// The second triangle maps its corner on the vertex 2 elsewhere in the texture, with another normal.
+	auto& texCoords = mesh.GetTriangle(1).GetOrCreateExtraData<VerticesTexCoordsExtraData>();
+	texCoords.SetVertexTexCoords(Vec2{ 0.5f, 0.5f }, 1);
+	const PackedMeshLayout seamLayout = MeshPacker::ComputeLayout(mesh, PackedNormalSource::Triangle);
+	EXPECT_EQ(seamLayout.GetVertexCount(), 5);
+	mesh.GetTriangle(1).GetOrCreateExtraData<TriangleNormalExtraData>().SetData(Vec3{ 0.f, 0.f, 1.f });
+	const PackedMeshLayout creaseLayout = MeshPacker::ComputeLayout(mesh, PackedNormalSource::Triangle);
+	EXPECT_EQ(creaseLayout.GetVertexCount(), 6);
+	EXPECT_EQ(creaseLayout.Indices, std::vector<uint32_t>({ 0, 2, 3, 1, 4, 5 }));
+
+	// The split vertices are consecutive, in the order of their triangles.
+	std::vector<PackedVertex> vertices(creaseLayout.GetVertexCount());
+	MeshPacker::PackVertices(mesh, creaseLayout, vertices);
+	EXPECT_EQ(vertices[3].Position, Vec3(1.f, 1.f, 0.f));
+	EXPECT_EQ(vertices[3].Normal, Vec3(1.f, 0.f, 0.f));
+	EXPECT_EQ(vertices[3].TexCoords, Vec2(1.f, 1.f));
+	EXPECT_EQ(vertices[4].Position, Vec3(1.f, 1.f, 0.f));
+	EXPECT_EQ(vertices[4].Normal, Vec3(0.f, 0.f, 1.f));
+	EXPECT_EQ(vertices[4].TexCoords, Vec2(0.5f, 0.5f));
+}
+
+TEST(MeshPackerTest, ComputeLayout_ShouldFollowTheNormalSource)
+{
+	std::unique_ptr<Mesh> mesh = MeshGenerator::CreateIcosphere(1);
+	mesh->ComputeTriangleNormals(true);
+	mesh->ComputeSmoothVertexNormals(true);
+
+	// The smooth normals never split the vertices, the triangle ones split every corner of a sphere.
+	EXPECT_EQ(MeshPacker::ComputeLayout(*mesh).GetVertexCount(), mesh->GetVertexCount());
+	const PackedMeshLayout flatLayout = MeshPacker::ComputeLayout(*mesh, PackedNormalSource::Triangle);
+	EXPECT_EQ(flatLayout.GetVertexCount(), 3 * mesh->GetTriangleCount());
+
+	std::vector<PackedVertex> vertices(flatLayout.GetVertexCount());
+	MeshPacker::PackVertices(*mesh, flatLayout, vertices);
+	for(TriangleIndex iTriangle = 0; iTriangle < mesh->GetTriangleCount(); ++iTriangle)
+	{
+		const Vec3& normal = mesh->GetTriangle(iTriangle).GetExtraData<TriangleNormalExtraData>()->GetData();
+		for(int iCorner = 0; iCorner < 3; ++iCorner)
+			EXPECT_EQ(vertices[flatLayout.Indices[3 * iTriangle + iCorner]].Normal, normal);
+	}
+}
+
+TEST(MeshPackerTest, PackIndices_ShouldSkipTheDeletedTriangles)
+{
+	std::unique_ptr<Mesh> mesh = MeshGenerator::CreateTerrain(60, 50);
+	mesh->DeleteTriangle(5);
+	Core::Parallel::SetThreadCount(1);
+	const PackedMeshLayout sequentialLayout = MeshPacker::ComputeLayout(*mesh);
+	Core::Parallel::SetThreadCount(3);
+	const PackedMeshLayout layout = MeshPacker::ComputeLayout(*mesh);
+	Core::Parallel::SetThreadCount(0);
+	EXPECT_EQ(layout.Indices, sequentialLayout.Indices);
+	EXPECT_EQ(layout.SourceCorners, sequentialLayout.SourceCorners);
+
+	EXPECT_EQ(layout.GetIndexCount(), 3 * (mesh->GetTriangleCount() - 1));
+	std::vector<uint32_t> indices(layout.GetIndexCount());
+	MeshPacker::PackIndices(layout, indices);
+	EXPECT_EQ(indices, layout.Indices);
+
+	// The triangle following the deleted one takes its indices.
+	std::vector<PackedVertex> vertices(layout.GetVertexCount());
+	MeshPacker::PackVertices(*mesh, layout, vertices);
+	const Data::Primitive::Triangle& nextTriangle = mesh->GetTriangleData(6);
+	for(int iCorner = 0; iCorner < 3; ++iCorner)
+	{
+		const Vec3& position = mesh->GetVertexData(nextTriangle.Vertices[iCorner]).Position;
+		EXPECT_EQ(vertices[indices[3 * 5 + iCorner]].Position, position);
+	}
+}
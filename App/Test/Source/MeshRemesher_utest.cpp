@@ -0,0 +1,106 @@
+#include "Application/ExtraDataType.h"
+#include "Application/Mesh.h"
+#include "Application/MeshIntegrity.h"
+#include "Application/MeshRemesher.h"
+#include "Application/TestHelpers.h"
+#include "Core/MathHelpers.h"
+
+#include <gtest/gtest.h>
+
+using namespace Core::BaseType;
+using namespace Core::Math::Geometry;
+using namespace Utilitary::Surface;
+using namespace Data::Surface;
+using namespace Data::ExtraData;
+
+namespace
+{
+/// @brief Mean length of the edges of a mesh, each interior edge being counted twice.
+float ComputeMeanEdgeLength(const Mesh& mesh)
+{
+	float totalLength = 0.f;
+	for(auto&& curTriangle : mesh.GetTriangles())
+	{
+		for(EdgeIndex iEdge = 0; iEdge < 3; ++iEdge)
+			totalLength += Length(
+				mesh.GetVertexData(curTriangle.Vertices[iEdge]).Position
+				- mesh.GetVertexData(curTriangle.Vertices[(iEdge + 1) % 3]).Position);
+	}
+	return totalLength / static_cast<float>(mesh.GetTriangleCount() * 3);
+}
+} // namespace
+
+TEST(MeshRemesherTest, RemeshIsotropic_FlatGrid_ShouldReachTargetLengthAndPreserveBoundary)
+{
+	Mesh mesh = TestHelpers::CreateGridMesh(10, 10);
+
+	MeshRemesher::RemeshIsotropic(mesh, { .TargetEdgeLength = 0.5f });
+
+	EXPECT_EQ(MeshIntegrity::CheckIntegrity(mesh), MeshIntegrity::ExitCode::MeshOK);
+	EXPECT_GT(mesh.GetTriangleCount(), 200);
+	EXPECT_NEAR(ComputeMeanEdgeLength(mesh), 0.5f, 0.1f);
+
+	// The grid is flat and its boundary vertices are never moved.
+	mesh.UpdateVerticesBoundaryStatus();
+	for(VertexIndex iVertex = 0; iVertex < mesh.GetVertexCount(); ++iVertex)
+	{
+		const Vec3& position = mesh.GetVertexData(iVertex).Position;
+		EXPECT_FLOAT_EQ(position.z, 0.f);
+		if(mesh.GetVertex(iVertex).GetExtraData<IsBoundaryVertexExtraData>()->IsBoundary())
+		{
+			EXPECT_TRUE(position.x == 0.f || position.x == 10.f || position.y == 0.f || position.y == 10.f);
+		}
+	}
+}
+
+TEST(MeshRemesherTest, RemeshIsotropic_ClosedMesh_ShouldKeepTopology)
+{
+	Mesh mesh = TestHelpers::CreateTorusMesh(16, 8);
+
+	MeshRemesher::RemeshIsotropic(mesh, { .TargetEdgeLength = 0.2f, .IterationCount = 5 });
+
+	EXPECT_EQ(MeshIntegrity::CheckIntegrity(mesh), MeshIntegrity::ExitCode::MeshOK);
+	const int euler = static_cast<int>(mesh.GetVertexCount()) - static_cast<int>(mesh.GetTriangleCount()) * 3 / 2
+		+ static_cast<int>(mesh.GetTriangleCount());
+	EXPECT_EQ(euler, 0);
+}
+
+TEST(MeshRemesherTest, RemeshIsotropic_Coarsening_ShouldReduceTriangleCount)
+{
+	Mesh mesh = TestHelpers::CreateTorusMesh(48, 24);
+
+	MeshRemesher::RemeshIsotropic(mesh, { .TargetEdgeLength = 0.6f });
+
+	EXPECT_EQ(MeshIntegrity::CheckIntegrity(mesh), MeshIntegrity::ExitCode::MeshOK);
+	EXPECT_LT(mesh.GetTriangleCount(), 48 * 24 * 2 / 2);
+}
+
+TEST(MeshRemesherTest, RemeshIsotropic_SizingField_ShouldAdaptDensity)
+{
+	Mesh mesh = TestHelpers::CreateGridMesh(10, 10);
+
+	// Fine on the left half of the grid, coarse on the right half.
+	std::vector<float> sizingField(mesh.GetVertexCount());
+	for(VertexIndex iVertex = 0; iVertex < mesh.GetVertexCount(); ++iVertex)
+		sizingField[iVertex] = mesh.GetVertexData(iVertex).Position.x < 5.f ? 0.3f : 1.f;
+
+	MeshRemesher::RemeshIsotropic(mesh, { .SizingField = sizingField });
+
+	EXPECT_EQ(MeshIntegrity::CheckIntegrity(mesh), MeshIntegrity::ExitCode::MeshOK);
+	uint32_t leftVertexCount = 0, rightVertexCount = 0;
+	for(auto&& curVertex : mesh.GetVertices())
+		++(curVertex.Position.x < 5.f ? leftVertexCount : rightVertexCount);
+	EXPECT_GT(leftVertexCount, 3 * rightVertexCount);
+}
+
+TEST(MeshRemesherTest, RemeshIsotropic_WithExtraData_ShouldClearContainers)
+{
+	Mesh mesh = TestHelpers::CreateTorusMesh(16, 8);
+	mesh.ComputeTriangleNormals(true);
+	mesh.ComputeSmoothVertexNormals(true);
+
+	MeshRemesher::RemeshIsotropic(mesh, { .TargetEdgeLength = 0.3f, .IterationCount = 2 });
+
+	EXPECT_FALSE(mesh.HasTrianglesExtraDataContainer());
+	EXPECT_FALSE(mesh.HasVerticesExtraDataContainer());
+}
@@ -0,0 +1,117 @@
+#include "Application/ExtraDataType.h"
+#include "Application/Mesh.h"
+#include "Application/MeshIntegrity.h"
+#include "Application/MeshReorderer.h"
+#include "Application/PrimitiveProxy.h"
+#include "Application/TestHelpers.h"
+#include "Core/MathHelpers.h"
+
+#include <gtest/gtest.h>
+
+using namespace Core::BaseType;
+using namespace Core::Math::Geometry;
+using namespace Core::Math::Compare;
+using namespace Utilitary::Surface;
+using namespace Data::Surface;
+using namespace Data::ExtraData;
+
+namespace
+{
+/// @brief Mean distance between the vertices stored next to each other.
+float ComputeMeanConsecutiveDistance(const Mesh& mesh)
+{
+	float totalDistance = 0.f;
+	for(VertexIndex iVertex = 1; iVertex < mesh.GetVertexCount(); ++iVertex)
+		totalDistance += Length(mesh.GetVertexData(iVertex).Position - mesh.GetVertexData(iVertex - 1).Position);
+	return totalDistance / static_cast<float>(mesh.GetVertexCount() - 1);
+}
+
+/// @brief Check that the normal stored on each triangle is still the normal of its vertices.
+void ExpectTriangleNormalsFollowTriangles(Mesh& mesh)
+{
+	for(TriangleIndex iTriangle = 0; iTriangle < mesh.GetTriangleCount(); ++iTriangle)
+	{
+		const auto& vertices = mesh.GetTriangleData(iTriangle).Vertices;
+		const Vec3& posA = mesh.GetVertexData(vertices[0]).Position;
+		const Vec3 expectedNormal = Normalize(
+			Cross(mesh.GetVertexData(vertices[1]).Position - posA, mesh.GetVertexData(vertices[2]).Position - posA));
+
+		auto curTriangleExtraData = mesh.GetTriangle(iTriangle).GetExtraData<TriangleNormalExtraData>();
+		ASSERT_NE(curTriangleExtraData, nullptr);
+		EXPECT_TRUE(EqualNear(curTriangleExtraData->GetData(), expectedNormal, 1e-5f));
+	}
+}
+} // namespace
+
+TEST(MeshReordererTest, ReorderVertices_Hilbert_ShouldImproveLocality)
+{
+	Mesh mesh = TestHelpers::CreateShuffledMesh(TestHelpers::CreateGridMesh(32, 32));
+	mesh.ComputeTriangleNormals(true);
+	ASSERT_GT(ComputeMeanConsecutiveDistance(mesh), 5.f);
+
+	MeshReorderer::ReorderVertices(mesh, SpaceFillingCurve::Hilbert);
+
+	EXPECT_EQ(MeshIntegrity::CheckIntegrity(mesh), MeshIntegrity::ExitCode::MeshOK);
+	EXPECT_EQ(mesh.GetVertexCount(), 33 * 33);
+	EXPECT_EQ(mesh.GetTriangleCount(), 2 * 32 * 32);
+	// Consecutive cells of the Hilbert curve are adjacent, only the quantization rounding breaks a few steps.
+	EXPECT_LT(ComputeMeanConsecutiveDistance(mesh), 1.5f);
+	ExpectTriangleNormalsFollowTriangles(mesh);
+}
+
+TEST(MeshReordererTest, ReorderVertices_Morton_ShouldImproveLocality)
+{
+	Mesh mesh = TestHelpers::CreateShuffledMesh(TestHelpers::CreateTorusMesh(32, 16));
+
+	MeshReorderer::ReorderVertices(mesh, SpaceFillingCurve::Morton);
+
+	EXPECT_EQ(MeshIntegrity::CheckIntegrity(mesh), MeshIntegrity::ExitCode::MeshOK);
+	EXPECT_LT(ComputeMeanConsecutiveDistance(mesh), 0.6f);
+}
+
+TEST(MeshReordererTest, ReorderTriangles_ShouldReduceCacheMisses)
+{
+	Mesh mesh = TestHelpers::CreateShuffledMesh(TestHelpers::CreateGridMesh(32, 32));
+	mesh.ComputeTriangleNormals(true);
+	const float shuffledACMR = MeshReorderer::ComputeACMR(mesh);
+
+	MeshReorderer::ReorderTriangles(mesh);
+
+	EXPECT_EQ(MeshIntegrity::CheckIntegrity(mesh), MeshIntegrity::ExitCode::MeshOK);
+	EXPECT_GT(shuffledACMR, 2.f);
+	EXPECT_LT(MeshReorderer::ComputeACMR(mesh), 0.8f);
+	ExpectTriangleNormalsFollowTriangles(mesh);
+}
+
+TEST(MeshReordererTest, ComputeACMR_ShouldSimulateAFifoOfTheCacheSize)
+{
+	Mesh mesh;
+
+	// Fan of three triangles around the vertex 0.
+	mesh.AddVertex({ .Position = { 0., 0., 0. } });
+	mesh.AddVertex({ .Position = { 1., 0., 0. } });
+	mesh.AddVertex({ .Position = { 1., 1., 0. } });
+	mesh.AddVertex({ .Position = { 0., 1., 0. } });
+	mesh.AddVertex({ .Position = { -1., 1., 0. } });
+	mesh.AddTriangle({ .Vertices = { 0, 1, 2 } });
+	mesh.AddTriangle({ .Vertices = { 0, 2, 3 } });
+	mesh.AddTriangle({ .Vertices = { 0, 3, 4 } });
+
+	// Size 3: 0, 1, 2 miss, then 3 evicts 0, then 0 evicts 1 and 4 evicts 2.
+	EXPECT_FLOAT_EQ(MeshReorderer::ComputeACMR(mesh, 3), 6.f / 3.f);
+	// Size 4: only the first use of each vertex misses.
+	EXPECT_FLOAT_EQ(MeshReorderer::ComputeACMR(mesh, 4), 5.f / 3.f);
+}
+
+TEST(MeshReordererTest, Reorder_WithDeletedElements_ShouldGarbageCollect)
+{
+	Mesh mesh = TestHelpers::CreateShuffledMesh(TestHelpers::CreateTorusMesh(16, 8));
+	mesh.DeleteVertex(0);
+
+	MeshReorderer::Reorder(mesh);
+
+	EXPECT_FALSE(mesh.HasGarbage());
+	EXPECT_EQ(mesh.GetVertexCount(), 16 * 8 - 1);
+	EXPECT_EQ(mesh.GetTriangleCount(), 16 * 8 * 2 - 6);
+	EXPECT_EQ(MeshIntegrity::CheckIntegrity(mesh), MeshIntegrity::ExitCode::MeshOK);
+}
@@ -0,0 +1,207 @@
+#include "Application/Mesh.h"
+#include "Application/MeshGenerator.h"
+#include "Application/MeshIntegrity.h"
+#include "Application/MeshRepairer.h"
+#include "Application/TestHelpers.h"
+#include "Core/MathHelpers.h"
+#include "Core/Parallel.h"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <memory>
+#include <utility>
+
+using namespace Core::BaseType;
+using namespace Core::Math::Geometry;
+using namespace Utilitary::Surface;
+using namespace Data::Surface;
+
+namespace
+{
+/// @brief Check that the mesh passes both the fast integrity check and the full report.
+void ExpectRepaired(const Mesh& mesh)
+{
+	EXPECT_EQ(MeshIntegrity::CheckIntegrity(mesh), MeshIntegrity::ExitCode::MeshOK);
+	const MeshIntegrity::Report report = MeshIntegrity::BuildReport(mesh);
+	EXPECT_TRUE(report.IsValid()) << report.ToString();
+}
+
+/// @brief Signed volume enclosed by the triangles.
+float ComputeSignedVolume(const Mesh& mesh)
+{
+	float volume = 0.f;
+	for(TriangleIndex iTriangle = 0; iTriangle < mesh.GetTriangleCount(); ++iTriangle)
+	{
+		const auto& vertices = mesh.GetTriangleData(iTriangle).Vertices;
+		volume += Dot(mesh.GetVertexData(vertices[0]).Position,
+					  Cross(mesh.GetVertexData(vertices[1]).Position, mesh.GetVertexData(vertices[2]).Position));
+	}
+	return volume / 6.f;
+}
+
+/// @brief Number of triangle edges without neighbor.
+uint32_t CountBoundaryEdges(const Mesh& mesh)
+{
+	uint32_t count = 0;
+	for(TriangleIndex iTriangle = 0; iTriangle < mesh.GetTriangleCount(); ++iTriangle)
+		for(const int neighborIdx : mesh.GetTriangleData(iTriangle).Neighbors)
+			count += neighborIdx == -1 ? 1 : 0;
+	return count;
+}
+} // namespace
+
+TEST(MeshRepairerTest, Repair_OnValidMesh_ShouldKeepElements)
+{
+	std::unique_ptr<Mesh> mesh = MeshGenerator::CreateTorus(20, 10);
+	const Mesh expectedMesh(*mesh);
+
+	const RepairSummary summary = MeshRepairer::Repair(*mesh);
+
+	EXPECT_EQ(summary.InvalidTriangleCount + summary.DegenerateTriangleCount + summary.DuplicatedTriangleCount, 0);
+	EXPECT_EQ(summary.FlippedTriangleCount, 0);
+	EXPECT_EQ(summary.SplitVertexCount, 0);
+	EXPECT_EQ(summary.FilledHoleCount, 0);
+	ASSERT_EQ(mesh->GetVertexCount(), expectedMesh.GetVertexCount());
+	ASSERT_EQ(mesh->GetTriangleCount(), expectedMesh.GetTriangleCount());
+	for(TriangleIndex iTriangle = 0; iTriangle < mesh->GetTriangleCount(); ++iTriangle)
+	{
+		EXPECT_EQ(mesh->GetTriangleData(iTriangle).Vertices, expectedMesh.GetTriangleData(iTriangle).Vertices);
+		EXPECT_EQ(mesh->GetTriangleData(iTriangle).Neighbors, expectedMesh.GetTriangleData(iTriangle).Neighbors);
+	}
+	ExpectRepaired(*mesh);
+}
+
+TEST(MeshRepairerTest, Repair_ShouldRemoveInvalidDegenerateAndDuplicatedTriangles)
+{
+	Mesh mesh = TestHelpers::CreateValidMesh();
+
+	// A vertex aligned with the first two ones, and broken neighbors.
+	mesh.AddVertex({ .Position = { 2., 0., 0. } });
+	mesh.AddTriangle({ .Vertices = { 0, 1, 1 } });
+	mesh.AddTriangle({ .Vertices = { 0, 1, 7 } });
+	mesh.AddTriangle({ .Vertices = { 0, 1, 4 }, .Neighbors = { 5, 5, 5 } });
+	mesh.AddTriangle({ .Vertices = { 2, 0, 1 }, .Neighbors = { 1, 1, 1 } });
+	mesh.GetTriangleData(0).Neighbors = { 3, 0, -1 };
+
+	const RepairSummary summary = MeshRepairer::Repair(mesh, { .MaxHoleEdgeCount = 0 });
+
+	EXPECT_EQ(summary.InvalidTriangleCount, 2);
+	EXPECT_EQ(summary.DegenerateTriangleCount, 1);
+	EXPECT_EQ(summary.DuplicatedTriangleCount, 1);
+	EXPECT_EQ(summary.UnreferencedVertexCount, 1);
+	EXPECT_EQ(mesh.GetVertexCount(), 4);
+	EXPECT_EQ(mesh.GetTriangleCount(), 2);
+	EXPECT_EQ(mesh.GetTriangleData(0).Neighbors, (std::array<int, 3>{ -1, 1, -1 }));
+	ExpectRepaired(mesh);
+}
+
+TEST(MeshRepairerTest, Repair_ShouldMakeOrientationConsistentAndOutwards)
+{
+	std::unique_ptr<Mesh> mesh = MeshGenerator::CreateIcosphere(2);
+	const float expectedVolume = ComputeSignedVolume(*mesh);
+
+	// Flip a triangle out of three, then every triangle.
+	uint32_t flippedCount = 0;
+	for(TriangleIndex iTriangle = 0; iTriangle < mesh->GetTriangleCount(); iTriangle += 3, ++flippedCount)
+		std::swap(mesh->GetTriangleData(iTriangle).Vertices[1], mesh->GetTriangleData(iTriangle).Vertices[2]);
+
+	EXPECT_EQ(MeshRepairer::Repair(*mesh).FlippedTriangleCount, flippedCount);
+	EXPECT_NEAR(ComputeSignedVolume(*mesh), expectedVolume, 1e-4f);
+	ExpectRepaired(*mesh);
+
+	for(TriangleIndex iTriangle = 0; iTriangle < mesh->GetTriangleCount(); ++iTriangle)
+		std::swap(mesh->GetTriangleData(iTriangle).Vertices[1], mesh->GetTriangleData(iTriangle).Vertices[2]);
+
+	EXPECT_EQ(MeshRepairer::Repair(*mesh).FlippedTriangleCount, mesh->GetTriangleCount());
+	EXPECT_NEAR(ComputeSignedVolume(*mesh), expectedVolume, 1e-4f);
+	ExpectRepaired(*mesh);
+}
+
+TEST(MeshRepairerTest, Repair_ShouldSplitNonManifoldVertex)
+{
+	Mesh mesh = TestHelpers::CreateBowtieMesh();
+
+	const RepairSummary summary = MeshRepairer::Repair(mesh);
+
+	EXPECT_EQ(summary.SplitVertexCount, 1);
+	EXPECT_EQ(summary.FilledHoleCount, 0);
+	ASSERT_EQ(mesh.GetVertexCount(), 6);
+	EXPECT_EQ(mesh.GetVertexData(5).Position, mesh.GetVertexData(0).Position);
+	EXPECT_EQ(mesh.GetTriangleData(1).Vertices[0], 5);
+	ExpectRepaired(mesh);
+}
+
+TEST(MeshRepairerTest, Repair_ShouldCutNonManifoldEdge)
+{
+	Mesh mesh = TestHelpers::CreateValidMesh();
+
+	// A third triangle on the edge from vertex 0 to vertex 2.
+	mesh.AddVertex({ .Position = { 1., 0., 1. } });
+	mesh.AddTriangle({ .Vertices = { 2, 0, 4 } });
+
+	const RepairSummary summary = MeshRepairer::Repair(mesh, { .MaxHoleEdgeCount = 0 });
+
+	EXPECT_EQ(summary.SplitVertexCount, 4);
+	EXPECT_EQ(mesh.GetTriangleCount(), 3);
+	EXPECT_EQ(CountBoundaryEdges(mesh), 9);
+	ExpectRepaired(mesh);
+}
+
+TEST(MeshRepairerTest, Repair_ShouldFillSmallHoles)
+{
+	std::unique_ptr<Mesh> mesh = MeshGenerator::CreateIcosphere(1);
+	const uint32_t triangleCount = mesh->GetTriangleCount();
+
+	// Remove the star of an original vertex of the icosahedron (5 triangles) and of a subdivision vertex (6 ones).
+	mesh->DeleteVertex(0);
+	mesh->DeleteVertex(mesh->GetVertexCount() - 1);
+
+	Mesh unfilledMesh(*mesh);
+	const RepairSummary unfilledSummary = MeshRepairer::Repair(unfilledMesh, { .MaxHoleEdgeCount = 5 });
+	EXPECT_EQ(unfilledSummary.FilledHoleCount, 1);
+	EXPECT_EQ(unfilledSummary.FillTriangleCount, 3);
+	EXPECT_EQ(CountBoundaryEdges(unfilledMesh), 6);
+	ExpectRepaired(unfilledMesh);
+
+	const RepairSummary summary = MeshRepairer::Repair(*mesh);
+	EXPECT_EQ(summary.FilledHoleCount, 2);
+	EXPECT_EQ(summary.FillTriangleCount, 7);
+	EXPECT_EQ(mesh->GetTriangleCount(), triangleCount - 4);
+	EXPECT_EQ(CountBoundaryEdges(*mesh), 0);
+	EXPECT_GT(ComputeSignedVolume(*mesh), 0.f);
+	ExpectRepaired(*mesh);
+}
+
+TEST(MeshRepairerTest, Repair_ShouldNotDependOnThreadCount)
+{
+	std::unique_ptr<Mesh> mesh = MeshGenerator::CreateTorus(120, 60);
+
+	// Flip, duplicate and remove triangles all over the mesh.
+	for(TriangleIndex iTriangle = 0; iTriangle < mesh->GetTriangleCount(); iTriangle += 7)
+		std::swap(mesh->GetTriangleData(iTriangle).Vertices[1], mesh->GetTriangleData(iTriangle).Vertices[2]);
+	for(TriangleIndex iTriangle = 5; iTriangle < mesh->GetTriangleCount(); iTriangle += 501)
+		mesh->AddTriangle({ .Vertices = mesh->GetTriangleData(iTriangle).Vertices });
+	for(TriangleIndex iTriangle = 3; iTriangle < mesh->GetTriangleCount(); iTriangle += 997)
+		mesh->DeleteTriangle(iTriangle);
+
+	Mesh parallelMesh(*mesh);
+	Core::Parallel::SetThreadCount(1);
+	const RepairSummary serialSummary = MeshRepairer::Repair(*mesh);
+	Core::Parallel::SetThreadCount(4);
+	const RepairSummary parallelSummary = MeshRepairer::Repair(parallelMesh);
+	Core::Parallel::SetThreadCount(0);
+
+	EXPECT_GT(serialSummary.DuplicatedTriangleCount, 0);
+	EXPECT_GT(serialSummary.FilledHoleCount, 0);
+	EXPECT_EQ(parallelSummary.FlippedTriangleCount, serialSummary.FlippedTriangleCount);
+	EXPECT_EQ(parallelSummary.FillTriangleCount, serialSummary.FillTriangleCount);
+	ASSERT_EQ(parallelMesh.GetTriangleCount(), mesh->GetTriangleCount());
+	for(TriangleIndex iTriangle = 0; iTriangle < mesh->GetTriangleCount(); ++iTriangle)
+	{
+		ASSERT_EQ(parallelMesh.GetTriangleData(iTriangle).Vertices, mesh->GetTriangleData(iTriangle).Vertices);
+		ASSERT_EQ(parallelMesh.GetTriangleData(iTriangle).Neighbors, mesh->GetTriangleData(iTriangle).Neighbors);
+	}
+	EXPECT_EQ(CountBoundaryEdges(*mesh), 0);
+	ExpectRepaired(*mesh);
+}
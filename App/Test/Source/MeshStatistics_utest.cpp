@@ -0,0 +1,85 @@
+#include "Application/Mesh.h"
+#include "Application/MeshGenerator.h"
+#include "Application/MeshStatistics.h"
+#include "Application/TestHelpers.h"
+#include "Core/Parallel.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <numbers>
+#include <numeric>
+#include <vector>
+
+using namespace Core::BaseType;
+using namespace Utilitary::Surface;
+using namespace Data::Surface;
+
+TEST(MeshStatisticsTest, ComputeOneRingStatistics_ShouldScatterTrianglesOnTheirCorners)
+{
+	const Mesh mesh = TestHelpers::CreateValidMesh();
+	constexpr float halfPi = 0.5f * std::numbers::pi_v<float>;
+
+	const OneRingStatistics statistics = MeshStatistics::ComputeOneRingStatistics(mesh);
+
+	EXPECT_EQ(statistics.Valences, (std::vector<uint32_t>{ 3, 2, 3, 2 }));
+	EXPECT_EQ(statistics.TriangleCounts, (std::vector<uint32_t>{ 2, 1, 2, 1 }));
+	for(VertexIndex iVertex = 0; iVertex < mesh.GetVertexCount(); ++iVertex)
+	{
+		EXPECT_FLOAT_EQ(statistics.Areas[iVertex], 0.5f * statistics.TriangleCounts[iVertex]);
+		EXPECT_FLOAT_EQ(statistics.AngleSums[iVertex], halfPi);
+		EXPECT_TRUE(statistics.IsBoundaryVertex(iVertex));
+		EXPECT_FLOAT_EQ(statistics.GetAngleDefect(iVertex), halfPi);
+	}
+}
+
+TEST(MeshStatisticsTest, ComputeOneRingStatistics_OnSphere_ShouldSatisfyGaussBonnet)
+{
+	const std::unique_ptr<Mesh> mesh = MeshGenerator::CreateIcosphere(3);
+
+	const OneRingStatistics statistics = MeshStatistics::ComputeOneRingStatistics(*mesh);
+
+	float angleDefectSum = 0.f;
+	for(VertexIndex iVertex = 0; iVertex < mesh->GetVertexCount(); ++iVertex)
+	{
+		EXPECT_FALSE(statistics.IsBoundaryVertex(iVertex));
+		EXPECT_EQ(statistics.Valences[iVertex], iVertex < 12 ? 5 : 6);
+		angleDefectSum += statistics.GetAngleDefect(iVertex);
+	}
+	EXPECT_NEAR(angleDefectSum, 4.f * std::numbers::pi_v<float>, 1e-3f);
+
+	// Each triangle is counted by its three corners, the sphere area is close to 4 pi.
+	const float areaSum = std::accumulate(statistics.Areas.begin(), statistics.Areas.end(), 0.f);
+	EXPECT_NEAR(areaSum / 3.f, 4.f * std::numbers::pi_v<float>, 0.1f);
+}
+
+TEST(MeshStatisticsTest, ComputeOneRingStatistics_ShouldMatchCirculators)
+{
+	std::unique_ptr<Mesh> mesh = MeshGenerator::CreateTorus(120, 60);
+	for(TriangleIndex iTriangle = 3; iTriangle < mesh->GetTriangleCount(); iTriangle += 97)
+		mesh->DeleteTriangle(iTriangle);
+
+	Core::Parallel::SetThreadCount(1);
+	const OneRingStatistics serialStatistics = MeshStatistics::ComputeOneRingStatistics(*mesh);
+	Core::Parallel::SetThreadCount(4);
+	const OneRingStatistics statistics = MeshStatistics::ComputeOneRingStatistics(*mesh);
+	Core::Parallel::SetThreadCount(0);
+
+	EXPECT_EQ(statistics.Valences, serialStatistics.Valences);
+	EXPECT_EQ(statistics.TriangleCounts, serialStatistics.TriangleCounts);
+	for(VertexIndex iVertex = 0; iVertex < mesh->GetVertexCount(); ++iVertex)
+	{
+		EXPECT_NEAR(statistics.Areas[iVertex], serialStatistics.Areas[iVertex], 1e-6f);
+		EXPECT_NEAR(statistics.AngleSums[iVertex], serialStatistics.AngleSums[iVertex], 1e-5f);
+
+		uint32_t triangleCount = 0;
+		for([[maybe_unused]] const TriangleIndex triangleIdx : mesh->GetTrianglesAroundVertex(iVertex))
+			++triangleCount;
+		uint32_t valence = 0;
+		for([[maybe_unused]] const VertexIndex vertexIdx : mesh->GetVerticesAroundVertex(iVertex))
+			++valence;
+		ASSERT_EQ(statistics.TriangleCounts[iVertex], triangleCount);
+		ASSERT_EQ(statistics.Valences[iVertex], valence);
+		EXPECT_EQ(statistics.IsBoundaryVertex(iVertex), mesh->IsBoundaryVertex(iVertex));
+	}
+}
@@ -5,6 +5,7 @@
 #include "Application/PrimitiveProxy.h"
 #include "Application/TestHelpers.h"
 #include "Core/MathHelpers.h"
+#include "Core/Parallel.h"
 
 #include <gtest/gtest.h>
 
@@ -34,6 +35,22 @@ TEST(MeshTest, CopyConstructor_ShouldDeepCopyMesh)
 	EXPECT_NE(copiedMesh.GetTriangleData(0).Vertices[0], originalMesh.GetTriangleData(0).Vertices[0]);
 }
 
+TEST(MeshTest, CopyAssignment_ShouldDeepCopyMeshAndShareItsCaches)
+{
+	Mesh originalMesh = TestHelpers::CreateGridMesh(2, 2);
+	const auto boundaryLoops = originalMesh.GetBoundaryLoops();
+
+	Mesh copiedMesh = TestHelpers::CreateValidMesh();
+	copiedMesh = originalMesh;
+
+	EXPECT_EQ(copiedMesh.GetVertexCount(), originalMesh.GetVertexCount());
+	EXPECT_EQ(copiedMesh.GetTriangleCount(), originalMesh.GetTriangleCount());
+	EXPECT_EQ(copiedMesh.GetBoundaryLoops(), boundaryLoops);
+
+	originalMesh.SetVertexPosition(0, { 2., 2., 2. });
+	EXPECT_NE(copiedMesh.GetVertexData(0).Position, originalMesh.GetVertexData(0).Position);
+}
+
 TEST(MeshTest, AddVertexAndFace_ShouldReturnCorrectIndices)
 {
 	Mesh mesh;
@@ -256,6 +273,29 @@ TEST(MeshTest, ComputeSmoothVertexNormals_ShouldComputeEachSmoothVertexNormal)
 	}
 }
 
+TEST(MeshTest, ComputeSmoothVertexNormals_ShouldNotDependOnThreadCount)
+{
+	Mesh serialMesh = TestHelpers::CreateTorusMesh(48, 24);
+	Mesh mesh(serialMesh);
+
+	Core::Parallel::SetThreadCount(1);
+	serialMesh.ComputeTriangleNormals();
+	serialMesh.ComputeSmoothVertexNormals(true);
+	Core::Parallel::SetThreadCount(4);
+	mesh.ComputeTriangleNormals();
+	mesh.ComputeSmoothVertexNormals(true);
+	Core::Parallel::SetThreadCount(0);
+
+	for(VertexIndex iVertex = 0; iVertex < mesh.GetVertexCount(); ++iVertex)
+	{
+		const Vec3& normal = mesh.GetVertex(iVertex).GetExtraData<SmoothVertexNormalExtraData>()->GetData();
+		const Vec3& serialNormal =
+			serialMesh.GetVertex(iVertex).GetExtraData<SmoothVertexNormalExtraData>()->GetData();
+		ASSERT_EQ(normal, serialNormal) << "Vertex " << iVertex;
+		EXPECT_NEAR(Core::Math::Geometry::Length(normal), 1.f, 1e-5f);
+	}
+}
+
 TEST(MeshTest, UpdateVerticesBoudaryStatus_ShouldUpdateEachVertexBoundaryStatus)
 {
 	Mesh mesh = TestHelpers::CreateGridMesh(2, 2);
@@ -272,3 +312,198 @@ TEST(MeshTest, UpdateVerticesBoudaryStatus_ShouldUpdateEachVertexBoundaryStatus)
 	EXPECT_TRUE(mesh.GetVertex(7).GetExtraData<IsBoundaryVertexExtraData>()->IsBoundary());
 	EXPECT_TRUE(mesh.GetVertex(8).GetExtraData<IsBoundaryVertexExtraData>()->IsBoundary());
 }
+
+TEST(MeshTest, IsBoundaryVertex_ShouldDetectBoundaryVertices)
+{
+	Mesh mesh = TestHelpers::CreateGridMesh(2, 2);
+
+	for(VertexIndex iVertex = 0; iVertex < mesh.GetVertexCount(); ++iVertex)
+		EXPECT_EQ(mesh.IsBoundaryVertex(iVertex), iVertex != 4);
+}
+
+TEST(MeshTest, FlipEdge_InteriorEdge_ShouldSwapDiagonal)
+{
+	Mesh mesh = TestHelpers::CreateGridMesh(2, 2);
+	const uint64_t revision = mesh.GetTopologyRevision();
+
+	// The first triangle (0, 1, 4) shares the edge 0-4 with the second triangle (0, 4, 3).
+	ASSERT_TRUE(mesh.FlipEdge(0, 1));
+	EXPECT_GT(mesh.GetTopologyRevision(), revision);
+
+	EXPECT_EQ(mesh.GetTriangleCount(), 8);
+	EXPECT_EQ(MeshIntegrity::CheckIntegrity(mesh), MeshIntegrity::ExitCode::MeshOK);
+	EXPECT_EQ(Utilitary::Primitive::GetEdgeIndex(mesh.GetTriangleData(0), 0, 4), -1);
+	EXPECT_NE(Utilitary::Primitive::GetEdgeIndex(mesh.GetTriangleData(0), 1, 3), -1);
+}
+
+TEST(MeshTest, FlipEdge_BoundaryEdge_ShouldFail)
+{
+	Mesh mesh = TestHelpers::CreateGridMesh(2, 2);
+	const uint64_t revision = mesh.GetTopologyRevision();
+
+	EXPECT_FALSE(mesh.FlipEdge(0, 2));
+	EXPECT_EQ(mesh.GetTriangleData(0).Vertices, (std::array<int, 3>{ 0, 1, 4 }));
+	EXPECT_EQ(mesh.GetTopologyRevision(), revision);
+}
+
+TEST(MeshTest, SplitEdge_InteriorEdge_ShouldSplitBothTriangles)
+{
+	Mesh mesh = TestHelpers::CreateGridMesh(2, 2);
+
+	const VertexIndex newVertexIdx = mesh.SplitEdge(0, 1, { 0.5f, 0.5f, 0.f });
+
+	EXPECT_EQ(newVertexIdx, 9);
+	EXPECT_EQ(mesh.GetVertexCount(), 10);
+	EXPECT_EQ(mesh.GetTriangleCount(), 10);
+	EXPECT_EQ(MeshIntegrity::CheckIntegrity(mesh), MeshIntegrity::ExitCode::MeshOK);
+	EXPECT_FALSE(mesh.IsBoundaryVertex(newVertexIdx));
+}
+
+TEST(MeshTest, SplitEdge_BoundaryEdge_ShouldSplitOneTriangle)
+{
+	Mesh mesh = TestHelpers::CreateGridMesh(2, 2);
+
+	const VertexIndex newVertexIdx = mesh.SplitEdge(0, 2, { 0.5f, 0.f, 0.f });
+
+	EXPECT_EQ(mesh.GetVertexCount(), 10);
+	EXPECT_EQ(mesh.GetTriangleCount(), 9);
+	EXPECT_EQ(MeshIntegrity::CheckIntegrity(mesh), MeshIntegrity::ExitCode::MeshOK);
+	EXPECT_TRUE(mesh.IsBoundaryVertex(newVertexIdx));
+}
+
+TEST(MeshTest, SplitTriangle_ShouldCreateThreeTriangles)
+{
+	Mesh mesh = TestHelpers::CreateGridMesh(2, 2);
+
+	const VertexIndex newVertexIdx = mesh.SplitTriangle(3, { 1.3f, 0.6f, 0.f });
+
+	EXPECT_EQ(mesh.GetVertexCount(), 10);
+	EXPECT_EQ(mesh.GetTriangleCount(), 10);
+	EXPECT_EQ(MeshIntegrity::CheckIntegrity(mesh), MeshIntegrity::ExitCode::MeshOK);
+
+	uint32_t triangleCount = 0;
+	for([[maybe_unused]] TriangleIndex triangleIdx : mesh.GetTrianglesAroundVertex(newVertexIdx))
+		++triangleCount;
+	EXPECT_EQ(triangleCount, 3);
+}
+
+TEST(MeshTest, CollapseEdge_InteriorEdge_ShouldRemoveOneVertexAndTwoTriangles)
+{
+	Mesh mesh = TestHelpers::CreateTorusMesh(8, 6);
+	mesh.ComputeTriangleNormals();
+
+	const VertexIndex removedVertexIdx = mesh.GetTriangleData(0).Vertices[2];
+	ASSERT_TRUE(mesh.CollapseEdge(0, 0, mesh.GetVertexData(mesh.GetTriangleData(0).Vertices[1]).Position));
+
+	// The removed elements are deleted but keep their slots until the garbage collection.
+	EXPECT_TRUE(mesh.IsVertexDeleted(removedVertexIdx));
+	EXPECT_TRUE(mesh.IsTriangleDeleted(0));
+	EXPECT_EQ(mesh.GetVertexCount(), 48);
+	EXPECT_EQ(MeshIntegrity::CheckIntegrity(mesh), MeshIntegrity::ExitCode::MeshOK);
+
+	mesh.GarbageCollect();
+	EXPECT_EQ(mesh.GetVertexCount(), 47);
+	EXPECT_EQ(mesh.GetTriangleCount(), 94);
+	EXPECT_EQ(MeshIntegrity::CheckIntegrity(mesh), MeshIntegrity::ExitCode::MeshOK);
+	for(TriangleIndex iTriangle = 0; iTriangle < mesh.GetTriangleCount(); ++iTriangle)
+		EXPECT_TRUE(mesh.GetTriangle(iTriangle).HasExtraData<TriangleNormalExtraData>());
+}
+
+TEST(MeshTest, CollapseEdge_BoundaryEdge_ShouldRemoveOneVertexAndOneTriangle)
+{
+	Mesh mesh = TestHelpers::CreateGridMesh(3, 3);
+
+	// The edge 1-2 lies on the bottom boundary of the grid.
+	ASSERT_TRUE(mesh.CollapseEdge(2, 2, { 1.5f, 0.f, 0.f }));
+	mesh.GarbageCollect();
+
+	EXPECT_EQ(mesh.GetVertexCount(), 15);
+	EXPECT_EQ(mesh.GetTriangleCount(), 17);
+	EXPECT_EQ(MeshIntegrity::CheckIntegrity(mesh), MeshIntegrity::ExitCode::MeshOK);
+}
+
+TEST(MeshTest, CollapseEdge_InvalidCollapse_ShouldLeaveMeshUnchanged)
+{
+	// The edge 1-5 is interior but joins two boundary vertices.
+	Mesh grid = TestHelpers::CreateGridMesh(2, 2);
+	EXPECT_FALSE(grid.IsCollapseValid(3, 2));
+	EXPECT_FALSE(grid.CollapseEdge(3, 2, { 1.5f, 0.5f, 0.f }));
+	EXPECT_EQ(grid.GetVertexCount(), 9);
+	EXPECT_EQ(grid.GetTriangleCount(), 8);
+
+	// Collapsing an edge opposite to a vertex with three triangles would fold the two remaining ones.
+	Mesh torus = TestHelpers::CreateTorusMesh(8, 6);
+	torus.SplitTriangle(0, torus.GetVertexData(0).Position);
+	EXPECT_FALSE(torus.IsCollapseValid(0, 2));
+	EXPECT_EQ(torus.GetVertexCount(), 49);
+	EXPECT_EQ(torus.GetTriangleCount(), 98);
+}
+
+TEST(MeshTest, DeleteTriangle_ShouldKeepIntegrity)
+{
+	Mesh mesh = TestHelpers::CreateGridMesh(2, 2);
+
+	// Deleting the two triangles of the corner 0 leaves the vertex 0 isolated, so it is deleted too.
+	mesh.DeleteTriangle(0);
+	mesh.DeleteTriangle(1);
+
+	EXPECT_TRUE(mesh.HasGarbage());
+	EXPECT_TRUE(mesh.IsTriangleDeleted(0));
+	EXPECT_TRUE(mesh.IsVertexDeleted(0));
+	EXPECT_FALSE(mesh.IsVertexDeleted(4));
+	EXPECT_EQ(mesh.GetTriangleData(2).Neighbors, (std::array<int, 3>{ -1, 3, -1 }));
+	EXPECT_EQ(MeshIntegrity::CheckIntegrity(mesh), MeshIntegrity::ExitCode::MeshOK);
+}
+
+TEST(MeshTest, DeleteVertex_ShouldDeleteItsStar)
+{
+	Mesh mesh = TestHelpers::CreateGridMesh(2, 2);
+
+	// The center vertex is shared by the six triangles, only two triangles on the corners remain.
+	mesh.DeleteVertex(4);
+
+	uint32_t aliveTriangleCount = 0;
+	for(TriangleIndex iTriangle = 0; iTriangle < mesh.GetTriangleCount(); ++iTriangle)
+		aliveTriangleCount += !mesh.IsTriangleDeleted(iTriangle);
+	EXPECT_EQ(aliveTriangleCount, 2);
+	EXPECT_TRUE(mesh.IsVertexDeleted(4));
+	EXPECT_EQ(MeshIntegrity::CheckIntegrity(mesh), MeshIntegrity::ExitCode::MeshOK);
+}
+
+TEST(MeshTest, GarbageCollect_ShouldCompactAndRemapIndices)
+{
+	Mesh mesh = TestHelpers::CreateGridMesh(2, 2);
+	mesh.ComputeTriangleNormals(true);
+	mesh.DeleteTriangle(0);
+	mesh.DeleteTriangle(1);
+
+	mesh.GarbageCollect();
+
+	EXPECT_FALSE(mesh.HasGarbage());
+	EXPECT_EQ(mesh.GetVertexCount(), 8);
+	EXPECT_EQ(mesh.GetTriangleCount(), 6);
+	ASSERT_TRUE(mesh.HasTrianglesExtraDataContainer());
+	EXPECT_EQ(MeshIntegrity::CheckIntegrity(mesh), MeshIntegrity::ExitCode::MeshOK);
+
+	// The old triangle 2 {1, 2, 5} is now the first one, with every vertex index shifted by the removed vertex 0.
+	EXPECT_EQ(mesh.GetTriangleData(0).Vertices, (std::array<int, 3>{ 0, 1, 4 }));
+	EXPECT_EQ(mesh.GetTriangleData(0).Neighbors, (std::array<int, 3>{ -1, 1, -1 }));
+	EXPECT_EQ(mesh.GetVertexData(0).Position, Vec3(1.f, 0.f, 0.f));
+	for(TriangleIndex iTriangle = 0; iTriangle < mesh.GetTriangleCount(); ++iTriangle)
+		EXPECT_TRUE(mesh.GetTriangle(iTriangle).HasExtraData<TriangleNormalExtraData>());
+}
+
+TEST(MeshTest, SplitEdge_AfterDeletion_ShouldReuseDeletedSlots)
+{
+	Mesh mesh = TestHelpers::CreateTorusMesh(8, 6);
+	ASSERT_TRUE(mesh.CollapseEdge(0, 0, mesh.GetVertexData(mesh.GetTriangleData(0).Vertices[1]).Position));
+	const TriangleIndex aliveTriangleIdx = mesh.IsTriangleDeleted(1) ? 2 : 1;
+
+	const VertexIndex newVertexIdx = mesh.SplitEdge(aliveTriangleIdx, 0, mesh.GetVertexData(0).Position);
+
+	EXPECT_LT(newVertexIdx, 48);
+	EXPECT_EQ(mesh.GetVertexCount(), 48);
+	EXPECT_EQ(mesh.GetTriangleCount(), 96);
+	EXPECT_FALSE(mesh.HasGarbage());
+	EXPECT_EQ(MeshIntegrity::CheckIntegrity(mesh), MeshIntegrity::ExitCode::MeshOK);
+}
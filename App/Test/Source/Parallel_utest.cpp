@@ -0,0 +1,287 @@
+#include "Core/ConcurrentQueue.h"
+#include "Core/JobSystem.h"
+#include "Core/Parallel.h"
+#include "Core/TaskGraph.h"
+#include "Core/ThreadPool.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdint>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace Core::Parallel;
+
+namespace
+{
+/// @brief Compute the n-th Fibonacci number with one task per call, each task waiting for its subtasks.
+uint64_t ComputeFibonacci(ThreadPool& pool, const uint32_t n)
+{
+	if(n < 2)
+		return n;
+
+	uint64_t lhs = 0;
+	TaskGroup group(pool);
+	group.Run([&]() { lhs = ComputeFibonacci(pool, n - 1); });
+	const uint64_t rhs = ComputeFibonacci(pool, n - 2);
+	group.Wait();
+	return lhs + rhs;
+}
+} // namespace
+
+TEST(ParallelTest, ParallelFor_ShouldVisitEachIndexOnce)
+{
+	constexpr size_t count = 100000;
+	std::vector<std::atomic<uint32_t>> visitCounts(count);
+
+	SetThreadCount(4);
+	ParallelFor(
+		0,
+		count,
+		[&](const size_t index)
+		{
+			visitCounts[index].fetch_add(1, std::memory_order_relaxed);
+		},
+		100);
+	SetThreadCount(0);
+
+	for(size_t index = 0; index < count; ++index)
+		ASSERT_EQ(visitCounts[index].load(), 1) << "Index " << index;
+}
+
+TEST(ParallelTest, ParallelForRange_WhenFuncThrows_ShouldRethrowOnCallingThread)
+{
+	std::atomic<size_t> chunkCount{ 0 };
+
+	SetThreadCount(4);
+	EXPECT_THROW(ParallelForRange(
+					 0,
+					 1000,
+					 [&](const size_t chunkBegin, size_t)
+					 {
+						 chunkCount.fetch_add(1, std::memory_order_relaxed);
+						 if(chunkBegin == 0)
+							 throw std::runtime_error("First chunk");
+					 },
+					 10),
+				 std::runtime_error);
+	SetThreadCount(0);
+
+	// The remaining chunks are skipped once the exception is thrown.
+	EXPECT_GE(chunkCount.load(), 1);
+	EXPECT_LE(chunkCount.load(), 4 * ChunksPerThread);
+}
+
+TEST(ParallelTest, ParallelReduce_Deterministic_ShouldNotDependOnThreadCount)
+{
+	constexpr size_t count = 200000;
+	auto sumRange = [](const size_t chunkBegin, const size_t chunkEnd)
+	{
+		float sum = 0.f;
+		for(size_t index = chunkBegin; index < chunkEnd; ++index)
+			sum += 1.f / static_cast<float>(index + 1);
+		return sum;
+	};
+	auto add = [](const float lhs, const float rhs) { return lhs + rhs; };
+
+	SetThreadCount(1);
+	const float serialSum = ParallelReduce(0, count, 0.f, sumRange, add, 1000, ReductionMode::Deterministic);
+	for(const uint32_t threadCount : { 2u, 3u, 8u })
+	{
+		SetThreadCount(threadCount);
+		EXPECT_EQ(ParallelReduce(0, count, 0.f, sumRange, add, 1000, ReductionMode::Deterministic), serialSum);
+		EXPECT_NEAR(ParallelReduce(0, count, 0.f, sumRange, add, 1000), serialSum, 1e-3f);
+	}
+	SetThreadCount(0);
+
+	EXPECT_EQ(ParallelReduce(5, 5, 7.f, sumRange, add), 7.f);
+}
+
+TEST(ParallelTest, TaskGroup_WithNestedWaits_ShouldComplete)
+{
+	// Without worker, the tasks are run by the waiting thread.
+	ThreadPool serialPool(0);
+	EXPECT_EQ(ComputeFibonacci(serialPool, 16), 987);
+
+	ThreadPool pool(3, ThreadAffinity::PinWorkers);
+	EXPECT_EQ(pool.GetWorkerCount(), 3);
+	EXPECT_EQ(ComputeFibonacci(pool, 20), 6765);
+}
+
+TEST(ParallelTest, TaskGraph_ShouldRunTasksAfterTheirPredecessors)
+{
+	// Diamond: 0 -> { 1, 2 } -> 3, each task storing its completion rank.
+	std::atomic<uint32_t> completionCount{ 0 };
+	std::vector<uint32_t> ranks(4, 0);
+	TaskGraph graph;
+	for(uint32_t iTask = 0; iTask < 4; ++iTask)
+		graph.AddTask([&, iTask]() { ranks[iTask] = completionCount.fetch_add(1) + 1; });
+	graph.AddDependency(0, 1);
+	graph.AddDependency(0, 2);
+	graph.AddDependency(1, 3);
+	graph.AddDependency(2, 3);
+
+	SetThreadCount(4);
+	graph.Run();
+	SetThreadCount(0);
+
+	EXPECT_EQ(graph.GetTaskCount(), 4);
+	EXPECT_EQ(completionCount.load(), 4);
+	EXPECT_EQ(ranks[0], 1);
+	EXPECT_EQ(ranks[3], 4);
+}
+
+TEST(ParallelTest, TaskGraph_WhenTaskThrows_ShouldSkipItsSuccessors)
+{
+	std::atomic<uint32_t> runCount{ 0 };
+	TaskGraph graph;
+	const TaskGraph::TaskId failingTask = graph.AddTask([]() { throw std::runtime_error("Failing task"); });
+	const TaskGraph::TaskId skippedTask = graph.AddTask([&]() { ++runCount; });
+	graph.AddTask([&]() { ++runCount; });
+	graph.AddDependency(failingTask, skippedTask);
+
+	EXPECT_THROW(graph.Run(), std::runtime_error);
+	EXPECT_EQ(runCount.load(), 1);
+
+	// A cycle is rejected before running anything.
+	graph.AddDependency(skippedTask, failingTask);
+	EXPECT_THROW(graph.Run(), std::invalid_argument);
+	EXPECT_EQ(runCount.load(), 1);
+}
+
+TEST(ParallelTest, ThreadPoolScope_ShouldRedirectTheParallelHelpers)
+{
+	ThreadPool pool(1);
+	const std::shared_ptr<ThreadPool> sharedPool = GetThreadPool();
+	{
+		const ThreadPoolScope scope(pool);
+		EXPECT_EQ(GetThreadPool().get(), &pool);
+
+		std::vector<uint32_t> visitCounts(1000, 0);
+		ParallelFor(0, visitCounts.size(), [&](const size_t index) { ++visitCounts[index]; });
+		for(const uint32_t visitCount : visitCounts)
+			EXPECT_EQ(visitCount, 1);
+	}
+	EXPECT_EQ(GetThreadPool(), sharedPool);
+}
+
+TEST(ParallelTest, ConcurrentQueue_ShouldDeliverEachValueOnce)
+{
+	ConcurrentQueue<uint32_t> queue(5);
+	EXPECT_EQ(queue.GetCapacity(), 8);
+
+	// Full then empty.
+	for(uint32_t value = 1; value <= 8; ++value)
+		EXPECT_TRUE(queue.TryPush(uint32_t{ value }));
+	EXPECT_FALSE(queue.TryPush(9));
+	uint32_t value = 0;
+	for(uint32_t expected = 1; expected <= 8; ++expected)
+	{
+		EXPECT_TRUE(queue.TryPop(value));
+		EXPECT_EQ(value, expected);
+	}
+	EXPECT_FALSE(queue.TryPop(value));
+
+	// Two producers and two consumers, each value being popped once.
+	constexpr uint32_t valueCount = 20000;
+	std::vector<std::atomic<uint32_t>> popCounts(2 * valueCount);
+	std::atomic<uint32_t> poppedCount{ 0 };
+	std::vector<std::thread> threads;
+	for(uint32_t iProducer = 0; iProducer < 2; ++iProducer)
+	{
+		threads.emplace_back(
+			[&, iProducer]()
+			{
+				for(uint32_t iValue = 0; iValue < valueCount; ++iValue)
+				{
+					while(!queue.TryPush(iProducer * valueCount + iValue))
+						std::this_thread::yield();
+				}
+			});
+	}
+	for(uint32_t iConsumer = 0; iConsumer < 2; ++iConsumer)
+	{
+		threads.emplace_back(
+			[&]()
+			{
+				uint32_t poppedValue = 0;
+				while(poppedCount.load() < 2 * valueCount)
+				{
+					if(queue.TryPop(poppedValue))
+					{
+						++popCounts[poppedValue];
+						++poppedCount;
+					}
+					else
+					{
+						std::this_thread::yield();
+					}
+				}
+			});
+	}
+	for(std::thread& thread : threads)
+		thread.join();
+
+	for(const std::atomic<uint32_t>& popCount : popCounts)
+		EXPECT_EQ(popCount.load(), 1);
+}
+
+TEST(ParallelTest, JobSystem_ShouldReportTheProgressAndTheOutcome)
+{
+	JobSystem jobs(2);
+	EXPECT_EQ(jobs.GetWorkerCount(), 2);
+
+	const std::shared_ptr<Job> completedJob = jobs.Submit(
+		[](const CancellationToken&, const ProgressCallback& progress)
+		{
+			progress(0.25f);
+			progress(2.f);
+		});
+	const std::shared_ptr<Job> failedJob = jobs.Submit(
+		[](const CancellationToken&, const ProgressCallback&) { throw std::runtime_error("Broken file"); });
+	completedJob->Wait();
+	failedJob->Wait();
+
+	EXPECT_EQ(completedJob->GetStatus(), JobStatus::Completed);
+	EXPECT_EQ(completedJob->GetProgress(), 1.f);
+	EXPECT_EQ(failedJob->GetStatus(), JobStatus::Failed);
+	EXPECT_EQ(failedJob->GetError(), "Broken file");
+}
+
+TEST(ParallelTest, JobSystem_WhenCancelled_ShouldStopTheJob)
+{
+	JobSystem jobs(1);
+
+	// The first job runs until cancelled, the second one waits behind it.
+	std::atomic<bool> isStarted{ false };
+	const std::shared_ptr<Job> runningJob = jobs.Submit(
+		[&](const CancellationToken& cancellation, const ProgressCallback& progress)
+		{
+			progress(0.5f);
+			isStarted = true;
+			while(!cancellation.IsCancelled())
+				std::this_thread::yield();
+		});
+	bool isQueuedJobRun = false;
+	const std::shared_ptr<Job> queuedJob =
+		jobs.Submit([&](const CancellationToken&, const ProgressCallback&) { isQueuedJobRun = true; });
+	while(!isStarted)
+		std::this_thread::yield();
+
+	EXPECT_EQ(runningJob->GetStatus(), JobStatus::Running);
+	EXPECT_EQ(runningJob->GetProgress(), 0.5f);
+	queuedJob->Cancel();
+	runningJob->Cancel();
+	runningJob->Wait();
+	queuedJob->Wait();
+
+	EXPECT_EQ(runningJob->GetStatus(), JobStatus::Cancelled);
+	EXPECT_EQ(runningJob->GetProgress(), 0.5f);
+	EXPECT_EQ(queuedJob->GetStatus(), JobStatus::Cancelled);
+	EXPECT_FALSE(isQueuedJobRun);
+
+	// A default token is never cancelled.
+	EXPECT_FALSE(CancellationToken{}.IsCancelled());
+}
@@ -0,0 +1,119 @@
+#include "Core/Parallel.h"
+#include "Core/PrintHelpers.h"
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace PrintHelpers;
+
+namespace
+{
+/// @brief Redirect the records to a temporary file for the duration of a test.
+class PrintHelpersTest : public testing::Test
+{
+protected:
+	void SetUp() override
+	{
+		m_Filepath = std::filesystem::temp_directory_path() / "PrintHelpersTest.log";
+		ASSERT_TRUE(SetLogFile(m_Filepath));
+		SetConsoleEnabled(false);
+	}
+
+	void TearDown() override
+	{
+		SetLogLevel(LogLevel::Trace);
+		SetConsoleEnabled(true);
+		SetLogFile({});
+		std::filesystem::remove(m_Filepath);
+	}
+
+	/// @brief Lines written so far in the log file.
+	std::vector<std::string> ReadLines() const
+	{
+		Flush();
+		std::ifstream file(m_Filepath);
+		std::vector<std::string> lines;
+		for(std::string line; std::getline(file, line);)
+			lines.push_back(line);
+		return lines;
+	}
+
+private:
+	std::filesystem::path m_Filepath;
+};
+} // namespace
+
+TEST_F(PrintHelpersTest, Info_ShouldWriteDecoratedRecord)
+{
+	Info("Loading {} objects", 3);
+	Warning("Missing {}", "normals");
+	Print("raw {}", 42);
+
+	const std::vector<std::string> lines = ReadLines();
+	ASSERT_EQ(lines.size(), 3);
+	EXPECT_TRUE(lines[0].starts_with("[INFO] ["));
+	EXPECT_TRUE(lines[0].ends_with("] Loading 3 objects"));
+	EXPECT_TRUE(lines[1].starts_with("[WARNING] ["));
+	EXPECT_TRUE(lines[1].ends_with("] Missing normals"));
+	EXPECT_EQ(lines[2], "raw 42");
+}
+
+TEST_F(PrintHelpersTest, SetLogLevel_ShouldFilterLowerLevels)
+{
+	SetLogLevel(LogLevel::Warning);
+	Info("filtered");
+	Success("filtered");
+	Warning("kept");
+	Error("kept");
+	Print("never filtered");
+
+	const std::vector<std::string> lines = ReadLines();
+	ASSERT_EQ(lines.size(), 3);
+	EXPECT_TRUE(lines[0].starts_with("[WARNING]"));
+	EXPECT_TRUE(lines[1].starts_with("[ERROR]"));
+	EXPECT_EQ(lines[2], "never filtered");
+}
+
+TEST_F(PrintHelpersTest, Debug_ShouldFollowCompileTimeLevel)
+{
+	Debug("debug record");
+
+	const size_t expectedCount = CompileTimeLogLevel <= LogLevel::Debug ? 1 : 0;
+	EXPECT_EQ(ReadLines().size(), expectedCount);
+}
+
+TEST_F(PrintHelpersTest, Info_FromSeveralThreads_ShouldKeepOrderPerThread)
+{
+	constexpr size_t threadCount = 4;
+	constexpr size_t recordCount = 2000;
+
+	Core::Parallel::SetThreadCount(threadCount);
+	Core::Parallel::ParallelForRange(
+		0,
+		threadCount,
+		[](size_t chunkBegin, size_t)
+		{
+			for(size_t iRecord = 0; iRecord < recordCount; ++iRecord)
+				Info("{} {}", chunkBegin, iRecord);
+		},
+		1);
+	Core::Parallel::SetThreadCount(0);
+
+	const std::vector<std::string> lines = ReadLines();
+	ASSERT_EQ(lines.size(), threadCount * recordCount);
+
+	std::vector<size_t> nextRecordIndices(threadCount, 0);
+	for(const std::string& line : lines)
+	{
+		const size_t messageBegin = line.rfind("] ") + 2;
+		const size_t separator = line.find(' ', messageBegin);
+		const size_t threadIdx = std::stoul(line.substr(messageBegin, separator - messageBegin));
+		const size_t recordIdx = std::stoul(line.substr(separator + 1));
+		ASSERT_LT(threadIdx, threadCount);
+		ASSERT_EQ(recordIdx, nextRecordIndices[threadIdx]++);
+	}
+}
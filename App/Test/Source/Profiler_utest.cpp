@@ -0,0 +1,141 @@
+#include "Core/Parallel.h"
+#include "Core/Profiler.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <set>
+#include <sstream>
+#include <string_view>
+#include <thread>
+
+using namespace Core::Profiler;
+
+namespace
+{
+/// @brief Number of collected zones with the given name.
+size_t CountZones(const std::vector<ZoneEvent>& zones, std::string_view name)
+{
+	return std::ranges::count_if(
+		zones,
+		[name](const ZoneEvent& zone)
+		{
+			return zone.Name == name;
+		});
+}
+} // namespace
+
+TEST(ProfilerTest, ScopedZone_ShouldRecordNestedZones)
+{
+	Clear();
+	{
+		const ScopedZone outerZone("OuterZone");
+		const ScopedZone innerZone("InnerZone");
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+
+	const std::vector<ZoneEvent> zones = CollectZones();
+	ASSERT_EQ(zones.size(), 2);
+	EXPECT_EQ(std::string_view(zones[0].Name), "OuterZone");
+	EXPECT_EQ(std::string_view(zones[1].Name), "InnerZone");
+	EXPECT_GE(zones[1].Duration, 1'000'000);
+	EXPECT_LE(zones[0].Start, zones[1].Start);
+	EXPECT_GE(zones[0].Start + zones[0].Duration, zones[1].Start + zones[1].Duration);
+}
+
+TEST(ProfilerTest, ProfileScope_ShouldFollowCompileTimeSwitch)
+{
+	Clear();
+	{
+		ProfileScope("MacroZone");
+	}
+
+#ifdef ENABLE_PROFILING
+	EXPECT_EQ(CountZones(CollectZones(), "MacroZone"), 1);
+#else
+	EXPECT_EQ(CountZones(CollectZones(), "MacroZone"), 0);
+#endif
+}
+
+TEST(ProfilerTest, RecordZone_WhenBufferIsFull_ShouldKeepLatestZones)
+{
+	Clear();
+	for(uint64_t iZone = 0; iZone < ZoneCapacity + 10; ++iZone)
+		RecordZone("RingZone", iZone, iZone + 1);
+
+	const std::vector<ZoneEvent> zones = CollectZones();
+	ASSERT_EQ(zones.size(), ZoneCapacity);
+	EXPECT_EQ(zones.front().Start, 10);
+	EXPECT_EQ(zones.back().Start, ZoneCapacity + 9);
+}
+
+TEST(ProfilerTest, RecordZone_FromParallelFor_ShouldReuseThreadBuffers)
+{
+	Clear();
+	Core::Parallel::SetThreadCount(4);
+	for(int iRun = 0; iRun < 3; ++iRun)
+	{
+		Core::Parallel::ParallelFor(
+			0,
+			4000,
+			[](size_t)
+			{
+				const ScopedZone zone("WorkerZone");
+			},
+			1000);
+	}
+	Core::Parallel::SetThreadCount(0);
+
+	const std::vector<ZoneEvent> zones = CollectZones();
+	EXPECT_EQ(CountZones(zones, "WorkerZone"), 12000);
+
+	// The workers of each run pick the buffers released by the previous ones.
+	std::set<uint32_t> threadIndices;
+	for(const ZoneEvent& zone : zones)
+		threadIndices.insert(zone.ThreadIdx);
+	EXPECT_LE(threadIndices.size(), 4);
+}
+
+TEST(ProfilerTest, CollectZones_WhileRecording_ShouldReturnCompleteZones)
+{
+	Clear();
+	std::atomic<bool> isDone{ false };
+	std::jthread writer(
+		[&isDone]()
+		{
+			for(uint64_t iZone = 0; iZone < 20 * ZoneCapacity; ++iZone)
+				RecordZone("ConcurrentZone", iZone, iZone + 3);
+			isDone = true;
+		});
+
+	while(!isDone)
+	{
+		for(const ZoneEvent& zone : CollectZones())
+		{
+			ASSERT_EQ(std::string_view(zone.Name), "ConcurrentZone");
+			ASSERT_EQ(zone.Duration, 3);
+		}
+	}
+}
+
+TEST(ProfilerTest, WriteChromeTrace_ShouldWriteTraceEvents)
+{
+	Clear();
+	RecordZone("Quoted \"Zone\"", 2000, 5000);
+
+	const std::filesystem::path filepath = std::filesystem::temp_directory_path() / "ProfilerTest.json";
+	ASSERT_TRUE(WriteChromeTrace(filepath));
+
+	std::ifstream file(filepath);
+	std::stringstream content;
+	content << file.rdbuf();
+	EXPECT_NE(content.str().find("\"traceEvents\""), std::string::npos);
+	EXPECT_NE(content.str().find("\"name\":\"Quoted \\\"Zone\\\"\""), std::string::npos);
+	EXPECT_NE(content.str().find("\"ph\":\"X\",\"ts\":2.000,\"dur\":3.000"), std::string::npos);
+
+	std::filesystem::remove(filepath);
+}
@@ -0,0 +1,63 @@
+#include "Core/Renderer/StreamingBuffer.h"
+#include "GLTestFixture.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+using namespace Renderer;
+
+namespace
+{
+class StreamingBufferTest : public TestHelpers::GLTestFixture
+{
+protected:
+	/// @brief Read a range of a buffer through a copy made by the GPU.
+	static std::vector<uint32_t> ReadBack(const GLuint buffer, const size_t offset, const size_t count)
+	{
+		GLuint readBuffer = 0;
+		const GLsizeiptr size = static_cast<GLsizeiptr>(count * sizeof(uint32_t));
+		glCreateBuffers(1, &readBuffer);
+		glNamedBufferStorage(readBuffer, size, nullptr, 0);
+		glCopyNamedBufferSubData(buffer, readBuffer, static_cast<GLintptr>(offset), 0, size);
+		std::vector<uint32_t> values(count);
+		glGetNamedBufferSubData(readBuffer, 0, size, values.data());
+		glDeleteBuffers(1, &readBuffer);
+		return values;
+	}
+};
+} // namespace
+
+TEST_F(StreamingBufferTest, BeginWrite_ShouldCycleThroughTheRegions)
+{
+	StreamingBuffer buffer(1000);
+	EXPECT_EQ(buffer.GetRegionSize(), 1024);
+	for(uint32_t iFrame = 0; iFrame < 2 * StreamingBuffer::RegionCount; ++iFrame)
+	{
+		const std::span<uint32_t> region = buffer.BeginWrite<uint32_t>();
+		ASSERT_EQ(region.size(), 256);
+		EXPECT_EQ(buffer.GetWriteOffset(), (iFrame % StreamingBuffer::RegionCount) * buffer.GetRegionSize());
+		std::ranges::fill(region, iFrame);
+
+		// The GPU sees the writes without flush.
+		const std::vector<uint32_t> values = ReadBack(buffer.GetHandle(), buffer.GetWriteOffset(), region.size());
+		EXPECT_TRUE(std::ranges::all_of(values, [&](const uint32_t value) { return value == iFrame; }));
+		buffer.EndFrame();
+	}
+	EXPECT_EQ(glGetError(), static_cast<GLenum>(GL_NO_ERROR));
+}
+
+TEST_F(StreamingBufferTest, BeginWrite_ShouldNotStallWhenTheGpuIsDone)
+{
+	StreamingBuffer buffer(64 * 1024);
+	for(uint32_t iFrame = 0; iFrame < 10; ++iFrame)
+	{
+		std::ranges::fill(buffer.BeginWrite(), std::byte{ 0x2A });
+		buffer.EndFrame();
+		glFinish();
+	}
+	EXPECT_EQ(buffer.GetStallCount(), 0);
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <vector>
+
+namespace Core::Memory
+{
+/// @brief Size of a cache line, the alignment of the buffers read by the vectorized kernels.
+inline constexpr size_t CacheLineSize = 64;
+
+/// @brief Allocator aligning its allocations, so that the vectorized loops start on a full register (or cache line).
+/// @tparam T Type of the elements.
+/// @tparam Alignment Alignment in bytes, a power of two at least the one of T.
+template<typename T, size_t Alignment = CacheLineSize>
+class AlignedAllocator
+{
+	static_assert((Alignment & (Alignment - 1)) == 0, "The alignment must be a power of two");
+	static_assert(Alignment >= alignof(T), "The alignment cannot be lower than the one of the type");
+
+public:
+	using value_type = T;
+
+	template<typename U>
+	struct rebind
+	{
+		using other = AlignedAllocator<U, Alignment>;
+	};
+
+public:
+	AlignedAllocator() = default;
+
+	template<typename U>
+	AlignedAllocator(const AlignedAllocator<U, Alignment>&)
+	{
+	}
+
+	/// @brief Allocate an aligned array of count elements.
+	T* allocate(const size_t count)
+	{
+		return static_cast<T*>(::operator new(count * sizeof(T), std::align_val_t{ Alignment }));
+	}
+
+	/// @brief Free an array given by allocate.
+	void deallocate(T* ptr, const size_t count)
+	{
+		::operator delete(ptr, count * sizeof(T), std::align_val_t{ Alignment });
+	}
+
+	template<typename U>
+	bool operator==(const AlignedAllocator<U, Alignment>&) const
+	{
+		return true;
+	}
+};
+
+/// @brief Vector whose data is aligned on a cache line.
+template<typename T>
+using AlignedVector = std::vector<T, AlignedAllocator<T>>;
+} // namespace Core::Memory
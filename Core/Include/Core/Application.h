@@ -2,9 +2,13 @@
 
 #include "Core/Event/ApplicationEvent.h"
 #include "Core/Event/KeyEvents.h"
+#include "Core/FrameStats.h"
 #include "Core/Layer.h"
+#include "Core/Renderer/GpuTimer.h"
 #include "Core/Window.h"
 
+#include <chrono>
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <set>
@@ -34,6 +38,7 @@ public:
 	void PushLayer()
 	{
 		m_LayerStack.push_back(std::make_unique<TLayer>());
+		AddLayerSections(*m_LayerStack.back());
 	}
 
 	BaseType::Vec2 GetFramebufferSize() const;
@@ -43,6 +48,13 @@ public:
 
 	void SetMenubarCallback(const std::function<void()>& funCallback) { m_MenubarCallback = funCallback; }
 
+	/// @brief Get the rolling CPU and GPU timings of the frame, of its steps and of each layer.
+	const Profiler::FrameStats& GetFrameStats() const { return m_FrameStats; }
+
+	/// @brief Show or hide the panel of the frame statistics.
+	void SetFrameStatsVisible(bool visible) { m_ShowFrameStats = visible; }
+	bool IsFrameStatsVisible() const { return m_ShowFrameStats; }
+
 	static Application& Get();
 	static GLFWwindow* GetWindow();
 	static float GetTime();
@@ -54,6 +66,13 @@ private:
 	bool OnCloseEvent(WindowCloseEvent& event);
 	bool OnKeyReleasedEvent(KeyReleasedEvent& event);
 
+	/// @brief Add the sections timing the update and the rendering of a layer.
+	void AddLayerSections(const Layer& layer);
+	/// @brief Record the CPU time of the frame and collect the GPU times of a past frame.
+	void EndFrameTimings();
+	/// @brief Draw the percentiles and the histogram of the frame times.
+	void DrawFrameStatsPanel();
+
 private:
 	ApplicationSpecification m_Specification;
 	std::shared_ptr<Window> m_Window;
@@ -61,6 +80,24 @@ private:
 
 	std::function<void()> m_MenubarCallback;
 	std::vector<std::unique_ptr<Layer>> m_LayerStack;
+
+	/// @brief Sections of the frame statistics, see AddLayerSections for the layers.
+	struct FrameSections
+	{
+		uint32_t Frame = 0;
+		uint32_t PollEvents = 0;
+		uint32_t ImGuiRender = 0;
+		uint32_t PlatformWindows = 0;
+		uint32_t SwapBuffers = 0;
+		/// @brief OnUpdate and OnRender sections of each layer, in the order of the stack.
+		std::vector<uint32_t> LayerUpdates{};
+		std::vector<uint32_t> LayerRenders{};
+	};
+	Profiler::FrameStats m_FrameStats;
+	FrameSections m_FrameSections;
+	std::unique_ptr<Renderer::GpuTimer> m_GpuTimer;
+	std::chrono::steady_clock::time_point m_FrameStart;
+	bool m_ShowFrameStats = false;
 };
 
 // Implemented by CLIENT
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Core::Container
+{
+/// @brief Resizable array of bits packed in 64-bit words.
+/// @note Unlike std::vector<bool>, bits of a same word can be set concurrently with SetAtomic.
+class Bitset
+{
+public:
+	/// @brief Default ctor.
+	Bitset() = default;
+	/// @brief Construct a bitset of the given size, every bit cleared.
+	explicit Bitset(const size_t size) { Resize(size); }
+
+	/// @brief Get the number of bits.
+	size_t GetSize() const { return m_Size; }
+
+	/// @brief Change the number of bits, the added ones are cleared.
+	void Resize(const size_t size)
+	{
+		if(size < m_Size && size % 64 != 0)
+			m_Words[size / 64] &= (uint64_t{ 1 } << (size % 64)) - 1;
+		m_Words.resize((size + 63) / 64, 0);
+		m_Size = size;
+	}
+
+	/// @brief Clear every bit.
+	void Reset() { std::fill(m_Words.begin(), m_Words.end(), 0); }
+
+	/// @brief Check whether a bit is set.
+	bool Test(const size_t index) const
+	{
+		assert(index < m_Size && "Index out of bound");
+		return (m_Words[index / 64] >> (index % 64)) & 1;
+	}
+
+	/// @brief Set a bit.
+	void Set(const size_t index)
+	{
+		assert(index < m_Size && "Index out of bound");
+		m_Words[index / 64] |= uint64_t{ 1 } << (index % 64);
+	}
+
+	/// @brief Set a bit, other threads may set bits of the same word at the same time.
+	void SetAtomic(const size_t index)
+	{
+		assert(index < m_Size && "Index out of bound");
+		const uint64_t mask = uint64_t{ 1 } << (index % 64);
+		std::atomic_ref<uint64_t>(m_Words[index / 64]).fetch_or(mask, std::memory_order_relaxed);
+	}
+
+	/// @brief Clear a bit.
+	void Reset(const size_t index)
+	{
+		assert(index < m_Size && "Index out of bound");
+		m_Words[index / 64] &= ~(uint64_t{ 1 } << (index % 64));
+	}
+
+	/// @brief Get the number of set bits.
+	size_t Count() const
+	{
+		size_t count = 0;
+		for(const uint64_t word : m_Words)
+			count += static_cast<size_t>(std::popcount(word));
+		return count;
+	}
+
+	/// @brief Get the words holding the bits, the bit i being the bit (i % 64) of the word (i / 64).
+	const std::vector<uint64_t>& GetWords() const { return m_Words; }
+
+	/// @brief Equality operator.
+	bool operator==(const Bitset& rhs) const = default;
+
+private:
+	/// @brief Packed bits, the unused bits of the last word are always cleared.
+	std::vector<uint64_t> m_Words{};
+	/// @brief Number of bits.
+	size_t m_Size{ 0 };
+};
+} // namespace Core::Container
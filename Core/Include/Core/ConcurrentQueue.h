@@ -0,0 +1,120 @@
+#pragma once
+
+#include "Core/AlignedAllocator.h"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace Core::Parallel
+{
+/// @brief Bounded lock-free queue, for any number of producer and consumer threads.
+/// @note Each cell holds a sequence number telling whether it is free for the push of a given position or filled for
+/// the pop of that position (Vyukov's bounded queue): a push or a pop only claims its position with a compare and
+/// swap, then publishes the cell, and neither ever blocks. A full queue makes TryPush fail, the producer decides
+/// whether to retry.
+template<typename T>
+class ConcurrentQueue
+{
+public:
+	/// @brief Allocate the cells of the queue.
+	/// @param capacity Maximum number of values in the queue, rounded up to a power of two.
+	explicit ConcurrentQueue(const size_t capacity)
+		: m_Cells(std::make_unique<Cell[]>(std::bit_ceil(std::max<size_t>(capacity, 2))))
+		, m_Mask(std::bit_ceil(std::max<size_t>(capacity, 2)) - 1)
+	{
+		for(size_t iCell = 0; iCell <= m_Mask; ++iCell)
+			m_Cells[iCell].Sequence.store(iCell, std::memory_order_relaxed);
+	}
+
+	ConcurrentQueue(const ConcurrentQueue&) = delete;
+	ConcurrentQueue& operator=(const ConcurrentQueue&) = delete;
+
+	/// @brief Get the maximum number of values in the queue.
+	size_t GetCapacity() const { return m_Mask + 1; }
+
+	/// @brief Move a value at the end of the queue.
+	/// @return False if the queue is full, the value being left untouched.
+	bool TryPush(T&& value)
+	{
+		size_t position = m_PushPosition.load(std::memory_order_relaxed);
+		for(;;)
+		{
+			Cell& cell = m_Cells[position & m_Mask];
+			const size_t sequence = cell.Sequence.load(std::memory_order_acquire);
+			const std::ptrdiff_t difference = static_cast<std::ptrdiff_t>(sequence - position);
+			if(difference == 0)
+			{
+				// The cell is free for this position, claim it.
+				if(m_PushPosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+				{
+					cell.Value = std::move(value);
+					cell.Sequence.store(position + 1, std::memory_order_release);
+					return true;
+				}
+			}
+			else if(difference < 0)
+			{
+				// The cell still holds the value pushed a lap before.
+				return false;
+			}
+			else
+			{
+				position = m_PushPosition.load(std::memory_order_relaxed);
+			}
+		}
+	}
+
+	/// @brief Move the first value out of the queue.
+	/// @return False if the queue is empty.
+	bool TryPop(T& value)
+	{
+		size_t position = m_PopPosition.load(std::memory_order_relaxed);
+		for(;;)
+		{
+			Cell& cell = m_Cells[position & m_Mask];
+			const size_t sequence = cell.Sequence.load(std::memory_order_acquire);
+			const std::ptrdiff_t difference = static_cast<std::ptrdiff_t>(sequence - (position + 1));
+			if(difference == 0)
+			{
+				// The cell is filled for this position, claim it.
+				if(m_PopPosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+				{
+					value = std::move(cell.Value);
+					cell.Value = T{};
+					cell.Sequence.store(position + m_Mask + 1, std::memory_order_release);
+					return true;
+				}
+			}
+			else if(difference < 0)
+			{
+				// The cell has not been filled yet.
+				return false;
+			}
+			else
+			{
+				position = m_PopPosition.load(std::memory_order_relaxed);
+			}
+		}
+	}
+
+private:
+	/// @brief Value and its sequence number: its position while free, its position + 1 once filled.
+	struct Cell
+	{
+		std::atomic<size_t> Sequence{ 0 };
+		T Value{};
+	};
+
+	std::unique_ptr<Cell[]> m_Cells;
+	/// @brief Capacity - 1, to wrap the positions.
+	const size_t m_Mask;
+	/// @brief Positions of the next push and of the next pop, on their own cache lines so that the producers and the
+	/// consumers do not invalidate each other.
+	alignas(Memory::CacheLineSize) std::atomic<size_t> m_PushPosition{ 0 };
+	alignas(Memory::CacheLineSize) std::atomic<size_t> m_PopPosition{ 0 };
+};
+} // namespace Core::Parallel
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Core::Profiler
+{
+/// @brief Number of frames kept by the rolling statistics, about 8 seconds at 60 frames per second.
+constexpr uint32_t FrameHistorySize = 512;
+
+/// @brief Statistics of a duration over the frames of the history, in milliseconds.
+struct TimingSummary
+{
+	uint32_t SampleCount = 0;
+	float Mean = 0.f;
+	float P50 = 0.f;
+	float P95 = 0.f;
+	float P99 = 0.f;
+	float Max = 0.f;
+};
+
+/// @brief Rolling window of the last FrameHistorySize durations of a timed section, in milliseconds.
+class TimingHistory
+{
+public:
+	/// @brief Add the duration of the last frame, replacing the oldest one once the window is full.
+	void AddSample(float milliseconds);
+
+	/// @brief Forget all the samples.
+	void Clear();
+
+	/// @brief Get the number of samples in the window.
+	uint32_t GetSampleCount() const { return m_SampleCount; }
+
+	/// @brief Get the samples in storage order, see GetOldestIndex.
+	std::span<const float> GetSamples() const { return { m_Samples.data(), m_SampleCount }; }
+
+	/// @brief Get the index in GetSamples of the oldest sample, from which the samples are in chronological order.
+	uint32_t GetOldestIndex() const { return m_SampleCount < FrameHistorySize ? 0 : m_NextIndex; }
+
+	/// @brief Get the last sample added, 0 if none.
+	float GetLastSample() const;
+
+	/// @brief Compute the mean, the maximum and the percentiles (nearest rank) of the samples.
+	TimingSummary ComputeSummary() const;
+
+	/// @brief Count the samples falling in each bin of equal width from 0 to maxMilliseconds.
+	/// @note The samples above maxMilliseconds are counted in the last bin.
+	void ComputeHistogram(std::span<float> binCounts, float maxMilliseconds) const;
+
+private:
+	std::array<float, FrameHistorySize> m_Samples{};
+	uint32_t m_SampleCount = 0;
+	/// @brief Index of the next sample to write.
+	uint32_t m_NextIndex = 0;
+};
+
+/// @brief Timed part of a frame, measured on the CPU and, when it issues OpenGL commands, on the GPU.
+struct FrameSection
+{
+	std::string Name{};
+	TimingHistory Cpu{};
+	TimingHistory Gpu{};
+};
+
+/// @brief Rolling timings of the sections of the frames: the whole frame, the event polling, each layer, the ImGui
+/// rendering...
+/// @note The sections are identified by an index, given once per name, so that recording a sample is a plain store.
+class FrameStats
+{
+public:
+	/// @brief Get the index of a section, added the first time its name is seen.
+	uint32_t GetSectionIndex(std::string_view name);
+
+	/// @brief Add the CPU duration of a section in the last frame.
+	void AddCpuSample(uint32_t section, float milliseconds) { m_Sections[section].Cpu.AddSample(milliseconds); }
+
+	/// @brief Add the GPU duration of a section in a past frame.
+	void AddGpuSample(uint32_t section, float milliseconds) { m_Sections[section].Gpu.AddSample(milliseconds); }
+
+	/// @brief Get the sections, in the order of their first use.
+	const std::vector<FrameSection>& GetSections() const { return m_Sections; }
+
+	/// @brief Forget the samples of every section, keeping the sections.
+	void Clear();
+
+	/// @brief Write the summary of each section in a CSV file, a row per section and clock.
+	/// @param filepath Path of the CSV file.
+	/// @return True if the file was written.
+	bool WriteCsv(const std::filesystem::path& filepath) const;
+
+private:
+	std::vector<FrameSection> m_Sections{};
+};
+} // namespace Core::Profiler
@@ -0,0 +1,126 @@
+#pragma once
+
+#include "Core/ThreadPool.h"
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace Core::Parallel
+{
+/// @brief Flag polled by a long operation to stop early, raised by another thread.
+/// @note The copies of a token share its flag. A default token is never cancelled, so that the operations can take
+/// one as an optional argument.
+class CancellationToken
+{
+public:
+	/// @brief Construct a token that is never cancelled.
+	CancellationToken() = default;
+
+	/// @brief Create a token that can be cancelled.
+	static CancellationToken Create();
+
+	/// @brief Request the cancellation, seen by every copy of the token.
+	void Cancel() const;
+
+	/// @brief Check whether the cancellation was requested.
+	bool IsCancelled() const { return m_IsCancelled && m_IsCancelled->load(std::memory_order_relaxed); }
+
+private:
+	/// @brief Flag shared by the copies, null for a token never cancelled.
+	std::shared_ptr<std::atomic<bool>> m_IsCancelled{};
+};
+
+/// @brief Called by a long operation with its progress, from 0 to 1, possibly from another thread than the caller.
+using ProgressCallback = std::function<void(float progress)>;
+
+/// @brief Step of the life of a job.
+enum struct JobStatus : uint8_t
+{
+	/// @brief Waiting for a worker.
+	Queued,
+	/// @brief Running on a worker.
+	Running,
+	/// @brief Returned without being cancelled.
+	Completed,
+	/// @brief Cancelled, before it started or while it ran.
+	Cancelled,
+	/// @brief Stopped by an exception.
+	Failed,
+};
+
+/// @brief State of a job submitted to a JobSystem, shared by the job and the thread that submitted it.
+class Job
+{
+public:
+	/// @brief Get the current step of the job.
+	JobStatus GetStatus() const { return m_Status.load(std::memory_order_acquire); }
+
+	/// @brief Check whether the job is completed, cancelled or failed.
+	bool IsDone() const { return GetStatus() > JobStatus::Running; }
+
+	/// @brief Get the last progress reported by the job, from 0 to 1.
+	float GetProgress() const { return m_Progress.load(std::memory_order_relaxed); }
+
+	/// @brief Request the cancellation of the job, which stops at its next check of the token.
+	void Cancel() const { m_CancellationToken.Cancel(); }
+
+	/// @brief Get the message of the exception that stopped the job, valid once it failed.
+	const std::string& GetError() const { return m_Error; }
+
+	/// @brief Block until the job is done.
+	void Wait() const;
+
+private:
+	friend class JobSystem;
+
+	std::atomic<JobStatus> m_Status{ JobStatus::Queued };
+	std::atomic<float> m_Progress{ 0.f };
+	CancellationToken m_CancellationToken = CancellationToken::Create();
+	std::string m_Error{};
+};
+
+/// @brief Operation run by a job, which reports its progress and polls its cancellation token.
+using JobFunction = std::function<void(const CancellationToken& cancellation, const ProgressCallback& progress)>;
+
+/// @brief Workers running long operations (loading a file, preparing a mesh) in the background of the main thread.
+/// @note The jobs run on a pool of their own, as do the parallel helpers they call (see ThreadPoolScope): the loops of
+/// the main thread on the shared pool never wait behind a background job. The cancellation is cooperative, each job
+/// checking its token between two steps.
+class JobSystem
+{
+public:
+	/// @brief Start the workers.
+	/// @param workerCount Number of worker threads, at least one.
+	explicit JobSystem(uint32_t workerCount = 1);
+
+	/// @brief Cancel every job, then wait for the running ones.
+	~JobSystem();
+
+	JobSystem(const JobSystem&) = delete;
+	JobSystem& operator=(const JobSystem&) = delete;
+
+	/// @brief Queue a job, run by the first idle worker.
+	/// @return The state of the job, to follow its progress or cancel it.
+	std::shared_ptr<Job> Submit(JobFunction function);
+
+	/// @brief Get the number of worker threads.
+	uint32_t GetWorkerCount() const { return m_Pool.GetWorkerCount(); }
+
+private:
+	/// @brief Run a job on the calling worker.
+	void Run(Job& job, const JobFunction& function);
+
+private:
+	/// @brief Protects m_Jobs.
+	std::mutex m_JobsMutex{};
+	/// @brief Jobs not done yet, cancelled by the destructor.
+	std::vector<std::weak_ptr<Job>> m_Jobs{};
+	/// @brief Workers of the jobs, destroyed first so that no job outlives the other members.
+	ThreadPool m_Pool;
+};
+} // namespace Core::Parallel
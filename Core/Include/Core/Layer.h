@@ -2,6 +2,8 @@
 
 #include "Core/Event/Event.h"
 
+#include <string_view>
+
 namespace Core
 {
 
@@ -15,6 +17,9 @@ public:
 	virtual void OnUpdate(float) {}
 
 	virtual void OnRender() {}
+
+	/// @brief Name of the layer in the frame statistics.
+	virtual std::string_view GetName() const { return "Layer"; }
 };
 
 } // namespace Core
@@ -0,0 +1,135 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+
+namespace Core::Memory
+{
+/// @brief Size of the first block of an arena, the next blocks doubling in size.
+inline constexpr size_t DefaultArenaBlockSize = 64 * 1024;
+
+/// @brief Largest capacity a scratch arena keeps once its outermost scope ends, a larger one being released so that a
+/// thread does not hold its largest temporary for its whole lifetime.
+inline constexpr size_t MaxScratchCapacity = 64 * 1024 * 1024;
+
+/// @brief Get the resource the arenas take their blocks from, the new/delete resource by default.
+std::pmr::memory_resource* GetUpstreamResource();
+
+/// @brief Set the resource the arenas created from now on take their blocks from.
+/// @param resource Resource outliving these arenas, nullptr restores the new/delete resource.
+void SetUpstreamResource(std::pmr::memory_resource* resource);
+
+/// @brief Monotonic arena: allocations bump a pointer in large blocks and are only freed all at once.
+/// @note Deallocating is a no-op. The blocks are kept when the arena is rewound, so an arena reused for each operation
+/// stops allocating once its capacity fits the largest operation.
+class MonotonicArena : public std::pmr::memory_resource
+{
+public:
+	/// @brief Position in the arena, see GetMarker and Rewind.
+	struct Marker
+	{
+		/// @brief Index of the current block.
+		size_t BlockIdx = 0;
+		/// @brief Bytes used in the current block.
+		size_t Offset = 0;
+	};
+
+public:
+	/// @brief Construct an empty arena, the first block is taken by the first allocation.
+	/// @param firstBlockSize Size of the first block in bytes.
+	/// @param upstream Resource providing the blocks.
+	explicit MonotonicArena(
+		size_t firstBlockSize = DefaultArenaBlockSize, std::pmr::memory_resource* upstream = GetUpstreamResource());
+
+	/// @brief Give the blocks back to the upstream resource.
+	~MonotonicArena() override;
+
+	MonotonicArena(const MonotonicArena&) = delete;
+	MonotonicArena& operator=(const MonotonicArena&) = delete;
+
+	/// @brief Get the current position, the allocations made after it are freed by Rewind.
+	Marker GetMarker() const;
+
+	/// @brief Free in O(1) every allocation made since the marker was taken, the blocks being kept.
+	/// @param marker Marker taken on this arena, no allocation made before it must have been freed since.
+	void Rewind(const Marker& marker);
+
+	/// @brief Free every allocation. The blocks are merged into a single one if the arena had to grow, so that the
+	/// next uses fit in one block.
+	void Reset();
+
+	/// @brief Free every allocation and give the blocks back to the upstream resource, the next block having the size
+	/// of the first one.
+	void Release();
+
+	/// @brief Get the total size of the blocks in bytes.
+	size_t GetCapacity() const;
+
+	/// @brief Get the number of blocks.
+	size_t GetBlockCount() const;
+
+private:
+	/// @brief Block taken from the upstream resource.
+	struct Block
+	{
+		std::byte* Data = nullptr;
+		size_t Size = 0;
+	};
+
+	void* do_allocate(size_t bytes, size_t alignment) override;
+	void do_deallocate(void* ptr, size_t bytes, size_t alignment) override;
+	bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+	/// @brief Try to allocate in the current block.
+	void* AllocateInCurrentBlock(size_t bytes, size_t alignment);
+
+	/// @brief Take a new block able to hold the allocation and make it the current one.
+	void AddBlock(size_t bytes, size_t alignment);
+
+private:
+	/// @brief Resource providing the blocks.
+	std::pmr::memory_resource* m_Upstream;
+	/// @brief Blocks in allocation order.
+	std::vector<Block> m_Blocks{};
+	/// @brief Position of the next allocation.
+	Marker m_Current{};
+	/// @brief Size of the first block to take.
+	size_t m_FirstBlockSize;
+	/// @brief Size of the next block to take.
+	size_t m_NextBlockSize;
+};
+
+/// @brief Scratch memory of the calling thread for the lifetime of the scope.
+/// @note The allocations are made in an arena owned by the thread and freed in O(1) at the end of the scope, the arena
+/// keeping its blocks for the next operations up to MaxScratchCapacity. The scopes of a thread are nested: the
+/// containers of a scope must be destroyed before its end, and an outer scope must not allocate while an inner one is
+/// open.
+class ScratchScope
+{
+public:
+	/// @brief Open a scope on the arena of the calling thread.
+	ScratchScope();
+
+	/// @brief Free the allocations of the scope.
+	~ScratchScope();
+
+	ScratchScope(const ScratchScope&) = delete;
+	ScratchScope& operator=(const ScratchScope&) = delete;
+
+	/// @brief Get the resource to give to the std::pmr containers of the scope.
+	std::pmr::memory_resource* GetResource() const;
+
+private:
+	/// @brief Arena of the calling thread.
+	MonotonicArena& m_Arena;
+	/// @brief Position of the arena when the scope was opened.
+	MonotonicArena::Marker m_Marker;
+	/// @brief Whether the scope is the outermost one of the thread.
+	bool m_IsOutermost;
+};
+
+/// @brief Get the scratch arena of the calling thread, created on first use with the current upstream resource.
+MonotonicArena& GetThreadScratchArena();
+} // namespace Core::Memory
@@ -0,0 +1,206 @@
+#pragma once
+
+#include "Core/ThreadPool.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace Core::Parallel
+{
+/// @brief Maximum number of chunks of a parallel loop per thread, so that the threads done first take the remaining
+/// chunks of the slower ones.
+inline constexpr size_t ChunksPerThread = 4;
+
+/// @brief Order in which ParallelReduce combines the partial results.
+enum struct ReductionMode : uint8_t
+{
+	/// @brief One chunk per thread, the rounding of the result can vary with the number of threads.
+	Fast,
+	/// @brief Chunks of exactly grainSize indices combined in order, the result does not depend on the threads.
+	Deterministic,
+};
+
+/// @brief Get the number of threads used by the parallel helpers, the calling thread included.
+uint32_t GetThreadCount();
+
+/// @brief Set the number of threads used by the parallel helpers.
+/// @param count Number of threads, 0 restores the hardware concurrency.
+/// @note The shared pool is restarted with count - 1 workers by the next parallel call.
+void SetThreadCount(uint32_t count);
+
+/// @brief Get the placement of the workers of the shared pool.
+ThreadAffinity GetThreadAffinity();
+
+/// @brief Set the placement of the workers of the shared pool, applied by the next parallel call.
+void SetThreadAffinity(ThreadAffinity affinity);
+
+/// @brief Get the pool used by the parallel helpers on the calling thread.
+/// @note This is the shared pool, with GetThreadCount() - 1 workers, unless a ThreadPoolScope is active on the thread.
+/// The shared pool is kept alive by the returned pointer, even if the number of threads changes meanwhile.
+std::shared_ptr<ThreadPool> GetThreadPool();
+
+/// @brief Run the parallel helpers called by the thread on another pool than the shared one, for the lifetime of
+/// the scope.
+/// @note The background jobs (see JobSystem) loop on their own pool: a thread waiting for its own loop on the shared
+/// pool, such as the render thread, then never runs the chunks of a long background loop.
+class ThreadPoolScope
+{
+public:
+	/// @brief Route the parallel helpers of the thread to a pool, which must outlive the scope.
+	explicit ThreadPoolScope(ThreadPool& pool);
+	~ThreadPoolScope();
+
+	ThreadPoolScope(const ThreadPoolScope&) = delete;
+	ThreadPoolScope& operator=(const ThreadPoolScope&) = delete;
+
+private:
+	/// @brief Pool of the thread before the scope, restored at its end.
+	ThreadPool* m_PreviousPool;
+};
+
+/// @brief Check whether the calling thread is running a chunk of a parallel loop.
+bool IsInParallelLoop();
+
+namespace detail
+{
+/// @brief Flag the calling thread as running a chunk of a parallel loop for the lifetime of the scope.
+class ParallelLoopScope
+{
+public:
+	ParallelLoopScope();
+	~ParallelLoopScope();
+
+	ParallelLoopScope(const ParallelLoopScope&) = delete;
+	ParallelLoopScope& operator=(const ParallelLoopScope&) = delete;
+
+private:
+	/// @brief Flag of the thread before the scope, restored at its end.
+	bool m_WasInParallelLoop;
+};
+
+/// @brief Call invoke(context, iChunk) for each chunk of [0, chunkCount) on the shared pool.
+/// @note The chunks are handed out one by one to the calling thread and to the workers, each chunk running in a
+/// ParallelLoopScope. The first exception thrown by a chunk is rethrown once all the running chunks are done.
+void RunChunks(size_t chunkCount, void (*invoke)(void*, size_t), void* context);
+
+/// @brief Call func(iChunk) for each chunk of [0, chunkCount) on the shared pool, see RunChunks.
+template<typename Func>
+void ForEachChunk(size_t chunkCount, Func& func)
+{
+	RunChunks(
+		chunkCount, [](void* context, size_t iChunk) { (*static_cast<Func*>(context))(iChunk); }, &func);
+}
+} // namespace detail
+
+/// @brief Split [begin, end) into contiguous chunks and call func(chunkBegin, chunkEnd) on each of them concurrently.
+/// @param begin First index of the range.
+/// @param end Past-the-end index of the range.
+/// @param func Callable invoked once per chunk.
+/// @param grainSize Minimum number of indices handled by one chunk.
+/// @note The chunks run on the shared pool (see GetThreadPool), at most ChunksPerThread chunks per thread. The calling
+/// thread takes part and waits for the others to complete, the first exception thrown by func is then rethrown.
+/// @note A loop nested in the chunk of another one runs serially on the calling thread, so that parallel algorithms
+/// can be applied concurrently to independent parts without spawning tasks from every thread.
+template<typename Func>
+void ParallelForRange(size_t begin, size_t end, Func&& func, size_t grainSize = 1024)
+{
+	if(end <= begin)
+		return;
+
+	const size_t count = end - begin;
+	grainSize = std::max<size_t>(grainSize, 1);
+	const size_t threadCount = IsInParallelLoop() ? 1 : GetThreadCount();
+	const size_t maxChunkCount = threadCount == 1 ? 1 : threadCount * ChunksPerThread;
+	size_t chunkCount = std::min<size_t>(maxChunkCount, (count + grainSize - 1) / grainSize);
+	if(chunkCount <= 1)
+	{
+		func(begin, end);
+		return;
+	}
+
+	const size_t chunkSize = (count + chunkCount - 1) / chunkCount;
+	chunkCount = (count + chunkSize - 1) / chunkSize;
+	auto runChunk = [&](size_t iChunk)
+	{
+		const size_t chunkBegin = begin + iChunk * chunkSize;
+		func(chunkBegin, std::min(end, chunkBegin + chunkSize));
+	};
+	detail::ForEachChunk(chunkCount, runChunk);
+}
+
+/// @brief Call func(index) for each index of [begin, end), concurrently.
+/// @param begin First index of the range.
+/// @param end Past-the-end index of the range.
+/// @param func Callable invoked once per index.
+/// @param grainSize Minimum number of indices handled by one thread.
+template<typename Func>
+void ParallelFor(size_t begin, size_t end, Func&& func, size_t grainSize = 1024)
+{
+	ParallelForRange(
+		begin,
+		end,
+		[&func](size_t chunkBegin, size_t chunkEnd)
+		{
+			for(size_t index = chunkBegin; index < chunkEnd; ++index)
+				func(index);
+		},
+		grainSize);
+}
+
+/// @brief Reduce the range [begin, end) by splitting it into chunks processed concurrently.
+/// @param begin First index of the range.
+/// @param end Past-the-end index of the range.
+/// @param identity Result of an empty range, neutral element of reduce.
+/// @param rangeFunc Callable returning the partial result of a chunk, rangeFunc(chunkBegin, chunkEnd).
+/// @param reduce Associative callable combining two partial results, reduce(lhs, rhs).
+/// @param grainSize Minimum number of indices handled by one chunk, the exact number in Deterministic mode.
+/// @param mode Whether the chunks depend on the number of threads, see ReductionMode.
+/// @return The partial results of the chunks combined from left to right, starting from identity.
+template<typename T, typename RangeFunc, typename ReduceFunc>
+T ParallelReduce(
+	size_t begin,
+	size_t end,
+	T identity,
+	RangeFunc&& rangeFunc,
+	ReduceFunc&& reduce,
+	size_t grainSize = 1024,
+	ReductionMode mode = ReductionMode::Fast)
+{
+	if(end <= begin)
+		return identity;
+
+	const size_t count = end - begin;
+	size_t chunkSize = std::max<size_t>(grainSize, 1);
+	if(mode == ReductionMode::Fast)
+	{
+		const size_t threadCount = IsInParallelLoop() ? 1 : GetThreadCount();
+		const size_t chunkCount = std::min<size_t>(threadCount, (count + chunkSize - 1) / chunkSize);
+		chunkSize = (count + chunkCount - 1) / chunkCount;
+	}
+	const size_t chunkCount = (count + chunkSize - 1) / chunkSize;
+
+	// Each partial result is wrapped, so that the chunks never share a word (std::vector<bool>).
+	struct PartialResult
+	{
+		T Value;
+	};
+	std::vector<PartialResult> partialResults(chunkCount, PartialResult{ identity });
+	ParallelFor(
+		0,
+		chunkCount,
+		[&](size_t iChunk)
+		{
+			const size_t chunkBegin = begin + iChunk * chunkSize;
+			partialResults[iChunk].Value = rangeFunc(chunkBegin, std::min(end, chunkBegin + chunkSize));
+		},
+		1);
+
+	T result = std::move(identity);
+	for(PartialResult& partialResult : partialResults)
+		result = reduce(std::move(result), std::move(partialResult.Value));
+	return result;
+}
+} // namespace Core::Parallel
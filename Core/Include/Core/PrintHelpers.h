@@ -1,7 +1,9 @@
 #pragma once
+#include <cstdint>
+#include <filesystem>
 #include <format>
-#include <iostream>
 #include <source_location>
+#include <string>
 
 namespace PrintHelpers
 {
@@ -50,115 +52,130 @@ inline std::string_view ExtractFunctionName(std::string_view signature)
 	return signature.substr(name_start, name_end - name_start);
 }
 
-// Basic output functions
-template<typename... Args>
-void Print(std::format_string<Args...> fmt, Args&&... args)
+/// @brief Severity of a log record.
+enum struct LogLevel : uint8_t
 {
-	(std::cout) << std::format(fmt, std::forward<Args>(args)...) << '\n';
-}
+	Trace = 0,
+	Debug,
+	Info,
+	Success,
+	Warning,
+	Error,
+	/// @brief Disable all the records.
+	Off,
+};
+
+// Records below this level are removed at compile time, Debug and Trace are removed from release builds by default.
+#ifndef PRINTHELPERS_MIN_LEVEL
+#ifdef NDEBUG
+#define PRINTHELPERS_MIN_LEVEL 2
+#else
+#define PRINTHELPERS_MIN_LEVEL 0
+#endif
+#endif
 
-template<typename... Args>
-void PrintErr(std::format_string<Args...> fmt, Args&&... args)
-{
-	std::cerr << std::format(fmt, std::forward<Args>(args)...) << '\n';
-}
+/// @brief Lowest level compiled in, see PRINTHELPERS_MIN_LEVEL.
+constexpr LogLevel CompileTimeLogLevel = static_cast<LogLevel>(PRINTHELPERS_MIN_LEVEL);
+
+/// @brief Set the lowest level written at runtime (Trace by default).
+void SetLogLevel(LogLevel level);
+
+/// @brief Get the lowest level written at runtime.
+LogLevel GetLogLevel();
+
+/// @brief Also write the records to a file, without the color codes.
+/// @param filepath Path of the file, it is truncated. An empty path closes the current file.
+/// @return True if the file was opened (or closed).
+bool SetLogFile(const std::filesystem::path& filepath);
+
+/// @brief Enable or disable the console (stdout and stderr) output.
+void SetConsoleEnabled(bool isEnabled);
+
+/// @brief Block until all the records pushed so far are written.
+/// @note The records are written by a background thread, call it before reading the outputs or aborting.
+void Flush();
 
 // Implementation functions (not called directly)
 namespace detail
 {
+/// @brief Check the runtime level of a record.
+bool IsLogLevelEnabled(LogLevel level);
+
+/// @brief Queue a formatted record, it is decorated and written by the logging thread.
+/// @param level Level of the record, it selects the console stream.
+/// @param functionName Function which emitted the record, or nullptr to write the message as is.
+/// @param message Formatted message.
+/// @note Lock-free: the records are pushed into a multiple producers, single consumer queue.
+/// @note The records pushed once the logger is destroyed, at exit, are dropped.
+void PushRecord(LogLevel level, const char* functionName, std::string&& message);
+
+template<LogLevel level, typename... Args>
+void LogImpl(const std::source_location& loc, std::format_string<Args...> fmt, Args&&... args)
+{
+	if constexpr(level < CompileTimeLogLevel)
+	{
+		(void)loc;
+		(void)fmt;
+		(void)sizeof...(args);
+	}
+	else
+	{
+		if(!IsLogLevelEnabled(level))
+			return;
+		PushRecord(level, loc.function_name(), std::format(fmt, std::forward<Args>(args)...));
+	}
+}
+
 template<typename... Args>
 void InfoImpl(const std::source_location& loc, std::format_string<Args...> fmt, Args&&... args)
 {
-	auto func_name = ExtractFunctionName(loc.function_name());
-	std::cout << std::format(
-		"{}[INFO]{} {}[{}]{} {}\n",
-		Color::Cyan,
-		Color::Reset,
-		Color::Blue,
-		func_name,
-		Color::Reset,
-		std::format(fmt, std::forward<Args>(args)...));
+	LogImpl<LogLevel::Info>(loc, fmt, std::forward<Args>(args)...);
 }
 
 template<typename... Args>
 void SuccessImpl(const std::source_location& loc, std::format_string<Args...> fmt, Args&&... args)
 {
-	auto func_name = ExtractFunctionName(loc.function_name());
-	std::cout << std::format(
-		"{}[SUCCESS]{} {}[{}]{} {}\n",
-		Color::Green,
-		Color::Reset,
-		Color::Blue,
-		func_name,
-		Color::Reset,
-		std::format(fmt, std::forward<Args>(args)...));
+	LogImpl<LogLevel::Success>(loc, fmt, std::forward<Args>(args)...);
 }
 
 template<typename... Args>
 void WarningImpl(const std::source_location& loc, std::format_string<Args...> fmt, Args&&... args)
 {
-	auto func_name = ExtractFunctionName(loc.function_name());
-	std::cerr << std::format(
-		"{}[WARNING]{} {}[{}]{} {}\n",
-		Color::Yellow,
-		Color::Reset,
-		Color::Blue,
-		func_name,
-		Color::Reset,
-		std::format(fmt, std::forward<Args>(args)...));
+	LogImpl<LogLevel::Warning>(loc, fmt, std::forward<Args>(args)...);
 }
 
 template<typename... Args>
 void ErrorImpl(const std::source_location& loc, std::format_string<Args...> fmt, Args&&... args)
 {
-	auto func_name = ExtractFunctionName(loc.function_name());
-	std::cerr << std::format(
-		"{}[ERROR]{} {}[{}]{} {}\n",
-		Color::BrightRed,
-		Color::Reset,
-		Color::Blue,
-		func_name,
-		Color::Reset,
-		std::format(fmt, std::forward<Args>(args)...));
+	LogImpl<LogLevel::Error>(loc, fmt, std::forward<Args>(args)...);
 }
 
 template<typename... Args>
 void DebugImpl(const std::source_location& loc, std::format_string<Args...> fmt, Args&&... args)
 {
-#ifdef NDEBUG
-	(void)sizeof...(args);
-#else
-	auto func_name = ExtractFunctionName(loc.function_name());
-	std::cout << std::format(
-		"{}[DEBUG]{} {}[{}]{} {}\n",
-		Color::Gray,
-		Color::Reset,
-		Color::Blue,
-		func_name,
-		Color::Reset,
-		std::format(fmt, std::forward<Args>(args)...));
-#endif
+	LogImpl<LogLevel::Debug>(loc, fmt, std::forward<Args>(args)...);
 }
 
 template<typename... Args>
 void TraceImpl(const std::source_location& loc, std::format_string<Args...> fmt, Args&&... args)
 {
-#ifdef NDEBUG
-	(void)sizeof...(args);
-#else
-	auto func_name = ExtractFunctionName(loc.function_name());
-	std::cout << std::format(
-		"{}[TRACE]{} {}[{}]{} {}\n",
-		Color::Magenta,
-		Color::Reset,
-		Color::Blue,
-		func_name,
-		Color::Reset,
-		std::format(fmt, std::forward<Args>(args)...));
-#endif
+	LogImpl<LogLevel::Trace>(loc, fmt, std::forward<Args>(args)...);
 }
 } // namespace detail
 
+// Basic output functions, written in order with the other records but never filtered.
+template<typename... Args>
+void Print(std::format_string<Args...> fmt, Args&&... args)
+{
+	detail::PushRecord(LogLevel::Info, nullptr, std::format(fmt, std::forward<Args>(args)...));
+}
+
+template<typename... Args>
+void PrintErr(std::format_string<Args...> fmt, Args&&... args)
+{
+	detail::PushRecord(LogLevel::Error, nullptr, std::format(fmt, std::forward<Args>(args)...));
+}
+
 } // namespace PrintHelpers
 
 // Macros to capture the caller's location
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+
+namespace Core::Profiler
+{
+/// @brief Maximal number of zones kept per thread, the oldest ones are overwritten first.
+constexpr uint32_t ZoneCapacity = 1 << 14;
+
+/// @brief Zone recorded by a thread.
+struct ZoneEvent
+{
+	/// @brief Name of the zone, a string with static storage duration.
+	const char* Name = nullptr;
+	/// @brief Start of the zone in nanoseconds, see GetTimestamp.
+	uint64_t Start = 0;
+	/// @brief Duration of the zone in nanoseconds.
+	uint64_t Duration = 0;
+	/// @brief Index of the buffer which recorded the zone.
+	/// @note A buffer is given back when its thread exits and reused by the next thread, so the short-lived workers of
+	/// Core::Parallel share a few lanes instead of creating one each.
+	uint32_t ThreadIdx = 0;
+};
+
+/// @brief Nanoseconds elapsed since the first use of the profiler.
+uint64_t GetTimestamp();
+
+/// @brief Record a zone in the buffer of the calling thread.
+/// @param name Name of the zone, it must outlive the profiler (string literal).
+/// @param start Start of the zone, see GetTimestamp.
+/// @param end End of the zone, see GetTimestamp.
+/// @note Lock-free: each thread only writes its own ring buffer.
+void RecordZone(const char* name, uint64_t start, uint64_t end);
+
+/// @brief Copy the zones recorded by all the threads, sorted by start time.
+/// @note The zones may keep being recorded meanwhile, the ones overwritten during the copy are dropped.
+std::vector<ZoneEvent> CollectZones();
+
+/// @brief Forget all the recorded zones.
+void Clear();
+
+/// @brief Write the recorded zones in the Chrome trace event format, readable by chrome://tracing and Perfetto.
+/// @param filepath Path of the JSON file.
+/// @return True if the file was written.
+bool WriteChromeTrace(const std::filesystem::path& filepath);
+
+/// @brief Record a zone from its construction to its destruction.
+class ScopedZone
+{
+public:
+	/// @brief Start the zone.
+	/// @param name Name of the zone, it must outlive the profiler (string literal).
+	explicit ScopedZone(const char* name)
+		: m_Name(name)
+		, m_Start(GetTimestamp())
+	{
+	}
+	/// @brief End the zone.
+	~ScopedZone() { RecordZone(m_Name, m_Start, GetTimestamp()); }
+
+	ScopedZone(const ScopedZone&) = delete;
+	ScopedZone& operator=(const ScopedZone&) = delete;
+
+private:
+	const char* m_Name;
+	uint64_t m_Start;
+};
+} // namespace Core::Profiler
+
+#define PROFILER_CONCAT_IMPL(a, b) a##b
+#define PROFILER_CONCAT(a, b) PROFILER_CONCAT_IMPL(a, b)
+
+// Macros to profile a scope, they are removed when the ENABLE_PROFILING option is off.
+#ifdef ENABLE_PROFILING
+#	define ProfileScope(name) const Core::Profiler::ScopedZone PROFILER_CONCAT(profilerZone, __LINE__)(name)
+#else
+#	define ProfileScope(name) ((void)0)
+#endif
+
+#define ProfileFunction() ProfileScope(__func__)
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <glad/gl.h>
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace Renderer
+{
+/// @brief GPU duration of a section in a past frame.
+struct GpuSectionTime
+{
+	uint32_t Section = 0;
+	float Milliseconds = 0.f;
+};
+
+/// @brief Timer of the GPU work of the sections of a frame, with timestamp queries read a few frames later.
+/// @note Each section records a timestamp query at its start and at its end (glQueryCounter), so that the sections can
+/// nest, unlike GL_TIME_ELAPSED queries. The queries of a frame are read FrameLatency - 1 frames later, when the GPU
+/// has most likely reached them: the results are never waited for, those not yet available are dropped.
+/// @note A current OpenGL 4.5 context is required.
+class GpuTimer
+{
+public:
+	/// @brief Number of frames in flight, the results of frame N are read at the end of frame N + 2.
+	static constexpr uint32_t FrameLatency = 3;
+
+public:
+	/// @brief Create the queries.
+	/// @param sectionCapacity Maximal number of sections, the sections of a larger index are not timed.
+	explicit GpuTimer(uint32_t sectionCapacity = 64);
+	/// @brief Delete the queries.
+	~GpuTimer();
+
+	GpuTimer(const GpuTimer&) = delete;
+	GpuTimer& operator=(const GpuTimer&) = delete;
+
+	/// @brief Record the start of a section in the current frame.
+	void Begin(uint32_t section);
+
+	/// @brief Record the end of a section in the current frame.
+	void End(uint32_t section);
+
+	/// @brief Close the current frame and read the oldest one.
+	/// @return The durations of the sections of the frame FrameLatency - 1 frames before, empty if not yet available.
+	std::span<const GpuSectionTime> EndFrame();
+
+private:
+	/// @brief Queries of a frame.
+	struct FrameQueries
+	{
+		/// @brief Start and end queries of each section.
+		std::vector<GLuint> Queries{};
+		/// @brief Sections ended in the frame, in order.
+		std::vector<uint32_t> Sections{};
+	};
+
+	/// @brief Read the durations of the sections of a frame, if all of them are available.
+	void ReadFrame(FrameQueries& frame);
+
+private:
+	uint32_t m_SectionCapacity = 0;
+	std::array<FrameQueries, FrameLatency> m_Frames{};
+	/// @brief Frame whose queries are being recorded.
+	uint32_t m_CurrentFrame = 0;
+	/// @brief Durations read by the last EndFrame.
+	std::vector<GpuSectionTime> m_Results{};
+};
+} // namespace Renderer
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <glad/gl.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace Renderer
+{
+/// @brief Buffer for the data uploaded every frame (deformed positions, per-frame uniforms), without stall.
+/// @note The buffer is allocated once with glNamedBufferStorage and stays persistently mapped. It is split into
+/// RegionCount regions used in turn: while the GPU reads the region of frame N, the CPU writes the next ones. A fence
+/// is inserted after the draws of each frame, BeginWrite only waits for it when the CPU is RegionCount frames ahead.
+/// @note The mapping is coherent, the writes need no flush. A current OpenGL 4.5 context is required.
+class StreamingBuffer
+{
+public:
+	/// @brief Number of regions, the CPU writes frame N + 2 while the GPU reads frame N.
+	static constexpr uint32_t RegionCount = 3;
+	/// @brief Alignment of the regions in the buffer, enough for any vertex, index or uniform buffer binding.
+	static constexpr size_t RegionAlignment = 256;
+
+public:
+	/// @brief Allocate and map the buffer.
+	/// @param regionSize Size in bytes available each frame, rounded up to RegionAlignment.
+	explicit StreamingBuffer(size_t regionSize);
+	/// @brief Wait for the GPU, then unmap and free the buffer.
+	~StreamingBuffer();
+
+	StreamingBuffer(const StreamingBuffer&) = delete;
+	StreamingBuffer& operator=(const StreamingBuffer&) = delete;
+
+	/// @brief Get the OpenGL name of the buffer, to bind it with GetWriteOffset.
+	GLuint GetHandle() const { return m_Handle; }
+
+	/// @brief Get the size in bytes of each region.
+	size_t GetRegionSize() const { return m_RegionSize; }
+
+	/// @brief Get the offset in the buffer of the region of the current frame.
+	size_t GetWriteOffset() const { return m_CurrentRegion * m_RegionSize; }
+
+	/// @brief Get the number of times BeginWrite had to wait for the GPU.
+	uint64_t GetStallCount() const { return m_StallCount; }
+
+	/// @brief Get the mapped region of the current frame, waiting until the GPU no longer reads it.
+	/// @note The region can be written from any thread (for instance by the parallel kernels filling vertex streams)
+	/// until EndFrame.
+	std::span<std::byte> BeginWrite();
+
+	/// @brief Get the mapped region of the current frame as an array of T, see BeginWrite.
+	template<typename T>
+	std::span<T> BeginWrite()
+	{
+		const std::span<std::byte> region = BeginWrite();
+		return { reinterpret_cast<T*>(region.data()), region.size() / sizeof(T) };
+	}
+
+	/// @brief Insert the fence of the current region and move to the next one.
+	/// @note Must be called once per frame, after the draw commands reading the region.
+	void EndFrame();
+
+private:
+	/// @brief Wait for the fence of a region and delete it, if any.
+	void WaitForRegion(uint32_t region);
+
+private:
+	/// @brief OpenGL name of the buffer.
+	GLuint m_Handle = 0;
+	/// @brief Start of the mapped buffer.
+	std::byte* m_MappedData = nullptr;
+	/// @brief Size in bytes of each region.
+	size_t m_RegionSize = 0;
+	/// @brief Region of the current frame.
+	uint32_t m_CurrentRegion = 0;
+	/// @brief Fence after the last draws reading each region, null when the region is free.
+	std::array<GLsync, RegionCount> m_Fences{};
+	/// @brief Number of waits for the GPU.
+	uint64_t m_StallCount = 0;
+};
+} // namespace Renderer
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace Core::Parallel
+{
+/// @brief Tasks with dependencies, each task being run on the shared pool once all its predecessors are done.
+/// @note The tasks can use the parallel helpers (see ParallelFor), their loops share the threads of the pool.
+class TaskGraph
+{
+public:
+	/// @brief Index of a task in the graph.
+	using TaskId = uint32_t;
+
+public:
+	/// @brief Add a task to the graph.
+	/// @return The index of the task.
+	TaskId AddTask(std::function<void()> func);
+
+	/// @brief Make a task wait for another one.
+	/// @param before Task to complete first.
+	/// @param after Task started once before is done.
+	void AddDependency(TaskId before, TaskId after);
+
+	/// @brief Get the number of tasks.
+	uint32_t GetTaskCount() const;
+
+	/// @brief Run every task and wait for them, the graph can be run again afterwards.
+	/// @throw std::invalid_argument if the dependencies form a cycle, nothing is run then.
+	/// @throw The first exception thrown by a task, the tasks depending on it are skipped.
+	void Run() const;
+
+private:
+	/// @brief Task and the tasks waiting for it.
+	struct Node
+	{
+		std::function<void()> Func{};
+		std::vector<TaskId> Successors{};
+		uint32_t PredecessorCount{ 0 };
+	};
+
+	/// @brief Tasks of the graph, indexed by TaskId.
+	std::vector<Node> m_Nodes{};
+};
+} // namespace Core::Parallel
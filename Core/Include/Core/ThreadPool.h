@@ -0,0 +1,142 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Core::Parallel
+{
+/// @brief Placement of the worker threads on the cores.
+enum struct ThreadAffinity : uint8_t
+{
+	/// @brief The workers are scheduled freely by the system.
+	None,
+	/// @brief Each worker is pinned to its own core, the calling thread being left on the first one.
+	PinWorkers,
+};
+
+/// @brief Pool of worker threads executing tasks, each worker owning a queue the idle workers steal from.
+/// @note A worker runs the last task pushed on its own queue first (the one most likely in cache), then steals the
+/// oldest task of the other queues. The tasks submitted by other threads go to a shared queue.
+/// @note A thread waiting for tasks (see TaskGroup::Wait) runs the pending ones meanwhile, so tasks can submit and
+/// wait for other tasks without blocking the workers.
+class ThreadPool
+{
+public:
+	/// @brief Task executed by the pool.
+	using Task = std::function<void()>;
+
+public:
+	/// @brief Start the worker threads.
+	/// @param workerCount Number of worker threads, the pool only queues the tasks if it is 0.
+	/// @param affinity Placement of the workers on the cores.
+	explicit ThreadPool(uint32_t workerCount, ThreadAffinity affinity = ThreadAffinity::None);
+
+	/// @brief Run the remaining tasks, then join the worker threads.
+	/// @note The pool must not be destroyed by one of its own tasks.
+	~ThreadPool();
+
+	ThreadPool(const ThreadPool&) = delete;
+	ThreadPool& operator=(const ThreadPool&) = delete;
+
+	/// @brief Get the number of worker threads.
+	uint32_t GetWorkerCount() const;
+
+	/// @brief Get the placement of the workers on the cores.
+	ThreadAffinity GetAffinity() const;
+
+	/// @brief Queue a task, on the queue of the calling worker if it belongs to the pool.
+	/// @note The task must not throw, see TaskGroup to get the exceptions back.
+	void Submit(Task task);
+
+	/// @brief Run one pending task on the calling thread.
+	/// @return False if no task was pending.
+	bool RunPendingTask();
+
+	/// @brief Run the pending tasks on the calling thread until the counter drops to 0.
+	/// @note The counter must be decremented by tasks of this pool, see NotifyCompletion.
+	void WaitUntilZero(const std::atomic<size_t>& counter);
+
+	/// @brief Wake the threads blocked in WaitUntilZero, called after a counter they wait for dropped to 0.
+	void NotifyCompletion();
+
+private:
+	/// @brief Queue of tasks, pushed and popped at the back by its owner and stolen at the front.
+	struct TaskQueue
+	{
+		std::mutex Mutex{};
+		std::deque<Task> Tasks{};
+	};
+
+	/// @brief Main loop of a worker thread.
+	void RunWorker(uint32_t workerIdx);
+
+	/// @brief Pop a task, from the queue of the given worker first (-1 for an external thread), then from the others.
+	bool PopTask(int workerIdx, Task& task);
+
+	/// @brief Index of the calling thread in the pool, -1 if it is not one of its workers.
+	int GetCurrentWorkerIndex() const;
+
+	/// @brief Increment the epoch and wake the sleeping threads.
+	void Signal(bool wakeAll);
+
+private:
+	/// @brief Queue of each worker, then the shared queue of the external threads.
+	std::vector<std::unique_ptr<TaskQueue>> m_Queues{};
+	/// @brief Worker threads.
+	std::vector<std::jthread> m_Workers{};
+	/// @brief Incremented by each submission and completion, the idle threads sleep until it changes.
+	std::atomic<uint32_t> m_Epoch{ 0 };
+	/// @brief Number of queued tasks not yet popped.
+	std::atomic<size_t> m_QueuedCount{ 0 };
+	/// @brief Set by the destructor to stop the workers once the queues are empty.
+	std::atomic<bool> m_IsStopping{ false };
+	/// @brief Placement of the workers on the cores.
+	ThreadAffinity m_Affinity{ ThreadAffinity::None };
+};
+
+/// @brief Group of tasks run on a pool and waited for together.
+/// @note The first exception thrown by a task is rethrown by Wait, the other tasks still run to completion.
+class TaskGroup
+{
+public:
+	/// @brief Construct an empty group.
+	explicit TaskGroup(ThreadPool& pool);
+
+	/// @brief Wait for the remaining tasks, their exceptions are dropped.
+	~TaskGroup();
+
+	TaskGroup(const TaskGroup&) = delete;
+	TaskGroup& operator=(const TaskGroup&) = delete;
+
+	/// @brief Submit a task of the group.
+	void Run(ThreadPool::Task task);
+
+	/// @brief Run a task of the group on the calling thread.
+	void RunInline(const ThreadPool::Task& task);
+
+	/// @brief Wait for every task of the group, running pending tasks meanwhile.
+	/// @throw The first exception thrown by a task.
+	void Wait();
+
+private:
+	/// @brief Keep the first exception thrown by a task.
+	void CaptureException();
+
+private:
+	/// @brief Pool running the tasks.
+	ThreadPool& m_Pool;
+	/// @brief Number of submitted tasks not yet completed.
+	std::atomic<size_t> m_PendingCount{ 0 };
+	/// @brief Protects m_Exception.
+	std::mutex m_ExceptionMutex{};
+	/// @brief First exception thrown by a task.
+	std::exception_ptr m_Exception{};
+};
+} // namespace Core::Parallel
@@ -3,6 +3,7 @@
 #include "Core/Event/Input.h"
 #include "Core/Event/KeyCodes.h"
 #include "Core/PrintHelpers.h"
+#include "Core/Profiler.h"
 #include "Core/Renderer/GLUtils.h"
 #include "imgui.h"
 #include "imgui_impl_glfw.h"
@@ -11,8 +12,14 @@
 #include <GLFW/glfw3.h>
 #include <glm/glm.hpp>
 
+#include <algorithm>
+#include <array>
 #include <cassert>
+#include <format>
 #include <iostream>
+#include <limits>
+#include <span>
+#include <string>
 
 extern bool g_ApplicationRunning;
 
@@ -28,6 +35,49 @@ static void GLFWErrorCallback(int error, const char* description)
 	Error("[GLFW Error]: {}", description);
 }
 
+namespace
+{
+/// @brief Number of bins of the histogram of the frame times.
+constexpr size_t FrameHistogramBinCount = 48;
+
+/// @brief Get the milliseconds elapsed since a time point.
+float GetElapsedMilliseconds(const std::chrono::steady_clock::time_point start)
+{
+	return std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+/// @brief Time a section of the frame on the CPU, and on the GPU when a timer is given, until the end of the scope.
+class SectionTimer
+{
+public:
+	SectionTimer(Profiler::FrameStats& stats, const uint32_t section, Renderer::GpuTimer* gpuTimer)
+		: m_Stats(stats)
+		, m_GpuTimer(gpuTimer)
+		, m_Section(section)
+		, m_Start(std::chrono::steady_clock::now())
+	{
+		if(m_GpuTimer)
+			m_GpuTimer->Begin(m_Section);
+	}
+
+	~SectionTimer()
+	{
+		if(m_GpuTimer)
+			m_GpuTimer->End(m_Section);
+		m_Stats.AddCpuSample(m_Section, GetElapsedMilliseconds(m_Start));
+	}
+
+	SectionTimer(const SectionTimer&) = delete;
+	SectionTimer& operator=(const SectionTimer&) = delete;
+
+private:
+	Profiler::FrameStats& m_Stats;
+	Renderer::GpuTimer* m_GpuTimer;
+	uint32_t m_Section;
+	std::chrono::steady_clock::time_point m_Start;
+};
+} // namespace
+
 Application::Application(const ApplicationSpecification& specification)
 	: m_Specification(specification)
 {
@@ -44,6 +94,14 @@ Application::Application(const ApplicationSpecification& specification)
 
 	Renderer::Utils::InitOpenGLDebugMessageCallback();
 
+	// The sections of the layers are added by PushLayer.
+	m_FrameSections.Frame = m_FrameStats.GetSectionIndex("Frame");
+	m_FrameSections.PollEvents = m_FrameStats.GetSectionIndex("PollEvents");
+	m_FrameSections.ImGuiRender = m_FrameStats.GetSectionIndex("ImGui::Render");
+	m_FrameSections.PlatformWindows = m_FrameStats.GetSectionIndex("PlatformWindows");
+	m_FrameSections.SwapBuffers = m_FrameStats.GetSectionIndex("SwapBuffers");
+	m_GpuTimer = std::make_unique<Renderer::GpuTimer>();
+
 	// ImGui initialization
 	IMGUI_CHECKVERSION();
 	ImGui::CreateContext();
@@ -80,6 +138,7 @@ Application::~Application()
 	ImGui::DestroyContext();
 
 	m_LayerStack.clear();
+	m_GpuTimer.reset();
 
 	m_Window->Destroy();
 	glfwTerminate();
@@ -98,7 +157,14 @@ void Application::Run()
 	// Main Application loop
 	while(m_Running)
 	{
-		glfwPollEvents();
+		ProfileScope("Application::Frame");
+		m_FrameStart = std::chrono::steady_clock::now();
+
+		{
+			ProfileScope("Application::PollEvents");
+			const SectionTimer timer(m_FrameStats, m_FrameSections.PollEvents, nullptr);
+			glfwPollEvents();
+		}
 
 		if(m_Window->ShouldClose())
 		{
@@ -106,13 +172,22 @@ void Application::Run()
 			break;
 		}
 
+		// The GPU section of the frame starts once the frame is sure to end, with EndFrameTimings.
+		m_GpuTimer->Begin(m_FrameSections.Frame);
+
 		float currentTime = GetTime();
 		float timestep = glm::clamp(currentTime - lastTime, 0.001f, 0.1f);
 		lastTime = currentTime;
 
 		// Main layer update here
-		for(const std::unique_ptr<Layer>& layer : m_LayerStack)
-			layer->OnUpdate(timestep);
+		{
+			ProfileScope("Application::UpdateLayers");
+			for(size_t iLayer = 0; iLayer < m_LayerStack.size(); ++iLayer)
+			{
+				const SectionTimer timer(m_FrameStats, m_FrameSections.LayerUpdates[iLayer], m_GpuTimer.get());
+				m_LayerStack[iLayer]->OnUpdate(timestep);
+			}
+		}
 
 		// Start the Dear ImGui frame
 		ImGui_ImplOpenGL3_NewFrame();
@@ -120,6 +195,8 @@ void Application::Run()
 		ImGui::NewFrame();
 
 		{
+			ProfileScope("Application::RenderLayers");
+
 			static ImGuiDockNodeFlags dockspace_flags = ImGuiDockNodeFlags_None;
 
 			// We are using the ImGuiWindowFlags_NoDocking flag to make the parent window not dockable into,
@@ -172,27 +249,48 @@ void Application::Run()
 			}
 
 			// NOTE: rendering can be done elsewhere (eg. render thread)
-			for(const std::unique_ptr<Layer>& layer : m_LayerStack)
-				layer->OnRender();
+			for(size_t iLayer = 0; iLayer < m_LayerStack.size(); ++iLayer)
+			{
+				const SectionTimer timer(m_FrameStats, m_FrameSections.LayerRenders[iLayer], m_GpuTimer.get());
+				m_LayerStack[iLayer]->OnRender();
+			}
+
+			if(m_ShowFrameStats)
+				DrawFrameStatsPanel();
 
 			ImGui::End();
 		}
 
-		ImGui::Render();
-		glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+		{
+			ProfileScope("Application::DrawImGui");
+
+			{
+				const SectionTimer timer(m_FrameStats, m_FrameSections.ImGuiRender, m_GpuTimer.get());
+				ImGui::Render();
+				glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+				ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+			}
+
+			ImGuiIO& io = ImGui::GetIO();
+			IM_UNUSED(io);
+			if(io.ConfigFlags & ImGuiConfigFlags_ViewportsEnable)
+			{
+				// The timestamps are taken in the main context, around the work submitted by the other contexts.
+				const SectionTimer timer(m_FrameStats, m_FrameSections.PlatformWindows, m_GpuTimer.get());
+				GLFWwindow* backup_current_context = glfwGetCurrentContext();
+				ImGui::UpdatePlatformWindows();
+				ImGui::RenderPlatformWindowsDefault();
+				glfwMakeContextCurrent(backup_current_context);
+			}
+		}
 
-		ImGuiIO& io = ImGui::GetIO();
-		IM_UNUSED(io);
-		ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
-		if(io.ConfigFlags & ImGuiConfigFlags_ViewportsEnable)
 		{
-			GLFWwindow* backup_current_context = glfwGetCurrentContext();
-			ImGui::UpdatePlatformWindows();
-			ImGui::RenderPlatformWindowsDefault();
-			glfwMakeContextCurrent(backup_current_context);
+			ProfileScope("Application::SwapBuffers");
+			const SectionTimer timer(m_FrameStats, m_FrameSections.SwapBuffers, nullptr);
+			m_Window->Update();
 		}
 
-		m_Window->Update();
+		EndFrameTimings();
 	}
 }
 
@@ -260,6 +358,110 @@ bool Application::OnCloseEvent(WindowCloseEvent&)
 	return true;
 }
 
+void Application::AddLayerSections(const Layer& layer)
+{
+	// The index in the stack tells apart the layers of the same type.
+	const size_t iLayer = m_FrameSections.LayerUpdates.size();
+	m_FrameSections.LayerUpdates.push_back(
+		m_FrameStats.GetSectionIndex(std::format("{} {}::OnUpdate", iLayer, layer.GetName())));
+	m_FrameSections.LayerRenders.push_back(
+		m_FrameStats.GetSectionIndex(std::format("{} {}::OnRender", iLayer, layer.GetName())));
+}
+
+void Application::EndFrameTimings()
+{
+	ProfileScope("Application::EndFrameTimings");
+
+	m_GpuTimer->End(m_FrameSections.Frame);
+	m_FrameStats.AddCpuSample(m_FrameSections.Frame, GetElapsedMilliseconds(m_FrameStart));
+
+	// The GPU times are those of a frame a few frames back, whose queries are done.
+	for(const Renderer::GpuSectionTime& time : m_GpuTimer->EndFrame())
+		m_FrameStats.AddGpuSample(time.Section, time.Milliseconds);
+}
+
+void Application::DrawFrameStatsPanel()
+{
+	ImGui::Begin("Frame Statistics", &m_ShowFrameStats);
+
+	const Profiler::FrameSection& frame = m_FrameStats.GetSections()[m_FrameSections.Frame];
+	const Profiler::TimingSummary frameSummary = frame.Cpu.ComputeSummary();
+	ImGui::Text("Frame %.2f ms (%.0f fps), p50 %.2f ms, p95 %.2f ms, p99 %.2f ms over %u frames",
+		frame.Cpu.GetLastSample(),
+		frameSummary.P50 > 0.f ? 1000.f / frameSummary.P50 : 0.f,
+		frameSummary.P50,
+		frameSummary.P95,
+		frameSummary.P99,
+		frameSummary.SampleCount);
+
+	// The plots range up to twice the 99th percentile, the histogram gathering the slower frames in its last bin.
+	const float timeRange = std::max(2.f * frameSummary.P99, 1.f);
+	const std::span<const float> frameTimes = frame.Cpu.GetSamples();
+	ImGui::PlotLines("##FrameTimes",
+		frameTimes.data(),
+		static_cast<int>(frameTimes.size()),
+		static_cast<int>(frame.Cpu.GetOldestIndex()),
+		"Frame time (ms)",
+		0.f,
+		timeRange,
+		ImVec2(-1.f, 60.f));
+
+	std::array<float, FrameHistogramBinCount> binCounts{};
+	frame.Cpu.ComputeHistogram(binCounts, timeRange);
+	const std::string histogramLabel = std::format("0 - {:.1f} ms", timeRange);
+	ImGui::PlotHistogram("##FrameHistogram",
+		binCounts.data(),
+		static_cast<int>(binCounts.size()),
+		0,
+		histogramLabel.c_str(),
+		0.f,
+		std::numeric_limits<float>::max(),
+		ImVec2(-1.f, 60.f));
+
+	if(ImGui::Button("Save CSV"))
+	{
+		if(m_FrameStats.WriteCsv("FrameStats.csv"))
+			Info("Frame statistics written to FrameStats.csv");
+		else
+			Error("Failed to write the frame statistics");
+	}
+	ImGui::SameLine();
+	if(ImGui::Button("Reset"))
+		m_FrameStats.Clear();
+
+	constexpr ImGuiTableFlags tableFlags =
+		ImGuiTableFlags_RowBg | ImGuiTableFlags_Borders | ImGuiTableFlags_SizingFixedFit;
+	if(ImGui::BeginTable("Sections", 7, tableFlags))
+	{
+		ImGui::TableSetupColumn("Section", ImGuiTableColumnFlags_WidthStretch);
+		for(const char* column : { "CPU p50", "CPU p95", "CPU p99", "GPU p50", "GPU p95", "GPU p99" })
+			ImGui::TableSetupColumn(column);
+		ImGui::TableHeadersRow();
+
+		for(const Profiler::FrameSection& section : m_FrameStats.GetSections())
+		{
+			ImGui::TableNextRow();
+			ImGui::TableNextColumn();
+			ImGui::TextUnformatted(section.Name.c_str());
+			for(const Profiler::TimingHistory* history : { &section.Cpu, &section.Gpu })
+			{
+				const Profiler::TimingSummary summary = history->ComputeSummary();
+				for(const float value : { summary.P50, summary.P95, summary.P99 })
+				{
+					ImGui::TableNextColumn();
+					if(summary.SampleCount > 0)
+						ImGui::Text("%.3f", value);
+					else
+						ImGui::TextUnformatted("-");
+				}
+			}
+		}
+		ImGui::EndTable();
+	}
+
+	ImGui::End();
+}
+
 bool Application::OnKeyReleasedEvent(KeyReleasedEvent& event)
 {
 	if(Input::IsKeyReleased(Key::Escape))
@@ -0,0 +1,124 @@
+#include "Core/FrameStats.h"
+
+#include <algorithm>
+#include <cmath>
+#include <format>
+#include <fstream>
+#include <numeric>
+
+namespace Core::Profiler
+{
+namespace
+{
+/// @brief Get the sample of rank ceil(percentile * count) in sorted samples.
+float GetPercentile(const std::span<const float> sortedSamples, const float percentile)
+{
+	const size_t rank = static_cast<size_t>(std::ceil(percentile * static_cast<float>(sortedSamples.size())));
+	return sortedSamples[std::clamp<size_t>(rank, 1, sortedSamples.size()) - 1];
+}
+} // namespace
+
+//==========================TimingHistory==========================//
+void TimingHistory::AddSample(const float milliseconds)
+{
+	m_Samples[m_NextIndex] = milliseconds;
+	m_NextIndex = (m_NextIndex + 1) % FrameHistorySize;
+	m_SampleCount = std::min(m_SampleCount + 1, FrameHistorySize);
+}
+
+void TimingHistory::Clear()
+{
+	m_SampleCount = 0;
+	m_NextIndex = 0;
+}
+
+float TimingHistory::GetLastSample() const
+{
+	if(m_SampleCount == 0)
+		return 0.f;
+	return m_Samples[(m_NextIndex + FrameHistorySize - 1) % FrameHistorySize];
+}
+
+TimingSummary TimingHistory::ComputeSummary() const
+{
+	TimingSummary summary;
+	summary.SampleCount = m_SampleCount;
+	if(m_SampleCount == 0)
+		return summary;
+
+	std::array<float, FrameHistorySize> sortedSamples;
+	const std::span<float> samples(sortedSamples.data(), m_SampleCount);
+	std::ranges::copy(GetSamples(), samples.begin());
+	std::ranges::sort(samples);
+
+	summary.Mean = std::accumulate(samples.begin(), samples.end(), 0.f) / static_cast<float>(m_SampleCount);
+	summary.P50 = GetPercentile(samples, 0.50f);
+	summary.P95 = GetPercentile(samples, 0.95f);
+	summary.P99 = GetPercentile(samples, 0.99f);
+	summary.Max = samples.back();
+	return summary;
+}
+
+void TimingHistory::ComputeHistogram(const std::span<float> binCounts, const float maxMilliseconds) const
+{
+	std::ranges::fill(binCounts, 0.f);
+	if(binCounts.empty() || maxMilliseconds <= 0.f)
+		return;
+
+	const float binScale = static_cast<float>(binCounts.size()) / maxMilliseconds;
+	for(const float sample : GetSamples())
+	{
+		const size_t iBin = static_cast<size_t>(std::max(sample * binScale, 0.f));
+		binCounts[std::min(iBin, binCounts.size() - 1)] += 1.f;
+	}
+}
+
+//==========================FrameStats==========================//
+uint32_t FrameStats::GetSectionIndex(const std::string_view name)
+{
+	const auto section = std::ranges::find(m_Sections, name, &FrameSection::Name);
+	if(section != m_Sections.end())
+		return static_cast<uint32_t>(section - m_Sections.begin());
+
+	m_Sections.push_back(FrameSection{ .Name = std::string(name) });
+	return static_cast<uint32_t>(m_Sections.size() - 1);
+}
+
+void FrameStats::Clear()
+{
+	for(FrameSection& section : m_Sections)
+	{
+		section.Cpu.Clear();
+		section.Gpu.Clear();
+	}
+}
+
+bool FrameStats::WriteCsv(const std::filesystem::path& filepath) const
+{
+	std::ofstream file(filepath);
+	if(!file.is_open())
+		return false;
+
+	file << "Section,Clock,Samples,Mean (ms),P50 (ms),P95 (ms),P99 (ms),Max (ms)\n";
+	for(const FrameSection& section : m_Sections)
+	{
+		for(const auto& [clock, history] : { std::pair{ "CPU", &section.Cpu }, std::pair{ "GPU", &section.Gpu } })
+		{
+			if(history->GetSampleCount() == 0)
+				continue;
+			const TimingSummary summary = history->ComputeSummary();
+			file << std::format("\"{}\",{},{},{:.4f},{:.4f},{:.4f},{:.4f},{:.4f}\n",
+				section.Name,
+				clock,
+				summary.SampleCount,
+				summary.Mean,
+				summary.P50,
+				summary.P95,
+				summary.P99,
+				summary.Max);
+		}
+	}
+
+	return file.good();
+}
+} // namespace Core::Profiler
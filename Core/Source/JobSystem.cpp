@@ -0,0 +1,101 @@
+#include "Core/JobSystem.h"
+
+#include "Core/Parallel.h"
+#include "Core/Profiler.h"
+
+#include <algorithm>
+#include <exception>
+
+namespace Core::Parallel
+{
+//==========================CancellationToken==========================//
+CancellationToken CancellationToken::Create()
+{
+	CancellationToken token;
+	token.m_IsCancelled = std::make_shared<std::atomic<bool>>(false);
+	return token;
+}
+
+void CancellationToken::Cancel() const
+{
+	if(m_IsCancelled)
+		m_IsCancelled->store(true, std::memory_order_relaxed);
+}
+
+//==========================Job==========================//
+void Job::Wait() const
+{
+	for(JobStatus status = GetStatus(); status <= JobStatus::Running; status = GetStatus())
+		m_Status.wait(status, std::memory_order_acquire);
+}
+
+//==========================JobSystem==========================//
+JobSystem::JobSystem(const uint32_t workerCount)
+	: m_Pool(std::max(1u, workerCount))
+{}
+
+JobSystem::~JobSystem()
+{
+	// The pool is destroyed next, running the remaining tasks: the queued jobs stop at once.
+	const std::lock_guard lock(m_JobsMutex);
+	for(const std::weak_ptr<Job>& weakJob : m_Jobs)
+	{
+		if(const std::shared_ptr<Job> job = weakJob.lock())
+			job->Cancel();
+	}
+}
+
+std::shared_ptr<Job> JobSystem::Submit(JobFunction function)
+{
+	std::shared_ptr<Job> job = std::make_shared<Job>();
+	{
+		const std::lock_guard lock(m_JobsMutex);
+		std::erase_if(m_Jobs,
+			[](const std::weak_ptr<Job>& weakJob)
+			{
+				const std::shared_ptr<Job> otherJob = weakJob.lock();
+				return !otherJob || otherJob->IsDone();
+			});
+		m_Jobs.push_back(job);
+	}
+
+	m_Pool.Submit([this, job, function = std::move(function)]() { Run(*job, function); });
+	return job;
+}
+
+void JobSystem::Run(Job& job, const JobFunction& function)
+{
+	ProfileScope("JobSystem::Run");
+
+	JobStatus status = JobStatus::Cancelled;
+	if(!job.m_CancellationToken.IsCancelled())
+	{
+		job.m_Status.store(JobStatus::Running, std::memory_order_release);
+		const ThreadPoolScope scope(m_Pool);
+		const ProgressCallback progress = [&job](const float value)
+		{
+			job.m_Progress.store(std::clamp(value, 0.f, 1.f), std::memory_order_relaxed);
+		};
+		try
+		{
+			function(job.m_CancellationToken, progress);
+			status = job.m_CancellationToken.IsCancelled() ? JobStatus::Cancelled : JobStatus::Completed;
+		}
+		catch(const std::exception& exception)
+		{
+			job.m_Error = exception.what();
+			status = JobStatus::Failed;
+		}
+		catch(...)
+		{
+			job.m_Error = "Unknown exception";
+			status = JobStatus::Failed;
+		}
+	}
+
+	if(status == JobStatus::Completed)
+		job.m_Progress.store(1.f, std::memory_order_relaxed);
+	job.m_Status.store(status, std::memory_order_release);
+	job.m_Status.notify_all();
+}
+} // namespace Core::Parallel
@@ -0,0 +1,180 @@
+#include "Core/MemoryArena.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+
+namespace Core::Memory
+{
+namespace
+{
+/// @brief Resource the arenas take their blocks from, null for the new/delete resource.
+std::atomic<std::pmr::memory_resource*> s_UpstreamResource{ nullptr };
+
+/// @brief Number of scratch scopes open on the calling thread.
+thread_local uint32_t t_ScratchScopeDepth = 0;
+
+/// @brief Round an address up to a power of two alignment.
+uintptr_t AlignUp(const uintptr_t address, const size_t alignment)
+{
+	return (address + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1);
+}
+} // namespace
+
+std::pmr::memory_resource* GetUpstreamResource()
+{
+	std::pmr::memory_resource* resource = s_UpstreamResource.load(std::memory_order_acquire);
+	return resource ? resource : std::pmr::new_delete_resource();
+}
+
+void SetUpstreamResource(std::pmr::memory_resource* resource)
+{
+	s_UpstreamResource.store(resource, std::memory_order_release);
+}
+
+//==========================MonotonicArena==========================//
+MonotonicArena::MonotonicArena(const size_t firstBlockSize, std::pmr::memory_resource* upstream)
+	: m_Upstream(upstream)
+	, m_FirstBlockSize(std::max<size_t>(firstBlockSize, 64))
+	, m_NextBlockSize(m_FirstBlockSize)
+{
+	assert(m_Upstream);
+}
+
+MonotonicArena::~MonotonicArena()
+{
+	Release();
+}
+
+MonotonicArena::Marker MonotonicArena::GetMarker() const
+{
+	return m_Current;
+}
+
+void MonotonicArena::Rewind(const Marker& marker)
+{
+	assert(marker.BlockIdx < m_Blocks.size() || (marker.BlockIdx == 0 && marker.Offset == 0));
+	assert(marker.BlockIdx < m_Current.BlockIdx
+		   || (marker.BlockIdx == m_Current.BlockIdx && marker.Offset <= m_Current.Offset));
+	m_Current = marker;
+}
+
+void MonotonicArena::Reset()
+{
+	m_Current = {};
+	if(m_Blocks.size() <= 1)
+		return;
+
+	// Replace the blocks by one block as large as all of them.
+	const size_t capacity = GetCapacity();
+	Release();
+	m_Blocks.push_back({ static_cast<std::byte*>(m_Upstream->allocate(capacity)), capacity });
+	m_NextBlockSize = 2 * capacity;
+}
+
+void MonotonicArena::Release()
+{
+	for(const Block& block : m_Blocks)
+		m_Upstream->deallocate(block.Data, block.Size);
+	m_Blocks.clear();
+	m_Current = {};
+	m_NextBlockSize = m_FirstBlockSize;
+}
+
+size_t MonotonicArena::GetCapacity() const
+{
+	size_t capacity = 0;
+	for(const Block& block : m_Blocks)
+		capacity += block.Size;
+	return capacity;
+}
+
+size_t MonotonicArena::GetBlockCount() const
+{
+	return m_Blocks.size();
+}
+
+void* MonotonicArena::do_allocate(const size_t bytes, const size_t alignment)
+{
+	if(void* ptr = AllocateInCurrentBlock(bytes, alignment))
+		return ptr;
+
+	// The blocks kept by a rewind are reused in order, the ones too small for the allocation being skipped.
+	while(m_Current.BlockIdx + 1 < m_Blocks.size())
+	{
+		m_Current = { m_Current.BlockIdx + 1, 0 };
+		if(void* ptr = AllocateInCurrentBlock(bytes, alignment))
+			return ptr;
+	}
+
+	AddBlock(bytes, alignment);
+	return AllocateInCurrentBlock(bytes, alignment);
+}
+
+void MonotonicArena::do_deallocate(void*, size_t, size_t)
+{
+	// The memory is freed by Rewind, Reset or Release.
+}
+
+bool MonotonicArena::do_is_equal(const std::pmr::memory_resource& other) const noexcept
+{
+	return this == &other;
+}
+
+void* MonotonicArena::AllocateInCurrentBlock(const size_t bytes, const size_t alignment)
+{
+	if(m_Current.BlockIdx >= m_Blocks.size())
+		return nullptr;
+
+	const Block& block = m_Blocks[m_Current.BlockIdx];
+	const uintptr_t blockBegin = reinterpret_cast<uintptr_t>(block.Data);
+	const uintptr_t address = AlignUp(blockBegin + m_Current.Offset, alignment);
+	if(address + bytes > blockBegin + block.Size)
+		return nullptr;
+
+	m_Current.Offset = address + bytes - blockBegin;
+	return reinterpret_cast<void*>(address);
+}
+
+void MonotonicArena::AddBlock(const size_t bytes, const size_t alignment)
+{
+	// The blocks double in size, an allocation larger than the next block getting a block of its own size.
+	const size_t blockSize = std::max(m_NextBlockSize, bytes + alignment);
+	m_Blocks.push_back({ static_cast<std::byte*>(m_Upstream->allocate(blockSize)), blockSize });
+	m_Current = { m_Blocks.size() - 1, 0 };
+	m_NextBlockSize = 2 * blockSize;
+}
+
+//==========================ScratchScope==========================//
+ScratchScope::ScratchScope()
+	: m_Arena(GetThreadScratchArena())
+	, m_Marker(m_Arena.GetMarker())
+	, m_IsOutermost(t_ScratchScopeDepth == 0)
+{
+	++t_ScratchScopeDepth;
+}
+
+ScratchScope::~ScratchScope()
+{
+	--t_ScratchScopeDepth;
+
+	// The outermost scope merges the blocks the operation required, or releases them past the capacity kept.
+	if(!m_IsOutermost)
+		m_Arena.Rewind(m_Marker);
+	else if(m_Arena.GetCapacity() > MaxScratchCapacity)
+		m_Arena.Release();
+	else
+		m_Arena.Reset();
+}
+
+std::pmr::memory_resource* ScratchScope::GetResource() const
+{
+	return &m_Arena;
+}
+
+MonotonicArena& GetThreadScratchArena()
+{
+	thread_local MonotonicArena arena;
+	return arena;
+}
+} // namespace Core::Memory
@@ -0,0 +1,144 @@
+#include "Core/Parallel.h"
+
+#include <atomic>
+#include <exception>
+#include <mutex>
+
+namespace Core::Parallel
+{
+namespace
+{
+/// @brief Number of threads requested by the user (0 = hardware concurrency).
+std::atomic<uint32_t> s_ThreadCount{ 0 };
+
+/// @brief Placement of the workers requested by the user.
+std::atomic<ThreadAffinity> s_ThreadAffinity{ ThreadAffinity::None };
+
+/// @brief Pool shared by the parallel helpers, created by the first parallel call.
+struct SharedThreadPool
+{
+	std::mutex Mutex{};
+	std::shared_ptr<ThreadPool> Pool{};
+};
+
+/// @brief Get the shared pool, which is never destroyed: its workers would otherwise exit during the destruction of
+/// the static objects, after the ones their thread-local data refers to (see Profiler).
+SharedThreadPool& GetSharedThreadPool()
+{
+	static SharedThreadPool* sharedThreadPool = new SharedThreadPool();
+	return *sharedThreadPool;
+}
+
+/// @brief Whether the thread is running a chunk of a parallel loop.
+thread_local bool t_IsInParallelLoop = false;
+
+/// @brief Pool of the parallel helpers of the thread set by a ThreadPoolScope, null for the shared pool.
+thread_local ThreadPool* t_ScopedThreadPool = nullptr;
+} // namespace
+
+uint32_t GetThreadCount()
+{
+	const uint32_t count = s_ThreadCount.load(std::memory_order_relaxed);
+	if(count != 0)
+		return count;
+
+	return std::max(1u, std::thread::hardware_concurrency());
+}
+
+void SetThreadCount(uint32_t count)
+{
+	s_ThreadCount.store(count, std::memory_order_relaxed);
+}
+
+ThreadAffinity GetThreadAffinity()
+{
+	return s_ThreadAffinity.load(std::memory_order_relaxed);
+}
+
+void SetThreadAffinity(ThreadAffinity affinity)
+{
+	s_ThreadAffinity.store(affinity, std::memory_order_relaxed);
+}
+
+std::shared_ptr<ThreadPool> GetThreadPool()
+{
+	// The scoped pool is owned by its scope, the pointer does not own it.
+	if(t_ScopedThreadPool != nullptr)
+		return std::shared_ptr<ThreadPool>(std::shared_ptr<ThreadPool>(), t_ScopedThreadPool);
+
+	const uint32_t workerCount = GetThreadCount() - 1;
+	const ThreadAffinity affinity = GetThreadAffinity();
+
+	// The replaced pool is released out of the lock, its destructor waiting for its workers.
+	SharedThreadPool& sharedThreadPool = GetSharedThreadPool();
+	std::shared_ptr<ThreadPool> replacedPool;
+	const std::lock_guard lock(sharedThreadPool.Mutex);
+	std::shared_ptr<ThreadPool>& pool = sharedThreadPool.Pool;
+	if(!pool || pool->GetWorkerCount() != workerCount || pool->GetAffinity() != affinity)
+	{
+		replacedPool = std::move(pool);
+		pool = std::make_shared<ThreadPool>(workerCount, affinity);
+	}
+	return pool;
+}
+
+ThreadPoolScope::ThreadPoolScope(ThreadPool& pool)
+	: m_PreviousPool(t_ScopedThreadPool)
+{
+	t_ScopedThreadPool = &pool;
+}
+
+ThreadPoolScope::~ThreadPoolScope()
+{
+	t_ScopedThreadPool = m_PreviousPool;
+}
+
+bool IsInParallelLoop()
+{
+	return t_IsInParallelLoop;
+}
+
+namespace detail
+{
+ParallelLoopScope::ParallelLoopScope()
+	: m_WasInParallelLoop(t_IsInParallelLoop)
+{
+	t_IsInParallelLoop = true;
+}
+
+ParallelLoopScope::~ParallelLoopScope()
+{
+	t_IsInParallelLoop = m_WasInParallelLoop;
+}
+
+void RunChunks(const size_t chunkCount, void (*invoke)(void*, size_t), void* context)
+{
+	const std::shared_ptr<ThreadPool> pool = GetThreadPool();
+
+	// Each thread takes the next chunk until none is left, an exception skipping the remaining ones.
+	std::atomic<size_t> nextChunkIdx{ 0 };
+	auto runChunks = [&]()
+	{
+		const ParallelLoopScope scope;
+		try
+		{
+			for(size_t iChunk = nextChunkIdx.fetch_add(1, std::memory_order_relaxed); iChunk < chunkCount;
+				iChunk = nextChunkIdx.fetch_add(1, std::memory_order_relaxed))
+				invoke(context, iChunk);
+		}
+		catch(...)
+		{
+			nextChunkIdx.store(chunkCount, std::memory_order_relaxed);
+			throw;
+		}
+	};
+
+	TaskGroup group(*pool);
+	const size_t helperCount = std::min<size_t>(pool->GetWorkerCount(), chunkCount - 1);
+	for(size_t iHelper = 0; iHelper < helperCount; ++iHelper)
+		group.Run(runChunks);
+	group.RunInline(runChunks);
+	group.Wait();
+}
+} // namespace detail
+} // namespace Core::Parallel
@@ -0,0 +1,312 @@
+#include "Core/PrintHelpers.h"
+
+#include <atomic>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <thread>
+
+namespace PrintHelpers
+{
+namespace
+{
+/// @brief Node of the record queue.
+struct Record
+{
+	std::atomic<Record*> Next{ nullptr };
+	LogLevel Level = LogLevel::Info;
+	const char* FunctionName = nullptr;
+	std::string Message;
+	/// @brief The logging thread stops once it reaches this record.
+	bool IsStop = false;
+};
+
+/// @brief Set when the logger is destroyed, at exit: the records of the destructors of the other static objects are
+/// dropped rather than pushed into a destroyed queue.
+std::atomic<bool> s_IsLoggerStopped{ false };
+
+/// @brief Tag and color of each level.
+struct LevelStyle
+{
+	const char* Tag;
+	const char* Color;
+};
+
+LevelStyle GetLevelStyle(const LogLevel level)
+{
+	switch(level)
+	{
+	case LogLevel::Trace:
+		return { "TRACE", Color::Magenta };
+	case LogLevel::Debug:
+		return { "DEBUG", Color::Gray };
+	case LogLevel::Info:
+		return { "INFO", Color::Cyan };
+	case LogLevel::Success:
+		return { "SUCCESS", Color::Green };
+	case LogLevel::Warning:
+		return { "WARNING", Color::Yellow };
+	default:
+		return { "ERROR", Color::BrightRed };
+	}
+}
+
+/// @brief Logger writing the records from a background thread.
+/// @note The records are linked into an intrusive multiple producers, single consumer queue (Vyukov): a producer only
+/// exchanges the head and links its record, it never waits for the other producers or the logging thread.
+class AsyncLogger
+{
+public:
+	AsyncLogger()
+		: m_Worker(
+			  [this]()
+			  {
+				  Run();
+			  })
+	{
+	}
+
+	~AsyncLogger()
+	{
+		s_IsLoggerStopped.store(true, std::memory_order_release);
+
+		// The stop record is queued after all the pending ones, which are written first.
+		auto stopRecord = std::make_unique<Record>();
+		stopRecord->IsStop = true;
+		Push(stopRecord.release());
+		m_Worker.join();
+	}
+
+	AsyncLogger(const AsyncLogger&) = delete;
+	AsyncLogger& operator=(const AsyncLogger&) = delete;
+
+	void Push(Record* record)
+	{
+		Link(record);
+		m_PushedCount.fetch_add(1, std::memory_order_release);
+		m_PushedCount.notify_one();
+	}
+
+	void Flush()
+	{
+		const uint64_t pushedCount = m_PushedCount.load(std::memory_order_acquire);
+		uint64_t writtenCount = m_WrittenCount.load(std::memory_order_acquire);
+		while(writtenCount < pushedCount)
+		{
+			m_WrittenCount.wait(writtenCount, std::memory_order_acquire);
+			writtenCount = m_WrittenCount.load(std::memory_order_acquire);
+		}
+	}
+
+	bool SetFile(const std::filesystem::path& filepath)
+	{
+		Flush();
+
+		const std::scoped_lock lock(m_FileMutex);
+		m_File.close();
+		if(filepath.empty())
+			return true;
+
+		m_File.clear();
+		m_File.open(filepath, std::ios::trunc);
+		return m_File.is_open();
+	}
+
+	void SetConsoleEnabled(const bool isEnabled)
+	{
+		Flush();
+		m_IsConsoleEnabled.store(isEnabled, std::memory_order_relaxed);
+	}
+
+private:
+	void Link(Record* record)
+	{
+		record->Next.store(nullptr, std::memory_order_relaxed);
+		Record* previousHead = m_Head.exchange(record, std::memory_order_acq_rel);
+		previousHead->Next.store(record, std::memory_order_release);
+	}
+
+	/// @brief Pop the oldest record, only called by the logging thread.
+	/// @return The record, or nullptr if the queue is empty or its next record is still being linked.
+	Record* Pop()
+	{
+		Record* tail = m_Tail;
+		Record* next = tail->Next.load(std::memory_order_acquire);
+		if(tail == &m_Stub)
+		{
+			if(next == nullptr)
+				return nullptr;
+			m_Tail = next;
+			tail = next;
+			next = next->Next.load(std::memory_order_acquire);
+		}
+
+		if(next != nullptr)
+		{
+			m_Tail = next;
+			return tail;
+		}
+
+		// The tail is the last linked record, the stub is queued behind it so that it can be popped.
+		if(tail != m_Head.load(std::memory_order_acquire))
+			return nullptr;
+		Link(&m_Stub);
+
+		next = tail->Next.load(std::memory_order_acquire);
+		if(next == nullptr)
+			return nullptr;
+		m_Tail = next;
+		return tail;
+	}
+
+	void Write(const Record& record)
+	{
+		const bool isErrorStream = record.Level >= LogLevel::Warning;
+		const LevelStyle style = GetLevelStyle(record.Level);
+		const std::string_view functionName =
+			record.FunctionName != nullptr ? ExtractFunctionName(record.FunctionName) : std::string_view{};
+
+		if(m_IsConsoleEnabled.load(std::memory_order_relaxed))
+		{
+			std::ostream& stream = isErrorStream ? std::cerr : std::cout;
+			if(record.FunctionName == nullptr)
+				stream << record.Message << '\n';
+			else
+				stream << std::format("{}[{}]{} {}[{}]{} {}\n",
+									  style.Color,
+									  style.Tag,
+									  Color::Reset,
+									  Color::Blue,
+									  functionName,
+									  Color::Reset,
+									  record.Message);
+		}
+
+		const std::scoped_lock lock(m_FileMutex);
+		if(!m_File.is_open())
+			return;
+		if(record.FunctionName == nullptr)
+			m_File << record.Message << '\n';
+		else
+			m_File << std::format("[{}] [{}] {}\n", style.Tag, functionName, record.Message);
+	}
+
+	void Run()
+	{
+		bool isStopping = false;
+		while(!isStopping)
+		{
+			const uint64_t pushedCount = m_PushedCount.load(std::memory_order_acquire);
+
+			uint64_t writtenCount = m_WrittenCount.load(std::memory_order_relaxed);
+			while(Record* record = Pop())
+			{
+				isStopping |= record->IsStop;
+				if(!record->IsStop)
+					Write(*record);
+				delete record;
+				++writtenCount;
+			}
+
+			// Flush the streams once per batch rather than once per record.
+			std::cout.flush();
+			std::cerr.flush();
+			{
+				const std::scoped_lock lock(m_FileMutex);
+				if(m_File.is_open())
+					m_File.flush();
+			}
+			m_WrittenCount.store(writtenCount, std::memory_order_release);
+			m_WrittenCount.notify_all();
+
+			if(isStopping)
+				break;
+
+			// A producer is still linking a counted record.
+			if(writtenCount < pushedCount)
+			{
+				std::this_thread::yield();
+				continue;
+			}
+			m_PushedCount.wait(pushedCount, std::memory_order_acquire);
+		}
+	}
+
+private:
+	Record m_Stub;
+	std::atomic<Record*> m_Head{ &m_Stub };
+	/// @brief Oldest record, only accessed by the logging thread.
+	Record* m_Tail{ &m_Stub };
+
+	std::atomic<uint64_t> m_PushedCount{ 0 };
+	std::atomic<uint64_t> m_WrittenCount{ 0 };
+
+	std::atomic<bool> m_IsConsoleEnabled{ true };
+	std::mutex m_FileMutex;
+	std::ofstream m_File;
+
+	std::thread m_Worker;
+};
+
+/// @return The logger, or nullptr once it is destroyed.
+AsyncLogger* GetLogger()
+{
+	// Checked before the definition of the logger, which must not be reached once it is destroyed.
+	if(s_IsLoggerStopped.load(std::memory_order_acquire))
+		return nullptr;
+	static AsyncLogger logger;
+	return &logger;
+}
+
+std::atomic<LogLevel> s_LogLevel{ LogLevel::Trace };
+} // namespace
+
+void SetLogLevel(const LogLevel level)
+{
+	s_LogLevel.store(level, std::memory_order_relaxed);
+}
+
+LogLevel GetLogLevel()
+{
+	return s_LogLevel.load(std::memory_order_relaxed);
+}
+
+bool SetLogFile(const std::filesystem::path& filepath)
+{
+	AsyncLogger* logger = GetLogger();
+	return logger != nullptr && logger->SetFile(filepath);
+}
+
+void SetConsoleEnabled(const bool isEnabled)
+{
+	if(AsyncLogger* logger = GetLogger())
+		logger->SetConsoleEnabled(isEnabled);
+}
+
+void Flush()
+{
+	if(AsyncLogger* logger = GetLogger())
+		logger->Flush();
+}
+
+namespace detail
+{
+bool IsLogLevelEnabled(const LogLevel level)
+{
+	return level >= s_LogLevel.load(std::memory_order_relaxed);
+}
+
+void PushRecord(const LogLevel level, const char* functionName, std::string&& message)
+{
+	AsyncLogger* logger = GetLogger();
+	if(logger == nullptr)
+		return;
+
+	auto record = std::make_unique<Record>();
+	record->Level = level;
+	record->FunctionName = functionName;
+	record->Message = std::move(message);
+	logger->Push(record.release());
+}
+} // namespace detail
+} // namespace PrintHelpers
@@ -0,0 +1,211 @@
+#include "Core/Profiler.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <format>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace Core::Profiler
+{
+namespace
+{
+/// @brief Slot of a ring buffer, its fields are atomic so that it can be read while its thread overwrites it.
+struct ZoneSlot
+{
+	std::atomic<const char*> Name{ nullptr };
+	std::atomic<uint64_t> Start{ 0 };
+	std::atomic<uint64_t> Duration{ 0 };
+};
+
+/// @brief Ring buffer written by a single thread at a time.
+/// @note The writer claims a slot before filling it and publishes it afterwards, the readers drop the slots claimed
+/// again during their copy (sequence lock).
+struct ZoneBuffer
+{
+	explicit ZoneBuffer(const uint32_t index)
+		: Index(index)
+	{
+	}
+
+	const uint32_t Index;
+	std::array<ZoneSlot, ZoneCapacity> Slots{};
+	/// @brief Number of zones whose slot has been claimed.
+	std::atomic<uint64_t> ClaimedCount{ 0 };
+	/// @brief Number of zones whose slot has been filled.
+	std::atomic<uint64_t> WrittenCount{ 0 };
+	/// @brief Zones below this count have been cleared.
+	std::atomic<uint64_t> ClearedCount{ 0 };
+};
+
+/// @brief All the buffers ever created, and the ones whose thread has exited.
+struct BufferRegistry
+{
+	std::mutex Mutex;
+	std::vector<std::unique_ptr<ZoneBuffer>> Buffers;
+	std::vector<ZoneBuffer*> FreeBuffers;
+};
+
+BufferRegistry& GetRegistry()
+{
+	static BufferRegistry registry;
+	return registry;
+}
+
+/// @brief Buffer of a thread, given back to the registry when the thread exits.
+struct ThreadBufferHandle
+{
+	ZoneBuffer* Buffer = nullptr;
+
+	~ThreadBufferHandle()
+	{
+		if(Buffer == nullptr)
+			return;
+
+		BufferRegistry& registry = GetRegistry();
+		const std::scoped_lock lock(registry.Mutex);
+		registry.FreeBuffers.push_back(Buffer);
+	}
+};
+
+ZoneBuffer& GetThreadBuffer()
+{
+	thread_local ThreadBufferHandle handle;
+	if(handle.Buffer != nullptr)
+		return *handle.Buffer;
+
+	BufferRegistry& registry = GetRegistry();
+	const std::scoped_lock lock(registry.Mutex);
+	if(!registry.FreeBuffers.empty())
+	{
+		handle.Buffer = registry.FreeBuffers.back();
+		registry.FreeBuffers.pop_back();
+	}
+	else
+	{
+		const uint32_t index = static_cast<uint32_t>(registry.Buffers.size());
+		handle.Buffer = registry.Buffers.emplace_back(std::make_unique<ZoneBuffer>(index)).get();
+	}
+	return *handle.Buffer;
+}
+
+/// @brief Escape the characters of a zone name which are not allowed in a JSON string.
+std::string EscapeJSON(const char* name)
+{
+	std::string escapedName;
+	for(const char* character = name; *character != '\0'; ++character)
+	{
+		if(*character == '"' || *character == '\\')
+			escapedName += '\\';
+		escapedName += *character;
+	}
+	return escapedName;
+}
+} // namespace
+
+uint64_t GetTimestamp()
+{
+	static const std::chrono::steady_clock::time_point s_Epoch = std::chrono::steady_clock::now();
+	return static_cast<uint64_t>(
+		std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - s_Epoch).count());
+}
+
+void RecordZone(const char* name, const uint64_t start, const uint64_t end)
+{
+	ZoneBuffer& buffer = GetThreadBuffer();
+	const uint64_t zoneIdx = buffer.WrittenCount.load(std::memory_order_relaxed);
+
+	buffer.ClaimedCount.store(zoneIdx + 1, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+
+	ZoneSlot& slot = buffer.Slots[zoneIdx % ZoneCapacity];
+	slot.Name.store(name, std::memory_order_relaxed);
+	slot.Start.store(start, std::memory_order_relaxed);
+	slot.Duration.store(end - start, std::memory_order_relaxed);
+
+	buffer.WrittenCount.store(zoneIdx + 1, std::memory_order_release);
+}
+
+std::vector<ZoneEvent> CollectZones()
+{
+	std::vector<ZoneEvent> zones;
+
+	BufferRegistry& registry = GetRegistry();
+	const std::scoped_lock lock(registry.Mutex);
+	for(const std::unique_ptr<ZoneBuffer>& buffer : registry.Buffers)
+	{
+		const uint64_t writtenCount = buffer->WrittenCount.load(std::memory_order_acquire);
+		const uint64_t firstZoneIdx = std::max(
+			writtenCount - std::min<uint64_t>(writtenCount, ZoneCapacity),
+			buffer->ClearedCount.load(std::memory_order_relaxed));
+
+		const size_t bufferBegin = zones.size();
+		for(uint64_t iZone = firstZoneIdx; iZone < writtenCount; ++iZone)
+		{
+			const ZoneSlot& slot = buffer->Slots[iZone % ZoneCapacity];
+			zones.push_back(
+				{ .Name = slot.Name.load(std::memory_order_relaxed),
+				  .Start = slot.Start.load(std::memory_order_relaxed),
+				  .Duration = slot.Duration.load(std::memory_order_relaxed),
+				  .ThreadIdx = buffer->Index });
+		}
+
+		// Drop the oldest zones if their slot was claimed again by the writer during the copy.
+		std::atomic_thread_fence(std::memory_order_acquire);
+		const uint64_t claimedCount = buffer->ClaimedCount.load(std::memory_order_relaxed);
+		const uint64_t overwrittenEnd = claimedCount > ZoneCapacity ? claimedCount - ZoneCapacity : 0;
+		const uint64_t overwrittenCount = std::clamp(overwrittenEnd, firstZoneIdx, writtenCount) - firstZoneIdx;
+		zones.erase(
+			zones.begin() + static_cast<std::ptrdiff_t>(bufferBegin),
+			zones.begin() + static_cast<std::ptrdiff_t>(bufferBegin + overwrittenCount));
+	}
+
+	std::sort(
+		zones.begin(),
+		zones.end(),
+		[](const ZoneEvent& firstZone, const ZoneEvent& secondZone)
+		{
+			return firstZone.Start < secondZone.Start;
+		});
+	return zones;
+}
+
+void Clear()
+{
+	BufferRegistry& registry = GetRegistry();
+	const std::scoped_lock lock(registry.Mutex);
+	for(const std::unique_ptr<ZoneBuffer>& buffer : registry.Buffers)
+		buffer->ClearedCount.store(buffer->WrittenCount.load(std::memory_order_acquire), std::memory_order_relaxed);
+}
+
+bool WriteChromeTrace(const std::filesystem::path& filepath)
+{
+	std::ofstream file(filepath);
+	if(!file.is_open())
+		return false;
+
+	const std::vector<ZoneEvent> zones = CollectZones();
+
+	// Complete events ("X"), the timestamps are in microseconds.
+	file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+	for(size_t iZone = 0; iZone < zones.size(); ++iZone)
+	{
+		const ZoneEvent& zone = zones[iZone];
+		file << std::format(
+			"{}\n{{\"name\":\"{}\",\"cat\":\"zone\",\"ph\":\"X\",\"ts\":{:.3f},\"dur\":{:.3f},"
+			"\"pid\":0,\"tid\":{}}}",
+			iZone == 0 ? "" : ",",
+			EscapeJSON(zone.Name),
+			static_cast<double>(zone.Start) * 1e-3,
+			static_cast<double>(zone.Duration) * 1e-3,
+			zone.ThreadIdx);
+	}
+	file << "\n]}\n";
+
+	return file.good();
+}
+} // namespace Core::Profiler
@@ -0,0 +1,67 @@
+#include "Core/Renderer/GpuTimer.h"
+
+namespace Renderer
+{
+GpuTimer::GpuTimer(const uint32_t sectionCapacity)
+	: m_SectionCapacity(sectionCapacity)
+{
+	for(FrameQueries& frame : m_Frames)
+	{
+		frame.Queries.resize(2 * size_t{ sectionCapacity });
+		glCreateQueries(GL_TIMESTAMP, static_cast<GLsizei>(frame.Queries.size()), frame.Queries.data());
+		frame.Sections.reserve(sectionCapacity);
+	}
+}
+
+GpuTimer::~GpuTimer()
+{
+	for(FrameQueries& frame : m_Frames)
+		glDeleteQueries(static_cast<GLsizei>(frame.Queries.size()), frame.Queries.data());
+}
+
+void GpuTimer::Begin(const uint32_t section)
+{
+	if(section < m_SectionCapacity)
+		glQueryCounter(m_Frames[m_CurrentFrame].Queries[2 * section], GL_TIMESTAMP);
+}
+
+void GpuTimer::End(const uint32_t section)
+{
+	if(section >= m_SectionCapacity)
+		return;
+	FrameQueries& frame = m_Frames[m_CurrentFrame];
+	glQueryCounter(frame.Queries[2 * section + 1], GL_TIMESTAMP);
+	frame.Sections.push_back(section);
+}
+
+std::span<const GpuSectionTime> GpuTimer::EndFrame()
+{
+	// The next frame reuses the queries of the oldest one, read them first.
+	m_CurrentFrame = (m_CurrentFrame + 1) % FrameLatency;
+	m_Results.clear();
+	ReadFrame(m_Frames[m_CurrentFrame]);
+	m_Frames[m_CurrentFrame].Sections.clear();
+	return m_Results;
+}
+
+void GpuTimer::ReadFrame(FrameQueries& frame)
+{
+	if(frame.Sections.empty())
+		return;
+
+	// The queries complete in order, the last end query is available once all the others are.
+	GLint isAvailable = GL_FALSE;
+	glGetQueryObjectiv(frame.Queries[2 * frame.Sections.back() + 1], GL_QUERY_RESULT_AVAILABLE, &isAvailable);
+	if(isAvailable == GL_FALSE)
+		return;
+
+	for(const uint32_t section : frame.Sections)
+	{
+		GLuint64 start = 0;
+		GLuint64 end = 0;
+		glGetQueryObjectui64v(frame.Queries[2 * section], GL_QUERY_RESULT, &start);
+		glGetQueryObjectui64v(frame.Queries[2 * section + 1], GL_QUERY_RESULT, &end);
+		m_Results.push_back({ section, end > start ? static_cast<float>(end - start) * 1e-6f : 0.f });
+	}
+}
+} // namespace Renderer
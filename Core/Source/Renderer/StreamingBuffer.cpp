@@ -0,0 +1,76 @@
+#include "Core/Renderer/StreamingBuffer.h"
+
+#include "Core/PrintHelpers.h"
+
+namespace Renderer
+{
+namespace
+{
+/// @brief Flags of the storage and of the mapping.
+constexpr GLbitfield MappingFlags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+/// @brief Time waited by each call to glClientWaitSync, in nanoseconds.
+constexpr GLuint64 FenceWaitTimeout = 1'000'000;
+} // namespace
+
+StreamingBuffer::StreamingBuffer(const size_t regionSize)
+	: m_RegionSize((regionSize + RegionAlignment - 1) / RegionAlignment * RegionAlignment)
+{
+	const GLsizeiptr bufferSize = static_cast<GLsizeiptr>(RegionCount * m_RegionSize);
+	glCreateBuffers(1, &m_Handle);
+	glNamedBufferStorage(m_Handle, bufferSize, nullptr, MappingFlags);
+	m_MappedData = static_cast<std::byte*>(glMapNamedBufferRange(m_Handle, 0, bufferSize, MappingFlags));
+	if(m_MappedData == nullptr)
+		Error("Failed to map the streaming buffer of {} bytes", bufferSize);
+}
+
+StreamingBuffer::~StreamingBuffer()
+{
+	for(uint32_t iRegion = 0; iRegion < RegionCount; ++iRegion)
+		WaitForRegion(iRegion);
+	if(m_MappedData != nullptr)
+		glUnmapNamedBuffer(m_Handle);
+	glDeleteBuffers(1, &m_Handle);
+}
+
+std::span<std::byte> StreamingBuffer::BeginWrite()
+{
+	if(m_MappedData == nullptr)
+		return {};
+	WaitForRegion(m_CurrentRegion);
+	return { m_MappedData + GetWriteOffset(), m_RegionSize };
+}
+
+void StreamingBuffer::EndFrame()
+{
+	// The fences signal in order, the new one replaces the fence of a region not written this frame.
+	GLsync& fence = m_Fences[m_CurrentRegion];
+	if(fence != nullptr)
+		glDeleteSync(fence);
+	fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	m_CurrentRegion = (m_CurrentRegion + 1) % RegionCount;
+}
+
+void StreamingBuffer::WaitForRegion(const uint32_t region)
+{
+	GLsync& fence = m_Fences[region];
+	if(fence == nullptr)
+		return;
+
+	// Poll first, the fence of a region written RegionCount frames ago is usually signaled already.
+	GLenum status = glClientWaitSync(fence, 0, 0);
+	if(status == GL_TIMEOUT_EXPIRED)
+	{
+		++m_StallCount;
+		do
+		{
+			status = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, FenceWaitTimeout);
+		} while(status == GL_TIMEOUT_EXPIRED);
+	}
+	if(status == GL_WAIT_FAILED)
+		Error("Failed to wait for the fence of the streaming buffer region {}", region);
+
+	glDeleteSync(fence);
+	fence = nullptr;
+}
+} // namespace Renderer
@@ -0,0 +1,95 @@
+#include "Core/TaskGraph.h"
+
+#include "Core/Parallel.h"
+
+#include <atomic>
+#include <cassert>
+#include <memory>
+#include <stdexcept>
+
+namespace Core::Parallel
+{
+namespace
+{
+/// @brief Check whether every task can be reached from the tasks without predecessor (Kahn's algorithm).
+template<typename Node>
+bool IsAcyclic(const std::vector<Node>& nodes)
+{
+	std::vector<uint32_t> predecessorCounts(nodes.size());
+	std::vector<uint32_t> readyTasks;
+	for(uint32_t iNode = 0; iNode < nodes.size(); ++iNode)
+	{
+		predecessorCounts[iNode] = nodes[iNode].PredecessorCount;
+		if(predecessorCounts[iNode] == 0)
+			readyTasks.push_back(iNode);
+	}
+
+	size_t visitedCount = 0;
+	while(!readyTasks.empty())
+	{
+		const uint32_t taskId = readyTasks.back();
+		readyTasks.pop_back();
+		++visitedCount;
+		for(const uint32_t successorId : nodes[taskId].Successors)
+		{
+			if(--predecessorCounts[successorId] == 0)
+				readyTasks.push_back(successorId);
+		}
+	}
+	return visitedCount == nodes.size();
+}
+} // namespace
+
+TaskGraph::TaskId TaskGraph::AddTask(std::function<void()> func)
+{
+	m_Nodes.push_back({ .Func = std::move(func) });
+	return static_cast<TaskId>(m_Nodes.size() - 1);
+}
+
+void TaskGraph::AddDependency(const TaskId before, const TaskId after)
+{
+	assert(before < m_Nodes.size() && after < m_Nodes.size() && "Task index out of bound");
+	m_Nodes[before].Successors.push_back(after);
+	++m_Nodes[after].PredecessorCount;
+}
+
+uint32_t TaskGraph::GetTaskCount() const
+{
+	return static_cast<uint32_t>(m_Nodes.size());
+}
+
+void TaskGraph::Run() const
+{
+	if(!IsAcyclic(m_Nodes))
+		throw std::invalid_argument("TaskGraph cannot be run with cyclic dependencies.");
+
+	// Number of predecessors left for each task, the last one to complete submits the task.
+	const std::unique_ptr<std::atomic<uint32_t>[]> remainingCounts(new std::atomic<uint32_t>[m_Nodes.size()]);
+	for(size_t iNode = 0; iNode < m_Nodes.size(); ++iNode)
+		remainingCounts[iNode].store(m_Nodes[iNode].PredecessorCount, std::memory_order_relaxed);
+
+	const std::shared_ptr<ThreadPool> pool = GetThreadPool();
+	TaskGroup group(*pool);
+	std::function<void(TaskId)> submitTask = [&](const TaskId taskId)
+	{
+		group.Run(
+			[&, taskId]()
+			{
+				const Node& node = m_Nodes[taskId];
+				node.Func();
+				for(const TaskId successorId : node.Successors)
+				{
+					if(remainingCounts[successorId].fetch_sub(1, std::memory_order_acq_rel) == 1)
+						submitTask(successorId);
+				}
+			});
+	};
+
+	for(TaskId iNode = 0; iNode < m_Nodes.size(); ++iNode)
+	{
+		if(m_Nodes[iNode].PredecessorCount == 0)
+			submitTask(iNode);
+	}
+	group.Wait();
+}
+} // namespace Core::Parallel
@@ -0,0 +1,248 @@
+#include "Core/ThreadPool.h"
+
+#include <algorithm>
+#include <cassert>
+
+#if defined(_WIN32)
+#	define NOMINMAX
+#	include <windows.h>
+#elif defined(__linux__)
+#	include <pthread.h>
+#	include <sched.h>
+#endif
+
+namespace Core::Parallel
+{
+namespace
+{
+/// @brief Pool the calling thread is a worker of, null for the other threads.
+thread_local const ThreadPool* t_WorkerPool = nullptr;
+/// @brief Index of the calling thread in t_WorkerPool.
+thread_local int t_WorkerIdx = -1;
+
+/// @brief Pin the calling thread to a core, cores are reused when there are more threads than cores.
+void PinCurrentThread(const uint32_t coreIdx)
+{
+	const uint32_t coreCount = std::max(1u, std::thread::hardware_concurrency());
+#if defined(_WIN32)
+	SetThreadAffinityMask(GetCurrentThread(), DWORD_PTR{ 1 } << (coreIdx % coreCount % (8 * sizeof(DWORD_PTR))));
+#elif defined(__linux__)
+	cpu_set_t cpuSet;
+	CPU_ZERO(&cpuSet);
+	CPU_SET(coreIdx % coreCount, &cpuSet);
+	pthread_setaffinity_np(pthread_self(), sizeof(cpuSet), &cpuSet);
+#else
+	(void)coreIdx;
+	(void)coreCount;
+#endif
+}
+} // namespace
+
+//==========================ThreadPool==========================//
+ThreadPool::ThreadPool(const uint32_t workerCount, const ThreadAffinity affinity)
+	: m_Affinity(affinity)
+{
+	m_Queues.reserve(workerCount + 1);
+	for(uint32_t iQueue = 0; iQueue <= workerCount; ++iQueue)
+		m_Queues.push_back(std::make_unique<TaskQueue>());
+
+	m_Workers.reserve(workerCount);
+	for(uint32_t iWorker = 0; iWorker < workerCount; ++iWorker)
+		m_Workers.emplace_back([this, iWorker]() { RunWorker(iWorker); });
+}
+
+ThreadPool::~ThreadPool()
+{
+	assert(t_WorkerPool != this && "A pool cannot be destroyed by its own tasks");
+
+	// The workers leave once every queued task is done.
+	m_IsStopping.store(true, std::memory_order_release);
+	Signal(true);
+	m_Workers.clear();
+
+	// Without workers, the tasks are run here.
+	while(RunPendingTask())
+		;
+}
+
+uint32_t ThreadPool::GetWorkerCount() const
+{
+	return static_cast<uint32_t>(m_Workers.size());
+}
+
+ThreadAffinity ThreadPool::GetAffinity() const
+{
+	return m_Affinity;
+}
+
+void ThreadPool::Submit(Task task)
+{
+	const int workerIdx = GetCurrentWorkerIndex();
+	TaskQueue& queue = *m_Queues[workerIdx == -1 ? m_Queues.size() - 1 : static_cast<size_t>(workerIdx)];
+	{
+		const std::lock_guard lock(queue.Mutex);
+		queue.Tasks.push_back(std::move(task));
+	}
+	m_QueuedCount.fetch_add(1, std::memory_order_release);
+	Signal(false);
+}
+
+bool ThreadPool::RunPendingTask()
+{
+	Task task;
+	if(!PopTask(GetCurrentWorkerIndex(), task))
+		return false;
+
+	task();
+	return true;
+}
+
+void ThreadPool::WaitUntilZero(const std::atomic<size_t>& counter)
+{
+	while(true)
+	{
+		// The epoch is read first, so that a completion or a submission happening after the checks wakes the thread.
+		const uint32_t epoch = m_Epoch.load(std::memory_order_acquire);
+		if(counter.load(std::memory_order_acquire) == 0)
+			return;
+		if(RunPendingTask())
+			continue;
+		m_Epoch.wait(epoch, std::memory_order_acquire);
+	}
+}
+
+void ThreadPool::NotifyCompletion()
+{
+	Signal(true);
+}
+
+void ThreadPool::RunWorker(const uint32_t workerIdx)
+{
+	t_WorkerPool = this;
+	t_WorkerIdx = static_cast<int>(workerIdx);
+	if(m_Affinity == ThreadAffinity::PinWorkers)
+		PinCurrentThread(workerIdx + 1);
+
+	while(true)
+	{
+		const uint32_t epoch = m_Epoch.load(std::memory_order_acquire);
+		if(RunPendingTask())
+			continue;
+		if(m_IsStopping.load(std::memory_order_acquire) && m_QueuedCount.load(std::memory_order_acquire) == 0)
+			return;
+		m_Epoch.wait(epoch, std::memory_order_acquire);
+	}
+}
+
+bool ThreadPool::PopTask(const int workerIdx, Task& task)
+{
+	if(m_QueuedCount.load(std::memory_order_acquire) == 0)
+		return false;
+
+	// The own queue is popped at the back, the most recent task.
+	if(workerIdx != -1)
+	{
+		TaskQueue& queue = *m_Queues[static_cast<size_t>(workerIdx)];
+		const std::lock_guard lock(queue.Mutex);
+		if(!queue.Tasks.empty())
+		{
+			task = std::move(queue.Tasks.back());
+			queue.Tasks.pop_back();
+			m_QueuedCount.fetch_sub(1, std::memory_order_relaxed);
+			return true;
+		}
+	}
+
+	// The other queues are stolen at the front, the oldest task, starting with the shared queue then the next worker.
+	const size_t queueCount = m_Queues.size();
+	const size_t firstVictimIdx = workerIdx == -1 ? queueCount - 1 : static_cast<size_t>(workerIdx) + 1;
+	for(size_t iVictim = 0; iVictim < queueCount; ++iVictim)
+	{
+		const size_t victimIdx = (firstVictimIdx + iVictim) % queueCount;
+		if(static_cast<int>(victimIdx) == workerIdx)
+			continue;
+
+		TaskQueue& queue = *m_Queues[victimIdx];
+		const std::lock_guard lock(queue.Mutex);
+		if(!queue.Tasks.empty())
+		{
+			task = std::move(queue.Tasks.front());
+			queue.Tasks.pop_front();
+			m_QueuedCount.fetch_sub(1, std::memory_order_relaxed);
+			return true;
+		}
+	}
+	return false;
+}
+
+int ThreadPool::GetCurrentWorkerIndex() const
+{
+	return t_WorkerPool == this ? t_WorkerIdx : -1;
+}
+
+void ThreadPool::Signal(const bool wakeAll)
+{
+	m_Epoch.fetch_add(1, std::memory_order_release);
+	if(wakeAll)
+		m_Epoch.notify_all();
+	else
+		m_Epoch.notify_one();
+}
+
+//==========================TaskGroup==========================//
+TaskGroup::TaskGroup(ThreadPool& pool)
+	: m_Pool(pool)
+{}
+
+TaskGroup::~TaskGroup()
+{
+	m_Pool.WaitUntilZero(m_PendingCount);
+}
+
+void TaskGroup::Run(ThreadPool::Task task)
+{
+	m_PendingCount.fetch_add(1, std::memory_order_relaxed);
+	m_Pool.Submit(
+		[this, task = std::move(task)]()
+		{
+			RunInline(task);
+
+			// The group can be destroyed as soon as the counter drops to 0, the pool outlives it.
+			ThreadPool& pool = m_Pool;
+			if(m_PendingCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+				pool.NotifyCompletion();
+		});
+}
+
+void TaskGroup::RunInline(const ThreadPool::Task& task)
+{
+	try
+	{
+		task();
+	}
+	catch(...)
+	{
+		CaptureException();
+	}
+}
+
+void TaskGroup::Wait()
+{
+	m_Pool.WaitUntilZero(m_PendingCount);
+
+	std::exception_ptr exception;
+	{
+		const std::lock_guard lock(m_ExceptionMutex);
+		std::swap(exception, m_Exception);
+	}
+	if(exception)
+		std::rethrow_exception(exception);
+}
+
+void TaskGroup::CaptureException()
+{
+	const std::lock_guard lock(m_ExceptionMutex);
+	if(!m_Exception)
+		m_Exception = std::current_exception();
+}
+} // namespace Core::Parallel
@@ -0,0 +1,20 @@
+include(FetchContent)
+
+# Google Benchmark
+find_package(benchmark 1.7 QUIET)
+if (NOT benchmark_FOUND)
+    FetchContent_Declare(
+        googlebenchmark
+        GIT_REPOSITORY https://github.com/google/benchmark.git
+        GIT_TAG v1.8.3
+    )
+
+    set(BENCHMARK_ENABLE_TESTING OFF CACHE BOOL "" FORCE)
+    set(BENCHMARK_ENABLE_INSTALL OFF CACHE BOOL "" FORCE)
+    FetchContent_MakeAvailable(googlebenchmark)
+endif()
+
+macro(AddBenchmarks target)
+    message("Adding benchmarks to ${target}")
+    target_link_libraries(${target} PRIVATE benchmark::benchmark)
+endmacro()